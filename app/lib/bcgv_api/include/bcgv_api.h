@@ -90,12 +90,96 @@ typedef enum {
     BGF_ACK_INDIC_RIGHT = (1 << 4),
 } bgf_ack_t;
 
+// cmd_t bits in get_cmds() and set_cmds()
+typedef enum {
+    CMD_BIT_POSITION_LIGHT = (1 << 6),
+    CMD_BIT_CROSSING_LIGHT = (1 << 5),
+    CMD_BIT_HIGHBEAM_LIGHT = (1 << 4),
+    CMD_BIT_INDIC_LEFT = (1 << 2),
+    CMD_BIT_INDIC_RIGHT = (1 << 3),
+    CMD_BIT_INDIC_HAZARD = (1 << 7),
+    CMD_BIT_WIPER = (1 << 1),
+    CMD_BIT_WASHER = (1 << 0),
+} cmd_bit_t;
+
+// flag_t bits in get_flags() and set_flags()
+typedef enum {
+    FLAG_BIT_POSITION_LIGHT = (1 << 0),
+    FLAG_BIT_CROSSING_LIGHT = (1 << 1),
+    FLAG_BIT_HIGHBEAM_LIGHT = (1 << 2),
+    FLAG_BIT_INDIC_HAZARD = (1 << 3),
+    FLAG_BIT_INDIC_LEFT = (1 << 4),
+    FLAG_BIT_INDIC_RIGHT = (1 << 5),
+    FLAG_BIT_WIPER = (1 << 6),
+    FLAG_BIT_WASHER = (1 << 7),
+} flag_bit_t;
+
+// Ranged data, out-of-range values counted by get_range_violations()
+typedef enum {
+    RANGE_FIELD_FRAME_NUMBER = 0,
+    RANGE_FIELD_FUEL_LEVEL,
+    RANGE_FIELD_ENGINE_RPM,
+    RANGE_FIELD_COUNT,
+} range_field_t;
+
 /**
  * \brief Initialize context.
  * \brief Initialize context variables for the api.
  */
 void bcgv_ctx_init();
 
+/**
+ * \brief Gets the number of out-of-range values given to the setter of a ranged data.
+ * \param field : The ranged data.
+ * \return uint32_t : The number of out-of-range values since start or last reset, 0 for an unknown field.
+ */
+uint32_t get_range_violations(range_field_t field);
+
+/**
+ * \brief Gets the name of a ranged data.
+ * \param field : The ranged data.
+ * \return const char * : The data name, "unknown" for an unknown field.
+ */
+const char *get_range_field_name(range_field_t field);
+
+/**
+ * \brief Resets the out-of-range counters of all ranged data.
+ */
+void reset_range_violations();
+
+#ifdef BCGV_API_INLINE
+// Header-only accessors, the context itself stays in the library
+#include "bcgv_api_inline.h"
+#else
+
+/**
+ * \brief Gets all cmd_t values at once.
+ * \details One bit per value, see cmd_bit_t.
+ * \return uint8_t : The cmds bits.
+ */
+uint8_t get_cmds();
+
+/**
+ * \brief Sets all cmd_t values at once.
+ * \details One bit per value, see cmd_bit_t.
+ * \param value : The new cmds bits.
+ */
+void set_cmds(uint8_t value);
+
+/**
+ * \brief Gets all flag_t values at once.
+ * \details One bit per value, see flag_bit_t.
+ * \return uint8_t : The flags bits.
+ */
+uint8_t get_flags();
+
+/**
+ * \brief Sets all flag_t values at once.
+ * \details One bit per value, see flag_bit_t.
+ * \param value : The new flags bits.
+ */
+void set_flags(uint8_t value);
+
 /**
  * \brief Gets the cmd_position_light value.
  * \details Returns the current state of the cmd_position_light.
@@ -217,7 +301,7 @@ frame_number_t get_frame_number();
 
 /**
  * \brief Sets the frame_number value.
- * \details Sets the frame_number to the given value.
+ * \details Sets the frame_number to the given value, an out-of-range value is counted and ignored.
  * \param value : The new value for the frame_number.
  */
 void set_frame_number(frame_number_t value);
@@ -287,7 +371,7 @@ fuel_level_t get_fuel_level();
 
 /**
  * \brief Sets the fuel_level value.
- * \details Sets the fuel_level to the given value.
+ * \details Sets the fuel_level to the given value, an out-of-range value is counted and ignored.
  * \param value : The new value for the fuel_level.
  */
 void set_fuel_level(fuel_level_t value);
@@ -301,7 +385,7 @@ engine_rpm_t get_engine_rpm();
 
 /**
  * \brief Sets the engine_rpm value.
- * \details Sets the engine_rpm to the given value.
+ * \details Sets the engine_rpm to the given value, an out-of-range value is counted and ignored.
  * \param value : The new value for the engine_rpm.
  */
 void set_engine_rpm(engine_rpm_t value);
@@ -460,4 +544,6 @@ bit_flag_t get_bit_flag_bgf_ack();
  */
 void set_bit_flag_bgf_ack(bit_flag_t value);
 
+#endif // BCGV_API_INLINE
+
 #endif // BCGV_API_H
\ No newline at end of file
@@ -0,0 +1,270 @@
+/**
+ * \file bcgv_api_inline.h
+ * \brief Header-only context accessors for project
+ * \details Included by bcgv_api.h when BCGV_API_INLINE is defined: the getters and setters of bcgv_api.c, with the
+ *          same range checks, as static inline functions on the context of the library.
+ * \author Raphael CAUSSE - Melvyn MUNOZ - Roland Cedric TAYO
+ */
+
+#ifndef BCGV_API_INLINE_H
+#define BCGV_API_INLINE_H
+
+// Context structure
+typedef struct {
+    // Used every cycle
+    distance_t distance; // Distance (km)
+    engine_rpm_t engine_rpm; // Engine Revolution/minute
+    uint8_t cmds; // cmd_t values, one bit each
+    uint8_t flags; // flag_t values, one bit each
+    speed_t speed; // Speed (km/h)
+    issues_t chassis_issues; // Chassis issues, bit-carrying
+    issues_t motor_issues; // Motor Issues, bit-carrying
+    fuel_level_t fuel_level; // Fuel tank level
+    issues_t battery_issues; // Battery issues, bit-carrying
+    bit_flag_t bit_flag_bgf_ack; // BGF acknowledgement flags, bit-carrying
+    // Only used for debug output
+    frame_number_t frame_number; // Frame number in message
+    crc8_t crc8; // CRC8
+} bcgv_context_t;
+
+// Global context structure instance, defined in bcgv_api.c
+extern bcgv_context_t bcgv_context;
+
+// Out-of-range values given to the setters of ranged data, defined in bcgv_api.c
+extern uint32_t bcgv_range_violations[RANGE_FIELD_COUNT];
+
+static inline uint8_t get_cmds() {
+    return bcgv_context.cmds;
+}
+
+static inline void set_cmds(uint8_t value) {
+    bcgv_context.cmds = value;
+}
+
+static inline uint8_t get_flags() {
+    return bcgv_context.flags;
+}
+
+static inline void set_flags(uint8_t value) {
+    bcgv_context.flags = value;
+}
+
+static inline cmd_t get_cmd_position_light() {
+    return (bcgv_context.cmds & CMD_BIT_POSITION_LIGHT) != 0;
+}
+
+static inline void set_cmd_position_light(cmd_t value) {
+    bcgv_context.cmds = (uint8_t)((bcgv_context.cmds & ~CMD_BIT_POSITION_LIGHT) | (value ? CMD_BIT_POSITION_LIGHT : 0));
+}
+
+static inline cmd_t get_cmd_crossing_light() {
+    return (bcgv_context.cmds & CMD_BIT_CROSSING_LIGHT) != 0;
+}
+
+static inline void set_cmd_crossing_light(cmd_t value) {
+    bcgv_context.cmds = (uint8_t)((bcgv_context.cmds & ~CMD_BIT_CROSSING_LIGHT) | (value ? CMD_BIT_CROSSING_LIGHT : 0));
+}
+
+static inline cmd_t get_cmd_highbeam_light() {
+    return (bcgv_context.cmds & CMD_BIT_HIGHBEAM_LIGHT) != 0;
+}
+
+static inline void set_cmd_highbeam_light(cmd_t value) {
+    bcgv_context.cmds = (uint8_t)((bcgv_context.cmds & ~CMD_BIT_HIGHBEAM_LIGHT) | (value ? CMD_BIT_HIGHBEAM_LIGHT : 0));
+}
+
+static inline cmd_t get_cmd_indic_left() {
+    return (bcgv_context.cmds & CMD_BIT_INDIC_LEFT) != 0;
+}
+
+static inline void set_cmd_indic_left(cmd_t value) {
+    bcgv_context.cmds = (uint8_t)((bcgv_context.cmds & ~CMD_BIT_INDIC_LEFT) | (value ? CMD_BIT_INDIC_LEFT : 0));
+}
+
+static inline cmd_t get_cmd_indic_right() {
+    return (bcgv_context.cmds & CMD_BIT_INDIC_RIGHT) != 0;
+}
+
+static inline void set_cmd_indic_right(cmd_t value) {
+    bcgv_context.cmds = (uint8_t)((bcgv_context.cmds & ~CMD_BIT_INDIC_RIGHT) | (value ? CMD_BIT_INDIC_RIGHT : 0));
+}
+
+static inline cmd_t get_cmd_indic_hazard() {
+    return (bcgv_context.cmds & CMD_BIT_INDIC_HAZARD) != 0;
+}
+
+static inline void set_cmd_indic_hazard(cmd_t value) {
+    bcgv_context.cmds = (uint8_t)((bcgv_context.cmds & ~CMD_BIT_INDIC_HAZARD) | (value ? CMD_BIT_INDIC_HAZARD : 0));
+}
+
+static inline cmd_t get_cmd_wiper() {
+    return (bcgv_context.cmds & CMD_BIT_WIPER) != 0;
+}
+
+static inline void set_cmd_wiper(cmd_t value) {
+    bcgv_context.cmds = (uint8_t)((bcgv_context.cmds & ~CMD_BIT_WIPER) | (value ? CMD_BIT_WIPER : 0));
+}
+
+static inline cmd_t get_cmd_washer() {
+    return (bcgv_context.cmds & CMD_BIT_WASHER) != 0;
+}
+
+static inline void set_cmd_washer(cmd_t value) {
+    bcgv_context.cmds = (uint8_t)((bcgv_context.cmds & ~CMD_BIT_WASHER) | (value ? CMD_BIT_WASHER : 0));
+}
+
+static inline frame_number_t get_frame_number() {
+    return bcgv_context.frame_number;
+}
+
+static inline void set_frame_number(frame_number_t value) {
+    const frame_number_t low = (frame_number_t)(value < FRAME_NUMBER_MIN);
+    const frame_number_t high = (frame_number_t)(value > FRAME_NUMBER_MAX);
+    bcgv_range_violations[RANGE_FIELD_FRAME_NUMBER] += (low | high);
+    const frame_number_t keep = (frame_number_t)-(low | high);
+    bcgv_context.frame_number = (frame_number_t)((value & ~keep) | (bcgv_context.frame_number & keep));
+}
+
+static inline distance_t get_distance() {
+    return bcgv_context.distance;
+}
+
+static inline void set_distance(distance_t value) {
+    bcgv_context.distance = value;
+}
+
+static inline speed_t get_speed() {
+    return bcgv_context.speed;
+}
+
+static inline void set_speed(speed_t value) {
+    bcgv_context.speed = value;
+}
+
+static inline issues_t get_chassis_issues() {
+    return bcgv_context.chassis_issues;
+}
+
+static inline void set_chassis_issues(issues_t value) {
+    bcgv_context.chassis_issues = value;
+}
+
+static inline issues_t get_motor_issues() {
+    return bcgv_context.motor_issues;
+}
+
+static inline void set_motor_issues(issues_t value) {
+    bcgv_context.motor_issues = value;
+}
+
+static inline fuel_level_t get_fuel_level() {
+    return bcgv_context.fuel_level;
+}
+
+static inline void set_fuel_level(fuel_level_t value) {
+    const fuel_level_t high = (fuel_level_t)(value > FUEL_LEVEL_MAX);
+    bcgv_range_violations[RANGE_FIELD_FUEL_LEVEL] += high;
+    const fuel_level_t keep = (fuel_level_t)-high;
+    bcgv_context.fuel_level = (fuel_level_t)((value & ~keep) | (bcgv_context.fuel_level & keep));
+}
+
+static inline engine_rpm_t get_engine_rpm() {
+    return bcgv_context.engine_rpm;
+}
+
+static inline void set_engine_rpm(engine_rpm_t value) {
+    const engine_rpm_t high = (engine_rpm_t)(value > ENGINE_RPM_MAX);
+    bcgv_range_violations[RANGE_FIELD_ENGINE_RPM] += high;
+    const engine_rpm_t keep = (engine_rpm_t)-high;
+    bcgv_context.engine_rpm = (engine_rpm_t)((value & ~keep) | (bcgv_context.engine_rpm & keep));
+}
+
+static inline issues_t get_battery_issues() {
+    return bcgv_context.battery_issues;
+}
+
+static inline void set_battery_issues(issues_t value) {
+    bcgv_context.battery_issues = value;
+}
+
+static inline crc8_t get_crc8() {
+    return bcgv_context.crc8;
+}
+
+static inline void set_crc8(crc8_t value) {
+    bcgv_context.crc8 = value;
+}
+
+static inline flag_t get_flag_position_light() {
+    return (bcgv_context.flags & FLAG_BIT_POSITION_LIGHT) != 0;
+}
+
+static inline void set_flag_position_light(flag_t value) {
+    bcgv_context.flags = (uint8_t)((bcgv_context.flags & ~FLAG_BIT_POSITION_LIGHT) | (value ? FLAG_BIT_POSITION_LIGHT : 0));
+}
+
+static inline flag_t get_flag_crossing_light() {
+    return (bcgv_context.flags & FLAG_BIT_CROSSING_LIGHT) != 0;
+}
+
+static inline void set_flag_crossing_light(flag_t value) {
+    bcgv_context.flags = (uint8_t)((bcgv_context.flags & ~FLAG_BIT_CROSSING_LIGHT) | (value ? FLAG_BIT_CROSSING_LIGHT : 0));
+}
+
+static inline flag_t get_flag_highbeam_light() {
+    return (bcgv_context.flags & FLAG_BIT_HIGHBEAM_LIGHT) != 0;
+}
+
+static inline void set_flag_highbeam_light(flag_t value) {
+    bcgv_context.flags = (uint8_t)((bcgv_context.flags & ~FLAG_BIT_HIGHBEAM_LIGHT) | (value ? FLAG_BIT_HIGHBEAM_LIGHT : 0));
+}
+
+static inline flag_t get_flag_indic_hazard() {
+    return (bcgv_context.flags & FLAG_BIT_INDIC_HAZARD) != 0;
+}
+
+static inline void set_flag_indic_hazard(flag_t value) {
+    bcgv_context.flags = (uint8_t)((bcgv_context.flags & ~FLAG_BIT_INDIC_HAZARD) | (value ? FLAG_BIT_INDIC_HAZARD : 0));
+}
+
+static inline flag_t get_flag_indic_left() {
+    return (bcgv_context.flags & FLAG_BIT_INDIC_LEFT) != 0;
+}
+
+static inline void set_flag_indic_left(flag_t value) {
+    bcgv_context.flags = (uint8_t)((bcgv_context.flags & ~FLAG_BIT_INDIC_LEFT) | (value ? FLAG_BIT_INDIC_LEFT : 0));
+}
+
+static inline flag_t get_flag_indic_right() {
+    return (bcgv_context.flags & FLAG_BIT_INDIC_RIGHT) != 0;
+}
+
+static inline void set_flag_indic_right(flag_t value) {
+    bcgv_context.flags = (uint8_t)((bcgv_context.flags & ~FLAG_BIT_INDIC_RIGHT) | (value ? FLAG_BIT_INDIC_RIGHT : 0));
+}
+
+static inline flag_t get_flag_wiper() {
+    return (bcgv_context.flags & FLAG_BIT_WIPER) != 0;
+}
+
+static inline void set_flag_wiper(flag_t value) {
+    bcgv_context.flags = (uint8_t)((bcgv_context.flags & ~FLAG_BIT_WIPER) | (value ? FLAG_BIT_WIPER : 0));
+}
+
+static inline flag_t get_flag_washer() {
+    return (bcgv_context.flags & FLAG_BIT_WASHER) != 0;
+}
+
+static inline void set_flag_washer(flag_t value) {
+    bcgv_context.flags = (uint8_t)((bcgv_context.flags & ~FLAG_BIT_WASHER) | (value ? FLAG_BIT_WASHER : 0));
+}
+
+static inline bit_flag_t get_bit_flag_bgf_ack() {
+    return bcgv_context.bit_flag_bgf_ack;
+}
+
+static inline void set_bit_flag_bgf_ack(bit_flag_t value) {
+    bcgv_context.bit_flag_bgf_ack = value;
+}
+
+#endif // BCGV_API_INLINE_H
@@ -5,281 +5,299 @@
  * \author Raphael CAUSSE - Melvyn MUNOZ - Roland Cedric TAYO
  */
 
+// The out-of-line accessors are defined here, whatever the accessor mode of the rest of the build
+#undef BCGV_API_INLINE
 #include "bcgv_api.h"
 
 // Context structure
 typedef struct {
-    cmd_t cmd_position_light; // Position light command
-    cmd_t cmd_crossing_light; // Crossing light command
-    cmd_t cmd_highbeam_light; // High beam light command
-    cmd_t cmd_indic_left; // Left turn indicator command
-    cmd_t cmd_indic_right; // Right turn Indicator command
-    cmd_t cmd_indic_hazard; // Hazard (warnings) lights command
-    cmd_t cmd_wiper; // Windshield wipers command
-    cmd_t cmd_washer; // Windshield washer command
-    frame_number_t frame_number; // Frame number in message
+    // Used every cycle
     distance_t distance; // Distance (km)
+    engine_rpm_t engine_rpm; // Engine Revolution/minute
+    uint8_t cmds; // cmd_t values, one bit each
+    uint8_t flags; // flag_t values, one bit each
     speed_t speed; // Speed (km/h)
     issues_t chassis_issues; // Chassis issues, bit-carrying
     issues_t motor_issues; // Motor Issues, bit-carrying
     fuel_level_t fuel_level; // Fuel tank level
-    engine_rpm_t engine_rpm; // Engine Revolution/minute
     issues_t battery_issues; // Battery issues, bit-carrying
-    crc8_t crc8; // CRC8
-    flag_t flag_position_light; // Position light activation flag
-    flag_t flag_crossing_light; // Crossing light activation flag
-    flag_t flag_highbeam_light; // High beam light activation flag
-    flag_t flag_indic_hazard; // Hazard (warnings) lights activation flag
-    flag_t flag_indic_left; // Left turn indicator activation flag
-    flag_t flag_indic_right; // Right turn Indicator activation flag
-    flag_t flag_wiper; // Windshield wipers activation flag
-    flag_t flag_washer; // Windshield washer activation flag
     bit_flag_t bit_flag_bgf_ack; // BGF acknowledgement flags, bit-carrying
-} context_t;
+    // Only used for debug output
+    frame_number_t frame_number; // Frame number in message
+    crc8_t crc8; // CRC8
+} bcgv_context_t;
+
+// Global context structure instance, also accessed by the inline accessors of bcgv_api_inline.h
+bcgv_context_t bcgv_context;
 
-// Global context structure instance
-static context_t context;
+// Out-of-range values given to the setters of ranged data
+uint32_t bcgv_range_violations[RANGE_FIELD_COUNT];
 
 void bcgv_ctx_init() {
-    context.cmd_position_light = 0;
-    context.cmd_crossing_light = 0;
-    context.cmd_highbeam_light = 0;
-    context.cmd_indic_left = 0;
-    context.cmd_indic_right = 0;
-    context.cmd_indic_hazard = 0;
-    context.cmd_wiper = 0;
-    context.cmd_washer = 0;
-    context.frame_number = 1;
-    context.distance = 0;
-    context.speed = 0;
-    context.chassis_issues = 0;
-    context.motor_issues = 0;
-    context.fuel_level = 40;
-    context.engine_rpm = 0;
-    context.battery_issues = 0;
-    context.crc8 = 0;
-    context.flag_position_light = 0;
-    context.flag_crossing_light = 0;
-    context.flag_highbeam_light = 0;
-    context.flag_indic_hazard = 0;
-    context.flag_indic_left = 0;
-    context.flag_indic_right = 0;
-    context.flag_wiper = 0;
-    context.flag_washer = 0;
-    context.bit_flag_bgf_ack = 0;
+    bcgv_context.cmds = 0;
+    bcgv_context.flags = 0;
+    bcgv_context.frame_number = 1;
+    bcgv_context.distance = 0;
+    bcgv_context.speed = 0;
+    bcgv_context.chassis_issues = 0;
+    bcgv_context.motor_issues = 0;
+    bcgv_context.fuel_level = 40;
+    bcgv_context.engine_rpm = 0;
+    bcgv_context.battery_issues = 0;
+    bcgv_context.crc8 = 0;
+    bcgv_context.bit_flag_bgf_ack = 0;
+}
+
+uint32_t get_range_violations(range_field_t field) {
+    return (field < RANGE_FIELD_COUNT) ? bcgv_range_violations[field] : 0;
+}
+
+const char *get_range_field_name(range_field_t field) {
+    static const char *const names[RANGE_FIELD_COUNT] = {
+        "frame_number",
+        "fuel_level",
+        "engine_rpm",
+    };
+    return (field < RANGE_FIELD_COUNT) ? names[field] : "unknown";
+}
+
+void reset_range_violations() {
+    for (int field = 0; field < RANGE_FIELD_COUNT; field++) {
+        bcgv_range_violations[field] = 0;
+    }
 }
 
 
+uint8_t get_cmds() {
+    return bcgv_context.cmds;
+}
+
+void set_cmds(uint8_t value) {
+    bcgv_context.cmds = value;
+}
+
+uint8_t get_flags() {
+    return bcgv_context.flags;
+}
+
+void set_flags(uint8_t value) {
+    bcgv_context.flags = value;
+}
+
 cmd_t get_cmd_position_light() {
-    return context.cmd_position_light;
+    return (bcgv_context.cmds & CMD_BIT_POSITION_LIGHT) != 0;
 }
 
 void set_cmd_position_light(cmd_t value) {
-    context.cmd_position_light = value;
+    bcgv_context.cmds = (uint8_t)((bcgv_context.cmds & ~CMD_BIT_POSITION_LIGHT) | (value ? CMD_BIT_POSITION_LIGHT : 0));
 }
 
 cmd_t get_cmd_crossing_light() {
-    return context.cmd_crossing_light;
+    return (bcgv_context.cmds & CMD_BIT_CROSSING_LIGHT) != 0;
 }
 
 void set_cmd_crossing_light(cmd_t value) {
-    context.cmd_crossing_light = value;
+    bcgv_context.cmds = (uint8_t)((bcgv_context.cmds & ~CMD_BIT_CROSSING_LIGHT) | (value ? CMD_BIT_CROSSING_LIGHT : 0));
 }
 
 cmd_t get_cmd_highbeam_light() {
-    return context.cmd_highbeam_light;
+    return (bcgv_context.cmds & CMD_BIT_HIGHBEAM_LIGHT) != 0;
 }
 
 void set_cmd_highbeam_light(cmd_t value) {
-    context.cmd_highbeam_light = value;
+    bcgv_context.cmds = (uint8_t)((bcgv_context.cmds & ~CMD_BIT_HIGHBEAM_LIGHT) | (value ? CMD_BIT_HIGHBEAM_LIGHT : 0));
 }
 
 cmd_t get_cmd_indic_left() {
-    return context.cmd_indic_left;
+    return (bcgv_context.cmds & CMD_BIT_INDIC_LEFT) != 0;
 }
 
 void set_cmd_indic_left(cmd_t value) {
-    context.cmd_indic_left = value;
+    bcgv_context.cmds = (uint8_t)((bcgv_context.cmds & ~CMD_BIT_INDIC_LEFT) | (value ? CMD_BIT_INDIC_LEFT : 0));
 }
 
 cmd_t get_cmd_indic_right() {
-    return context.cmd_indic_right;
+    return (bcgv_context.cmds & CMD_BIT_INDIC_RIGHT) != 0;
 }
 
 void set_cmd_indic_right(cmd_t value) {
-    context.cmd_indic_right = value;
+    bcgv_context.cmds = (uint8_t)((bcgv_context.cmds & ~CMD_BIT_INDIC_RIGHT) | (value ? CMD_BIT_INDIC_RIGHT : 0));
 }
 
 cmd_t get_cmd_indic_hazard() {
-    return context.cmd_indic_hazard;
+    return (bcgv_context.cmds & CMD_BIT_INDIC_HAZARD) != 0;
 }
 
 void set_cmd_indic_hazard(cmd_t value) {
-    context.cmd_indic_hazard = value;
+    bcgv_context.cmds = (uint8_t)((bcgv_context.cmds & ~CMD_BIT_INDIC_HAZARD) | (value ? CMD_BIT_INDIC_HAZARD : 0));
 }
 
 cmd_t get_cmd_wiper() {
-    return context.cmd_wiper;
+    return (bcgv_context.cmds & CMD_BIT_WIPER) != 0;
 }
 
 void set_cmd_wiper(cmd_t value) {
-    context.cmd_wiper = value;
+    bcgv_context.cmds = (uint8_t)((bcgv_context.cmds & ~CMD_BIT_WIPER) | (value ? CMD_BIT_WIPER : 0));
 }
 
 cmd_t get_cmd_washer() {
-    return context.cmd_washer;
+    return (bcgv_context.cmds & CMD_BIT_WASHER) != 0;
 }
 
 void set_cmd_washer(cmd_t value) {
-    context.cmd_washer = value;
+    bcgv_context.cmds = (uint8_t)((bcgv_context.cmds & ~CMD_BIT_WASHER) | (value ? CMD_BIT_WASHER : 0));
 }
 
 frame_number_t get_frame_number() {
-    return context.frame_number;
+    return bcgv_context.frame_number;
 }
 
 void set_frame_number(frame_number_t value) {
-    if (value >= FRAME_NUMBER_MIN && value <= FRAME_NUMBER_MAX) {
-        context.frame_number = value;
-    }
+    const frame_number_t low = (frame_number_t)(value < FRAME_NUMBER_MIN);
+    const frame_number_t high = (frame_number_t)(value > FRAME_NUMBER_MAX);
+    bcgv_range_violations[RANGE_FIELD_FRAME_NUMBER] += (low | high);
+    const frame_number_t keep = (frame_number_t)-(low | high);
+    bcgv_context.frame_number = (frame_number_t)((value & ~keep) | (bcgv_context.frame_number & keep));
 }
 
 distance_t get_distance() {
-    return context.distance;
+    return bcgv_context.distance;
 }
 
 void set_distance(distance_t value) {
-    context.distance = value;
+    bcgv_context.distance = value;
 }
 
 speed_t get_speed() {
-    return context.speed;
+    return bcgv_context.speed;
 }
 
 void set_speed(speed_t value) {
-    context.speed = value;
+    bcgv_context.speed = value;
 }
 
 issues_t get_chassis_issues() {
-    return context.chassis_issues;
+    return bcgv_context.chassis_issues;
 }
 
 void set_chassis_issues(issues_t value) {
-    context.chassis_issues = value;
+    bcgv_context.chassis_issues = value;
 }
 
 issues_t get_motor_issues() {
-    return context.motor_issues;
+    return bcgv_context.motor_issues;
 }
 
 void set_motor_issues(issues_t value) {
-    context.motor_issues = value;
+    bcgv_context.motor_issues = value;
 }
 
 fuel_level_t get_fuel_level() {
-    return context.fuel_level;
+    return bcgv_context.fuel_level;
 }
 
 void set_fuel_level(fuel_level_t value) {
-    if (value <= FUEL_LEVEL_MAX) {
-        context.fuel_level = value;
-    }
+    const fuel_level_t high = (fuel_level_t)(value > FUEL_LEVEL_MAX);
+    bcgv_range_violations[RANGE_FIELD_FUEL_LEVEL] += high;
+    const fuel_level_t keep = (fuel_level_t)-high;
+    bcgv_context.fuel_level = (fuel_level_t)((value & ~keep) | (bcgv_context.fuel_level & keep));
 }
 
 engine_rpm_t get_engine_rpm() {
-    return context.engine_rpm;
+    return bcgv_context.engine_rpm;
 }
 
 void set_engine_rpm(engine_rpm_t value) {
-    if (value <= ENGINE_RPM_MAX) {
-        context.engine_rpm = value;
-    }
+    const engine_rpm_t high = (engine_rpm_t)(value > ENGINE_RPM_MAX);
+    bcgv_range_violations[RANGE_FIELD_ENGINE_RPM] += high;
+    const engine_rpm_t keep = (engine_rpm_t)-high;
+    bcgv_context.engine_rpm = (engine_rpm_t)((value & ~keep) | (bcgv_context.engine_rpm & keep));
 }
 
 issues_t get_battery_issues() {
-    return context.battery_issues;
+    return bcgv_context.battery_issues;
 }
 
 void set_battery_issues(issues_t value) {
-    context.battery_issues = value;
+    bcgv_context.battery_issues = value;
 }
 
 crc8_t get_crc8() {
-    return context.crc8;
+    return bcgv_context.crc8;
 }
 
 void set_crc8(crc8_t value) {
-    context.crc8 = value;
+    bcgv_context.crc8 = value;
 }
 
 flag_t get_flag_position_light() {
-    return context.flag_position_light;
+    return (bcgv_context.flags & FLAG_BIT_POSITION_LIGHT) != 0;
 }
 
 void set_flag_position_light(flag_t value) {
-    context.flag_position_light = value;
+    bcgv_context.flags = (uint8_t)((bcgv_context.flags & ~FLAG_BIT_POSITION_LIGHT) | (value ? FLAG_BIT_POSITION_LIGHT : 0));
 }
 
 flag_t get_flag_crossing_light() {
-    return context.flag_crossing_light;
+    return (bcgv_context.flags & FLAG_BIT_CROSSING_LIGHT) != 0;
 }
 
 void set_flag_crossing_light(flag_t value) {
-    context.flag_crossing_light = value;
+    bcgv_context.flags = (uint8_t)((bcgv_context.flags & ~FLAG_BIT_CROSSING_LIGHT) | (value ? FLAG_BIT_CROSSING_LIGHT : 0));
 }
 
 flag_t get_flag_highbeam_light() {
-    return context.flag_highbeam_light;
+    return (bcgv_context.flags & FLAG_BIT_HIGHBEAM_LIGHT) != 0;
 }
 
 void set_flag_highbeam_light(flag_t value) {
-    context.flag_highbeam_light = value;
+    bcgv_context.flags = (uint8_t)((bcgv_context.flags & ~FLAG_BIT_HIGHBEAM_LIGHT) | (value ? FLAG_BIT_HIGHBEAM_LIGHT : 0));
 }
 
 flag_t get_flag_indic_hazard() {
-    return context.flag_indic_hazard;
+    return (bcgv_context.flags & FLAG_BIT_INDIC_HAZARD) != 0;
 }
 
 void set_flag_indic_hazard(flag_t value) {
-    context.flag_indic_hazard = value;
+    bcgv_context.flags = (uint8_t)((bcgv_context.flags & ~FLAG_BIT_INDIC_HAZARD) | (value ? FLAG_BIT_INDIC_HAZARD : 0));
 }
 
 flag_t get_flag_indic_left() {
-    return context.flag_indic_left;
+    return (bcgv_context.flags & FLAG_BIT_INDIC_LEFT) != 0;
 }
 
 void set_flag_indic_left(flag_t value) {
-    context.flag_indic_left = value;
+    bcgv_context.flags = (uint8_t)((bcgv_context.flags & ~FLAG_BIT_INDIC_LEFT) | (value ? FLAG_BIT_INDIC_LEFT : 0));
 }
 
 flag_t get_flag_indic_right() {
-    return context.flag_indic_right;
+    return (bcgv_context.flags & FLAG_BIT_INDIC_RIGHT) != 0;
 }
 
 void set_flag_indic_right(flag_t value) {
-    context.flag_indic_right = value;
+    bcgv_context.flags = (uint8_t)((bcgv_context.flags & ~FLAG_BIT_INDIC_RIGHT) | (value ? FLAG_BIT_INDIC_RIGHT : 0));
 }
 
 flag_t get_flag_wiper() {
-    return context.flag_wiper;
+    return (bcgv_context.flags & FLAG_BIT_WIPER) != 0;
 }
 
 void set_flag_wiper(flag_t value) {
-    context.flag_wiper = value;
+    bcgv_context.flags = (uint8_t)((bcgv_context.flags & ~FLAG_BIT_WIPER) | (value ? FLAG_BIT_WIPER : 0));
 }
 
 flag_t get_flag_washer() {
-    return context.flag_washer;
+    return (bcgv_context.flags & FLAG_BIT_WASHER) != 0;
 }
 
 void set_flag_washer(flag_t value) {
-    context.flag_washer = value;
+    bcgv_context.flags = (uint8_t)((bcgv_context.flags & ~FLAG_BIT_WASHER) | (value ? FLAG_BIT_WASHER : 0));
 }
 
 bit_flag_t get_bit_flag_bgf_ack() {
-    return context.bit_flag_bgf_ack;
+    return bcgv_context.bit_flag_bgf_ack;
 }
 
 void set_bit_flag_bgf_ack(bit_flag_t value) {
-    context.bit_flag_bgf_ack = value;
+    bcgv_context.bit_flag_bgf_ack = value;
 }
@@ -6,84 +6,499 @@
 
 /***** Includes **************************************************************/
 
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
 #include "drv_api.h"
 #include "bcgv_api.h"
-#include "mux.h"
-#include "bgf.h"
-#include "comodo.h"
+#include "cycle.h"
+#include "serial.h"
 #include "log.h"
+#include "metrics.h"
+#include "rt_profile.h"
+#include "telemetry.h"
+#include "mqtt_pub.h"
+#include "ctx_history.h"
+#include "trace_rec.h"
+#include "trip_stats.h"
+#include "cycle_perf.h"
+#include "debug_trace.h"
+#include "checkpoint.h"
 #include "fsm_lights.h"
 #include "fsm_indicators.h"
 #include "fsm_windshield_washer.h"
 
+/***** Definitions ***********************************************************/
+
+#define METRICS_REPORT_PERIOD_CYCLES (100) /* 10 seconds = 100 * 100ms */
+
+/***** Static Functions ******************************************************/
+
+/**
+ * \brief Parse a network destination.
+ * \param arg : Destination as "address" or "address:port", modified in place
+ * \param host : Output address
+ * \param port : Output port, unchanged if not given
+ * \return bool : true on success, false otherwise
+ */
+static bool parse_destination(char *arg, const char **host, uint16_t *port)
+{
+    char *separator = strchr(arg, ':');
+    char *end = NULL;
+    unsigned long value = 0;
+
+    if (separator != NULL)
+    {
+        *separator = '\0';
+        value = strtoul(separator + 1, &end, 10);
+        if ((*end != '\0') || (value == 0) || (value > 65535))
+        {
+            return false;
+        }
+        *port = (uint16_t)value;
+    }
+    *host = arg;
+
+    return true;
+}
+
+/**
+ * \brief Parse an MQTT deadband setting.
+ * \param arg : Setting as "topic=value", modified in place
+ * \param config : MQTT publisher configuration to update
+ * \return bool : true on success, false otherwise
+ */
+static bool parse_deadband(char *arg, mqtt_pub_config_t *config)
+{
+    char *separator = strchr(arg, '=');
+    char *end = NULL;
+    unsigned long value = 0;
+
+    if (separator == NULL)
+    {
+        return false;
+    }
+    *separator = '\0';
+    value = strtoul(separator + 1, &end, 10);
+    if ((*end != '\0') || (value > UINT32_MAX))
+    {
+        return false;
+    }
+
+    return mqtt_pub_set_deadband(config, arg, (uint32_t)value);
+}
+
+/**
+ * \brief Print command line usage.
+ * \param name : Program name
+ */
+static void print_usage(const char *name)
+{
+    printf("Usage: %s [-r] [-k] [-l level] [-L file] [-t] [-c cpu] [-p priority]\n", name);
+    printf("       [-e address[:port]] [-b batch] [-d oldest|newest]\n");
+    printf("       [-m address[:port]] [-H heartbeat_ms] [-D topic=deadband] [-f file] [-w file] [-C file] [-P]\n");
+    printf("       [-h]\n");
+    printf("  -r : Read serial frames in a dedicated thread, as soon as they arrive\n");
+    printf("  -k : Evaluate FSMs immediately on BGF acknowledgement (implies -r)\n");
+    printf("  -l : Minimum log level (0: info, 1: warn, 2: error, 3: none)\n");
+    printf("  -L : Write logs as binary records to a file, rendered by tools/bin/log_decode\n");
+    printf("  -t : Apply real-time profile (lock and prefault memory, SCHED_FIFO)\n");
+    printf("  -c : Pin main loop to a CPU (implies -t)\n");
+    printf("  -p : SCHED_FIFO priority, default %d (implies -t)\n", RT_PROFILE_DEFAULT_PRIORITY);
+    printf("  -e : Export telemetry as Influx line protocol over UDP, default %s:%d\n",
+           TELEMETRY_DEFAULT_HOST, TELEMETRY_DEFAULT_PORT);
+    printf("  -b : Telemetry samples per datagram, default %d (max %d)\n", TELEMETRY_DEFAULT_BATCH, TELEMETRY_MAX_BATCH);
+    printf("  -d : Telemetry drop policy when queue is full, default oldest\n");
+    printf("  -m : Publish context and FSM states to an MQTT broker, default %s:%d\n",
+           MQTT_PUB_DEFAULT_HOST, MQTT_PUB_DEFAULT_PORT);
+    printf("  -H : MQTT heartbeat, values are published at least this often, default %d\n",
+           MQTT_PUB_DEFAULT_HEARTBEAT_MS);
+    printf("  -D : MQTT deadband of a topic, e.g. speed=2 (repeatable)\n");
+    printf("  -f : Append the context of the last %d cycles to a file on a fault (invalid MUX frame, FSM failure)\n",
+           CTX_HISTORY_DEPTH);
+    printf("  -w : Record MUX frames and serial channels of each cycle to a columnar trace file\n");
+    printf("  -C : Checkpoint the state every cycle to a file, e.g. /dev/shm/bcgv.ckpt, restored at startup if recent\n");
+    printf("  -P : Count instructions, cycles, cache and branch misses, context switches per cycle stage\n");
+    printf("  -h : Print this help\n");
+}
+
+/**
+ * \brief Report instrumentation of all FSMs, read without stopping the main loop.
+ */
+static void report_fsm_traces(void)
+{
+    fsm_trace_data_t data;
+
+    fsm_lights_get_trace(&data);
+    fsm_trace_report("lights", &data);
+    fsm_indicators_get_trace(&data);
+    fsm_trace_report("indicators", &data);
+    fsm_windshield_washer_get_trace(&data);
+    fsm_trace_report("windshield_washer", &data);
+}
+
+/**
+ * \brief Log the out-of-range values given to ranged context data since start.
+ * \details Ranged data are only written by the main loop (MUX decode), no lock needed.
+ */
+static void report_range_violations(void)
+{
+    uint32_t count = 0;
+
+    for (int field = 0; field < RANGE_FIELD_COUNT; field++)
+    {
+        count = get_range_violations((range_field_t)field);
+        if (count > 0)
+        {
+            log_warn("%s: %u out-of-range values", get_range_field_name((range_field_t)field), count);
+        }
+    }
+}
+
 /***** Main function *********************************************************/
 
-int main(void)
+int main(int argc, char *argv[])
 {
     bool quit = false;
     bool success = false;
+    bool serial_rx_thread = false;
+    bool kick_fsm = false;
+    bool real_time = false;
+    rt_profile_config_t rt_config;
+    bool export_telemetry = false;
+    telemetry_config_t telemetry_config;
+    telemetry_stats_t telemetry_stats;
+    bool publish_mqtt = false;
+    mqtt_pub_config_t mqtt_config;
+    mqtt_pub_stats_t mqtt_stats;
+    const char *history_path = NULL;
+    ctx_history_stats_t history_stats;
+    const char *trace_path = NULL;
+    trace_rec_stats_t trace_stats;
+    const char *log_path = NULL;
+    const char *checkpoint_path = NULL;
+    bool count_perf = false;
+    int opt = 0;
     int32_t ret = 0;
     int32_t driver_fd = 0;
+    uint32_t cycle = 0;
+
+    /***** Parsing options *****/
+
+    rt_profile_default(&rt_config);
+    telemetry_default(&telemetry_config);
+    mqtt_pub_default(&mqtt_config);
+    while ((opt = getopt(argc, argv, "rkl:L:tc:p:e:b:d:m:H:D:f:w:C:Ph")) != -1)
+    {
+        switch (opt)
+        {
+        case 'r':
+            serial_rx_thread = true;
+            break;
+        case 'k':
+            serial_rx_thread = true;
+            kick_fsm = true;
+            break;
+        case 'l':
+            log_set_level((log_level_t)atoi(optarg));
+            break;
+        case 'L':
+            log_path = optarg;
+            break;
+        case 't':
+            real_time = true;
+            break;
+        case 'c':
+            real_time = true;
+            rt_config.cpu = atoi(optarg);
+            break;
+        case 'p':
+            real_time = true;
+            rt_config.priority = atoi(optarg);
+            break;
+        case 'e':
+            export_telemetry = true;
+            if (parse_destination(optarg, &telemetry_config.host, &telemetry_config.port) == false)
+            {
+                print_usage(argv[0]);
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'b':
+            telemetry_config.batch = (uint32_t)atoi(optarg);
+            break;
+        case 'd':
+            if (strcmp(optarg, "oldest") == 0)
+            {
+                telemetry_config.drop_policy = TELEMETRY_DROP_OLDEST;
+            }
+            else if (strcmp(optarg, "newest") == 0)
+            {
+                telemetry_config.drop_policy = TELEMETRY_DROP_NEWEST;
+            }
+            else
+            {
+                print_usage(argv[0]);
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'm':
+            publish_mqtt = true;
+            if (parse_destination(optarg, &mqtt_config.host, &mqtt_config.port) == false)
+            {
+                print_usage(argv[0]);
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'H':
+            mqtt_config.heartbeat_ms = (uint32_t)atoi(optarg);
+            break;
+        case 'D':
+            if (parse_deadband(optarg, &mqtt_config) == false)
+            {
+                print_usage(argv[0]);
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'f':
+            history_path = optarg;
+            break;
+        case 'w':
+            trace_path = optarg;
+            break;
+        case 'C':
+            checkpoint_path = optarg;
+            break;
+        case 'P':
+            count_perf = true;
+            break;
+        case 'h':
+            print_usage(argv[0]);
+            return EXIT_SUCCESS;
+        default:
+            print_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
 
     /***** Starting application *****/
 
+    if (log_path != NULL)
+    {
+        if (log_open_binary(log_path) == false)
+        {
+            log_error("cannot write binary log to %s", log_path);
+            return EXIT_FAILURE;
+        }
+        log_info("binary log written to %s", log_path);
+    }
+
     driver_fd = drv_open();
     if (driver_fd == DRV_ERROR)
     {
         log_error("error while opening driver", NULL);
+        log_close_binary();
         return EXIT_FAILURE;
     }
     else if (driver_fd == DRV_VER_MISMATCH)
     {
         log_error("driver version mismatch", NULL);
+        log_close_binary();
         return EXIT_FAILURE;
     }
     log_info("driver opened", NULL);
 
     bcgv_ctx_init();
 
-    /***** Main loop *****/
+    /* Before any thread creation, the first cycle resumes from the restored state */
+    if (checkpoint_path != NULL)
+    {
+        if (checkpoint_open(checkpoint_path) == false)
+        {
+            drv_close(driver_fd);
+            log_close_binary();
+            return EXIT_FAILURE;
+        }
+        checkpoint_restore();
+        log_info("state checkpointed to %s", checkpoint_path);
+    }
 
-    (void)success;
-    while (quit == false)
+#ifdef DEBUG
+    /* Frames recorded as binary records, read with tools/bin/debug_trace_dump */
+    if (debug_trace_open(DEBUG_TRACE_DEFAULT_PATH) == true)
     {
-        /* Receive and decode MUX frame (UDP) */
-        success = mux_read_frame_100ms(driver_fd);
-        mux_check_frame_number();
-        success = mux_decode_frame_100ms();
+        log_info("debug trace recorded to %s", DEBUG_TRACE_DEFAULT_PATH);
+    }
+#endif
 
-        /* Receive serial frames */
-        ret = bgf_read_frames(driver_fd);
-        success = comodo_read_frame_500ms(driver_fd);
+    /* Before any thread creation, so that reception thread inherits the profile */
+    if (real_time == true)
+    {
+        success = rt_profile_apply(&rt_config);
+        (void)success; /* Steps are reported, application still runs without privileges */
+    }
 
-        /* Decode COMODO frame (serial) */
-        success = comodo_decode_frame();
+    if (serial_rx_thread == true)
+    {
+        success = serial_rx_start(driver_fd, kick_fsm);
+        if (success == false)
+        {
+            drv_close(driver_fd);
+            log_close_binary();
+            return EXIT_FAILURE;
+        }
+        log_info("serial reception thread started", NULL);
+    }
 
-        /* FSM executions */
-        ret = fsm_lights_run();
-        ret = fsm_indicators_run();
-        ret = fsm_windshield_washer_run();
+    if (export_telemetry == true)
+    {
+        success = telemetry_start(&telemetry_config);
+        if (success == false)
+        {
+            serial_rx_stop();
+            drv_close(driver_fd);
+            log_close_binary();
+            return EXIT_FAILURE;
+        }
+        log_info("telemetry exported to %s:%u", telemetry_config.host, telemetry_config.port);
+    }
+
+    if (publish_mqtt == true)
+    {
+        success = mqtt_pub_start(&mqtt_config);
+        if (success == false)
+        {
+            telemetry_stop();
+            serial_rx_stop();
+            drv_close(driver_fd);
+            log_close_binary();
+            return EXIT_FAILURE;
+        }
+        log_info("MQTT publisher connected to %s:%u", mqtt_config.host, mqtt_config.port);
+    }
 
-        /* Encode and send MUX frame (UDP) */
-        mux_encode_frame_200ms();
-        success = mux_write_frame_200ms(driver_fd);
+    if (history_path != NULL)
+    {
+        success = ctx_history_start(history_path);
+        if (success == false)
+        {
+            mqtt_pub_stop();
+            telemetry_stop();
+            serial_rx_stop();
+            drv_close(driver_fd);
+            log_close_binary();
+            return EXIT_FAILURE;
+        }
+        log_info("context history dumped to %s on faults", history_path);
+    }
 
-        /* Encode and write serial frames */
-        ret = bgf_write_frames(driver_fd);
+    if (trace_path != NULL)
+    {
+        success = trace_rec_start(trace_path);
+        if (success == false)
+        {
+            ctx_history_stop();
+            mqtt_pub_stop();
+            telemetry_stop();
+            serial_rx_stop();
+            drv_close(driver_fd);
+            log_close_binary();
+            return EXIT_FAILURE;
+        }
+        log_info("trace recorded to %s", trace_path);
+    }
 
-        /* Prepare next MUX frame number check */
-        mux_incr_frame_number();
+    /* Counters follow the main loop thread only */
+    if (count_perf == true)
+    {
+        success = cycle_perf_start();
+        if (success == false)
+        {
+            trace_rec_stop();
+            ctx_history_stop();
+            mqtt_pub_stop();
+            telemetry_stop();
+            serial_rx_stop();
+            drv_close(driver_fd);
+            log_close_binary();
+            return EXIT_FAILURE;
+        }
+        log_info("hardware counters sampled per cycle stage", NULL);
+    }
+
+    /***** Main loop *****/
+
+    while (quit == false)
+    {
+        cycle_run(driver_fd);
+
+        /* Periodic metrics report */
+        cycle++;
+        if ((cycle % METRICS_REPORT_PERIOD_CYCLES) == 0)
+        {
+            log_flush();
+            metrics_report();
+            cycle_perf_report();
+            trip_stats_report();
+            report_fsm_traces();
+            report_range_violations();
+            if (export_telemetry == true)
+            {
+                telemetry_get_stats(&telemetry_stats);
+                log_info("telemetry: sampled %u, sent %u in %u datagrams, dropped %u, send errors %u",
+                         telemetry_stats.sampled, telemetry_stats.sent, telemetry_stats.datagrams,
+                         telemetry_stats.dropped, telemetry_stats.send_errors);
+            }
+            if (publish_mqtt == true)
+            {
+                mqtt_pub_get_stats(&mqtt_stats);
+                log_info("mqtt: queued %u, suppressed %u, published %u, dropped %u, errors %u",
+                         mqtt_stats.queued, mqtt_stats.suppressed, mqtt_stats.published,
+                         mqtt_stats.dropped, mqtt_stats.errors);
+            }
+            if (history_path != NULL)
+            {
+                ctx_history_get_stats(&history_stats);
+                log_info("context history: recorded %u, dumps %u, dropped %u, write errors %u",
+                         history_stats.recorded, history_stats.dumps, history_stats.dropped,
+                         history_stats.write_errors);
+            }
+            if (trace_path != NULL)
+            {
+                trace_rec_get_stats(&trace_stats);
+                log_info("trace: rows %u, blocks %u (%llu bytes), dropped %u, write errors %u",
+                         trace_stats.rows, trace_stats.blocks, (unsigned long long)trace_stats.bytes,
+                         trace_stats.dropped, trace_stats.write_errors);
+            }
+        }
     }
 
     /***** Closing application *****/
 
+    cycle_perf_stop();
+    trace_rec_stop();
+    ctx_history_stop();
+    mqtt_pub_stop();
+    telemetry_stop();
+    serial_rx_stop();
+
+#ifdef DEBUG
+    debug_trace_close();
+#endif
+    checkpoint_close();
+    log_flush();
+
     ret = drv_close(driver_fd);
     if (ret == DRV_ERROR)
     {
         log_error("error while closing driver", NULL);
+        log_close_binary();
         return EXIT_FAILURE;
     }
     log_info("driver closed", NULL);
+    log_close_binary();
 
     return EXIT_SUCCESS;
 }
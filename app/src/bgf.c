@@ -1,7 +1,9 @@
 /**
  * \file bgf.c
  * \brief Implementation of BGF system.
- * \details Read and write serial frames of BGF from driver.
+ * \details Handle serial frames received from BGF and write serial frames to driver.
+ *          Every message id has its own entry in an outstanding message table, so messages
+ *          are acknowledged and retransmitted independently of each other.
  * \author Melvyn MUNOZ
  */
 
@@ -11,12 +13,24 @@
 #include "serial.h"
 #include "bit_utils.h"
 #include "log.h"
+#include "comodo.h"
+#include "metrics.h"
+#include "probe.h"
+#include "fsm_common.h"
 
 /***** Definitions ***********************************************************/
 
 #define BGF_SERIAL_CHANNEL (11 - 1) /* Serial channel 11 */
 #define BGF_SERIAL_FRAME_SIZE (2)	/* bytes */
-#define BGF_NUM_MSG (5)
+
+#define BGF_RTO_INIT (200 * TIMESTAMP_NS_PER_MS) /* Retransmission timeout before first RTT sample */
+#define BGF_RTO_MIN (20 * TIMESTAMP_NS_PER_MS)	 /* Lower bound of retransmission timeout */
+#define BGF_RTO_MAX (1000 * TIMESTAMP_NS_PER_MS) /* Upper bound of retransmission timeout */
+#define BGF_MAX_RETRIES (3)						 /* Retransmissions before giving up */
+
+/* FSMs fail a light or indicator not acknowledged within TIMER_1S_COUNT_100MS cycles: a retransmission
+   after that window is useless traffic, the message is given up at the end of the window instead */
+#define BGF_ACK_WINDOW (TIMER_1S_COUNT_100MS * 100 * TIMESTAMP_NS_PER_MS)
 
 typedef struct
 {
@@ -24,33 +38,121 @@ typedef struct
 	uint8_t flag;
 } bgf_msg_t;
 
+/* Outstanding message table entry, one per message id */
+typedef struct
+{
+	bgf_msg_t msg;				  /* Last message sent */
+	bool in_flight;				  /* Sent and not acknowledged yet */
+	uint8_t retries;			  /* Retransmissions of current message */
+	timestamp_t sent_timestamp;	  /* Time of first transmission */
+	timestamp_t retry_timestamp;  /* Time of last (re)transmission */
+	timestamp_t retry_deadline;	  /* Time of next retransmission */
+	timestamp_t ack_deadline;	  /* End of the acknowledgement window of the FSMs */
+	timestamp_t srtt;			  /* Smoothed round trip time */
+	timestamp_t rttvar;			  /* Round trip time variation */
+	bgf_msg_stats_t stats;		  /* Counters and RTT bounds */
+} bgf_outstanding_t;
+
 /***** Static variables ******************************************************/
 
-/* Last saved messages sent by BCGV to BGF and last saved flags */
-static bgf_msg_t bgf_msg[BGF_NUM_MSG];
-static flag_t flag_position_light_saved = false;
-static flag_t flag_crossing_light_saved = false;
-static flag_t flag_highbeam_light_saved = false;
-static flag_t flag_indic_right_saved = false;
-static flag_t flag_indic_left_saved = false;
+/* Outstanding message table, indexed by message id - 1 */
+static bgf_outstanding_t bgf_table[BGF_NUM_MSG];
+
+/* Acknowledgement bit of each message id */
+static const bit_flag_t bgf_ack_bits[BGF_NUM_MSG] = {
+	BGF_ACK_POSITION_LIGHT, /* BCGV_BGF_MSG_ID_1 */
+	BGF_ACK_CROSSING_LIGHT, /* BCGV_BGF_MSG_ID_2 */
+	BGF_ACK_HIGHBEAM_LIGHT, /* BCGV_BGF_MSG_ID_3 */
+	BGF_ACK_INDIC_RIGHT,	/* BCGV_BGF_MSG_ID_4 */
+	BGF_ACK_INDIC_LEFT,		/* BCGV_BGF_MSG_ID_5 */
+};
+
+/* Reception time of last acknowledgement per message and acknowledgement bits not yet consumed by FSMs */
+static timestamp_t bgf_ack_timestamp[BGF_NUM_MSG];
+static bit_flag_t bgf_ack_pending = 0;
+
+/* Messages to write in next driver call */
+static uint32_t bgf_write_count = 0;
 
 /***** Functions *************************************************************/
 
+/**
+ * \brief Compute the retransmission timeout of a message id.
+ * \param entry : Outstanding table entry
+ * \return timestamp_t : Retransmission timeout (ns)
+ */
+static timestamp_t bgf_rto(const bgf_outstanding_t *entry)
+{
+	timestamp_t rto = BGF_RTO_INIT;
+
+	if (entry->stats.rtt_count > 0)
+	{
+		rto = entry->srtt + 4 * entry->rttvar;
+	}
+	if (rto < BGF_RTO_MIN)
+	{
+		rto = BGF_RTO_MIN;
+	}
+	if (rto > BGF_RTO_MAX)
+	{
+		rto = BGF_RTO_MAX;
+	}
+
+	return rto;
+}
+
+/**
+ * \brief Update round trip time statistics of a message id with a new sample.
+ * \param entry : Outstanding table entry
+ * \param rtt : Round trip time sample
+ */
+static void bgf_rtt_update(bgf_outstanding_t *entry, timestamp_t rtt)
+{
+	timestamp_t delta = 0;
+
+	/* Smoothed RTT and variation as in RFC 6298 */
+	if (entry->stats.rtt_count == 0)
+	{
+		entry->srtt = rtt;
+		entry->rttvar = rtt / 2;
+		entry->stats.rtt_min = rtt;
+		entry->stats.rtt_max = rtt;
+	}
+	else
+	{
+		delta = (entry->srtt > rtt) ? (entry->srtt - rtt) : (rtt - entry->srtt);
+		entry->rttvar = (3 * entry->rttvar + delta) / 4;
+		entry->srtt = (7 * entry->srtt + rtt) / 8;
+		if (rtt < entry->stats.rtt_min)
+		{
+			entry->stats.rtt_min = rtt;
+		}
+		if (rtt > entry->stats.rtt_max)
+		{
+			entry->stats.rtt_max = rtt;
+		}
+	}
+	entry->stats.rtt_count++;
+	entry->stats.srtt = entry->srtt;
+
+	metrics_record(METRIC_BGF_ACK_RTT, rtt);
+}
+
 /**
  * \brief Check if the message received is same as last message sent.
  * \param msg_received : BGF message received
  * \return bool : the data in the received message are the same in the sended message
  */
-bool bgf_check_msg_received(const bgf_msg_t *msg_received)
+static bool bgf_check_msg_received(const bgf_msg_t *msg_received)
 {
 	bool same_msg = false;
 
-	if (msg_received->id > BGF_NUM_MSG)
+	if ((msg_received->id == 0) || (msg_received->id > BGF_NUM_MSG))
 	{
 		log_error("invalid message id (%u)", msg_received->id);
 	}
-	else if ((bgf_msg[msg_received->id - 1].id == msg_received->id) &&
-			 (bgf_msg[msg_received->id - 1].flag == msg_received->flag))
+	else if ((bgf_table[msg_received->id - 1].msg.id == msg_received->id) &&
+			 (bgf_table[msg_received->id - 1].msg.flag == msg_received->flag))
 	{
 		same_msg = true;
 	}
@@ -61,159 +163,281 @@ bool bgf_check_msg_received(const bgf_msg_t *msg_received)
 /**
  * \brief Set acknowledgement bit according to received message.
  * \param msg : BGF message
+ * \param rx_timestamp : Reception time of the message
  */
-void bgf_set_bit_ack(const bgf_msg_t *msg)
+static void bgf_set_bit_ack(const bgf_msg_t *msg, timestamp_t rx_timestamp)
 {
 	bit_flag_t bit_flag_actual = get_bit_flag_bgf_ack();
-	bit_flag_t bit_ack = 1;
+	bit_flag_t bit_ack = bgf_ack_bits[msg->id - 1];
 
-	bit_ack = bit_ack << (msg->id - 1);
+	bgf_ack_timestamp[msg->id - 1] = rx_timestamp;
 	if (msg->flag == 1)
 	{
 		set_bit_flag_bgf_ack(bit_flag_actual | bit_ack);
+		bgf_ack_pending |= bit_ack;
 	}
 	else
 	{
 		set_bit_flag_bgf_ack(CLEAR_BIT(bit_flag_actual, bit_ack));
+		bgf_ack_pending &= (bit_flag_t)~bit_ack;
 	}
 }
 
 /**
- * \brief Set serial write buffer with the BGF message to send
- * \param msg_to_send : BGF message to_send
+ * \brief Add a BGF message to the serial write buffer.
+ * \param msg_to_send : BGF message to send
  */
-void bgf_set_buffer_write(const bgf_msg_t *msg_to_send)
+static void bgf_set_buffer_write(const bgf_msg_t *msg_to_send)
 {
-	serial_buffer_write[BGF_SERIAL_CHANNEL].serNum = BGF_SERIAL_CHANNEL + 1;
-	serial_buffer_write[BGF_SERIAL_CHANNEL].frameSize = BGF_SERIAL_FRAME_SIZE;
-	serial_buffer_write[BGF_SERIAL_CHANNEL].frame[0] = msg_to_send->id;
-	serial_buffer_write[BGF_SERIAL_CHANNEL].frame[1] = msg_to_send->flag;
+	serial_buffer_write[bgf_write_count].serNum = BGF_SERIAL_CHANNEL + 1;
+	serial_buffer_write[bgf_write_count].frameSize = BGF_SERIAL_FRAME_SIZE;
+	serial_buffer_write[bgf_write_count].frame[0] = msg_to_send->id;
+	serial_buffer_write[bgf_write_count].frame[1] = msg_to_send->flag;
+	bgf_write_count++;
 }
 
 /**
- * \brief Write one serial message to driver.
+ * \brief Write all messages of serial write buffer to driver in one call.
  * \param drv_fd : Fd driver
- * \param msg_id : Message id to set and send
- * \param msg_flag : Message flag to set and send
  * \return bool : true if successfully write to driver, false otherwise
  */
-bool bgf_write_msg(int32_t drv_fd, uint8_t msg_id, uint8_t msg_flag)
+static bool bgf_flush_buffer_write(int32_t drv_fd)
 {
 	int32_t ret = 0;
+	uint32_t count = bgf_write_count;
 
-	if (msg_id > BGF_NUM_MSG)
+	if (count == 0)
 	{
-		log_error("invalid BGF message id (%u)", msg_id);
-		return false;
+		return true;
 	}
 
-	bgf_msg[msg_id - 1].id = msg_id;
-	bgf_msg[msg_id - 1].id = msg_flag;
-
-	bgf_set_buffer_write(&bgf_msg[msg_id - 1]);
-	ret = drv_write_ser(drv_fd, serial_buffer_write, 1);
+	bgf_write_count = 0;
+	ret = drv_write_ser(drv_fd, serial_buffer_write, count);
+	PROBE2(serial_write, count, ret);
 	if (ret == DRV_ERROR)
 	{
-		log_error("error while writing BGF_%u message to driver", msg_id);
+		log_error("error while writing %u BGF messages to driver", count);
 		return false;
 	}
 
 	return true;
 }
 
-int32_t bgf_read_frames(int32_t drv_fd)
+/**
+ * \brief Queue a new message for a message id, replacing any outstanding one.
+ * \param msg_id : Message id to set and send
+ * \param msg_flag : Message flag to set and send
+ * \param now : Current time
+ */
+static void bgf_queue_msg(uint8_t msg_id, uint8_t msg_flag, timestamp_t now)
+{
+	bgf_outstanding_t *entry = &bgf_table[msg_id - 1];
+
+	entry->msg.id = msg_id;
+	entry->msg.flag = msg_flag;
+	entry->in_flight = true;
+	entry->retries = 0;
+	entry->sent_timestamp = now;
+	entry->retry_timestamp = now;
+	entry->retry_deadline = now + bgf_rto(entry);
+	entry->ack_deadline = now + BGF_ACK_WINDOW;
+	entry->stats.sent++;
+
+	PROBE3(bgf_send, msg_id, msg_flag, 0);
+	bgf_set_buffer_write(&entry->msg);
+}
+
+bool bgf_handle_frame(const serial_frame_t *frame, timestamp_t rx_timestamp)
 {
-	int32_t ret = 0;
-	int32_t count = 0;
-	uint32_t serial_data_len = 0;
 	bgf_msg_t msg_received;
+	bgf_outstanding_t *entry = NULL;
 	bool same_msg = false;
 
-	ret = drv_read_ser(drv_fd, serial_buffer_read, &serial_data_len);
-	if (ret == DRV_ERROR)
+	if ((frame->serNum != BGF_SERIAL_CHANNEL + 1) || (frame->frameSize != BGF_SERIAL_FRAME_SIZE))
 	{
-		log_error("error while reading from driver", NULL);
-		return DRV_ERROR;
+		return false;
 	}
 
-	/* Try to pull all available BGF messages */
-	while ((serial_data_len > 0) && (serial_buffer_read[BGF_SERIAL_CHANNEL].frameSize == BGF_SERIAL_FRAME_SIZE))
+	msg_received.id = frame->frame[0];
+	msg_received.flag = frame->frame[1];
+
+	/* Check for acknowledgement */
+	same_msg = bgf_check_msg_received(&msg_received);
+	if (same_msg == true)
 	{
-		count++;
-		msg_received.id = serial_buffer_read[BGF_SERIAL_CHANNEL].frame[0];
-		msg_received.flag = serial_buffer_read[BGF_SERIAL_CHANNEL].frame[1];
+		entry = &bgf_table[msg_received.id - 1];
+		if (entry->in_flight == true)
+		{
+			/* Karn's algorithm: no RTT sample from retransmitted messages, nor from messages resumed after a restart */
+			if ((entry->retries == 0) && (entry->sent_timestamp != TIMESTAMP_NONE))
+			{
+				bgf_rtt_update(entry, timestamp_elapsed(entry->sent_timestamp, rx_timestamp));
+			}
+			entry->in_flight = false;
+			entry->stats.acked++;
+			PROBE3(bgf_ack, msg_received.id, msg_received.flag, timestamp_elapsed(entry->sent_timestamp, rx_timestamp));
+		}
+		bgf_set_bit_ack(&msg_received, rx_timestamp);
+	}
+
+	return same_msg;
+}
 
-		/* Check for acknowledgement */
-		same_msg = bgf_check_msg_received(&msg_received);
-		if (same_msg == true)
+void bgf_ack_latency_update(void)
+{
+	bit_flag_t bit_flag_actual = get_bit_flag_bgf_ack();
+	bit_flag_t consumed = bgf_ack_pending & (bit_flag_t)~bit_flag_actual;
+	timestamp_t now = TIMESTAMP_NONE;
+
+	if (consumed == 0)
+	{
+		return;
+	}
+
+	/* Acknowledgement bits cleared by FSMs since reception */
+	now = timestamp_now();
+	for (uint8_t i = 0; i < BGF_NUM_MSG; i++)
+	{
+		if ((consumed & bgf_ack_bits[i]) != 0)
 		{
-			bgf_set_bit_ack(&msg_received);
-			log_info("Bit set", NULL);
+			metrics_record(METRIC_BGF_ACK_TO_STATE_CHANGE, timestamp_elapsed(bgf_ack_timestamp[i], now));
 		}
+	}
+	bgf_ack_pending &= (bit_flag_t)~consumed;
+}
+
+int32_t bgf_retry_frames(int32_t drv_fd)
+{
+	bgf_outstanding_t *entry = NULL;
+	timestamp_t now = timestamp_now();
+	timestamp_t backoff = 0;
+	int32_t retried = 0;
 
-		/* Continue reading next available message */
-		ret = drv_read_ser(drv_fd, serial_buffer_read, &serial_data_len);
-		if (ret == DRV_ERROR)
+	for (uint8_t i = 0; i < BGF_NUM_MSG; i++)
+	{
+		entry = &bgf_table[i];
+		if ((entry->in_flight == false) || (now < entry->retry_deadline))
+		{
+			continue;
+		}
+
+		if ((entry->retries >= BGF_MAX_RETRIES) || (now >= entry->ack_deadline))
+		{
+			log_warn("BGF_%u message not acknowledged after %u retries", entry->msg.id, entry->retries);
+			entry->in_flight = false;
+			entry->stats.expired++;
+			continue;
+		}
+
+		/* Exponential backoff on each retransmission, bounded, last deadline at the end of the window */
+		entry->retries++;
+		entry->retry_timestamp = now;
+		backoff = bgf_rto(entry) << entry->retries;
+		if (backoff > BGF_RTO_MAX)
 		{
-			log_error("error while reading from driver", NULL);
-			return DRV_ERROR;
+			backoff = BGF_RTO_MAX;
 		}
+		entry->retry_deadline = now + backoff;
+		if (entry->retry_deadline > entry->ack_deadline)
+		{
+			entry->retry_deadline = entry->ack_deadline;
+		}
+		entry->stats.retries++;
+		PROBE3(bgf_send, entry->msg.id, entry->msg.flag, entry->retries);
+		bgf_set_buffer_write(&entry->msg);
+		retried++;
 	}
 
-	return count;
+	if (bgf_flush_buffer_write(drv_fd) == false)
+	{
+		return DRV_ERROR;
+	}
+
+	return retried;
 }
 
 int32_t bgf_write_frames(int32_t drv_fd)
 {
-	bool success = false;
-	int32_t errors = 0;
-	flag_t flag_position_light_new = get_flag_position_light();
-	flag_t flag_crossing_light_new = get_flag_crossing_light();
-	flag_t flag_highbeam_light_new = get_flag_highbeam_light();
-	flag_t flag_indic_right_new = get_flag_indic_right();
-	flag_t flag_indic_left_new = get_flag_indic_left();
+	timestamp_t now = timestamp_now();
+	int32_t count = 0;
+	flag_t flags_new[BGF_NUM_MSG] = {
+		get_flag_position_light(), /* BCGV_BGF_MSG_ID_1 */
+		get_flag_crossing_light(), /* BCGV_BGF_MSG_ID_2 */
+		get_flag_highbeam_light(), /* BCGV_BGF_MSG_ID_3 */
+		get_flag_indic_right(),	   /* BCGV_BGF_MSG_ID_4 */
+		get_flag_indic_left(),	   /* BCGV_BGF_MSG_ID_5 */
+	};
 
-	/* Send serial message only if flags are different */
-	if (flag_position_light_new != flag_position_light_saved)
+	/* Send serial message only if flags are different from last message sent */
+	for (uint8_t i = 0; i < BGF_NUM_MSG; i++)
 	{
-		success = bgf_write_msg(drv_fd, BCGV_BGF_MSG_ID_1, flag_position_light_new);
-		if (success == false)
+		if (flags_new[i] != bgf_table[i].msg.flag)
 		{
-			errors++;
+			bgf_queue_msg(i + 1, flags_new[i], now);
+			count++;
 		}
 	}
-	if (flag_crossing_light_new != flag_crossing_light_saved)
+
+	if (bgf_flush_buffer_write(drv_fd) == false)
 	{
-		success = bgf_write_msg(drv_fd, BCGV_BGF_MSG_ID_2, flag_crossing_light_new);
-		if (success == false)
-		{
-			errors++;
-		}
+		return DRV_ERROR;
 	}
-	if (flag_highbeam_light_new != flag_highbeam_light_saved)
+
+	/* Measure age of the command which triggered these messages */
+	if ((count > 0) && (comodo_get_decoded_timestamp() != TIMESTAMP_NONE))
 	{
-		success = bgf_write_msg(drv_fd, BCGV_BGF_MSG_ID_3, flag_highbeam_light_new);
-		if (success == false)
-		{
-			errors++;
-		}
+		metrics_record(METRIC_COMODO_AGE_AT_BGF_WRITE,
+					   timestamp_elapsed(comodo_get_decoded_timestamp(), timestamp_now()));
 	}
-	if (flag_indic_right_new != flag_indic_right_saved)
+
+	return count;
+}
+
+void bgf_get_msg_stats(uint8_t msg_id, bgf_msg_stats_t *stats)
+{
+	if ((msg_id == 0) || (msg_id > BGF_NUM_MSG) || (stats == NULL))
 	{
-		success = bgf_write_msg(drv_fd, BCGV_BGF_MSG_ID_4, flag_indic_right_new);
-		if (success == false)
-		{
-			errors++;
-		}
+		return;
+	}
+
+	*stats = bgf_table[msg_id - 1].stats;
+	stats->in_flight = bgf_table[msg_id - 1].in_flight;
+}
+
+void bgf_save(bgf_saved_msg_t *saved)
+{
+	for (uint8_t i = 0; i < BGF_NUM_MSG; i++)
+	{
+		saved[i].id = bgf_table[i].msg.id;
+		saved[i].flag = bgf_table[i].msg.flag;
+		saved[i].in_flight = (uint8_t)bgf_table[i].in_flight;
+		saved[i].retries = bgf_table[i].retries;
 	}
-	if (flag_indic_left_new != flag_indic_left_saved)
+}
+
+void bgf_restore(const bgf_saved_msg_t *saved)
+{
+	bgf_outstanding_t *entry = NULL;
+	timestamp_t now = timestamp_now();
+
+	for (uint8_t i = 0; i < BGF_NUM_MSG; i++)
 	{
-		success = bgf_write_msg(drv_fd, BCGV_BGF_MSG_ID_5, flag_indic_left_new);
-		if (success == false)
+		if (((saved[i].id != 0) && (saved[i].id != i + 1)) || (saved[i].flag > 1) ||
+			(saved[i].retries > BGF_MAX_RETRIES))
 		{
-			errors++;
+			continue;
 		}
-	}
 
-	return errors;
+		entry = &bgf_table[i];
+		entry->msg.id = saved[i].id;
+		entry->msg.flag = saved[i].flag;
+		entry->in_flight = (saved[i].id != 0) && (saved[i].in_flight != 0);
+		entry->retries = saved[i].retries;
+
+		/* Time of first transmission unknown: retransmit now, without RTT sample, in a new window */
+		entry->sent_timestamp = TIMESTAMP_NONE;
+		entry->retry_timestamp = now;
+		entry->retry_deadline = now;
+		entry->ack_deadline = now + BGF_ACK_WINDOW;
+	}
 }
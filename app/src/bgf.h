@@ -1,7 +1,7 @@
 /**
  * \file bgf.h
  * \brief Interface of BGF system.
- * \details Read and write serial frames of BGF from driver.
+ * \details Handle serial frames received from BGF and write serial frames to driver.
  * \author Melvyn MUNOZ
  */
 
@@ -10,22 +10,91 @@
 
 /***** Includes **************************************************************/
 
+#include "drv_api.h"
 #include "bcgv_api.h"
+#include "timestamp.h"
+
+/***** Definitions ***********************************************************/
+
+#define BGF_NUM_MSG (5)
+
+/* Statistics of one BGF message id */
+typedef struct
+{
+	uint32_t sent;		   /* New messages sent */
+	uint32_t retries;	   /* Retransmissions */
+	uint32_t acked;		   /* Messages acknowledged */
+	uint32_t expired;	   /* Messages given up after last retransmission */
+	uint32_t rtt_count;	   /* Round trip time samples */
+	timestamp_t rtt_min;   /* Minimum round trip time (ns) */
+	timestamp_t rtt_max;   /* Maximum round trip time (ns) */
+	timestamp_t srtt;	   /* Smoothed round trip time (ns) */
+	bool in_flight;		   /* Last message not acknowledged yet */
+} bgf_msg_stats_t;
+
+/* Saved state of one BGF message id, for a warm restart */
+typedef struct
+{
+	uint8_t id;		   /* Id of last message sent, 0 if none */
+	uint8_t flag;	   /* Flag of last message sent */
+	uint8_t in_flight; /* Last message not acknowledged yet */
+	uint8_t retries;   /* Retransmissions of last message */
+} bgf_saved_msg_t;
 
 /***** Functions *************************************************************/
 
 /**
- * \brief Read all available serial frames for BGF.
- * \param drv_fd : Driver file descriptor.
- * \return int32_t : Number of serial read, or -1 if an error occured
+ * \brief Handle one received serial frame, setting acknowledgement bit if it acknowledges the last message sent.
+ * \param frame : Received serial frame, ignored if not from BGF
+ * \param rx_timestamp : Reception time of the frame
+ * \return bool : true if the frame is an acknowledgement, false otherwise
  */
-int32_t bgf_read_frames(int32_t drv_fd);
+bool bgf_handle_frame(const serial_frame_t *frame, timestamp_t rx_timestamp);
+
+/**
+ * \brief Measure acknowledgement to FSM state change latency.
+ * \details To call after FSM executions: acknowledgement bits cleared by FSMs since their reception are recorded.
+ */
+void bgf_ack_latency_update(void);
 
 /**
  * \brief Write all necessary messages as serial frames.
+ * \details A message is sent for each flag which differs from the last message sent with the same id.
+ *          All messages are written in a single driver call.
  * \param drv_fd : Driver file descriptor.
- * \return int32_t : Number of errors while writing
+ * \return int32_t : Number of messages written, or DRV_ERROR if an error occured
  */
 int32_t bgf_write_frames(int32_t drv_fd);
 
+/**
+ * \brief Retransmit messages whose acknowledgement deadline has expired.
+ * \details Each message id is retried independently, with an exponential backoff of its
+ *          retransmission timeout bounded by BGF_RTO_MAX, and given up after BGF_MAX_RETRIES
+ *          retransmissions or at the end of the 1 second acknowledgement window of the FSMs.
+ * \param drv_fd : Driver file descriptor.
+ * \return int32_t : Number of messages retransmitted, or DRV_ERROR if an error occured
+ */
+int32_t bgf_retry_frames(int32_t drv_fd);
+
+/**
+ * \brief Get statistics of a message id.
+ * \param msg_id : Message id (1 to BGF_NUM_MSG)
+ * \param stats : Output statistics
+ */
+void bgf_get_msg_stats(uint8_t msg_id, bgf_msg_stats_t *stats);
+
+/**
+ * \brief Save the last message sent of each message id, for a warm restart.
+ * \param saved : Output saved messages, BGF_NUM_MSG entries indexed by message id - 1
+ */
+void bgf_save(bgf_saved_msg_t *saved);
+
+/**
+ * \brief Resume the outstanding message table from saved messages, before the first cycle.
+ * \details Flags already sent are not sent again. Messages still in flight are retransmitted at the next
+ *          retry pass, with their retransmission count kept. Statistics and RTT estimates start over.
+ * \param saved : Saved messages, BGF_NUM_MSG entries indexed by message id - 1, invalid entries ignored
+ */
+void bgf_restore(const bgf_saved_msg_t *saved);
+
 #endif /* BGF_H */
@@ -0,0 +1,310 @@
+/**
+ * \file checkpoint.c
+ * \brief Implementation of the application state checkpoint.
+ * \details A save fills the slot of the next image number: it clears the slot sequence, copies the state,
+ *          computes its CRC and publishes the slot by storing its sequence last. A restore keeps the slot with
+ *          the highest sequence whose CRC matches, a slot interrupted by a crash has a null sequence.
+ * \author Raphael CAUSSE
+ */
+
+/***** Includes **************************************************************/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stddef.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#include "checkpoint.h"
+#include "bcgv_api.h"
+#include "mux.h"
+#include "crc8.h"
+#include "log.h"
+#include "timestamp.h"
+#include "fsm_lights.h"
+#include "fsm_indicators.h"
+#include "fsm_windshield_washer.h"
+
+/***** Static Variables ******************************************************/
+
+static checkpoint_image_t *checkpoint_image = NULL; /* Mapped file, NULL until opened */
+static uint64_t checkpoint_seq = 0;                /* Number of the last image written */
+
+static const char *const checkpoint_fsm_names[CHECKPOINT_FSM_COUNT] = {
+    "lights",
+    "indicators",
+    "windshield washer",
+};
+
+/***** Static Functions ******************************************************/
+
+/**
+ * \brief Get the wall clock time.
+ * \return uint64_t : Time (ns since the Epoch)
+ */
+static uint64_t checkpoint_wall_time(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_REALTIME, &ts);
+
+    return (uint64_t)ts.tv_sec * TIMESTAMP_NS_PER_S + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * \brief Compute the CRC of a slot.
+ * \param slot : Slot
+ * \return uint8_t : CRC8 of the wall time and state
+ */
+static uint8_t checkpoint_crc(const checkpoint_slot_t *slot)
+{
+    return crc8_compute((const uint8_t *)&slot->wall_time,
+                        offsetof(checkpoint_slot_t, crc) - offsetof(checkpoint_slot_t, wall_time));
+}
+
+/**
+ * \brief Reset an image, without any valid slot.
+ * \param image : Image
+ */
+static void checkpoint_reset(checkpoint_image_t *image)
+{
+    memset(image, 0, sizeof(checkpoint_image_t));
+    memcpy(image->header.magic, CHECKPOINT_MAGIC, sizeof(image->header.magic));
+    image->header.version = CHECKPOINT_VERSION;
+    image->header.slot_size = sizeof(checkpoint_slot_t);
+}
+
+/**
+ * \brief Find the newest valid slot.
+ * \param image : Image
+ * \return const checkpoint_slot_t* : Slot, NULL if none
+ */
+static const checkpoint_slot_t *checkpoint_newest(const checkpoint_image_t *image)
+{
+    const checkpoint_slot_t *newest = NULL;
+    const checkpoint_slot_t *slot = NULL;
+
+    for (uint32_t i = 0; i < CHECKPOINT_SLOTS; i++)
+    {
+        slot = &image->slots[i];
+        if ((slot->seq == 0) || (slot->crc != checkpoint_crc(slot)))
+        {
+            continue;
+        }
+        if ((newest == NULL) || (slot->seq > newest->seq))
+        {
+            newest = slot;
+        }
+    }
+
+    return newest;
+}
+
+/**
+ * \brief Apply a saved state to the context and modules.
+ * \param state : Saved state
+ */
+static void checkpoint_apply(const checkpoint_state_t *state)
+{
+    bool resumed[CHECKPOINT_FSM_COUNT];
+
+    set_distance(state->distance);
+    set_engine_rpm(state->engine_rpm);
+    set_cmds(state->cmds);
+    set_flags(state->flags);
+    set_frame_number(state->frame_number);
+    set_speed(state->speed);
+    set_chassis_issues(state->chassis_issues);
+    set_motor_issues(state->motor_issues);
+    set_fuel_level(state->fuel_level);
+    set_battery_issues(state->battery_issues);
+    set_crc8(state->crc8);
+    set_bit_flag_bgf_ack(state->bgf_ack);
+
+    if (mux_set_expected_frame_number(state->expected_frame_number) == false)
+    {
+        log_warn("checkpoint: invalid expected frame number %u", state->expected_frame_number);
+    }
+
+    resumed[CHECKPOINT_FSM_LIGHTS] = fsm_lights_restore(state->fsm_states[CHECKPOINT_FSM_LIGHTS],
+                                                        state->fsm_timers[CHECKPOINT_FSM_LIGHTS]);
+    resumed[CHECKPOINT_FSM_INDICATORS] = fsm_indicators_restore(state->fsm_states[CHECKPOINT_FSM_INDICATORS],
+                                                                state->fsm_timers[CHECKPOINT_FSM_INDICATORS]);
+    resumed[CHECKPOINT_FSM_WINDSHIELD_WASHER] =
+        fsm_windshield_washer_restore(state->fsm_states[CHECKPOINT_FSM_WINDSHIELD_WASHER],
+                                      state->fsm_timers[CHECKPOINT_FSM_WINDSHIELD_WASHER]);
+    for (uint32_t i = 0; i < CHECKPOINT_FSM_COUNT; i++)
+    {
+        if (resumed[i] == false)
+        {
+            log_warn("checkpoint: %s FSM not resumed from state %u", checkpoint_fsm_names[i], state->fsm_states[i]);
+        }
+    }
+
+    bgf_restore(state->bgf);
+}
+
+/***** Functions *************************************************************/
+
+bool checkpoint_open(const char *path)
+{
+    int fd = -1;
+    void *map = NULL;
+    struct stat st;
+    bool reset = false;
+    const checkpoint_slot_t *newest = NULL;
+
+    fd = open(path, O_RDWR | O_CREAT, 0644);
+    if (fd == -1)
+    {
+        log_error("cannot open checkpoint %s: %s", path, strerror(errno));
+        return false;
+    }
+    if (fstat(fd, &st) != 0)
+    {
+        log_error("cannot stat checkpoint %s: %s", path, strerror(errno));
+        close(fd);
+        return false;
+    }
+    if (st.st_size != (off_t)sizeof(checkpoint_image_t))
+    {
+        reset = true;
+        if (ftruncate(fd, sizeof(checkpoint_image_t)) != 0)
+        {
+            log_error("cannot size checkpoint %s: %s", path, strerror(errno));
+            close(fd);
+            return false;
+        }
+    }
+
+    /* Shared mapping: images reach the file through the page cache, without write calls */
+    map = mmap(NULL, sizeof(checkpoint_image_t), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+    {
+        log_error("cannot map checkpoint %s: %s", path, strerror(errno));
+        return false;
+    }
+
+    checkpoint_close();
+    checkpoint_image = (checkpoint_image_t *)map;
+
+    if ((reset == false) &&
+        ((memcmp(checkpoint_image->header.magic, CHECKPOINT_MAGIC, sizeof(checkpoint_image->header.magic)) != 0) ||
+         (checkpoint_image->header.version != CHECKPOINT_VERSION) ||
+         (checkpoint_image->header.slot_size != sizeof(checkpoint_slot_t))))
+    {
+        log_warn("checkpoint %s is not of this version, reset", path);
+        reset = true;
+    }
+    if (reset == true)
+    {
+        checkpoint_reset(checkpoint_image);
+    }
+
+    /* Continue numbering after the newest image, so that it stays the newest until overwritten */
+    newest = checkpoint_newest(checkpoint_image);
+    checkpoint_seq = (newest != NULL) ? newest->seq : 0;
+
+    return true;
+}
+
+bool checkpoint_restore(void)
+{
+    const checkpoint_slot_t *newest = NULL;
+    checkpoint_slot_t slot;
+    uint64_t now = 0;
+    uint64_t age = 0;
+
+    if (checkpoint_image == NULL)
+    {
+        return false;
+    }
+
+    newest = checkpoint_newest(checkpoint_image);
+    if (newest == NULL)
+    {
+        log_info("no valid checkpoint, cold start", NULL);
+        return false;
+    }
+    slot = *newest;
+
+    now = checkpoint_wall_time();
+    if (slot.wall_time > now)
+    {
+        log_info("checkpoint from the future, cold start", NULL);
+        return false;
+    }
+    age = (now - slot.wall_time) / TIMESTAMP_NS_PER_MS;
+    if (age > CHECKPOINT_MAX_AGE_MS)
+    {
+        log_info("checkpoint %llu ms old, cold start", (unsigned long long)age);
+        return false;
+    }
+
+    checkpoint_apply(&slot.state);
+    log_info("warm restart from checkpoint %llu, %llu ms old", (unsigned long long)slot.seq, (unsigned long long)age);
+
+    return true;
+}
+
+void checkpoint_save(void)
+{
+    checkpoint_slot_t *slot = NULL;
+    checkpoint_state_t *state = NULL;
+    uint64_t seq = 0;
+
+    if (checkpoint_image == NULL)
+    {
+        return;
+    }
+
+    seq = checkpoint_seq + 1;
+    slot = &checkpoint_image->slots[seq % CHECKPOINT_SLOTS];
+    state = &slot->state;
+
+    __atomic_store_n(&slot->seq, 0, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    slot->wall_time = checkpoint_wall_time();
+    state->distance = get_distance();
+    state->engine_rpm = get_engine_rpm();
+    state->cmds = get_cmds();
+    state->flags = get_flags();
+    state->frame_number = get_frame_number();
+    state->speed = get_speed();
+    state->chassis_issues = get_chassis_issues();
+    state->motor_issues = get_motor_issues();
+    state->fuel_level = get_fuel_level();
+    state->battery_issues = get_battery_issues();
+    state->crc8 = get_crc8();
+    state->bgf_ack = get_bit_flag_bgf_ack();
+    state->expected_frame_number = mux_get_expected_frame_number();
+    state->reserved = 0;
+    fsm_lights_save(&state->fsm_states[CHECKPOINT_FSM_LIGHTS], &state->fsm_timers[CHECKPOINT_FSM_LIGHTS]);
+    fsm_indicators_save(&state->fsm_states[CHECKPOINT_FSM_INDICATORS],
+                        &state->fsm_timers[CHECKPOINT_FSM_INDICATORS]);
+    fsm_windshield_washer_save(&state->fsm_states[CHECKPOINT_FSM_WINDSHIELD_WASHER],
+                               &state->fsm_timers[CHECKPOINT_FSM_WINDSHIELD_WASHER]);
+    bgf_save(state->bgf);
+    slot->crc = checkpoint_crc(slot);
+
+    __atomic_store_n(&slot->seq, seq, __ATOMIC_RELEASE);
+    checkpoint_seq = seq;
+}
+
+void checkpoint_close(void)
+{
+    if (checkpoint_image == NULL)
+    {
+        return;
+    }
+
+    msync(checkpoint_image, sizeof(checkpoint_image_t), MS_SYNC);
+    munmap(checkpoint_image, sizeof(checkpoint_image_t));
+    checkpoint_image = NULL;
+}
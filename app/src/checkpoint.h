@@ -0,0 +1,119 @@
+/**
+ * \file checkpoint.h
+ * \brief Interface of the application state checkpoint.
+ * \details At the end of each cycle, the state needed to resume the application (context, FSM states and
+ *          timers, expected MUX frame number, last BGF messages sent) is copied to an image mapped from a file,
+ *          without any system call. After a crash or a restart, the image is restored at startup if it is valid
+ *          and recent, so that the lights stay on and BGF messages already acknowledged are not sent again.
+ *          The image holds two slots written alternately: a crash while writing one leaves the other intact.
+ *
+ *          File layout, host byte order (restore on the same architecture):
+ *          - Header (checkpoint_header_t)
+ *          - CHECKPOINT_SLOTS slots (checkpoint_slot_t), image n in slot n % CHECKPOINT_SLOTS
+ * \author Raphael CAUSSE
+ */
+
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+/***** Includes **************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "bgf.h"
+
+/***** Definitions ***********************************************************/
+
+#define CHECKPOINT_MAGIC "BCKP"
+#define CHECKPOINT_VERSION (1)
+#define CHECKPOINT_SLOTS (2)
+#define CHECKPOINT_MAX_AGE_MS (5000) /* Older images describe a stale vehicle state and are not restored */
+
+/* FSMs saved */
+typedef enum
+{
+    CHECKPOINT_FSM_LIGHTS = 0,
+    CHECKPOINT_FSM_INDICATORS,
+    CHECKPOINT_FSM_WINDSHIELD_WASHER,
+    CHECKPOINT_FSM_COUNT
+} checkpoint_fsm_t;
+
+/* Application state, 48 bytes */
+typedef struct
+{
+    uint32_t distance;
+    uint32_t engine_rpm;
+    uint8_t cmds;                  /* See cmd_bit_t */
+    uint8_t flags;                 /* See flag_bit_t */
+    uint8_t frame_number;
+    uint8_t speed;
+    uint8_t chassis_issues;
+    uint8_t motor_issues;
+    uint8_t fuel_level;
+    uint8_t battery_issues;
+    uint8_t crc8;
+    uint8_t bgf_ack;               /* Acknowledgement bits */
+    uint8_t expected_frame_number; /* Next MUX frame number expected */
+    uint8_t reserved;
+    uint8_t fsm_states[CHECKPOINT_FSM_COUNT];
+    uint8_t fsm_timers[CHECKPOINT_FSM_COUNT];
+    bgf_saved_msg_t bgf[BGF_NUM_MSG]; /* Indexed by message id - 1 */
+} checkpoint_state_t;
+
+/* Slot, 72 bytes */
+typedef struct
+{
+    uint64_t seq;             /* Image number, 0 while being written */
+    uint64_t wall_time;       /* Wall clock time of the image (ns since the Epoch) */
+    checkpoint_state_t state;
+    uint8_t crc;              /* CRC8 of the wall time and state */
+    uint8_t reserved[7];
+} checkpoint_slot_t;
+
+/* File header, 16 bytes */
+typedef struct
+{
+    char magic[4];      /* CHECKPOINT_MAGIC */
+    uint16_t version;   /* CHECKPOINT_VERSION */
+    uint16_t slot_size; /* sizeof(checkpoint_slot_t) */
+    uint64_t reserved;
+} checkpoint_header_t;
+
+/* Whole image, as mapped from the file */
+typedef struct
+{
+    checkpoint_header_t header;
+    checkpoint_slot_t slots[CHECKPOINT_SLOTS];
+} checkpoint_image_t;
+
+/***** Functions *************************************************************/
+
+/**
+ * \brief Map the checkpoint image from a file, created if it does not exist.
+ * \details A file of another size or version is reset. Use a file in /dev/shm to keep the image in memory
+ *          only, it then survives a crash or a restart of the application but not a reboot.
+ * \param path : File path
+ * \return bool : true on success, false otherwise
+ */
+bool checkpoint_open(const char *path);
+
+/**
+ * \brief Restore the application state from the newest valid image, at startup before the first cycle.
+ * \details An image older than CHECKPOINT_MAX_AGE_MS is ignored, the application then starts from its
+ *          initial state. The outcome is logged.
+ * \return bool : true if the state was restored, false otherwise
+ */
+bool checkpoint_restore(void);
+
+/**
+ * \brief Save the application state, at the end of each cycle under the context lock.
+ * \details Does nothing until opened.
+ */
+void checkpoint_save(void);
+
+/**
+ * \brief Flush and unmap the checkpoint image, the file is kept for the next start.
+ */
+void checkpoint_close(void);
+
+#endif /* CHECKPOINT_H */
@@ -1,7 +1,7 @@
 /**
  * \file comodo.h
  * \brief Interface of COMODO system.
- * \details Read and write serial frames OF COMODO from driver, decode COMODO frames.
+ * \details Handle serial frames received from COMODO, decode COMODO frames.
  * \author Raphael CAUSSE - Melvyn MUNOZ - Roland Cedric TAYO
  */
 
@@ -10,11 +10,18 @@
 
 /***** Includes **************************************************************/
 
+#include "drv_api.h"
 #include "bcgv_api.h"
+#include "timestamp.h"
 
 /***** Functions *************************************************************/
 
-bool comodo_read_frame_500ms(int32_t drv_fd);
+/**
+ * \brief Handle one received serial frame, keeping it for next decoding if it comes from COMODO.
+ * \param frame : Received serial frame, ignored if not from COMODO
+ * \param rx_timestamp : Reception time of the frame
+ */
+void comodo_handle_frame(const serial_frame_t *frame, timestamp_t rx_timestamp);
 
 /**
  * \brief Decode the COMODO serial frame and update application data.
@@ -23,8 +30,9 @@ bool comodo_read_frame_500ms(int32_t drv_fd);
 bool comodo_decode_frame(void);
 
 /**
- * \brief Print decoded data extracted from COMODO serial frame.
+ * \brief Get the reception time of the COMODO commands currently stored in app context.
+ * \return timestamp_t : Reception time of the frame, TIMESTAMP_NONE if no frame received yet
  */
-void comodo_print_decoded(void);
+timestamp_t comodo_get_decoded_timestamp(void);
 
 #endif /* COMODO_H */
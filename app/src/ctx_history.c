@@ -0,0 +1,526 @@
+/**
+ * \file ctx_history.c
+ * \brief Implementation of application context history.
+ * \details One entry per cycle: the mask of fields stored for the cycle and their values in a byte pool,
+ *          the fields changed since the previous cycle, or all of them every CTX_HISTORY_KEYFRAME_PERIOD
+ *          cycles. The values at the oldest kept cycle are maintained as entries are dropped, so a query
+ *          reads at most one keyframe period of entries.
+ * \author Raphael CAUSSE
+ */
+
+/***** Includes **************************************************************/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include "ctx_history.h"
+#include "bcgv_api.h"
+#include "fsm_lights.h"
+#include "fsm_indicators.h"
+#include "fsm_windshield_washer.h"
+#include "log.h"
+#include "rt_profile.h"
+
+/***** Definitions ***********************************************************/
+
+#define CTX_HISTORY_POOL_MASK (CTX_HISTORY_POOL_SIZE - 1)
+#define CTX_HISTORY_ALL_FIELDS ((1u << CTX_FIELD_COUNT) - 1)
+
+/* One recorded cycle */
+typedef struct
+{
+    uint16_t stored;  /* Fields whose value is stored in the pool */
+    uint16_t changed; /* Fields changed since the previous cycle */
+    uint16_t offset;  /* Pool offset of the first stored value */
+} ctx_history_entry_t;
+
+/* History ring */
+typedef struct
+{
+    ctx_history_entry_t entries[CTX_HISTORY_DEPTH];
+    uint8_t pool[CTX_HISTORY_POOL_SIZE]; /* Stored values, little endian, in field order */
+    uint32_t base[CTX_FIELD_COUNT];      /* Values at the oldest kept cycle */
+    uint32_t first;                      /* Entry of the oldest kept cycle */
+    uint32_t count;                      /* Kept cycles */
+    uint32_t first_cycle;                /* History cycle of the oldest kept cycle */
+    uint32_t pool_head;                  /* Pool offset of the oldest stored value */
+    uint32_t pool_used;                  /* Bytes used in pool */
+} ctx_history_ring_t;
+
+/***** Static Variables ******************************************************/
+
+static const uint8_t ctx_field_sizes[CTX_FIELD_COUNT] = {1, 4, 1, 1, 1, 1, 4, 1, 1, 1, 1, 1, 1, 1, 1};
+
+static const char *const ctx_field_names[CTX_FIELD_COUNT] = {
+    "frame_number",
+    "distance",
+    "speed",
+    "chassis_issues",
+    "motor_issues",
+    "fuel_level",
+    "engine_rpm",
+    "battery_issues",
+    "crc8",
+    "cmds",
+    "flags",
+    "bgf_ack",
+    "fsm_lights",
+    "fsm_indicators",
+    "fsm_windshield_washer",
+};
+
+/* Owned by the main loop */
+static ctx_history_ring_t ctx_history;
+static uint32_t ctx_history_values[CTX_FIELD_COUNT]; /* Values at the newest cycle */
+static ctx_history_change_t ctx_history_changes[CTX_FIELD_COUNT];
+static uint32_t ctx_history_cycle = 0; /* History cycle of the next record, cycles recorded */
+
+static pthread_t ctx_history_thread;
+static pthread_mutex_t ctx_history_mutex; /* Priority inheritance, locked by the main loop on a fault */
+static pthread_cond_t ctx_history_cond = PTHREAD_COND_INITIALIZER;
+static volatile bool ctx_history_running = false;
+static const char *ctx_history_path = NULL;
+
+/* Dump request, shared with the main loop */
+static ctx_history_ring_t ctx_history_pending;
+static const char *ctx_history_pending_reason = NULL;
+static bool ctx_history_dump_pending = false;
+static ctx_history_stats_t ctx_history_stats;
+
+/* Owned by the dump thread */
+static ctx_history_ring_t ctx_history_dumped;
+
+/***** Static Functions ******************************************************/
+
+/**
+ * \brief Read the fields of the application context.
+ * \param values : Output values, one per field
+ */
+static void ctx_history_read_context(uint32_t values[CTX_FIELD_COUNT])
+{
+    values[CTX_FIELD_FRAME_NUMBER] = get_frame_number();
+    values[CTX_FIELD_DISTANCE] = get_distance();
+    values[CTX_FIELD_SPEED] = get_speed();
+    values[CTX_FIELD_CHASSIS_ISSUES] = get_chassis_issues();
+    values[CTX_FIELD_MOTOR_ISSUES] = get_motor_issues();
+    values[CTX_FIELD_FUEL_LEVEL] = get_fuel_level();
+    values[CTX_FIELD_ENGINE_RPM] = get_engine_rpm();
+    values[CTX_FIELD_BATTERY_ISSUES] = get_battery_issues();
+    values[CTX_FIELD_CRC8] = get_crc8();
+    values[CTX_FIELD_CMDS] = get_cmds();
+    values[CTX_FIELD_FLAGS] = get_flags();
+    values[CTX_FIELD_BGF_ACK] = get_bit_flag_bgf_ack();
+    values[CTX_FIELD_FSM_LIGHTS] = (uint8_t)fsm_lights_get_state();
+    values[CTX_FIELD_FSM_INDICATORS] = (uint8_t)fsm_indicators_get_state();
+    values[CTX_FIELD_FSM_WINDSHIELD_WASHER] = (uint8_t)fsm_windshield_washer_get_state();
+}
+
+/**
+ * \brief Size of the values of a set of fields.
+ * \param fields : Fields, one bit per field
+ * \return uint32_t : Size in bytes.
+ */
+static uint32_t ctx_history_size(uint32_t fields)
+{
+    uint32_t size = 0;
+
+    for (uint32_t field = 0; field < CTX_FIELD_COUNT; field++)
+    {
+        if ((fields & (1u << field)) != 0)
+        {
+            size += ctx_field_sizes[field];
+        }
+    }
+
+    return size;
+}
+
+/**
+ * \brief Read a value from the pool.
+ * \param ring : History ring
+ * \param offset : Pool offset, wrapping
+ * \param size : Value size in bytes
+ * \return uint32_t : Value.
+ */
+static uint32_t ctx_history_pool_read(const ctx_history_ring_t *ring, uint32_t offset, uint32_t size)
+{
+    uint32_t value = 0;
+
+    for (uint32_t i = 0; i < size; i++)
+    {
+        value |= (uint32_t)ring->pool[(offset + i) & CTX_HISTORY_POOL_MASK] << (8 * i);
+    }
+
+    return value;
+}
+
+/**
+ * \brief Write a value to the pool.
+ * \param ring : History ring
+ * \param offset : Pool offset, wrapping
+ * \param value : Value
+ * \param size : Value size in bytes
+ */
+static void ctx_history_pool_write(ctx_history_ring_t *ring, uint32_t offset, uint32_t value, uint32_t size)
+{
+    for (uint32_t i = 0; i < size; i++)
+    {
+        ring->pool[(offset + i) & CTX_HISTORY_POOL_MASK] = (uint8_t)(value >> (8 * i));
+    }
+}
+
+/**
+ * \brief Apply the values stored by an entry.
+ * \param ring : History ring
+ * \param entry : Entry
+ * \param values : Values updated with the stored ones
+ */
+static void ctx_history_apply(const ctx_history_ring_t *ring, const ctx_history_entry_t *entry,
+                              uint32_t values[CTX_FIELD_COUNT])
+{
+    uint32_t offset = entry->offset;
+
+    for (uint32_t field = 0; field < CTX_FIELD_COUNT; field++)
+    {
+        if ((entry->stored & (1u << field)) != 0)
+        {
+            values[field] = ctx_history_pool_read(ring, offset, ctx_field_sizes[field]);
+            offset += ctx_field_sizes[field];
+        }
+    }
+}
+
+/**
+ * \brief Drop the oldest kept cycle.
+ * \param ring : History ring, not empty
+ */
+static void ctx_history_evict(ctx_history_ring_t *ring)
+{
+    uint32_t size = ctx_history_size(ring->entries[ring->first].stored);
+
+    ring->pool_head = (ring->pool_head + size) & CTX_HISTORY_POOL_MASK;
+    ring->pool_used -= size;
+    ring->first = (ring->first + 1) % CTX_HISTORY_DEPTH;
+    ring->first_cycle++;
+    ring->count--;
+
+    /* The next cycle becomes the oldest one, the base catches up with it */
+    if (ring->count > 0)
+    {
+        ctx_history_apply(ring, &ring->entries[ring->first], ring->base);
+    }
+}
+
+/**
+ * \brief Append a history to the dump file.
+ * \param ring : History ring, not empty
+ * \param reason : Reason of the dump
+ * \return bool : true on success, false otherwise
+ */
+static bool ctx_history_write(const ctx_history_ring_t *ring, const char *reason)
+{
+    uint32_t values[CTX_FIELD_COUNT];
+    FILE *file = NULL;
+    bool success = false;
+
+    file = fopen(ctx_history_path, "a");
+    if (file == NULL)
+    {
+        log_error("error while opening %s: %s", ctx_history_path, strerror(errno));
+        return false;
+    }
+
+    fprintf(file, "# %s, cycles %u to %u\ncycle", reason, ring->first_cycle, ring->first_cycle + ring->count - 1);
+    for (uint32_t field = 0; field < CTX_FIELD_COUNT; field++)
+    {
+        fprintf(file, ",%s", ctx_field_names[field]);
+    }
+    fputc('\n', file);
+
+    /* Rebuild every cycle from the oldest one */
+    memcpy(values, ring->base, sizeof(values));
+    for (uint32_t i = 0; i < ring->count; i++)
+    {
+        if (i > 0)
+        {
+            ctx_history_apply(ring, &ring->entries[(ring->first + i) % CTX_HISTORY_DEPTH], values);
+        }
+        fprintf(file, "%u", ring->first_cycle + i);
+        for (uint32_t field = 0; field < CTX_FIELD_COUNT; field++)
+        {
+            fprintf(file, ",%u", values[field]);
+        }
+        fputc('\n', file);
+    }
+
+    success = (ferror(file) == 0);
+    success = (fclose(file) == 0) && success;
+    if (success == false)
+    {
+        log_error("error while writing %s", ctx_history_path);
+    }
+
+    return success;
+}
+
+/**
+ * \brief Dump thread, writes the requested dumps.
+ * \param arg : Unused
+ * \return void* : Unused
+ */
+static void *ctx_history_thread_main(void *arg)
+{
+    const char *reason = NULL;
+    bool running = true;
+    bool dump = false;
+    bool success = false;
+
+    (void)arg;
+    while (running == true)
+    {
+        pthread_mutex_lock(&ctx_history_mutex);
+        while ((ctx_history_running == true) && (ctx_history_dump_pending == false))
+        {
+            pthread_cond_wait(&ctx_history_cond, &ctx_history_mutex);
+        }
+        running = ctx_history_running;
+        dump = ctx_history_dump_pending;
+        reason = ctx_history_pending_reason;
+        pthread_mutex_unlock(&ctx_history_mutex);
+
+        if (dump == true)
+        {
+            /* Copied outside the lock, the main loop leaves a pending request untouched */
+            ctx_history_dumped = ctx_history_pending;
+            pthread_mutex_lock(&ctx_history_mutex);
+            ctx_history_dump_pending = false;
+            pthread_mutex_unlock(&ctx_history_mutex);
+
+            success = ctx_history_write(&ctx_history_dumped, reason);
+
+            pthread_mutex_lock(&ctx_history_mutex);
+            if (success == true)
+            {
+                ctx_history_stats.dumps++;
+            }
+            else
+            {
+                ctx_history_stats.write_errors++;
+            }
+            pthread_mutex_unlock(&ctx_history_mutex);
+
+            if (success == true)
+            {
+                log_warn("context history dumped to %s: %s", ctx_history_path, reason);
+            }
+        }
+    }
+
+    return NULL;
+}
+
+/***** Functions *************************************************************/
+
+uint32_t ctx_history_record(void)
+{
+    ctx_history_ring_t *ring = &ctx_history;
+    ctx_history_entry_t *entry = NULL;
+    uint32_t values[CTX_FIELD_COUNT];
+    uint32_t changed = 0;
+    uint32_t stored = 0;
+    uint32_t size = 0;
+    uint32_t offset = 0;
+
+    ctx_history_read_context(values);
+    for (uint32_t field = 0; field < CTX_FIELD_COUNT; field++)
+    {
+        changed |= (uint32_t)(values[field] != ctx_history_values[field]) << field;
+    }
+    if (ctx_history_cycle == 0)
+    {
+        changed = CTX_HISTORY_ALL_FIELDS;
+    }
+
+    if (ring->count == CTX_HISTORY_DEPTH)
+    {
+        ctx_history_evict(ring);
+    }
+    stored = ((ctx_history_cycle % CTX_HISTORY_KEYFRAME_PERIOD) == 0) ? CTX_HISTORY_ALL_FIELDS : changed;
+    size = ctx_history_size(stored);
+    while ((ring->count > 0) && (ring->pool_used + size > CTX_HISTORY_POOL_SIZE))
+    {
+        ctx_history_evict(ring);
+    }
+
+    /* The oldest kept cycle is the base of the others */
+    if (ring->count == 0)
+    {
+        stored = CTX_HISTORY_ALL_FIELDS;
+        size = ctx_history_size(stored);
+        memcpy(ring->base, values, sizeof(values));
+        ring->first_cycle = ctx_history_cycle;
+    }
+
+    entry = &ring->entries[(ring->first + ring->count) % CTX_HISTORY_DEPTH];
+    entry->stored = (uint16_t)stored;
+    entry->changed = (uint16_t)changed;
+    entry->offset = (uint16_t)((ring->pool_head + ring->pool_used) & CTX_HISTORY_POOL_MASK);
+    offset = entry->offset;
+    for (uint32_t field = 0; field < CTX_FIELD_COUNT; field++)
+    {
+        if ((stored & (1u << field)) != 0)
+        {
+            ctx_history_pool_write(ring, offset, values[field], ctx_field_sizes[field]);
+            offset += ctx_field_sizes[field];
+        }
+    }
+    ring->pool_used += size;
+    ring->count++;
+
+    for (uint32_t field = 0; field < CTX_FIELD_COUNT; field++)
+    {
+        if ((changed & (1u << field)) != 0)
+        {
+            ctx_history_changes[field].cycle = ctx_history_cycle;
+            ctx_history_changes[field].before = ctx_history_values[field];
+            ctx_history_changes[field].after = values[field];
+        }
+    }
+    memcpy(ctx_history_values, values, sizeof(values));
+    ctx_history_cycle++;
+
+    return changed;
+}
+
+uint32_t ctx_history_newest_cycle(void)
+{
+    return ctx_history_cycle - 1;
+}
+
+bool ctx_history_value_at(ctx_field_t field, uint32_t cycle, uint32_t *value)
+{
+    const ctx_history_ring_t *ring = &ctx_history;
+    const ctx_history_entry_t *entry = NULL;
+    uint32_t offset = 0;
+
+    if ((field >= CTX_FIELD_COUNT) || (value == NULL) || (cycle - ring->first_cycle >= ring->count))
+    {
+        return false;
+    }
+
+    /* Walk back to the last cycle storing the field, at most one keyframe period */
+    for (uint32_t index = cycle - ring->first_cycle; index > 0; index--)
+    {
+        entry = &ring->entries[(ring->first + index) % CTX_HISTORY_DEPTH];
+        if ((entry->stored & (1u << field)) != 0)
+        {
+            offset = entry->offset + ctx_history_size(entry->stored & ((1u << field) - 1));
+            *value = ctx_history_pool_read(ring, offset, ctx_field_sizes[field]);
+            return true;
+        }
+    }
+    *value = ring->base[field];
+
+    return true;
+}
+
+bool ctx_history_last_change(ctx_field_t field, ctx_history_change_t *change)
+{
+    if ((field >= CTX_FIELD_COUNT) || (change == NULL) || (ctx_history_cycle == 0))
+    {
+        return false;
+    }
+    *change = ctx_history_changes[field];
+
+    return true;
+}
+
+const char *ctx_history_field_name(ctx_field_t field)
+{
+    return (field < CTX_FIELD_COUNT) ? ctx_field_names[field] : "unknown";
+}
+
+bool ctx_history_start(const char *path)
+{
+    pthread_attr_t thread_attr;
+    int ret = 0;
+
+    if (ctx_history_running == true)
+    {
+        return true;
+    }
+
+    ret = rt_profile_mutex_init(&ctx_history_mutex);
+    if (ret != 0)
+    {
+        log_error("error while creating context history mutex (%d)", ret);
+        return false;
+    }
+
+    ctx_history_path = path;
+    ctx_history_dump_pending = false;
+    ctx_history_running = true;
+    ret = rt_profile_helper_attr_init(&thread_attr);
+    if (ret == 0)
+    {
+        ret = pthread_create(&ctx_history_thread, &thread_attr, &ctx_history_thread_main, NULL);
+        pthread_attr_destroy(&thread_attr);
+    }
+    if (ret != 0)
+    {
+        log_error("error while creating context history thread (%d)", ret);
+        ctx_history_running = false;
+        pthread_mutex_destroy(&ctx_history_mutex);
+        return false;
+    }
+
+    return true;
+}
+
+void ctx_history_stop(void)
+{
+    if (ctx_history_running == true)
+    {
+        pthread_mutex_lock(&ctx_history_mutex);
+        ctx_history_running = false;
+        pthread_cond_signal(&ctx_history_cond);
+        pthread_mutex_unlock(&ctx_history_mutex);
+
+        pthread_join(ctx_history_thread, NULL);
+        pthread_mutex_destroy(&ctx_history_mutex);
+    }
+}
+
+void ctx_history_trigger(const char *reason)
+{
+    if ((ctx_history_running == false) || (ctx_history.count == 0))
+    {
+        return;
+    }
+
+    /* Only a copy in the loop, the dump thread formats and writes it */
+    pthread_mutex_lock(&ctx_history_mutex);
+    if (ctx_history_dump_pending == true)
+    {
+        ctx_history_stats.dropped++;
+    }
+    else
+    {
+        ctx_history_pending = ctx_history;
+        ctx_history_pending_reason = reason;
+        ctx_history_dump_pending = true;
+        pthread_cond_signal(&ctx_history_cond);
+    }
+    pthread_mutex_unlock(&ctx_history_mutex);
+}
+
+void ctx_history_get_stats(ctx_history_stats_t *stats)
+{
+    pthread_mutex_lock(&ctx_history_mutex);
+    *stats = ctx_history_stats;
+    pthread_mutex_unlock(&ctx_history_mutex);
+    stats->recorded = ctx_history_cycle;
+}
@@ -0,0 +1,130 @@
+/**
+ * \file ctx_history.h
+ * \brief Interface of application context history.
+ * \details Keep the application context of the last cycles in a fixed-size ring, each cycle encoded
+ *          as the fields changed since the previous one, with a full snapshot every few cycles.
+ *          Values of any field at any kept cycle can be queried, and the whole history can be dumped
+ *          to a file by a dedicated thread, on a fault, without stopping the main loop.
+ * \author Raphael CAUSSE
+ */
+
+#ifndef CTX_HISTORY_H
+#define CTX_HISTORY_H
+
+/***** Includes **************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/***** Definitions ***********************************************************/
+
+#define CTX_HISTORY_DEPTH (256)          /* Cycles kept, 25.6 seconds at 100ms cycle */
+#define CTX_HISTORY_KEYFRAME_PERIOD (16) /* Cycles between full snapshots, bounds the cost of a query */
+#define CTX_HISTORY_POOL_SIZE (4096)     /* Bytes of encoded values, power of 2 */
+
+/* Fields of the history */
+typedef enum
+{
+    CTX_FIELD_FRAME_NUMBER = 0,
+    CTX_FIELD_DISTANCE,
+    CTX_FIELD_SPEED,
+    CTX_FIELD_CHASSIS_ISSUES,
+    CTX_FIELD_MOTOR_ISSUES,
+    CTX_FIELD_FUEL_LEVEL,
+    CTX_FIELD_ENGINE_RPM,
+    CTX_FIELD_BATTERY_ISSUES,
+    CTX_FIELD_CRC8,
+    CTX_FIELD_CMDS,                  /* Commands, see cmd_bit_t */
+    CTX_FIELD_FLAGS,                 /* Flags, see flag_bit_t */
+    CTX_FIELD_BGF_ACK,               /* BGF acknowledgement bits */
+    CTX_FIELD_FSM_LIGHTS,            /* State of lights FSM */
+    CTX_FIELD_FSM_INDICATORS,        /* State of indicators FSM */
+    CTX_FIELD_FSM_WINDSHIELD_WASHER, /* State of windshield washer FSM */
+    CTX_FIELD_COUNT
+} ctx_field_t;
+
+/* Last change of a field */
+typedef struct
+{
+    uint32_t cycle;  /* History cycle of the change */
+    uint32_t before; /* Value before the change */
+    uint32_t after;  /* Value after the change */
+} ctx_history_change_t;
+
+/* History counters */
+typedef struct
+{
+    uint32_t recorded;     /* Cycles recorded */
+    uint32_t dumps;        /* Dumps written */
+    uint32_t dropped;      /* Dump requests dropped, previous dump still pending */
+    uint32_t write_errors; /* Dumps that could not be written */
+} ctx_history_stats_t;
+
+/***** Functions *************************************************************/
+
+/**
+ * \brief Record the application context of the current cycle.
+ * \details Called from the main loop with the context lock held, once per cycle. The oldest cycles
+ *          are dropped when the ring is full.
+ * \return uint32_t : Fields changed since the previous cycle, one bit per ctx_field_t.
+ */
+uint32_t ctx_history_record(void);
+
+/**
+ * \brief Get the history cycle of the last recorded context.
+ * \return uint32_t : Cycle number, counted from the first record.
+ */
+uint32_t ctx_history_newest_cycle(void);
+
+/**
+ * \brief Get the value of a field at a past cycle, from the main loop.
+ * \param field : Field
+ * \param cycle : History cycle
+ * \param value : Output value
+ * \return bool : true on success, false if the cycle is not in the history anymore (or not yet).
+ */
+bool ctx_history_value_at(ctx_field_t field, uint32_t cycle, uint32_t *value);
+
+/**
+ * \brief Get the last change of a field, from the main loop.
+ * \param field : Field
+ * \param change : Output change
+ * \return bool : true on success, false if nothing was recorded yet.
+ */
+bool ctx_history_last_change(ctx_field_t field, ctx_history_change_t *change);
+
+/**
+ * \brief Get the name of a field.
+ * \param field : Field
+ * \return const char* : Field name, "unknown" for an unknown field.
+ */
+const char *ctx_history_field_name(ctx_field_t field);
+
+/**
+ * \brief Start the dump thread.
+ * \param path : File the history is appended to on each dump
+ * \return bool : true on success, false otherwise
+ */
+bool ctx_history_start(const char *path);
+
+/**
+ * \brief Stop the dump thread, writing a pending dump.
+ */
+void ctx_history_stop(void);
+
+/**
+ * \brief Request a dump of the current history.
+ * \details Called from the main loop with the context lock held. Copies the history and returns,
+ *          the file is written by the dump thread. Does nothing if the dump thread is not started,
+ *          drops the request if the dump thread has not yet taken the previous one.
+ * \param reason : Reason written in the dump, string literal
+ */
+void ctx_history_trigger(const char *reason);
+
+/**
+ * \brief Get a copy of history counters, from the main loop while the dump thread is started.
+ * \param stats : Output counters
+ */
+void ctx_history_get_stats(ctx_history_stats_t *stats);
+
+#endif /* CTX_HISTORY_H */
@@ -0,0 +1,27 @@
+/**
+ * \file ctx_lock.c
+ * \brief Implementation of application context lock.
+ * \details Serialize accesses to the application context between the main loop and the serial reception thread.
+ * \author Raphael CAUSSE
+ */
+
+/***** Includes **************************************************************/
+
+#include <pthread.h>
+#include "ctx_lock.h"
+
+/***** Static Variables ******************************************************/
+
+static pthread_mutex_t ctx_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/***** Functions *************************************************************/
+
+void ctx_lock(void)
+{
+    pthread_mutex_lock(&ctx_mutex);
+}
+
+void ctx_unlock(void)
+{
+    pthread_mutex_unlock(&ctx_mutex);
+}
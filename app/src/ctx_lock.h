@@ -0,0 +1,23 @@
+/**
+ * \file ctx_lock.h
+ * \brief Interface of application context lock.
+ * \details Serialize accesses to the application context between the main loop and the serial reception thread.
+ * \author Raphael CAUSSE
+ */
+
+#ifndef CTX_LOCK_H
+#define CTX_LOCK_H
+
+/***** Functions *************************************************************/
+
+/**
+ * \brief Take the application context lock (blocking call).
+ */
+void ctx_lock(void);
+
+/**
+ * \brief Release the application context lock.
+ */
+void ctx_unlock(void);
+
+#endif /* CTX_LOCK_H */
@@ -0,0 +1,125 @@
+/**
+ * \file cycle.c
+ * \brief Implementation of application cycle.
+ * \details One cycle of the main loop: receive, decode, run FSMs, encode and send.
+ * \author Raphael CAUSSE - Melvyn MUNOZ - Roland Cedric TAYO
+ */
+
+/***** Includes **************************************************************/
+
+#include "cycle.h"
+#include "drv_api.h"
+#include "bcgv_api.h"
+#include "mux.h"
+#include "bgf.h"
+#include "comodo.h"
+#include "serial.h"
+#include "ctx_lock.h"
+#include "ctx_history.h"
+#include "metrics.h"
+#include "telemetry.h"
+#include "mqtt_pub.h"
+#include "trace_rec.h"
+#include "cycle_perf.h"
+#include "checkpoint.h"
+#include "fsm_lights.h"
+#include "fsm_indicators.h"
+#include "fsm_windshield_washer.h"
+
+/***** Definitions ***********************************************************/
+
+#define FSM_FINAL_STATE (255) /* Final state of the generated FSMs, only reached on error */
+
+/***** Static Variables ******************************************************/
+
+static bool mux_was_valid = true; /* Validity of the previous MUX frame */
+
+/***** Static Functions ******************************************************/
+
+/**
+ * \brief Check whether an FSM has just reached its final state.
+ * \param changed : Fields changed in this cycle, see ctx_history_record()
+ * \return bool : true if an FSM failed in this cycle.
+ */
+static bool cycle_fsm_failed(uint32_t changed)
+{
+    return (((changed & (1u << CTX_FIELD_FSM_LIGHTS)) != 0) && (fsm_lights_get_state() == FSM_FINAL_STATE)) ||
+           (((changed & (1u << CTX_FIELD_FSM_INDICATORS)) != 0) && (fsm_indicators_get_state() == FSM_FINAL_STATE)) ||
+           (((changed & (1u << CTX_FIELD_FSM_WINDSHIELD_WASHER)) != 0) &&
+            (fsm_windshield_washer_get_state() == FSM_FINAL_STATE));
+}
+
+/***** Functions *************************************************************/
+
+void cycle_run(int32_t drv_fd)
+{
+    bool success = false;
+    bool mux_valid = false;
+    int32_t ret = 0;
+    uint32_t changed = 0;
+    timestamp_t start = 0;
+
+    /* Receive and decode MUX frame (UDP) */
+    success = mux_read_frame_100ms(drv_fd);
+    start = timestamp_now();
+    cycle_perf_begin();
+
+    ctx_lock();
+
+    mux_check_frame_number();
+    mux_valid = mux_decode_frame_100ms();
+
+    /* Receive serial frames (done by reception thread if started) */
+    ret = serial_read_frames(drv_fd);
+
+    /* Decode COMODO frame (serial) */
+    success = comodo_decode_frame();
+    cycle_perf_stage(CYCLE_STAGE_DECODE);
+
+    /* FSM executions */
+    ret = fsm_lights_run();
+    ret = fsm_indicators_run();
+    ret = fsm_windshield_washer_run();
+    bgf_ack_latency_update();
+    cycle_perf_stage(CYCLE_STAGE_FSM);
+
+    /* Keep context history, dumped when MUX data gets corrupted or an FSM fails */
+    changed = ctx_history_record();
+    if ((mux_valid == false) && (mux_was_valid == true))
+    {
+        ctx_history_trigger("invalid MUX frame");
+    }
+    else if (cycle_fsm_failed(changed) == true)
+    {
+        ctx_history_trigger("FSM failure");
+    }
+    mux_was_valid = mux_valid;
+    cycle_perf_stage(CYCLE_STAGE_HISTORY);
+
+    /* Encode and send MUX frame (UDP) */
+    mux_encode_frame_200ms();
+    success = mux_write_frame_200ms(drv_fd);
+
+    /* Encode and write serial frames */
+    ret = bgf_write_frames(drv_fd);
+    ret = bgf_retry_frames(drv_fd);
+
+    /* Prepare next MUX frame number check, then save the state resumed after a restart */
+    mux_incr_frame_number();
+    checkpoint_save();
+    cycle_perf_stage(CYCLE_STAGE_SEND);
+
+    /* Queue telemetry sample, MQTT values and trace row (sent or written by their threads if started) */
+    telemetry_sample();
+    mqtt_pub_sample();
+    trace_rec_sample(mux_valid);
+    cycle_perf_stage(CYCLE_STAGE_QUEUE);
+
+    ctx_unlock();
+
+    /* Processing time, from MUX frame reception to last write */
+    metrics_record(METRIC_CYCLE_DURATION, timestamp_elapsed(start, timestamp_now()));
+
+    (void)success;
+    (void)ret;
+}
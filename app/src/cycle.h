@@ -0,0 +1,24 @@
+/**
+ * \file cycle.h
+ * \brief Interface of application cycle.
+ * \details One cycle of the main loop: receive, decode, run FSMs, encode and send.
+ * \author Raphael CAUSSE - Melvyn MUNOZ - Roland Cedric TAYO
+ */
+
+#ifndef CYCLE_H
+#define CYCLE_H
+
+/***** Includes **************************************************************/
+
+#include <stdint.h>
+
+/***** Functions *************************************************************/
+
+/**
+ * \brief Run one application cycle.
+ * \details Blocks until the next MUX 100ms frame is received, then handles it under the context lock.
+ * \param drv_fd : Driver file descriptor
+ */
+void cycle_run(int32_t drv_fd);
+
+#endif /* CYCLE_H */
@@ -0,0 +1,321 @@
+/**
+ * \file cycle_perf.c
+ * \brief Implementation of hardware counters per cycle stage.
+ * \details Counters form one perf_event group, read with a single read() per stage boundary. When the kernel
+ *          multiplexes the group out during a stage, the stage duration is kept but its counter deltas are
+ *          not attributed, they would only be partial.
+ * \author Raphael CAUSSE
+ */
+
+/***** Includes **************************************************************/
+
+#define _GNU_SOURCE /* syscall */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#include "cycle_perf.h"
+#include "log.h"
+
+/***** Definitions ***********************************************************/
+
+#define CYCLE_PERF_REPORT_LINE_SIZE (256)
+
+/* Group read, with PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING */
+typedef struct
+{
+    uint64_t nr;
+    uint64_t time_enabled;
+    uint64_t time_running;
+    uint64_t values[CYCLE_PERF_COUNTER_COUNT]; /* In opening order */
+} cycle_perf_read_t;
+
+/* Counter definition */
+typedef struct
+{
+    uint32_t type;
+    uint64_t config;
+    const char *name;
+} cycle_perf_event_t;
+
+/***** Static Variables ******************************************************/
+
+static const cycle_perf_event_t cycle_perf_events[CYCLE_PERF_COUNTER_COUNT] = {
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, "instructions"},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, "cycles"},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES, "cache_misses"},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES, "branch_misses"},
+    {PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CONTEXT_SWITCHES, "context_switches"},
+};
+
+static const char *const cycle_stage_names[CYCLE_STAGE_COUNT] = {
+    "decode",
+    "fsm",
+    "history",
+    "send",
+    "queue",
+};
+
+static bool cycle_perf_running = false;
+static int cycle_perf_leader = -1;
+static int cycle_perf_fds[CYCLE_PERF_COUNTER_COUNT] = {-1, -1, -1, -1, -1};
+static int32_t cycle_perf_slots[CYCLE_PERF_COUNTER_COUNT]; /* Position of each counter in a group read, -1 if not open */
+static uint32_t cycle_perf_opened = 0;
+
+static cycle_perf_read_t cycle_perf_last;
+static timestamp_t cycle_perf_last_time = 0;
+static cycle_perf_stat_t cycle_perf_stats[CYCLE_STAGE_COUNT];
+
+/***** Static Functions ******************************************************/
+
+/**
+ * \brief Open one counter of the group.
+ * \param event : Counter definition
+ * \param exclude_kernel : Count user space only
+ * \return int : File descriptor, -1 on error with errno set
+ */
+static int cycle_perf_open(const cycle_perf_event_t *event, bool exclude_kernel)
+{
+    struct perf_event_attr attr;
+
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = event->type;
+    attr.config = event->config;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    attr.disabled = (cycle_perf_leader == -1) ? 1 : 0; /* Whole group enabled through its leader */
+    attr.exclude_kernel = exclude_kernel ? 1 : 0;
+    attr.exclude_hv = 1;
+
+    /* Calling thread, any CPU */
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, cycle_perf_leader, 0);
+}
+
+/**
+ * \brief Read the group.
+ * \param data : Output values
+ * \return bool : true on success
+ */
+static bool cycle_perf_read(cycle_perf_read_t *data)
+{
+    ssize_t size = (ssize_t)((3 + cycle_perf_opened) * sizeof(uint64_t));
+
+    return read(cycle_perf_leader, data, sizeof(cycle_perf_read_t)) == size;
+}
+
+/***** Functions *************************************************************/
+
+bool cycle_perf_start(void)
+{
+    bool exclude_kernel = false;
+    int fd = -1;
+
+    if (cycle_perf_running == true)
+    {
+        return true;
+    }
+
+    memset(cycle_perf_stats, 0, sizeof(cycle_perf_stats));
+    cycle_perf_opened = 0;
+    for (uint32_t counter = 0; counter < CYCLE_PERF_COUNTER_COUNT; counter++)
+    {
+        cycle_perf_slots[counter] = -1;
+
+        fd = cycle_perf_open(&cycle_perf_events[counter], exclude_kernel);
+        if ((fd == -1) && ((errno == EACCES) || (errno == EPERM)) && (exclude_kernel == false))
+        {
+            /* perf_event_paranoid forbids kernel profiling, count user space only */
+            log_warn("kernel activity not counted: %s", strerror(errno));
+            exclude_kernel = true;
+            fd = cycle_perf_open(&cycle_perf_events[counter], exclude_kernel);
+        }
+        if (fd == -1)
+        {
+            log_warn("counter %s not available: %s", cycle_perf_events[counter].name, strerror(errno));
+            continue;
+        }
+
+        if (cycle_perf_leader == -1)
+        {
+            cycle_perf_leader = fd;
+        }
+        cycle_perf_fds[counter] = fd;
+        cycle_perf_slots[counter] = (int32_t)cycle_perf_opened++;
+    }
+
+    if (cycle_perf_leader == -1)
+    {
+        log_error("no perf counter available", NULL);
+        return false;
+    }
+
+    if ((ioctl(cycle_perf_leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP) != 0) ||
+        (ioctl(cycle_perf_leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP) != 0) ||
+        (cycle_perf_read(&cycle_perf_last) == false))
+    {
+        log_error("cannot enable counters: %s", strerror(errno));
+        cycle_perf_stop();
+        return false;
+    }
+
+    cycle_perf_last_time = timestamp_now();
+    cycle_perf_running = true;
+
+    return true;
+}
+
+void cycle_perf_stop(void)
+{
+    cycle_perf_running = false;
+
+    for (uint32_t counter = 0; counter < CYCLE_PERF_COUNTER_COUNT; counter++)
+    {
+        if (cycle_perf_fds[counter] != -1)
+        {
+            close(cycle_perf_fds[counter]);
+            cycle_perf_fds[counter] = -1;
+        }
+    }
+    cycle_perf_leader = -1;
+}
+
+void cycle_perf_begin(void)
+{
+    if (cycle_perf_running == false)
+    {
+        return;
+    }
+
+    if (cycle_perf_read(&cycle_perf_last) == true)
+    {
+        cycle_perf_last_time = timestamp_now();
+    }
+}
+
+void cycle_perf_stage(cycle_stage_t stage)
+{
+    cycle_perf_read_t current;
+    cycle_perf_stat_t *stat = NULL;
+    timestamp_t now = 0;
+    timestamp_t elapsed = 0;
+
+    if ((cycle_perf_running == false) || (stage >= CYCLE_STAGE_COUNT))
+    {
+        return;
+    }
+
+    if (cycle_perf_read(&current) == false)
+    {
+        return;
+    }
+    now = timestamp_now();
+    elapsed = timestamp_elapsed(cycle_perf_last_time, now);
+
+    stat = &cycle_perf_stats[stage];
+    stat->count++;
+    stat->time_sum += elapsed;
+    if (elapsed > stat->time_max)
+    {
+        stat->time_max = elapsed;
+    }
+
+    /* Group scheduled on a CPU for the whole stage */
+    if ((current.time_running - cycle_perf_last.time_running) == (current.time_enabled - cycle_perf_last.time_enabled))
+    {
+        stat->counted++;
+        for (uint32_t counter = 0; counter < CYCLE_PERF_COUNTER_COUNT; counter++)
+        {
+            if (cycle_perf_slots[counter] != -1)
+            {
+                stat->counters[counter] +=
+                    current.values[cycle_perf_slots[counter]] - cycle_perf_last.values[cycle_perf_slots[counter]];
+            }
+        }
+    }
+
+    cycle_perf_last = current;
+    cycle_perf_last_time = now;
+}
+
+bool cycle_perf_available(cycle_perf_counter_t counter)
+{
+    return (counter < CYCLE_PERF_COUNTER_COUNT) && (cycle_perf_fds[counter] != -1);
+}
+
+void cycle_perf_get(cycle_stage_t stage, cycle_perf_stat_t *stat)
+{
+    if ((stage < CYCLE_STAGE_COUNT) && (stat != NULL))
+    {
+        *stat = cycle_perf_stats[stage];
+    }
+}
+
+void cycle_perf_report(void)
+{
+    const cycle_perf_stat_t *stat = NULL;
+    char line[CYCLE_PERF_REPORT_LINE_SIZE];
+    size_t length = 0;
+    double instructions = 0;
+
+    if (cycle_perf_running == false)
+    {
+        return;
+    }
+
+    for (uint32_t stage = 0; stage < CYCLE_STAGE_COUNT; stage++)
+    {
+        stat = &cycle_perf_stats[stage];
+        if (stat->count == 0)
+        {
+            continue;
+        }
+
+        line[0] = '\0';
+        length = 0;
+        if (stat->counted > 0)
+        {
+            instructions = (double)stat->counters[CYCLE_PERF_INSTRUCTIONS];
+            if (cycle_perf_available(CYCLE_PERF_INSTRUCTIONS) == true)
+            {
+                length += (size_t)snprintf(&line[length], sizeof(line) - length, " instr=%.0f",
+                                           instructions / stat->counted);
+            }
+            if ((cycle_perf_available(CYCLE_PERF_INSTRUCTIONS) == true) &&
+                (cycle_perf_available(CYCLE_PERF_CYCLES) == true) && (stat->counters[CYCLE_PERF_CYCLES] > 0))
+            {
+                length += (size_t)snprintf(&line[length], sizeof(line) - length, " ipc=%.2f",
+                                           instructions / (double)stat->counters[CYCLE_PERF_CYCLES]);
+            }
+            /* Miss rates per thousand instructions */
+            if ((cycle_perf_available(CYCLE_PERF_INSTRUCTIONS) == true) && (instructions > 0))
+            {
+                if (cycle_perf_available(CYCLE_PERF_CACHE_MISSES) == true)
+                {
+                    length += (size_t)snprintf(&line[length], sizeof(line) - length, " cache_mpki=%.2f",
+                                               1000.0 * (double)stat->counters[CYCLE_PERF_CACHE_MISSES] / instructions);
+                }
+                if (cycle_perf_available(CYCLE_PERF_BRANCH_MISSES) == true)
+                {
+                    length += (size_t)snprintf(&line[length], sizeof(line) - length, " branch_mpki=%.2f",
+                                               1000.0 * (double)stat->counters[CYCLE_PERF_BRANCH_MISSES] / instructions);
+                }
+            }
+            if (cycle_perf_available(CYCLE_PERF_CONTEXT_SWITCHES) == true)
+            {
+                length += (size_t)snprintf(&line[length], sizeof(line) - length, " ctx_switches=%llu",
+                                           (unsigned long long)stat->counters[CYCLE_PERF_CONTEXT_SWITCHES]);
+            }
+        }
+
+        log_info("stage %s: n=%u avg=%lluns max=%lluns%s",
+                 cycle_stage_names[stage],
+                 stat->count,
+                 (unsigned long long)(stat->time_sum / stat->count),
+                 (unsigned long long)stat->time_max,
+                 line);
+    }
+}
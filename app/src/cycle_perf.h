@@ -0,0 +1,100 @@
+/**
+ * \file cycle_perf.h
+ * \brief Interface of hardware counters per cycle stage.
+ * \details Optional instrumentation of the control thread with perf_event counters (instructions, cycles,
+ *          cache misses, branch misses, context switches). The counters are read as one group at each stage
+ *          boundary of a cycle and their deltas are attributed to the stage that just ended, along with its
+ *          duration. When not started, stage boundaries cost a single test.
+ *          Functions must be called from the control thread.
+ * \author Raphael CAUSSE
+ */
+
+#ifndef CYCLE_PERF_H
+#define CYCLE_PERF_H
+
+/***** Includes **************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "timestamp.h"
+
+/***** Definitions ***********************************************************/
+
+/* Stages of a cycle, after MUX frame reception */
+typedef enum
+{
+    CYCLE_STAGE_DECODE = 0, /* MUX, serial and COMODO decoding */
+    CYCLE_STAGE_FSM,        /* FSM executions */
+    CYCLE_STAGE_HISTORY,    /* Context history */
+    CYCLE_STAGE_SEND,       /* MUX and BGF encoding and writes */
+    CYCLE_STAGE_QUEUE,      /* Telemetry, MQTT and trace sampling */
+    CYCLE_STAGE_COUNT
+} cycle_stage_t;
+
+/* Counters */
+typedef enum
+{
+    CYCLE_PERF_INSTRUCTIONS = 0,
+    CYCLE_PERF_CYCLES,
+    CYCLE_PERF_CACHE_MISSES,
+    CYCLE_PERF_BRANCH_MISSES,
+    CYCLE_PERF_CONTEXT_SWITCHES,
+    CYCLE_PERF_COUNTER_COUNT
+} cycle_perf_counter_t;
+
+/* Statistics of one stage */
+typedef struct
+{
+    uint32_t count;       /* Number of samples */
+    timestamp_t time_sum; /* Sum of durations (ns) */
+    timestamp_t time_max; /* Maximum duration (ns) */
+    uint32_t counted;     /* Samples whose counters were attributed, the group was not multiplexed out */
+    uint64_t counters[CYCLE_PERF_COUNTER_COUNT]; /* Sum of counter deltas over counted samples */
+} cycle_perf_stat_t;
+
+/***** Functions *************************************************************/
+
+/**
+ * \brief Open the counters for the calling thread.
+ * \details Counters that the CPU or the kernel do not provide are reported and left out. Kernel activity
+ *          is counted when perf_event_paranoid allows it.
+ * \return bool : true if at least one counter is open, false otherwise
+ */
+bool cycle_perf_start(void);
+
+/**
+ * \brief Close the counters.
+ */
+void cycle_perf_stop(void);
+
+/**
+ * \brief Mark the beginning of a cycle.
+ */
+void cycle_perf_begin(void);
+
+/**
+ * \brief Mark the end of a stage, the next stage begins.
+ * \param stage : Stage that just ended
+ */
+void cycle_perf_stage(cycle_stage_t stage);
+
+/**
+ * \brief Check whether a counter is open.
+ * \param counter : Counter
+ * \return bool : true if the counter is open
+ */
+bool cycle_perf_available(cycle_perf_counter_t counter);
+
+/**
+ * \brief Get a copy of the statistics of a stage.
+ * \param stage : Stage
+ * \param stat : Output statistics
+ */
+void cycle_perf_get(cycle_stage_t stage, cycle_perf_stat_t *stat);
+
+/**
+ * \brief Log duration, IPC and miss rates of every stage, if started.
+ */
+void cycle_perf_report(void);
+
+#endif /* CYCLE_PERF_H */
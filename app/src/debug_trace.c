@@ -0,0 +1,136 @@
+/**
+ * \file debug_trace.c
+ * \brief Implementation of the debug trace ring.
+ * \details A writer reserves a record number by incrementing the head, clears the record sequence, fills the
+ *          record and publishes it by storing its sequence last. A reader skips records whose sequence does not
+ *          match their slot, they were being written or were overwritten meanwhile.
+ * \author Raphael CAUSSE
+ */
+
+/***** Includes **************************************************************/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "debug_trace.h"
+#include "log.h"
+#include "timestamp.h"
+
+/***** Definitions ***********************************************************/
+
+#define DEBUG_TRACE_MASK (DEBUG_TRACE_RECORDS - 1)
+
+/***** Static Variables ******************************************************/
+
+static debug_trace_ring_t debug_trace_memory = {
+    .header = {
+        .magic = DEBUG_TRACE_MAGIC,
+        .version = DEBUG_TRACE_VERSION,
+        .record_size = sizeof(debug_trace_record_t),
+        .records = DEBUG_TRACE_RECORDS,
+    },
+};
+static debug_trace_ring_t *debug_trace_ring = &debug_trace_memory; /* Memory ring or mapped file */
+static debug_trace_ring_t *debug_trace_mapped = NULL;
+
+/***** Static Functions ******************************************************/
+
+/**
+ * \brief Reset a ring.
+ * \param ring : Ring
+ */
+static void debug_trace_reset(debug_trace_ring_t *ring)
+{
+    memset(ring, 0, sizeof(debug_trace_ring_t));
+    memcpy(ring->header.magic, DEBUG_TRACE_MAGIC, sizeof(ring->header.magic));
+    ring->header.version = DEBUG_TRACE_VERSION;
+    ring->header.record_size = sizeof(debug_trace_record_t);
+    ring->header.records = DEBUG_TRACE_RECORDS;
+    ring->header.start_time = timestamp_now();
+}
+
+/***** Functions *************************************************************/
+
+bool debug_trace_open(const char *path)
+{
+    int fd = -1;
+    void *map = NULL;
+
+    fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd == -1)
+    {
+        log_error("cannot create debug trace %s: %s", path, strerror(errno));
+        return false;
+    }
+    if (ftruncate(fd, sizeof(debug_trace_ring_t)) != 0)
+    {
+        log_error("cannot size debug trace %s: %s", path, strerror(errno));
+        close(fd);
+        return false;
+    }
+
+    /* Shared mapping: records reach the file through the page cache, without write calls */
+    map = mmap(NULL, sizeof(debug_trace_ring_t), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+    {
+        log_error("cannot map debug trace %s: %s", path, strerror(errno));
+        return false;
+    }
+
+    debug_trace_close();
+    debug_trace_mapped = (debug_trace_ring_t *)map;
+    debug_trace_reset(debug_trace_mapped);
+    __atomic_store_n(&debug_trace_ring, debug_trace_mapped, __ATOMIC_RELEASE);
+
+    return true;
+}
+
+void debug_trace_close(void)
+{
+    if (debug_trace_mapped == NULL)
+    {
+        return;
+    }
+
+    debug_trace_reset(&debug_trace_memory);
+    __atomic_store_n(&debug_trace_ring, &debug_trace_memory, __ATOMIC_RELEASE);
+
+    msync(debug_trace_mapped, sizeof(debug_trace_ring_t), MS_SYNC);
+    munmap(debug_trace_mapped, sizeof(debug_trace_ring_t));
+    debug_trace_mapped = NULL;
+}
+
+void debug_trace_record(debug_trace_type_t type, const void *payload, size_t size)
+{
+    debug_trace_ring_t *ring = __atomic_load_n(&debug_trace_ring, __ATOMIC_ACQUIRE);
+    debug_trace_record_t *record = NULL;
+    uint64_t number = 0;
+
+    if (type == DEBUG_TRACE_MUX_READ)
+    {
+        __atomic_fetch_add(&ring->header.cycle, 1, __ATOMIC_RELAXED);
+    }
+
+    number = __atomic_fetch_add(&ring->header.head, 1, __ATOMIC_RELAXED);
+    record = &ring->records[number & DEBUG_TRACE_MASK];
+
+    __atomic_store_n(&record->seq, 0, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    if (size > DEBUG_TRACE_PAYLOAD_SIZE)
+    {
+        size = DEBUG_TRACE_PAYLOAD_SIZE;
+    }
+    record->cycle = __atomic_load_n(&ring->header.cycle, __ATOMIC_RELAXED);
+    record->time = timestamp_now();
+    record->type = (uint8_t)type;
+    record->size = (uint8_t)size;
+    memcpy(record->payload, payload, size);
+
+    __atomic_store_n(&record->seq, (uint32_t)(number + 1), __ATOMIC_RELEASE);
+}
@@ -0,0 +1,113 @@
+/**
+ * \file debug_trace.h
+ * \brief Interface of the debug trace ring.
+ * \details Debug builds record the frames read, decoded and encoded by MUX and COMODO as fixed-size binary
+ *          records in a ring, instead of printing them. The ring is mapped from a file, so it survives a crash
+ *          and can be read while the application runs; tools/bin/debug_trace_dump pretty-prints it.
+ *          Recording copies at most DEBUG_TRACE_PAYLOAD_SIZE bytes, without any system call. Records may come
+ *          from the main loop and the serial reception thread, each one reserves its slot atomically.
+ *
+ *          File layout, host byte order (decode on the same architecture):
+ *          - Header (debug_trace_header_t)
+ *          - DEBUG_TRACE_RECORDS records (debug_trace_record_t), record n in slot n % DEBUG_TRACE_RECORDS
+ * \author Raphael CAUSSE
+ */
+
+#ifndef DEBUG_TRACE_H
+#define DEBUG_TRACE_H
+
+/***** Includes **************************************************************/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/***** Definitions ***********************************************************/
+
+#define DEBUG_TRACE_MAGIC "DTRC"
+#define DEBUG_TRACE_VERSION (1)
+#define DEBUG_TRACE_RECORDS (4096) /* Power of two, about 80 seconds at 5 records per 100ms cycle */
+#define DEBUG_TRACE_PAYLOAD_SIZE (40)
+#define DEBUG_TRACE_DEFAULT_PATH "debug_trace.bin"
+
+/* Record types */
+typedef enum
+{
+    DEBUG_TRACE_NONE = 0,
+    DEBUG_TRACE_MUX_READ,      /* Raw MUX 100ms frame, starts a new cycle */
+    DEBUG_TRACE_MUX_DECODE,    /* debug_trace_mux_decoded_t */
+    DEBUG_TRACE_MUX_ENCODE,    /* Raw MUX 200ms frame */
+    DEBUG_TRACE_COMODO_READ,   /* Raw COMODO frame */
+    DEBUG_TRACE_COMODO_DECODE, /* Command bits, see cmd_bits_t */
+    DEBUG_TRACE_TYPE_COUNT
+} debug_trace_type_t;
+
+/* Decoded MUX 100ms frame */
+typedef struct
+{
+    uint32_t distance;
+    uint32_t engine_rpm;
+    uint8_t frame_number;
+    uint8_t speed;
+    uint8_t chassis_issues;
+    uint8_t motor_issues;
+    uint8_t fuel_level;
+    uint8_t battery_issues;
+    uint8_t crc8;
+} debug_trace_mux_decoded_t;
+
+/* Record, 64 bytes */
+typedef struct
+{
+    uint32_t seq;   /* Record number + 1, 0 while being written */
+    uint32_t cycle; /* Cycle number, counted from MUX 100ms frames read */
+    uint64_t time;  /* Monotonic time (ns) */
+    uint8_t type;   /* See debug_trace_type_t */
+    uint8_t size;   /* Payload bytes used */
+    uint8_t reserved[6];
+    uint8_t payload[DEBUG_TRACE_PAYLOAD_SIZE];
+} debug_trace_record_t;
+
+/* File header, 32 bytes */
+typedef struct
+{
+    char magic[4];        /* DEBUG_TRACE_MAGIC */
+    uint16_t version;     /* DEBUG_TRACE_VERSION */
+    uint16_t record_size; /* sizeof(debug_trace_record_t) */
+    uint32_t records;     /* Ring capacity */
+    uint32_t cycle;       /* Current cycle number */
+    uint64_t head;        /* Records written, next record number */
+    uint64_t start_time;  /* Monotonic time the ring was reset (ns) */
+} debug_trace_header_t;
+
+/* Whole ring, as mapped from the file */
+typedef struct
+{
+    debug_trace_header_t header;
+    debug_trace_record_t records[DEBUG_TRACE_RECORDS];
+} debug_trace_ring_t;
+
+/***** Functions *************************************************************/
+
+/**
+ * \brief Map the ring from a file, records are then kept by the kernel even if the application crashes.
+ * \details Until opened, and after an error, records go to a ring in memory.
+ * \param path : File path, truncated if it exists
+ * \return bool : true on success, false otherwise
+ */
+bool debug_trace_open(const char *path);
+
+/**
+ * \brief Flush and unmap the ring file, records go back to memory.
+ */
+void debug_trace_close(void);
+
+/**
+ * \brief Record a frame or decoded values.
+ * \param type : Record type
+ * \param payload : Payload, copied
+ * \param size : Payload size, truncated to DEBUG_TRACE_PAYLOAD_SIZE
+ */
+void debug_trace_record(debug_trace_type_t type, const void *payload, size_t size);
+
+#endif /* DEBUG_TRACE_H */
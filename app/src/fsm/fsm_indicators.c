@@ -9,78 +9,11 @@
 
 #include "fsm_common.h"
 #include "fsm_indicators.h"
-
-/***** Definitions ***********************************************************/
-
-#define TRANS_COUNT (sizeof(trans_table) / sizeof(*trans_table))
-
-/* States */
-typedef enum
-{
-    ST_ANY = -1,         /* Any state */
-    ST_INIT = 0,         /* Initial state */
-    ST_OFF,              /* All off */
-    ST_ACTIVATED_ON,     /* Activated and on */
-    ST_ACTIVATED_OFF,    /* Activated and off */
-    ST_ACKNOWLEDGED_ON,  /* Acknowledged and on */
-    ST_ACKNOWLEDGED_OFF, /* Acknowledged and off */
-    ST_ERROR,            /* Error, permanently off */
-    ST_TERM = 255        /* Final state */
-} fsm_state_t;
-
-/* Events */
-typedef enum
-{
-    EV_ANY = -1,         /* Any event */
-    EV_NONE = 0,         /* No event */
-    EV_CMD_ON,           /* Command to activate received  */
-    EV_CMD_OFF,          /* Command to deactivate received */
-    EV_ACK_RECEIVED,     /* Acknowledgement received */
-    EV_ACK_NOT_RECEIVED, /* Acknowledgement not received */
-    EV_TIMEOUT,          /* Timeout after 1 second */
-    EV_ERR = 255         /* Error event */
-} fsm_event_t;
-
-/* State transition */
-typedef struct
-{
-    fsm_state_t state;
-    fsm_event_t event;
-    int (*callback)(void);
-    int next_state;
-} transition_t;
-
-/***** Static Functions Declarations *****************************************/
-
-static int callback_init(void);
-static int callback_cmd_on(void);
-static int callback_cmd_off(void);
-static int callback_ack_not_received(void);
-static int callback_timeout(void);
-static int callback_error(void);
-static fsm_event_t get_next_event(fsm_state_t current_state);
-
-/***** Static Variables ******************************************************/
-
-static fsm_state_t state = ST_INIT; /* State of the FSM */
-static uint8_t timer_counter = 0;   /* Timer for 1 second delay, increment each 100ms */
-
-static const transition_t trans_table[] = {
-    {ST_INIT, EV_NONE, &callback_init, ST_OFF},
-    {ST_OFF, EV_CMD_ON, &callback_cmd_on, ST_ACTIVATED_ON},
-    {ST_ACTIVATED_ON, EV_CMD_OFF, &callback_cmd_off, ST_OFF},
-    {ST_ACTIVATED_ON, EV_ACK_RECEIVED, NULL, ST_ACKNOWLEDGED_ON},
-    {ST_ACTIVATED_ON, EV_ACK_NOT_RECEIVED, &callback_ack_not_received, ST_ERROR},
-    {ST_ACTIVATED_OFF, EV_CMD_OFF, &callback_cmd_off, ST_OFF},
-    {ST_ACTIVATED_OFF, EV_ACK_RECEIVED, NULL, ST_ACKNOWLEDGED_OFF},
-    {ST_ACTIVATED_OFF, EV_ACK_NOT_RECEIVED, &callback_ack_not_received, ST_ERROR},
-    {ST_ACKNOWLEDGED_ON, EV_CMD_OFF, &callback_cmd_off, ST_OFF},
-    {ST_ACKNOWLEDGED_ON, EV_TIMEOUT, &callback_timeout, ST_ACTIVATED_OFF},
-    {ST_ACKNOWLEDGED_OFF, EV_CMD_OFF, &callback_cmd_off, ST_OFF},
-    {ST_ACKNOWLEDGED_OFF, EV_TIMEOUT, &callback_timeout, ST_ACTIVATED_ON},
-    {ST_ERROR, EV_ERR, &callback_error, ST_TERM},
-    {ST_ANY, EV_ERR, &callback_error, ST_TERM},
-};
+#include "fsm_indicators_gen.h"
+#include "probe.h"
+#ifdef WITH_FSM_PRODUCT
+#include "fsm_product.h"
+#endif
 
 /***** Static Functions Definitions ******************************************/
 
@@ -120,6 +53,9 @@ static int callback_cmd_on(void)
         set_flag_indic_right(ON);
     }
 
+    /* Acknowledgement window starts now */
+    timer_counter = 0;
+
     return 0;
 }
 
@@ -149,6 +85,32 @@ static int callback_cmd_off(void)
     return 0;
 }
 
+/**
+ * \brief Clear the acknowledgement bits of the active commands.
+ * \return int : Negative value for error code.
+ */
+static int callback_ack_received(void)
+{
+    bit_flag_t bgf_ack = get_bit_flag_bgf_ack();
+
+    if ((get_cmd_indic_hazard() == ON) && (bgf_ack & BGF_ACK_INDIC_LEFT) && (bgf_ack & BGF_ACK_INDIC_RIGHT))
+    {
+        CLEAR_BIT(bgf_ack, BGF_ACK_INDIC_LEFT);
+        CLEAR_BIT(bgf_ack, BGF_ACK_INDIC_RIGHT);
+    }
+    if ((get_cmd_indic_left() == ON) && (bgf_ack & BGF_ACK_INDIC_LEFT))
+    {
+        CLEAR_BIT(bgf_ack, BGF_ACK_INDIC_LEFT);
+    }
+    if ((get_cmd_indic_right() == ON) && (bgf_ack & BGF_ACK_INDIC_RIGHT))
+    {
+        CLEAR_BIT(bgf_ack, BGF_ACK_INDIC_RIGHT);
+    }
+    set_bit_flag_bgf_ack(bgf_ack);
+
+    return 0;
+}
+
 /**
  * \brief reset the timer if ack is not received in time (1 second).
  * \return int : Negative value for error code.
@@ -204,142 +166,159 @@ static int callback_error(void)
 }
 
 /**
- * \brief Get the next event for the FSM.
- * \param current_state : Current FSM state.
- * \return fsm_event_t : Next event value.
+ * \brief Check whether the activated indicators have been acknowledged.
+ * \return bool : true when an acknowledgement matches an active command.
  */
-static fsm_event_t get_next_event(fsm_state_t current_state)
+static bool guard_ack_received(void)
 {
-    fsm_event_t event = EV_NONE;
-    cmd_t cmd_hazard = get_cmd_indic_hazard();
-    cmd_t cmd_left = get_cmd_indic_left();
-    cmd_t cmd_right = get_cmd_indic_right();
-    flag_t flag_hazard = get_flag_indic_hazard();
-    flag_t flag_left = get_flag_indic_left();
-    flag_t flag_right = get_flag_indic_right();
     bit_flag_t bgf_ack = get_bit_flag_bgf_ack();
-
-    /* Common checks for all states */
-    bool hazard_on = (cmd_hazard == ON);
-    bool left_on = (cmd_left == ON);
-    bool right_on = (cmd_right == ON);
     bool hazard_ack = ((bgf_ack & BGF_ACK_INDIC_LEFT) && (bgf_ack & BGF_ACK_INDIC_RIGHT));
     bool left_ack = (bgf_ack & BGF_ACK_INDIC_LEFT);
     bool right_ack = (bgf_ack & BGF_ACK_INDIC_RIGHT);
 
-    switch (current_state)
+    return ((get_cmd_indic_hazard() == ON) && hazard_ack) ||
+           ((get_cmd_indic_left() == ON) && left_ack) ||
+           ((get_cmd_indic_right() == ON) && right_ack);
+}
+
+#ifdef WITH_FSM_PRODUCT
+/**
+ * \brief Evaluate the FSM once with a single lookup in its precomputed table.
+ * \details Same outcome as fsm_step(), which still handles a state outside the table.
+ * \param tick : true for periodic 100ms evaluation, false for an immediate evaluation not advancing timers
+ * \return int : Return code of transition callback.
+ */
+static int fsm_step_product(bool tick)
+{
+    uint32_t state_index = fsm_product_state_index(state, FSM_PRODUCT_INDICATORS_STATES);
+    bit_flag_t bgf_ack = 0;
+    uint32_t ack_clear = 0;
+    uint32_t flags = 0;
+    uint32_t next_flags = 0;
+    uint32_t changed = 0;
+    uint32_t inputs = 0;
+    uint32_t transition = 0;
+    uint16_t entry = 0;
+    fsm_state_t previous = state;
+
+    if (state_index >= FSM_PRODUCT_INDICATORS_STATES)
     {
-    case ST_OFF:
-        if (hazard_on || left_on || right_on)
-        {
-            event = EV_CMD_ON;
-        }
-        break;
-
-    case ST_ACTIVATED_ON:
-    case ST_ACTIVATED_OFF:
-        timer_counter++;
-        /* Commands to deactivate */
-        if ((!hazard_on && (cmd_hazard != flag_hazard)) ||
-            (!left_on && (cmd_left != flag_left)) ||
-            (!right_on && (cmd_right != flag_right)))
-        {
-            event = EV_CMD_OFF;
-        }
-        /* No acknowledgement after 1 second */
-        else if (timer_counter >= TIMER_1S_COUNT_100MS)
-        {
-            event = EV_ACK_NOT_RECEIVED;
-        }
-        /* Wait acknowledgement */
-        else if (timer_counter < TIMER_1S_COUNT_100MS)
-        {
-            if ((hazard_on && hazard_ack))
-            {
-                event = EV_ACK_RECEIVED;
-                CLEAR_BIT(bgf_ack, BGF_ACK_INDIC_LEFT);
-                CLEAR_BIT(bgf_ack, BGF_ACK_INDIC_RIGHT);
-            }
-            if (left_on && left_ack)
-            {
-                event = EV_ACK_RECEIVED;
-                CLEAR_BIT(bgf_ack, BGF_ACK_INDIC_LEFT);
-            }
-            if (right_on && right_ack)
-            {
-                event = EV_ACK_RECEIVED;
-                CLEAR_BIT(bgf_ack, BGF_ACK_INDIC_RIGHT);
-            }
-
-            /* Clear acknowledgement bit */
-            if (event == EV_ACK_RECEIVED)
-            {
-                set_bit_flag_bgf_ack(bgf_ack);
-            }
-        }
-        break;
-
-    case ST_ACKNOWLEDGED_ON:
-    case ST_ACKNOWLEDGED_OFF:
-        timer_counter++;
-        /* Commands to deactivate */
-        if ((!hazard_on && (cmd_hazard != flag_hazard)) ||
-            (!left_on && (cmd_left != flag_left)) ||
-            (!right_on && (cmd_right != flag_right)))
-        {
-            event = EV_CMD_OFF;
-        }
-        /* Timeout 1 second to toggle indicators */
-        else if (timer_counter >= TIMER_1S_COUNT_100MS)
-        {
-            event = EV_TIMEOUT;
-        }
-        break;
-
-    case ST_ERROR:
-        event = EV_ERR;
-        break;
-
-    default:
-        break;
+        return fsm_step(tick);
     }
 
-    return event;
+    bgf_ack = get_bit_flag_bgf_ack();
+    flags = (uint32_t)get_flag_indic_hazard() | ((uint32_t)get_flag_indic_left() << 1) |
+            ((uint32_t)get_flag_indic_right() << 2);
+    inputs = (uint32_t)get_cmd_indic_hazard() | ((uint32_t)get_cmd_indic_left() << 1) |
+             ((uint32_t)get_cmd_indic_right() << 2) | (flags << 3) |
+             ((uint32_t)((bgf_ack & (BGF_ACK_INDIC_LEFT | BGF_ACK_INDIC_RIGHT)) >> 3) << 6);
+    entry = fsm_product_indicators[fsm_product_index(inputs, FSM_PRODUCT_INDICATORS_INPUTS, tick,
+                                                  fsm_product_timer_class(timer_counter, TIMER_1S_COUNT_100MS),
+                                                  state_index)];
+
+    fsm_trace_begin(&trace);
+    transition = FSM_PRODUCT_TRANSITION(entry);
+    if (transition != 0)
+    {
+        transition--;
+        fsm_trace_transition(&trace, transition, state, fsm_product_indicators_next[transition],
+                             fsm_product_indicators_event[transition]);
+        state = (fsm_state_t)fsm_product_indicators_next[transition];
+    }
+
+    /* Outputs: changed flags, acknowledgement bits to clear and timer */
+    next_flags = FSM_PRODUCT_FLAGS(entry);
+    changed = next_flags ^ flags;
+    if (changed & (1u << 0))
+    {
+        set_flag_indic_hazard((next_flags >> 0) & 0x01u);
+    }
+    if (changed & (1u << 1))
+    {
+        set_flag_indic_left((next_flags >> 1) & 0x01u);
+    }
+    if (changed & (1u << 2))
+    {
+        set_flag_indic_right((next_flags >> 2) & 0x01u);
+    }
+    ack_clear = FSM_PRODUCT_ACK_CLEAR(entry);
+    if (ack_clear != 0)
+    {
+        set_bit_flag_bgf_ack(bgf_ack & (bit_flag_t)~(bit_flag_t)(ack_clear << 3));
+    }
+    timer_counter = fsm_product_timer_next(entry, timer_counter);
+    fsm_trace_end(&trace);
+
+    /* Keep the transitions leading to the final state */
+    if ((state == ST_TERM) && (previous != ST_TERM))
+    {
+        fsm_trace_dump("indicators", &trace.data);
+    }
+
+    return ((entry & FSM_PRODUCT_ERROR) != 0) ? -1 : 0;
+}
+#endif
+
+/**
+ * \brief Evaluate the FSM with the selected implementation, firing the transition probe on a state change.
+ * \param tick : true for periodic 100ms evaluation, false for an immediate evaluation not advancing timers
+ * \return int : Return code of transition callback.
+ */
+static int fsm_eval(bool tick)
+{
+    int from = (int)state;
+    int ret = 0;
+
+#ifdef WITH_FSM_PRODUCT
+    ret = fsm_step_product(tick);
+#else
+    ret = fsm_step(tick);
+#endif
+    if ((int)state != from)
+    {
+        PROBE3(fsm_transition, "indicators", from, (int)state);
+    }
+
+    return ret;
 }
 
 /***** Functions *************************************************************/
 
 int fsm_indicators_run(void)
 {
-    int ret = -1;
-    size_t i = 0;
-    fsm_event_t event = EV_NONE;
+    return fsm_eval(true);
+}
+
+int fsm_indicators_kick(void)
+{
+    return fsm_eval(false);
+}
+
+int fsm_indicators_get_state(void)
+{
+    return (int)state;
+}
 
-    if (state != ST_TERM)
+void fsm_indicators_get_trace(fsm_trace_data_t *data)
+{
+    fsm_trace_snapshot(&trace, data);
+}
+
+void fsm_indicators_save(uint8_t *saved_state, uint8_t *saved_timer)
+{
+    *saved_state = (uint8_t)state;
+    *saved_timer = timer_counter;
+}
+
+bool fsm_indicators_restore(uint8_t saved_state, uint8_t saved_timer)
+{
+    /* A terminated or unknown state is not resumed, the FSM starts over */
+    if (saved_state > ST_ERROR)
     {
-        /* Get event */
-        event = get_next_event(state);
-        /* For each transitions */
-        for (i = 0; i < TRANS_COUNT; i++)
-        {
-            /* If State is current state OR The transition applies to all states ...*/
-            if ((state == trans_table[i].state) || (ST_ANY == trans_table[i].state))
-            {
-                /* If event is the transition event OR the event applies to all */
-                if ((event == trans_table[i].event) || (EV_ANY == trans_table[i].event))
-                {
-                    /* Apply the new state */
-                    state = trans_table[i].next_state;
-                    if (trans_table[i].callback != NULL)
-                    {
-                        /* Call the state function */
-                        ret = (trans_table[i].callback)();
-                    }
-                    break;
-                }
-            }
-        }
+        return false;
     }
+    state = (fsm_state_t)saved_state;
+    timer_counter = saved_timer;
 
-    return ret;
+    return true;
 }
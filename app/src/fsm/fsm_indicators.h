@@ -8,12 +8,52 @@
 #ifndef FSM_INDICATORS_H
 #define FSM_INDICATORS_H
 
+/***** Includes **************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "fsm_trace.h"
+
 /***** Functions *************************************************************/
 
 /**
  * \brief Run the indicators FSM to handle current state and event.
- * \return int : Return code of transition callback.
+ * \return int : Return code of transition callback, 0 if none was called.
  */
 int fsm_indicators_run(void);
 
+/**
+ * \brief Evaluate the indicators FSM immediately, without advancing its timers.
+ * \details Used to react to an acknowledgement as soon as it is received.
+ * \return int : Return code of transition callback, 0 if none was called.
+ */
+int fsm_indicators_kick(void);
+
+/**
+ * \brief Get the current state of the indicators FSM.
+ * \return int : Current state value
+ */
+int fsm_indicators_get_state(void);
+
+/**
+ * \brief Get a snapshot of the indicators FSM instrumentation, from any thread.
+ * \param data : Output instrumentation data
+ */
+void fsm_indicators_get_trace(fsm_trace_data_t *data);
+
+/**
+ * \brief Save the state and timer of the indicators FSM, for a warm restart.
+ * \param saved_state : Output state
+ * \param saved_timer : Output timer counter
+ */
+void fsm_indicators_save(uint8_t *saved_state, uint8_t *saved_timer);
+
+/**
+ * \brief Resume the indicators FSM from a saved state and timer, before its first run.
+ * \param saved_state : Saved state
+ * \param saved_timer : Saved timer counter
+ * \return bool : true if resumed, false if terminated or unknown (the FSM starts from ST_INIT)
+ */
+bool fsm_indicators_restore(uint8_t saved_state, uint8_t saved_timer);
+
 #endif /* FSM_INDICATORS_H */
\ No newline at end of file
@@ -0,0 +1,240 @@
+/**
+ * \file fsm_indicators_gen.h
+ * \brief Generated evaluation of the indicators (hazard/warnings, left and right) FSM.
+ * \details Generated by generator/gen_fsm.py from generator/fsm/indicators.json, do not edit.
+ *          Private to fsm_indicators.c, which provides the actions and guards declared here.
+ *          Each state evaluates its own rules and calls the matching transition directly.
+ * \author Raphael CAUSSE
+ */
+
+#ifndef FSM_INDICATORS_GEN_H
+#define FSM_INDICATORS_GEN_H
+
+/***** Definitions ***********************************************************/
+
+/* States */
+typedef enum
+{
+    ST_INIT = 0,         /* Initial state */
+    ST_OFF,              /* All off */
+    ST_ACTIVATED_ON,     /* Activated and on */
+    ST_ACTIVATED_OFF,    /* Activated and off */
+    ST_ACKNOWLEDGED_ON,  /* Acknowledged and on */
+    ST_ACKNOWLEDGED_OFF, /* Acknowledged and off */
+    ST_ERROR,            /* Error, permanently off */
+    ST_TERM = 255        /* Final state */
+} fsm_state_t;
+
+/* Events */
+typedef enum
+{
+    EV_NONE = 0,         /* No event */
+    EV_CMD_ON,           /* Command to activate received */
+    EV_CMD_OFF,          /* Command to deactivate received */
+    EV_ACK_RECEIVED,     /* Acknowledgement received */
+    EV_ACK_NOT_RECEIVED, /* Acknowledgement not received */
+    EV_TIMEOUT,          /* Timeout after 1 second */
+    EV_ERR = 255         /* Error event */
+} fsm_event_t;
+
+/***** Static Functions Declarations *****************************************/
+
+static int callback_init(void);
+static int callback_cmd_on(void);
+static int callback_cmd_off(void);
+static int callback_ack_received(void);
+static int callback_ack_not_received(void);
+static int callback_timeout(void);
+static int callback_error(void);
+static bool guard_ack_received(void);
+static int fsm_step(bool tick);
+
+/***** Static Variables ******************************************************/
+
+static fsm_state_t state = ST_INIT; /* State of the FSM */
+static fsm_trace_t trace;           /* Transition instrumentation */
+static uint8_t timer_counter = 0;   /* Timer for 1 second delay, increment each 100ms */
+
+/***** Static Functions Definitions ******************************************/
+
+/**
+ * \brief Evaluate the FSM once.
+ * \param tick : true for periodic 100ms evaluation, false for an immediate evaluation not advancing timers
+ * \return int : Return code of transition callback.
+ */
+static int fsm_step(bool tick)
+{
+    int ret = -1;
+    fsm_state_t previous = state;
+
+    fsm_trace_begin(&trace);
+    switch (state)
+    {
+    case ST_INIT:
+    {
+        fsm_trace_transition(&trace, 0u, ST_INIT, ST_OFF, EV_NONE);
+        state = ST_OFF;
+        ret = callback_init();
+        break;
+    }
+
+    case ST_OFF:
+    {
+        const bool hazard_on = (get_cmd_indic_hazard() == ON);
+        const bool left_on = (get_cmd_indic_left() == ON);
+        const bool right_on = (get_cmd_indic_right() == ON);
+
+        if (hazard_on || left_on || right_on)
+        {
+            fsm_trace_transition(&trace, 1u, ST_OFF, ST_ACTIVATED_ON, EV_CMD_ON);
+            state = ST_ACTIVATED_ON;
+            ret = callback_cmd_on();
+        }
+        break;
+    }
+
+    case ST_ACTIVATED_ON:
+    {
+        const bool hazard_on = (get_cmd_indic_hazard() == ON);
+        const bool left_on = (get_cmd_indic_left() == ON);
+        const bool right_on = (get_cmd_indic_right() == ON);
+        const bool cmd_off = ((!hazard_on && (get_cmd_indic_hazard() != get_flag_indic_hazard())) || (!left_on && (get_cmd_indic_left() != get_flag_indic_left())) || (!right_on && (get_cmd_indic_right() != get_flag_indic_right())));
+
+        if (tick)
+        {
+            timer_counter++;
+        }
+        if (cmd_off)
+        {
+            fsm_trace_transition(&trace, 2u, ST_ACTIVATED_ON, ST_OFF, EV_CMD_OFF);
+            state = ST_OFF;
+            ret = callback_cmd_off();
+        }
+        else if (timer_counter >= TIMER_1S_COUNT_100MS)
+        {
+            fsm_trace_transition(&trace, 4u, ST_ACTIVATED_ON, ST_ERROR, EV_ACK_NOT_RECEIVED);
+            state = ST_ERROR;
+            ret = callback_ack_not_received();
+        }
+        else if (guard_ack_received())
+        {
+            fsm_trace_transition(&trace, 3u, ST_ACTIVATED_ON, ST_ACKNOWLEDGED_ON, EV_ACK_RECEIVED);
+            state = ST_ACKNOWLEDGED_ON;
+            ret = callback_ack_received();
+        }
+        break;
+    }
+
+    case ST_ACTIVATED_OFF:
+    {
+        const bool hazard_on = (get_cmd_indic_hazard() == ON);
+        const bool left_on = (get_cmd_indic_left() == ON);
+        const bool right_on = (get_cmd_indic_right() == ON);
+        const bool cmd_off = ((!hazard_on && (get_cmd_indic_hazard() != get_flag_indic_hazard())) || (!left_on && (get_cmd_indic_left() != get_flag_indic_left())) || (!right_on && (get_cmd_indic_right() != get_flag_indic_right())));
+
+        if (tick)
+        {
+            timer_counter++;
+        }
+        if (cmd_off)
+        {
+            fsm_trace_transition(&trace, 5u, ST_ACTIVATED_OFF, ST_OFF, EV_CMD_OFF);
+            state = ST_OFF;
+            ret = callback_cmd_off();
+        }
+        else if (timer_counter >= TIMER_1S_COUNT_100MS)
+        {
+            fsm_trace_transition(&trace, 7u, ST_ACTIVATED_OFF, ST_ERROR, EV_ACK_NOT_RECEIVED);
+            state = ST_ERROR;
+            ret = callback_ack_not_received();
+        }
+        else if (guard_ack_received())
+        {
+            fsm_trace_transition(&trace, 6u, ST_ACTIVATED_OFF, ST_ACKNOWLEDGED_OFF, EV_ACK_RECEIVED);
+            state = ST_ACKNOWLEDGED_OFF;
+            ret = callback_ack_received();
+        }
+        break;
+    }
+
+    case ST_ACKNOWLEDGED_ON:
+    {
+        const bool hazard_on = (get_cmd_indic_hazard() == ON);
+        const bool left_on = (get_cmd_indic_left() == ON);
+        const bool right_on = (get_cmd_indic_right() == ON);
+        const bool cmd_off = ((!hazard_on && (get_cmd_indic_hazard() != get_flag_indic_hazard())) || (!left_on && (get_cmd_indic_left() != get_flag_indic_left())) || (!right_on && (get_cmd_indic_right() != get_flag_indic_right())));
+
+        if (tick)
+        {
+            timer_counter++;
+        }
+        if (cmd_off)
+        {
+            fsm_trace_transition(&trace, 8u, ST_ACKNOWLEDGED_ON, ST_OFF, EV_CMD_OFF);
+            state = ST_OFF;
+            ret = callback_cmd_off();
+        }
+        else if (timer_counter >= TIMER_1S_COUNT_100MS)
+        {
+            fsm_trace_transition(&trace, 9u, ST_ACKNOWLEDGED_ON, ST_ACTIVATED_OFF, EV_TIMEOUT);
+            state = ST_ACTIVATED_OFF;
+            ret = callback_timeout();
+        }
+        break;
+    }
+
+    case ST_ACKNOWLEDGED_OFF:
+    {
+        const bool hazard_on = (get_cmd_indic_hazard() == ON);
+        const bool left_on = (get_cmd_indic_left() == ON);
+        const bool right_on = (get_cmd_indic_right() == ON);
+        const bool cmd_off = ((!hazard_on && (get_cmd_indic_hazard() != get_flag_indic_hazard())) || (!left_on && (get_cmd_indic_left() != get_flag_indic_left())) || (!right_on && (get_cmd_indic_right() != get_flag_indic_right())));
+
+        if (tick)
+        {
+            timer_counter++;
+        }
+        if (cmd_off)
+        {
+            fsm_trace_transition(&trace, 10u, ST_ACKNOWLEDGED_OFF, ST_OFF, EV_CMD_OFF);
+            state = ST_OFF;
+            ret = callback_cmd_off();
+        }
+        else if (timer_counter >= TIMER_1S_COUNT_100MS)
+        {
+            fsm_trace_transition(&trace, 11u, ST_ACKNOWLEDGED_OFF, ST_ACTIVATED_ON, EV_TIMEOUT);
+            state = ST_ACTIVATED_ON;
+            ret = callback_timeout();
+        }
+        break;
+    }
+
+    case ST_ERROR:
+    {
+        fsm_trace_transition(&trace, 12u, ST_ERROR, ST_TERM, EV_ERR);
+        state = ST_TERM;
+        ret = callback_error();
+        break;
+    }
+
+    case ST_TERM:
+        break;
+
+    default:
+        fsm_trace_transition(&trace, 13u, state, ST_TERM, EV_ERR);
+        state = ST_TERM;
+        ret = callback_error();
+        break;
+    }
+    fsm_trace_end(&trace);
+
+    /* Keep the transitions leading to the final state */
+    if ((state == ST_TERM) && (previous != ST_TERM))
+    {
+        fsm_trace_dump("indicators", &trace.data);
+    }
+
+    return ret;
+}
+
+#endif /* FSM_INDICATORS_GEN_H */
@@ -0,0 +1,1385 @@
+/**
+ * \file fsm_indicators_product.c
+ * \brief Precomputed table of the indicators FSM.
+ * \details Generated by generator/gen_fsm_product.c (make fsm_product), do not edit.
+ * \author Raphael CAUSSE
+ */
+
+/***** Includes **************************************************************/
+
+#include "fsm_product.h"
+
+/***** Variables *************************************************************/
+
+const uint8_t fsm_product_indicators_next[14] = {1, 2, 1, 4, 6, 1, 5, 6, 1, 3, 1, 2, 255, 0};
+
+const uint8_t fsm_product_indicators_event[14] = {0, 1, 2, 3, 4, 2, 3, 4, 2, 5, 2, 5, 255, 0};
+
+const uint16_t fsm_product_indicators[16384] = {
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1000, 0x0812, 0x0822, 0x0832,
+    0x0842, 0x0852, 0x0862, 0x0872, 0x1010, 0x0812, 0x0832, 0x0832, 0x0852, 0x0852, 0x0872, 0x0872,
+    0x1020, 0x0832, 0x0822, 0x0832, 0x0862, 0x0872, 0x0862, 0x0872, 0x1030, 0x0832, 0x0832, 0x0832,
+    0x0872, 0x0872, 0x0872, 0x0872, 0x1040, 0x0852, 0x0862, 0x0872, 0x0842, 0x0852, 0x0862, 0x0872,
+    0x1050, 0x0852, 0x0872, 0x0872, 0x0852, 0x0852, 0x0872, 0x0872, 0x1060, 0x0872, 0x0862, 0x0872,
+    0x0862, 0x0872, 0x0862, 0x0872, 0x1070, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872,
+    0x1000, 0x0812, 0x0822, 0x0832, 0x0842, 0x0852, 0x0862, 0x0872, 0x1010, 0x0812, 0x0832, 0x0832,
+    0x0852, 0x0852, 0x0872, 0x0872, 0x1020, 0x0832, 0x0822, 0x0832, 0x0862, 0x0872, 0x0862, 0x0872,
+    0x1030, 0x0832, 0x0832, 0x0832, 0x0872, 0x0872, 0x0872, 0x0872, 0x1040, 0x0852, 0x0862, 0x0872,
+    0x0842, 0x0852, 0x0862, 0x0872, 0x1050, 0x0852, 0x0872, 0x0872, 0x0852, 0x0852, 0x0872, 0x0872,
+    0x1060, 0x0872, 0x0862, 0x0872, 0x0862, 0x0872, 0x0862, 0x0872, 0x1070, 0x0872, 0x0872, 0x0872,
+    0x0872, 0x0872, 0x0872, 0x0872, 0x1000, 0x0812, 0x0822, 0x0832, 0x0842, 0x0852, 0x0862, 0x0872,
+    0x1010, 0x0812, 0x0832, 0x0832, 0x0852, 0x0852, 0x0872, 0x0872, 0x1020, 0x0832, 0x0822, 0x0832,
+    0x0862, 0x0872, 0x0862, 0x0872, 0x1030, 0x0832, 0x0832, 0x0832, 0x0872, 0x0872, 0x0872, 0x0872,
+    0x1040, 0x0852, 0x0862, 0x0872, 0x0842, 0x0852, 0x0862, 0x0872, 0x1050, 0x0852, 0x0872, 0x0872,
+    0x0852, 0x0852, 0x0872, 0x0872, 0x1060, 0x0872, 0x0862, 0x0872, 0x0862, 0x0872, 0x0862, 0x0872,
+    0x1070, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872, 0x1000, 0x0812, 0x0822, 0x0832,
+    0x0842, 0x0852, 0x0862, 0x0872, 0x1010, 0x0812, 0x0832, 0x0832, 0x0852, 0x0852, 0x0872, 0x0872,
+    0x1020, 0x0832, 0x0822, 0x0832, 0x0862, 0x0872, 0x0862, 0x0872, 0x1030, 0x0832, 0x0832, 0x0832,
+    0x0872, 0x0872, 0x0872, 0x0872, 0x1040, 0x0852, 0x0862, 0x0872, 0x0842, 0x0852, 0x0862, 0x0872,
+    0x1050, 0x0852, 0x0872, 0x0872, 0x0852, 0x0852, 0x0872, 0x0872, 0x1060, 0x0872, 0x0862, 0x0872,
+    0x0862, 0x0872, 0x0862, 0x0872, 0x1070, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872,
+    0x1000, 0x0812, 0x0822, 0x0832, 0x0842, 0x0852, 0x0862, 0x0872, 0x1010, 0x0812, 0x0832, 0x0832,
+    0x0852, 0x0852, 0x0872, 0x0872, 0x1020, 0x0832, 0x0822, 0x0832, 0x0862, 0x0872, 0x0862, 0x0872,
+    0x1030, 0x0832, 0x0832, 0x0832, 0x0872, 0x0872, 0x0872, 0x0872, 0x1040, 0x0852, 0x0862, 0x0872,
+    0x0842, 0x0852, 0x0862, 0x0872, 0x1050, 0x0852, 0x0872, 0x0872, 0x0852, 0x0852, 0x0872, 0x0872,
+    0x1060, 0x0872, 0x0862, 0x0872, 0x0862, 0x0872, 0x0862, 0x0872, 0x1070, 0x0872, 0x0872, 0x0872,
+    0x0872, 0x0872, 0x0872, 0x0872, 0x1000, 0x0812, 0x0822, 0x0832, 0x0842, 0x0852, 0x0862, 0x0872,
+    0x1010, 0x0812, 0x0832, 0x0832, 0x0852, 0x0852, 0x0872, 0x0872, 0x1020, 0x0832, 0x0822, 0x0832,
+    0x0862, 0x0872, 0x0862, 0x0872, 0x1030, 0x0832, 0x0832, 0x0832, 0x0872, 0x0872, 0x0872, 0x0872,
+    0x1040, 0x0852, 0x0862, 0x0872, 0x0842, 0x0852, 0x0862, 0x0872, 0x1050, 0x0852, 0x0872, 0x0872,
+    0x0852, 0x0852, 0x0872, 0x0872, 0x1060, 0x0872, 0x0862, 0x0872, 0x0862, 0x0872, 0x0862, 0x0872,
+    0x1070, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872, 0x1000, 0x0812, 0x0822, 0x0832,
+    0x0842, 0x0852, 0x0862, 0x0872, 0x1010, 0x0812, 0x0832, 0x0832, 0x0852, 0x0852, 0x0872, 0x0872,
+    0x1020, 0x0832, 0x0822, 0x0832, 0x0862, 0x0872, 0x0862, 0x0872, 0x1030, 0x0832, 0x0832, 0x0832,
+    0x0872, 0x0872, 0x0872, 0x0872, 0x1040, 0x0852, 0x0862, 0x0872, 0x0842, 0x0852, 0x0862, 0x0872,
+    0x1050, 0x0852, 0x0872, 0x0872, 0x0852, 0x0852, 0x0872, 0x0872, 0x1060, 0x0872, 0x0862, 0x0872,
+    0x0862, 0x0872, 0x0862, 0x0872, 0x1070, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872,
+    0x1000, 0x0812, 0x0822, 0x0832, 0x0842, 0x0852, 0x0862, 0x0872, 0x1010, 0x0812, 0x0832, 0x0832,
+    0x0852, 0x0852, 0x0872, 0x0872, 0x1020, 0x0832, 0x0822, 0x0832, 0x0862, 0x0872, 0x0862, 0x0872,
+    0x1030, 0x0832, 0x0832, 0x0832, 0x0872, 0x0872, 0x0872, 0x0872, 0x1040, 0x0852, 0x0862, 0x0872,
+    0x0842, 0x0852, 0x0862, 0x0872, 0x1050, 0x0852, 0x0872, 0x0872, 0x0852, 0x0852, 0x0872, 0x0872,
+    0x1060, 0x0872, 0x0862, 0x0872, 0x0862, 0x0872, 0x0862, 0x0872, 0x1070, 0x0872, 0x0872, 0x0872,
+    0x0872, 0x0872, 0x0872, 0x0872, 0x1000, 0x0812, 0x0822, 0x0832, 0x0842, 0x0852, 0x0862, 0x0872,
+    0x1010, 0x0812, 0x0832, 0x0832, 0x0852, 0x0852, 0x0872, 0x0872, 0x1020, 0x0832, 0x0822, 0x0832,
+    0x0862, 0x0872, 0x0862, 0x0872, 0x1030, 0x0832, 0x0832, 0x0832, 0x0872, 0x0872, 0x0872, 0x0872,
+    0x1040, 0x0852, 0x0862, 0x0872, 0x0842, 0x0852, 0x0862, 0x0872, 0x1050, 0x0852, 0x0872, 0x0872,
+    0x0852, 0x0852, 0x0872, 0x0872, 0x1060, 0x0872, 0x0862, 0x0872, 0x0862, 0x0872, 0x0862, 0x0872,
+    0x1070, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872, 0x1000, 0x0812, 0x0822, 0x0832,
+    0x0842, 0x0852, 0x0862, 0x0872, 0x1010, 0x0812, 0x0832, 0x0832, 0x0852, 0x0852, 0x0872, 0x0872,
+    0x1020, 0x0832, 0x0822, 0x0832, 0x0862, 0x0872, 0x0862, 0x0872, 0x1030, 0x0832, 0x0832, 0x0832,
+    0x0872, 0x0872, 0x0872, 0x0872, 0x1040, 0x0852, 0x0862, 0x0872, 0x0842, 0x0852, 0x0862, 0x0872,
+    0x1050, 0x0852, 0x0872, 0x0872, 0x0852, 0x0852, 0x0872, 0x0872, 0x1060, 0x0872, 0x0862, 0x0872,
+    0x0862, 0x0872, 0x0862, 0x0872, 0x1070, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872,
+    0x1000, 0x0812, 0x0822, 0x0832, 0x0842, 0x0852, 0x0862, 0x0872, 0x1010, 0x0812, 0x0832, 0x0832,
+    0x0852, 0x0852, 0x0872, 0x0872, 0x1020, 0x0832, 0x0822, 0x0832, 0x0862, 0x0872, 0x0862, 0x0872,
+    0x1030, 0x0832, 0x0832, 0x0832, 0x0872, 0x0872, 0x0872, 0x0872, 0x1040, 0x0852, 0x0862, 0x0872,
+    0x0842, 0x0852, 0x0862, 0x0872, 0x1050, 0x0852, 0x0872, 0x0872, 0x0852, 0x0852, 0x0872, 0x0872,
+    0x1060, 0x0872, 0x0862, 0x0872, 0x0862, 0x0872, 0x0862, 0x0872, 0x1070, 0x0872, 0x0872, 0x0872,
+    0x0872, 0x0872, 0x0872, 0x0872, 0x1000, 0x0812, 0x0822, 0x0832, 0x0842, 0x0852, 0x0862, 0x0872,
+    0x1010, 0x0812, 0x0832, 0x0832, 0x0852, 0x0852, 0x0872, 0x0872, 0x1020, 0x0832, 0x0822, 0x0832,
+    0x0862, 0x0872, 0x0862, 0x0872, 0x1030, 0x0832, 0x0832, 0x0832, 0x0872, 0x0872, 0x0872, 0x0872,
+    0x1040, 0x0852, 0x0862, 0x0872, 0x0842, 0x0852, 0x0862, 0x0872, 0x1050, 0x0852, 0x0872, 0x0872,
+    0x0852, 0x0852, 0x0872, 0x0872, 0x1060, 0x0872, 0x0862, 0x0872, 0x0862, 0x0872, 0x0862, 0x0872,
+    0x1070, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872, 0x1000, 0x0812, 0x0822, 0x0832,
+    0x0842, 0x0852, 0x0862, 0x0872, 0x1010, 0x0812, 0x0832, 0x0832, 0x0852, 0x0852, 0x0872, 0x0872,
+    0x1020, 0x0832, 0x0822, 0x0832, 0x0862, 0x0872, 0x0862, 0x0872, 0x1030, 0x0832, 0x0832, 0x0832,
+    0x0872, 0x0872, 0x0872, 0x0872, 0x1040, 0x0852, 0x0862, 0x0872, 0x0842, 0x0852, 0x0862, 0x0872,
+    0x1050, 0x0852, 0x0872, 0x0872, 0x0852, 0x0852, 0x0872, 0x0872, 0x1060, 0x0872, 0x0862, 0x0872,
+    0x0862, 0x0872, 0x0862, 0x0872, 0x1070, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872,
+    0x1000, 0x0812, 0x0822, 0x0832, 0x0842, 0x0852, 0x0862, 0x0872, 0x1010, 0x0812, 0x0832, 0x0832,
+    0x0852, 0x0852, 0x0872, 0x0872, 0x1020, 0x0832, 0x0822, 0x0832, 0x0862, 0x0872, 0x0862, 0x0872,
+    0x1030, 0x0832, 0x0832, 0x0832, 0x0872, 0x0872, 0x0872, 0x0872, 0x1040, 0x0852, 0x0862, 0x0872,
+    0x0842, 0x0852, 0x0862, 0x0872, 0x1050, 0x0852, 0x0872, 0x0872, 0x0852, 0x0852, 0x0872, 0x0872,
+    0x1060, 0x0872, 0x0862, 0x0872, 0x0862, 0x0872, 0x0862, 0x0872, 0x1070, 0x0872, 0x0872, 0x0872,
+    0x0872, 0x0872, 0x0872, 0x0872, 0x1000, 0x0812, 0x0822, 0x0832, 0x0842, 0x0852, 0x0862, 0x0872,
+    0x1010, 0x0812, 0x0832, 0x0832, 0x0852, 0x0852, 0x0872, 0x0872, 0x1020, 0x0832, 0x0822, 0x0832,
+    0x0862, 0x0872, 0x0862, 0x0872, 0x1030, 0x0832, 0x0832, 0x0832, 0x0872, 0x0872, 0x0872, 0x0872,
+    0x1040, 0x0852, 0x0862, 0x0872, 0x0842, 0x0852, 0x0862, 0x0872, 0x1050, 0x0852, 0x0872, 0x0872,
+    0x0852, 0x0852, 0x0872, 0x0872, 0x1060, 0x0872, 0x0862, 0x0872, 0x0862, 0x0872, 0x0862, 0x0872,
+    0x1070, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872, 0x1000, 0x0812, 0x0822, 0x0832,
+    0x0842, 0x0852, 0x0862, 0x0872, 0x1010, 0x0812, 0x0832, 0x0832, 0x0852, 0x0852, 0x0872, 0x0872,
+    0x1020, 0x0832, 0x0822, 0x0832, 0x0862, 0x0872, 0x0862, 0x0872, 0x1030, 0x0832, 0x0832, 0x0832,
+    0x0872, 0x0872, 0x0872, 0x0872, 0x1040, 0x0852, 0x0862, 0x0872, 0x0842, 0x0852, 0x0862, 0x0872,
+    0x1050, 0x0852, 0x0872, 0x0872, 0x0852, 0x0852, 0x0872, 0x0872, 0x1060, 0x0872, 0x0862, 0x0872,
+    0x0862, 0x0872, 0x0862, 0x0872, 0x1070, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872,
+    0x1000, 0x0812, 0x0822, 0x0832, 0x0842, 0x0852, 0x0862, 0x0872, 0x1010, 0x0812, 0x0832, 0x0832,
+    0x0852, 0x0852, 0x0872, 0x0872, 0x1020, 0x0832, 0x0822, 0x0832, 0x0862, 0x0872, 0x0862, 0x0872,
+    0x1030, 0x0832, 0x0832, 0x0832, 0x0872, 0x0872, 0x0872, 0x0872, 0x1040, 0x0852, 0x0862, 0x0872,
+    0x0842, 0x0852, 0x0862, 0x0872, 0x1050, 0x0852, 0x0872, 0x0872, 0x0852, 0x0852, 0x0872, 0x0872,
+    0x1060, 0x0872, 0x0862, 0x0872, 0x0862, 0x0872, 0x0862, 0x0872, 0x1070, 0x0872, 0x0872, 0x0872,
+    0x0872, 0x0872, 0x0872, 0x0872, 0x1000, 0x0812, 0x0822, 0x0832, 0x0842, 0x0852, 0x0862, 0x0872,
+    0x1010, 0x0812, 0x0832, 0x0832, 0x0852, 0x0852, 0x0872, 0x0872, 0x1020, 0x0832, 0x0822, 0x0832,
+    0x0862, 0x0872, 0x0862, 0x0872, 0x1030, 0x0832, 0x0832, 0x0832, 0x0872, 0x0872, 0x0872, 0x0872,
+    0x1040, 0x0852, 0x0862, 0x0872, 0x0842, 0x0852, 0x0862, 0x0872, 0x1050, 0x0852, 0x0872, 0x0872,
+    0x0852, 0x0852, 0x0872, 0x0872, 0x1060, 0x0872, 0x0862, 0x0872, 0x0862, 0x0872, 0x0862, 0x0872,
+    0x1070, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872, 0x1000, 0x0812, 0x0822, 0x0832,
+    0x0842, 0x0852, 0x0862, 0x0872, 0x1010, 0x0812, 0x0832, 0x0832, 0x0852, 0x0852, 0x0872, 0x0872,
+    0x1020, 0x0832, 0x0822, 0x0832, 0x0862, 0x0872, 0x0862, 0x0872, 0x1030, 0x0832, 0x0832, 0x0832,
+    0x0872, 0x0872, 0x0872, 0x0872, 0x1040, 0x0852, 0x0862, 0x0872, 0x0842, 0x0852, 0x0862, 0x0872,
+    0x1050, 0x0852, 0x0872, 0x0872, 0x0852, 0x0852, 0x0872, 0x0872, 0x1060, 0x0872, 0x0862, 0x0872,
+    0x0862, 0x0872, 0x0862, 0x0872, 0x1070, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872,
+    0x1000, 0x0812, 0x0822, 0x0832, 0x0842, 0x0852, 0x0862, 0x0872, 0x1010, 0x0812, 0x0832, 0x0832,
+    0x0852, 0x0852, 0x0872, 0x0872, 0x1020, 0x0832, 0x0822, 0x0832, 0x0862, 0x0872, 0x0862, 0x0872,
+    0x1030, 0x0832, 0x0832, 0x0832, 0x0872, 0x0872, 0x0872, 0x0872, 0x1040, 0x0852, 0x0862, 0x0872,
+    0x0842, 0x0852, 0x0862, 0x0872, 0x1050, 0x0852, 0x0872, 0x0872, 0x0852, 0x0852, 0x0872, 0x0872,
+    0x1060, 0x0872, 0x0862, 0x0872, 0x0862, 0x0872, 0x0862, 0x0872, 0x1070, 0x0872, 0x0872, 0x0872,
+    0x0872, 0x0872, 0x0872, 0x0872, 0x1000, 0x0812, 0x0822, 0x0832, 0x0842, 0x0852, 0x0862, 0x0872,
+    0x1010, 0x0812, 0x0832, 0x0832, 0x0852, 0x0852, 0x0872, 0x0872, 0x1020, 0x0832, 0x0822, 0x0832,
+    0x0862, 0x0872, 0x0862, 0x0872, 0x1030, 0x0832, 0x0832, 0x0832, 0x0872, 0x0872, 0x0872, 0x0872,
+    0x1040, 0x0852, 0x0862, 0x0872, 0x0842, 0x0852, 0x0862, 0x0872, 0x1050, 0x0852, 0x0872, 0x0872,
+    0x0852, 0x0852, 0x0872, 0x0872, 0x1060, 0x0872, 0x0862, 0x0872, 0x0862, 0x0872, 0x0862, 0x0872,
+    0x1070, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872, 0x1000, 0x0812, 0x0822, 0x0832,
+    0x0842, 0x0852, 0x0862, 0x0872, 0x1010, 0x0812, 0x0832, 0x0832, 0x0852, 0x0852, 0x0872, 0x0872,
+    0x1020, 0x0832, 0x0822, 0x0832, 0x0862, 0x0872, 0x0862, 0x0872, 0x1030, 0x0832, 0x0832, 0x0832,
+    0x0872, 0x0872, 0x0872, 0x0872, 0x1040, 0x0852, 0x0862, 0x0872, 0x0842, 0x0852, 0x0862, 0x0872,
+    0x1050, 0x0852, 0x0872, 0x0872, 0x0852, 0x0852, 0x0872, 0x0872, 0x1060, 0x0872, 0x0862, 0x0872,
+    0x0862, 0x0872, 0x0862, 0x0872, 0x1070, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872,
+    0x1000, 0x0812, 0x0822, 0x0832, 0x0842, 0x0852, 0x0862, 0x0872, 0x1010, 0x0812, 0x0832, 0x0832,
+    0x0852, 0x0852, 0x0872, 0x0872, 0x1020, 0x0832, 0x0822, 0x0832, 0x0862, 0x0872, 0x0862, 0x0872,
+    0x1030, 0x0832, 0x0832, 0x0832, 0x0872, 0x0872, 0x0872, 0x0872, 0x1040, 0x0852, 0x0862, 0x0872,
+    0x0842, 0x0852, 0x0862, 0x0872, 0x1050, 0x0852, 0x0872, 0x0872, 0x0852, 0x0852, 0x0872, 0x0872,
+    0x1060, 0x0872, 0x0862, 0x0872, 0x0862, 0x0872, 0x0862, 0x0872, 0x1070, 0x0872, 0x0872, 0x0872,
+    0x0872, 0x0872, 0x0872, 0x0872, 0x1000, 0x0812, 0x0822, 0x0832, 0x0842, 0x0852, 0x0862, 0x0872,
+    0x1010, 0x0812, 0x0832, 0x0832, 0x0852, 0x0852, 0x0872, 0x0872, 0x1020, 0x0832, 0x0822, 0x0832,
+    0x0862, 0x0872, 0x0862, 0x0872, 0x1030, 0x0832, 0x0832, 0x0832, 0x0872, 0x0872, 0x0872, 0x0872,
+    0x1040, 0x0852, 0x0862, 0x0872, 0x0842, 0x0852, 0x0862, 0x0872, 0x1050, 0x0852, 0x0872, 0x0872,
+    0x0852, 0x0852, 0x0872, 0x0872, 0x1060, 0x0872, 0x0862, 0x0872, 0x0862, 0x0872, 0x0862, 0x0872,
+    0x1070, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872, 0x0872, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x0003, 0x1010, 0x0003, 0x1010, 0x0003, 0x1010, 0x0003, 0x1010, 0x0003, 0x0003, 0x1020, 0x1020,
+    0x0003, 0x0003, 0x1020, 0x1020, 0x0003, 0x0013, 0x0023, 0x1030, 0x0003, 0x0013, 0x0023, 0x1030,
+    0x0003, 0x0003, 0x0003, 0x0003, 0x1040, 0x1040, 0x1040, 0x1040, 0x0003, 0x0013, 0x0003, 0x0013,
+    0x0043, 0x1050, 0x0043, 0x1050, 0x0003, 0x0003, 0x0023, 0x0023, 0x0043, 0x0043, 0x1060, 0x1060,
+    0x0003, 0x0013, 0x0023, 0x0033, 0x0043, 0x0053, 0x0063, 0x1070, 0x1000, 0x1000, 0x0084, 0x0084,
+    0x1000, 0x1000, 0x0084, 0x0084, 0x0003, 0x1010, 0x0003, 0x0094, 0x0003, 0x1010, 0x0003, 0x0094,
+    0x0003, 0x0003, 0x00a4, 0x00a4, 0x0003, 0x0003, 0x00a4, 0x00a4, 0x0003, 0x0013, 0x0023, 0x00b4,
+    0x0003, 0x0013, 0x0023, 0x00b4, 0x0003, 0x0003, 0x0003, 0x0003, 0x1040, 0x1040, 0x00c4, 0x00c4,
+    0x0003, 0x0013, 0x0003, 0x0013, 0x0043, 0x1050, 0x0043, 0x00d4, 0x0003, 0x0003, 0x0023, 0x0023,
+    0x0043, 0x0043, 0x00e4, 0x00e4, 0x0003, 0x0013, 0x0023, 0x0033, 0x0043, 0x0053, 0x0063, 0x00f4,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x0104, 0x0104, 0x0104, 0x0104, 0x0003, 0x1010, 0x0003, 0x1010,
+    0x0003, 0x0114, 0x0003, 0x0114, 0x0003, 0x0003, 0x1020, 0x1020, 0x0003, 0x0003, 0x0124, 0x0124,
+    0x0003, 0x0013, 0x0023, 0x1030, 0x0003, 0x0013, 0x0023, 0x0134, 0x0003, 0x0003, 0x0003, 0x0003,
+    0x0144, 0x0144, 0x0144, 0x0144, 0x0003, 0x0013, 0x0003, 0x0013, 0x0043, 0x0154, 0x0043, 0x0154,
+    0x0003, 0x0003, 0x0023, 0x0023, 0x0043, 0x0043, 0x0164, 0x0164, 0x0003, 0x0013, 0x0023, 0x0033,
+    0x0043, 0x0053, 0x0063, 0x0174, 0x1000, 0x0184, 0x0084, 0x0184, 0x0104, 0x0184, 0x0184, 0x0184,
+    0x0003, 0x0194, 0x0003, 0x0194, 0x0003, 0x0194, 0x0003, 0x0194, 0x0003, 0x0003, 0x00a4, 0x01a4,
+    0x0003, 0x0003, 0x01a4, 0x01a4, 0x0003, 0x0013, 0x0023, 0x01b4, 0x0003, 0x0013, 0x0023, 0x01b4,
+    0x0003, 0x0003, 0x0003, 0x0003, 0x0144, 0x01c4, 0x01c4, 0x01c4, 0x0003, 0x0013, 0x0003, 0x0013,
+    0x0043, 0x01d4, 0x0043, 0x01d4, 0x0003, 0x0003, 0x0023, 0x0023, 0x0043, 0x0043, 0x01e4, 0x01e4,
+    0x0003, 0x0013, 0x0023, 0x0033, 0x0043, 0x0053, 0x0063, 0x01f4, 0x1400, 0x1400, 0x1400, 0x1400,
+    0x1400, 0x1400, 0x1400, 0x1400, 0x0403, 0x1410, 0x0403, 0x1410, 0x0403, 0x1410, 0x0403, 0x1410,
+    0x0403, 0x0403, 0x1420, 0x1420, 0x0403, 0x0403, 0x1420, 0x1420, 0x0403, 0x0413, 0x0423, 0x1430,
+    0x0403, 0x0413, 0x0423, 0x1430, 0x0403, 0x0403, 0x0403, 0x0403, 0x1440, 0x1440, 0x1440, 0x1440,
+    0x0403, 0x0413, 0x0403, 0x0413, 0x0443, 0x1450, 0x0443, 0x1450, 0x0403, 0x0403, 0x0423, 0x0423,
+    0x0443, 0x0443, 0x1460, 0x1460, 0x0403, 0x0413, 0x0423, 0x0433, 0x0443, 0x0453, 0x0463, 0x1470,
+    0x1400, 0x1400, 0x0484, 0x0484, 0x1400, 0x1400, 0x0484, 0x0484, 0x0403, 0x1410, 0x0403, 0x0494,
+    0x0403, 0x1410, 0x0403, 0x0494, 0x0403, 0x0403, 0x04a4, 0x04a4, 0x0403, 0x0403, 0x04a4, 0x04a4,
+    0x0403, 0x0413, 0x0423, 0x04b4, 0x0403, 0x0413, 0x0423, 0x04b4, 0x0403, 0x0403, 0x0403, 0x0403,
+    0x1440, 0x1440, 0x04c4, 0x04c4, 0x0403, 0x0413, 0x0403, 0x0413, 0x0443, 0x1450, 0x0443, 0x04d4,
+    0x0403, 0x0403, 0x0423, 0x0423, 0x0443, 0x0443, 0x04e4, 0x04e4, 0x0403, 0x0413, 0x0423, 0x0433,
+    0x0443, 0x0453, 0x0463, 0x04f4, 0x1400, 0x1400, 0x1400, 0x1400, 0x0504, 0x0504, 0x0504, 0x0504,
+    0x0403, 0x1410, 0x0403, 0x1410, 0x0403, 0x0514, 0x0403, 0x0514, 0x0403, 0x0403, 0x1420, 0x1420,
+    0x0403, 0x0403, 0x0524, 0x0524, 0x0403, 0x0413, 0x0423, 0x1430, 0x0403, 0x0413, 0x0423, 0x0534,
+    0x0403, 0x0403, 0x0403, 0x0403, 0x0544, 0x0544, 0x0544, 0x0544, 0x0403, 0x0413, 0x0403, 0x0413,
+    0x0443, 0x0554, 0x0443, 0x0554, 0x0403, 0x0403, 0x0423, 0x0423, 0x0443, 0x0443, 0x0564, 0x0564,
+    0x0403, 0x0413, 0x0423, 0x0433, 0x0443, 0x0453, 0x0463, 0x0574, 0x1400, 0x0584, 0x0484, 0x0584,
+    0x0504, 0x0584, 0x0584, 0x0584, 0x0403, 0x0594, 0x0403, 0x0594, 0x0403, 0x0594, 0x0403, 0x0594,
+    0x0403, 0x0403, 0x04a4, 0x05a4, 0x0403, 0x0403, 0x05a4, 0x05a4, 0x0403, 0x0413, 0x0423, 0x05b4,
+    0x0403, 0x0413, 0x0423, 0x05b4, 0x0403, 0x0403, 0x0403, 0x0403, 0x0544, 0x05c4, 0x05c4, 0x05c4,
+    0x0403, 0x0413, 0x0403, 0x0413, 0x0443, 0x05d4, 0x0443, 0x05d4, 0x0403, 0x0403, 0x0423, 0x0423,
+    0x0443, 0x0443, 0x05e4, 0x05e4, 0x0403, 0x0413, 0x0423, 0x0433, 0x0443, 0x0453, 0x0463, 0x05f4,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x0003, 0x1010, 0x0003, 0x1010,
+    0x0003, 0x1010, 0x0003, 0x1010, 0x0003, 0x0003, 0x1020, 0x1020, 0x0003, 0x0003, 0x1020, 0x1020,
+    0x0003, 0x0013, 0x0023, 0x1030, 0x0003, 0x0013, 0x0023, 0x1030, 0x0003, 0x0003, 0x0003, 0x0003,
+    0x1040, 0x1040, 0x1040, 0x1040, 0x0003, 0x0013, 0x0003, 0x0013, 0x0043, 0x1050, 0x0043, 0x1050,
+    0x0003, 0x0003, 0x0023, 0x0023, 0x0043, 0x0043, 0x1060, 0x1060, 0x0003, 0x0013, 0x0023, 0x0033,
+    0x0043, 0x0053, 0x0063, 0x1070, 0x1000, 0x1000, 0x0084, 0x0084, 0x1000, 0x1000, 0x0084, 0x0084,
+    0x0003, 0x1010, 0x0003, 0x0094, 0x0003, 0x1010, 0x0003, 0x0094, 0x0003, 0x0003, 0x00a4, 0x00a4,
+    0x0003, 0x0003, 0x00a4, 0x00a4, 0x0003, 0x0013, 0x0023, 0x00b4, 0x0003, 0x0013, 0x0023, 0x00b4,
+    0x0003, 0x0003, 0x0003, 0x0003, 0x1040, 0x1040, 0x00c4, 0x00c4, 0x0003, 0x0013, 0x0003, 0x0013,
+    0x0043, 0x1050, 0x0043, 0x00d4, 0x0003, 0x0003, 0x0023, 0x0023, 0x0043, 0x0043, 0x00e4, 0x00e4,
+    0x0003, 0x0013, 0x0023, 0x0033, 0x0043, 0x0053, 0x0063, 0x00f4, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x0104, 0x0104, 0x0104, 0x0104, 0x0003, 0x1010, 0x0003, 0x1010, 0x0003, 0x0114, 0x0003, 0x0114,
+    0x0003, 0x0003, 0x1020, 0x1020, 0x0003, 0x0003, 0x0124, 0x0124, 0x0003, 0x0013, 0x0023, 0x1030,
+    0x0003, 0x0013, 0x0023, 0x0134, 0x0003, 0x0003, 0x0003, 0x0003, 0x0144, 0x0144, 0x0144, 0x0144,
+    0x0003, 0x0013, 0x0003, 0x0013, 0x0043, 0x0154, 0x0043, 0x0154, 0x0003, 0x0003, 0x0023, 0x0023,
+    0x0043, 0x0043, 0x0164, 0x0164, 0x0003, 0x0013, 0x0023, 0x0033, 0x0043, 0x0053, 0x0063, 0x0174,
+    0x1000, 0x0184, 0x0084, 0x0184, 0x0104, 0x0184, 0x0184, 0x0184, 0x0003, 0x0194, 0x0003, 0x0194,
+    0x0003, 0x0194, 0x0003, 0x0194, 0x0003, 0x0003, 0x00a4, 0x01a4, 0x0003, 0x0003, 0x01a4, 0x01a4,
+    0x0003, 0x0013, 0x0023, 0x01b4, 0x0003, 0x0013, 0x0023, 0x01b4, 0x0003, 0x0003, 0x0003, 0x0003,
+    0x0144, 0x01c4, 0x01c4, 0x01c4, 0x0003, 0x0013, 0x0003, 0x0013, 0x0043, 0x01d4, 0x0043, 0x01d4,
+    0x0003, 0x0003, 0x0023, 0x0023, 0x0043, 0x0043, 0x01e4, 0x01e4, 0x0003, 0x0013, 0x0023, 0x0033,
+    0x0043, 0x0053, 0x0063, 0x01f4, 0x0805, 0x0805, 0x0805, 0x0805, 0x0805, 0x0805, 0x0805, 0x0805,
+    0x0403, 0x0815, 0x0403, 0x0815, 0x0403, 0x0815, 0x0403, 0x0815, 0x0403, 0x0403, 0x0825, 0x0825,
+    0x0403, 0x0403, 0x0825, 0x0825, 0x0403, 0x0413, 0x0423, 0x0835, 0x0403, 0x0413, 0x0423, 0x0835,
+    0x0403, 0x0403, 0x0403, 0x0403, 0x0845, 0x0845, 0x0845, 0x0845, 0x0403, 0x0413, 0x0403, 0x0413,
+    0x0443, 0x0855, 0x0443, 0x0855, 0x0403, 0x0403, 0x0423, 0x0423, 0x0443, 0x0443, 0x0865, 0x0865,
+    0x0403, 0x0413, 0x0423, 0x0433, 0x0443, 0x0453, 0x0463, 0x0875, 0x0805, 0x0805, 0x0805, 0x0805,
+    0x0805, 0x0805, 0x0805, 0x0805, 0x0403, 0x0815, 0x0403, 0x0815, 0x0403, 0x0815, 0x0403, 0x0815,
+    0x0403, 0x0403, 0x0825, 0x0825, 0x0403, 0x0403, 0x0825, 0x0825, 0x0403, 0x0413, 0x0423, 0x0835,
+    0x0403, 0x0413, 0x0423, 0x0835, 0x0403, 0x0403, 0x0403, 0x0403, 0x0845, 0x0845, 0x0845, 0x0845,
+    0x0403, 0x0413, 0x0403, 0x0413, 0x0443, 0x0855, 0x0443, 0x0855, 0x0403, 0x0403, 0x0423, 0x0423,
+    0x0443, 0x0443, 0x0865, 0x0865, 0x0403, 0x0413, 0x0423, 0x0433, 0x0443, 0x0453, 0x0463, 0x0875,
+    0x0805, 0x0805, 0x0805, 0x0805, 0x0805, 0x0805, 0x0805, 0x0805, 0x0403, 0x0815, 0x0403, 0x0815,
+    0x0403, 0x0815, 0x0403, 0x0815, 0x0403, 0x0403, 0x0825, 0x0825, 0x0403, 0x0403, 0x0825, 0x0825,
+    0x0403, 0x0413, 0x0423, 0x0835, 0x0403, 0x0413, 0x0423, 0x0835, 0x0403, 0x0403, 0x0403, 0x0403,
+    0x0845, 0x0845, 0x0845, 0x0845, 0x0403, 0x0413, 0x0403, 0x0413, 0x0443, 0x0855, 0x0443, 0x0855,
+    0x0403, 0x0403, 0x0423, 0x0423, 0x0443, 0x0443, 0x0865, 0x0865, 0x0403, 0x0413, 0x0423, 0x0433,
+    0x0443, 0x0453, 0x0463, 0x0875, 0x0805, 0x0805, 0x0805, 0x0805, 0x0805, 0x0805, 0x0805, 0x0805,
+    0x0403, 0x0815, 0x0403, 0x0815, 0x0403, 0x0815, 0x0403, 0x0815, 0x0403, 0x0403, 0x0825, 0x0825,
+    0x0403, 0x0403, 0x0825, 0x0825, 0x0403, 0x0413, 0x0423, 0x0835, 0x0403, 0x0413, 0x0423, 0x0835,
+    0x0403, 0x0403, 0x0403, 0x0403, 0x0845, 0x0845, 0x0845, 0x0845, 0x0403, 0x0413, 0x0403, 0x0413,
+    0x0443, 0x0855, 0x0443, 0x0855, 0x0403, 0x0403, 0x0423, 0x0423, 0x0443, 0x0443, 0x0865, 0x0865,
+    0x0403, 0x0413, 0x0423, 0x0433, 0x0443, 0x0453, 0x0463, 0x0875, 0x0805, 0x0805, 0x0805, 0x0805,
+    0x0805, 0x0805, 0x0805, 0x0805, 0x0003, 0x0815, 0x0003, 0x0815, 0x0003, 0x0815, 0x0003, 0x0815,
+    0x0003, 0x0003, 0x0825, 0x0825, 0x0003, 0x0003, 0x0825, 0x0825, 0x0003, 0x0013, 0x0023, 0x0835,
+    0x0003, 0x0013, 0x0023, 0x0835, 0x0003, 0x0003, 0x0003, 0x0003, 0x0845, 0x0845, 0x0845, 0x0845,
+    0x0003, 0x0013, 0x0003, 0x0013, 0x0043, 0x0855, 0x0043, 0x0855, 0x0003, 0x0003, 0x0023, 0x0023,
+    0x0043, 0x0043, 0x0865, 0x0865, 0x0003, 0x0013, 0x0023, 0x0033, 0x0043, 0x0053, 0x0063, 0x0875,
+    0x0805, 0x0805, 0x0805, 0x0805, 0x0805, 0x0805, 0x0805, 0x0805, 0x0003, 0x0815, 0x0003, 0x0815,
+    0x0003, 0x0815, 0x0003, 0x0815, 0x0003, 0x0003, 0x0825, 0x0825, 0x0003, 0x0003, 0x0825, 0x0825,
+    0x0003, 0x0013, 0x0023, 0x0835, 0x0003, 0x0013, 0x0023, 0x0835, 0x0003, 0x0003, 0x0003, 0x0003,
+    0x0845, 0x0845, 0x0845, 0x0845, 0x0003, 0x0013, 0x0003, 0x0013, 0x0043, 0x0855, 0x0043, 0x0855,
+    0x0003, 0x0003, 0x0023, 0x0023, 0x0043, 0x0043, 0x0865, 0x0865, 0x0003, 0x0013, 0x0023, 0x0033,
+    0x0043, 0x0053, 0x0063, 0x0875, 0x0805, 0x0805, 0x0805, 0x0805, 0x0805, 0x0805, 0x0805, 0x0805,
+    0x0003, 0x0815, 0x0003, 0x0815, 0x0003, 0x0815, 0x0003, 0x0815, 0x0003, 0x0003, 0x0825, 0x0825,
+    0x0003, 0x0003, 0x0825, 0x0825, 0x0003, 0x0013, 0x0023, 0x0835, 0x0003, 0x0013, 0x0023, 0x0835,
+    0x0003, 0x0003, 0x0003, 0x0003, 0x0845, 0x0845, 0x0845, 0x0845, 0x0003, 0x0013, 0x0003, 0x0013,
+    0x0043, 0x0855, 0x0043, 0x0855, 0x0003, 0x0003, 0x0023, 0x0023, 0x0043, 0x0043, 0x0865, 0x0865,
+    0x0003, 0x0013, 0x0023, 0x0033, 0x0043, 0x0053, 0x0063, 0x0875, 0x0805, 0x0805, 0x0805, 0x0805,
+    0x0805, 0x0805, 0x0805, 0x0805, 0x0003, 0x0815, 0x0003, 0x0815, 0x0003, 0x0815, 0x0003, 0x0815,
+    0x0003, 0x0003, 0x0825, 0x0825, 0x0003, 0x0003, 0x0825, 0x0825, 0x0003, 0x0013, 0x0023, 0x0835,
+    0x0003, 0x0013, 0x0023, 0x0835, 0x0003, 0x0003, 0x0003, 0x0003, 0x0845, 0x0845, 0x0845, 0x0845,
+    0x0003, 0x0013, 0x0003, 0x0013, 0x0043, 0x0855, 0x0043, 0x0855, 0x0003, 0x0003, 0x0023, 0x0023,
+    0x0043, 0x0043, 0x0865, 0x0865, 0x0003, 0x0013, 0x0023, 0x0033, 0x0043, 0x0053, 0x0063, 0x0875,
+    0x0805, 0x0805, 0x0805, 0x0805, 0x0805, 0x0805, 0x0805, 0x0805, 0x0403, 0x0815, 0x0403, 0x0815,
+    0x0403, 0x0815, 0x0403, 0x0815, 0x0403, 0x0403, 0x0825, 0x0825, 0x0403, 0x0403, 0x0825, 0x0825,
+    0x0403, 0x0413, 0x0423, 0x0835, 0x0403, 0x0413, 0x0423, 0x0835, 0x0403, 0x0403, 0x0403, 0x0403,
+    0x0845, 0x0845, 0x0845, 0x0845, 0x0403, 0x0413, 0x0403, 0x0413, 0x0443, 0x0855, 0x0443, 0x0855,
+    0x0403, 0x0403, 0x0423, 0x0423, 0x0443, 0x0443, 0x0865, 0x0865, 0x0403, 0x0413, 0x0423, 0x0433,
+    0x0443, 0x0453, 0x0463, 0x0875, 0x0805, 0x0805, 0x0805, 0x0805, 0x0805, 0x0805, 0x0805, 0x0805,
+    0x0403, 0x0815, 0x0403, 0x0815, 0x0403, 0x0815, 0x0403, 0x0815, 0x0403, 0x0403, 0x0825, 0x0825,
+    0x0403, 0x0403, 0x0825, 0x0825, 0x0403, 0x0413, 0x0423, 0x0835, 0x0403, 0x0413, 0x0423, 0x0835,
+    0x0403, 0x0403, 0x0403, 0x0403, 0x0845, 0x0845, 0x0845, 0x0845, 0x0403, 0x0413, 0x0403, 0x0413,
+    0x0443, 0x0855, 0x0443, 0x0855, 0x0403, 0x0403, 0x0423, 0x0423, 0x0443, 0x0443, 0x0865, 0x0865,
+    0x0403, 0x0413, 0x0423, 0x0433, 0x0443, 0x0453, 0x0463, 0x0875, 0x0805, 0x0805, 0x0805, 0x0805,
+    0x0805, 0x0805, 0x0805, 0x0805, 0x0403, 0x0815, 0x0403, 0x0815, 0x0403, 0x0815, 0x0403, 0x0815,
+    0x0403, 0x0403, 0x0825, 0x0825, 0x0403, 0x0403, 0x0825, 0x0825, 0x0403, 0x0413, 0x0423, 0x0835,
+    0x0403, 0x0413, 0x0423, 0x0835, 0x0403, 0x0403, 0x0403, 0x0403, 0x0845, 0x0845, 0x0845, 0x0845,
+    0x0403, 0x0413, 0x0403, 0x0413, 0x0443, 0x0855, 0x0443, 0x0855, 0x0403, 0x0403, 0x0423, 0x0423,
+    0x0443, 0x0443, 0x0865, 0x0865, 0x0403, 0x0413, 0x0423, 0x0433, 0x0443, 0x0453, 0x0463, 0x0875,
+    0x0805, 0x0805, 0x0805, 0x0805, 0x0805, 0x0805, 0x0805, 0x0805, 0x0403, 0x0815, 0x0403, 0x0815,
+    0x0403, 0x0815, 0x0403, 0x0815, 0x0403, 0x0403, 0x0825, 0x0825, 0x0403, 0x0403, 0x0825, 0x0825,
+    0x0403, 0x0413, 0x0423, 0x0835, 0x0403, 0x0413, 0x0423, 0x0835, 0x0403, 0x0403, 0x0403, 0x0403,
+    0x0845, 0x0845, 0x0845, 0x0845, 0x0403, 0x0413, 0x0403, 0x0413, 0x0443, 0x0855, 0x0443, 0x0855,
+    0x0403, 0x0403, 0x0423, 0x0423, 0x0443, 0x0443, 0x0865, 0x0865, 0x0403, 0x0413, 0x0423, 0x0433,
+    0x0443, 0x0453, 0x0463, 0x0875, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x0006, 0x1010, 0x0006, 0x1010,
+    0x0006, 0x1010, 0x0006, 0x1010, 0x0006, 0x0006, 0x1020, 0x1020, 0x0006, 0x0006, 0x1020, 0x1020,
+    0x0006, 0x0016, 0x0026, 0x1030, 0x0006, 0x0016, 0x0026, 0x1030, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x1040, 0x1040, 0x1040, 0x1040, 0x0006, 0x0016, 0x0006, 0x0016, 0x0046, 0x1050, 0x0046, 0x1050,
+    0x0006, 0x0006, 0x0026, 0x0026, 0x0046, 0x0046, 0x1060, 0x1060, 0x0006, 0x0016, 0x0026, 0x0036,
+    0x0046, 0x0056, 0x0066, 0x1070, 0x1000, 0x1000, 0x0087, 0x0087, 0x1000, 0x1000, 0x0087, 0x0087,
+    0x0006, 0x1010, 0x0006, 0x0097, 0x0006, 0x1010, 0x0006, 0x0097, 0x0006, 0x0006, 0x00a7, 0x00a7,
+    0x0006, 0x0006, 0x00a7, 0x00a7, 0x0006, 0x0016, 0x0026, 0x00b7, 0x0006, 0x0016, 0x0026, 0x00b7,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x1040, 0x1040, 0x00c7, 0x00c7, 0x0006, 0x0016, 0x0006, 0x0016,
+    0x0046, 0x1050, 0x0046, 0x00d7, 0x0006, 0x0006, 0x0026, 0x0026, 0x0046, 0x0046, 0x00e7, 0x00e7,
+    0x0006, 0x0016, 0x0026, 0x0036, 0x0046, 0x0056, 0x0066, 0x00f7, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x0107, 0x0107, 0x0107, 0x0107, 0x0006, 0x1010, 0x0006, 0x1010, 0x0006, 0x0117, 0x0006, 0x0117,
+    0x0006, 0x0006, 0x1020, 0x1020, 0x0006, 0x0006, 0x0127, 0x0127, 0x0006, 0x0016, 0x0026, 0x1030,
+    0x0006, 0x0016, 0x0026, 0x0137, 0x0006, 0x0006, 0x0006, 0x0006, 0x0147, 0x0147, 0x0147, 0x0147,
+    0x0006, 0x0016, 0x0006, 0x0016, 0x0046, 0x0157, 0x0046, 0x0157, 0x0006, 0x0006, 0x0026, 0x0026,
+    0x0046, 0x0046, 0x0167, 0x0167, 0x0006, 0x0016, 0x0026, 0x0036, 0x0046, 0x0056, 0x0066, 0x0177,
+    0x1000, 0x0187, 0x0087, 0x0187, 0x0107, 0x0187, 0x0187, 0x0187, 0x0006, 0x0197, 0x0006, 0x0197,
+    0x0006, 0x0197, 0x0006, 0x0197, 0x0006, 0x0006, 0x00a7, 0x01a7, 0x0006, 0x0006, 0x01a7, 0x01a7,
+    0x0006, 0x0016, 0x0026, 0x01b7, 0x0006, 0x0016, 0x0026, 0x01b7, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0147, 0x01c7, 0x01c7, 0x01c7, 0x0006, 0x0016, 0x0006, 0x0016, 0x0046, 0x01d7, 0x0046, 0x01d7,
+    0x0006, 0x0006, 0x0026, 0x0026, 0x0046, 0x0046, 0x01e7, 0x01e7, 0x0006, 0x0016, 0x0026, 0x0036,
+    0x0046, 0x0056, 0x0066, 0x01f7, 0x1400, 0x1400, 0x1400, 0x1400, 0x1400, 0x1400, 0x1400, 0x1400,
+    0x0406, 0x1410, 0x0406, 0x1410, 0x0406, 0x1410, 0x0406, 0x1410, 0x0406, 0x0406, 0x1420, 0x1420,
+    0x0406, 0x0406, 0x1420, 0x1420, 0x0406, 0x0416, 0x0426, 0x1430, 0x0406, 0x0416, 0x0426, 0x1430,
+    0x0406, 0x0406, 0x0406, 0x0406, 0x1440, 0x1440, 0x1440, 0x1440, 0x0406, 0x0416, 0x0406, 0x0416,
+    0x0446, 0x1450, 0x0446, 0x1450, 0x0406, 0x0406, 0x0426, 0x0426, 0x0446, 0x0446, 0x1460, 0x1460,
+    0x0406, 0x0416, 0x0426, 0x0436, 0x0446, 0x0456, 0x0466, 0x1470, 0x1400, 0x1400, 0x0487, 0x0487,
+    0x1400, 0x1400, 0x0487, 0x0487, 0x0406, 0x1410, 0x0406, 0x0497, 0x0406, 0x1410, 0x0406, 0x0497,
+    0x0406, 0x0406, 0x04a7, 0x04a7, 0x0406, 0x0406, 0x04a7, 0x04a7, 0x0406, 0x0416, 0x0426, 0x04b7,
+    0x0406, 0x0416, 0x0426, 0x04b7, 0x0406, 0x0406, 0x0406, 0x0406, 0x1440, 0x1440, 0x04c7, 0x04c7,
+    0x0406, 0x0416, 0x0406, 0x0416, 0x0446, 0x1450, 0x0446, 0x04d7, 0x0406, 0x0406, 0x0426, 0x0426,
+    0x0446, 0x0446, 0x04e7, 0x04e7, 0x0406, 0x0416, 0x0426, 0x0436, 0x0446, 0x0456, 0x0466, 0x04f7,
+    0x1400, 0x1400, 0x1400, 0x1400, 0x0507, 0x0507, 0x0507, 0x0507, 0x0406, 0x1410, 0x0406, 0x1410,
+    0x0406, 0x0517, 0x0406, 0x0517, 0x0406, 0x0406, 0x1420, 0x1420, 0x0406, 0x0406, 0x0527, 0x0527,
+    0x0406, 0x0416, 0x0426, 0x1430, 0x0406, 0x0416, 0x0426, 0x0537, 0x0406, 0x0406, 0x0406, 0x0406,
+    0x0547, 0x0547, 0x0547, 0x0547, 0x0406, 0x0416, 0x0406, 0x0416, 0x0446, 0x0557, 0x0446, 0x0557,
+    0x0406, 0x0406, 0x0426, 0x0426, 0x0446, 0x0446, 0x0567, 0x0567, 0x0406, 0x0416, 0x0426, 0x0436,
+    0x0446, 0x0456, 0x0466, 0x0577, 0x1400, 0x0587, 0x0487, 0x0587, 0x0507, 0x0587, 0x0587, 0x0587,
+    0x0406, 0x0597, 0x0406, 0x0597, 0x0406, 0x0597, 0x0406, 0x0597, 0x0406, 0x0406, 0x04a7, 0x05a7,
+    0x0406, 0x0406, 0x05a7, 0x05a7, 0x0406, 0x0416, 0x0426, 0x05b7, 0x0406, 0x0416, 0x0426, 0x05b7,
+    0x0406, 0x0406, 0x0406, 0x0406, 0x0547, 0x05c7, 0x05c7, 0x05c7, 0x0406, 0x0416, 0x0406, 0x0416,
+    0x0446, 0x05d7, 0x0446, 0x05d7, 0x0406, 0x0406, 0x0426, 0x0426, 0x0446, 0x0446, 0x05e7, 0x05e7,
+    0x0406, 0x0416, 0x0426, 0x0436, 0x0446, 0x0456, 0x0466, 0x05f7, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x0006, 0x1010, 0x0006, 0x1010, 0x0006, 0x1010, 0x0006, 0x1010,
+    0x0006, 0x0006, 0x1020, 0x1020, 0x0006, 0x0006, 0x1020, 0x1020, 0x0006, 0x0016, 0x0026, 0x1030,
+    0x0006, 0x0016, 0x0026, 0x1030, 0x0006, 0x0006, 0x0006, 0x0006, 0x1040, 0x1040, 0x1040, 0x1040,
+    0x0006, 0x0016, 0x0006, 0x0016, 0x0046, 0x1050, 0x0046, 0x1050, 0x0006, 0x0006, 0x0026, 0x0026,
+    0x0046, 0x0046, 0x1060, 0x1060, 0x0006, 0x0016, 0x0026, 0x0036, 0x0046, 0x0056, 0x0066, 0x1070,
+    0x1000, 0x1000, 0x0087, 0x0087, 0x1000, 0x1000, 0x0087, 0x0087, 0x0006, 0x1010, 0x0006, 0x0097,
+    0x0006, 0x1010, 0x0006, 0x0097, 0x0006, 0x0006, 0x00a7, 0x00a7, 0x0006, 0x0006, 0x00a7, 0x00a7,
+    0x0006, 0x0016, 0x0026, 0x00b7, 0x0006, 0x0016, 0x0026, 0x00b7, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x1040, 0x1040, 0x00c7, 0x00c7, 0x0006, 0x0016, 0x0006, 0x0016, 0x0046, 0x1050, 0x0046, 0x00d7,
+    0x0006, 0x0006, 0x0026, 0x0026, 0x0046, 0x0046, 0x00e7, 0x00e7, 0x0006, 0x0016, 0x0026, 0x0036,
+    0x0046, 0x0056, 0x0066, 0x00f7, 0x1000, 0x1000, 0x1000, 0x1000, 0x0107, 0x0107, 0x0107, 0x0107,
+    0x0006, 0x1010, 0x0006, 0x1010, 0x0006, 0x0117, 0x0006, 0x0117, 0x0006, 0x0006, 0x1020, 0x1020,
+    0x0006, 0x0006, 0x0127, 0x0127, 0x0006, 0x0016, 0x0026, 0x1030, 0x0006, 0x0016, 0x0026, 0x0137,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0147, 0x0147, 0x0147, 0x0147, 0x0006, 0x0016, 0x0006, 0x0016,
+    0x0046, 0x0157, 0x0046, 0x0157, 0x0006, 0x0006, 0x0026, 0x0026, 0x0046, 0x0046, 0x0167, 0x0167,
+    0x0006, 0x0016, 0x0026, 0x0036, 0x0046, 0x0056, 0x0066, 0x0177, 0x1000, 0x0187, 0x0087, 0x0187,
+    0x0107, 0x0187, 0x0187, 0x0187, 0x0006, 0x0197, 0x0006, 0x0197, 0x0006, 0x0197, 0x0006, 0x0197,
+    0x0006, 0x0006, 0x00a7, 0x01a7, 0x0006, 0x0006, 0x01a7, 0x01a7, 0x0006, 0x0016, 0x0026, 0x01b7,
+    0x0006, 0x0016, 0x0026, 0x01b7, 0x0006, 0x0006, 0x0006, 0x0006, 0x0147, 0x01c7, 0x01c7, 0x01c7,
+    0x0006, 0x0016, 0x0006, 0x0016, 0x0046, 0x01d7, 0x0046, 0x01d7, 0x0006, 0x0006, 0x0026, 0x0026,
+    0x0046, 0x0046, 0x01e7, 0x01e7, 0x0006, 0x0016, 0x0026, 0x0036, 0x0046, 0x0056, 0x0066, 0x01f7,
+    0x0808, 0x0808, 0x0808, 0x0808, 0x0808, 0x0808, 0x0808, 0x0808, 0x0406, 0x0818, 0x0406, 0x0818,
+    0x0406, 0x0818, 0x0406, 0x0818, 0x0406, 0x0406, 0x0828, 0x0828, 0x0406, 0x0406, 0x0828, 0x0828,
+    0x0406, 0x0416, 0x0426, 0x0838, 0x0406, 0x0416, 0x0426, 0x0838, 0x0406, 0x0406, 0x0406, 0x0406,
+    0x0848, 0x0848, 0x0848, 0x0848, 0x0406, 0x0416, 0x0406, 0x0416, 0x0446, 0x0858, 0x0446, 0x0858,
+    0x0406, 0x0406, 0x0426, 0x0426, 0x0446, 0x0446, 0x0868, 0x0868, 0x0406, 0x0416, 0x0426, 0x0436,
+    0x0446, 0x0456, 0x0466, 0x0878, 0x0808, 0x0808, 0x0808, 0x0808, 0x0808, 0x0808, 0x0808, 0x0808,
+    0x0406, 0x0818, 0x0406, 0x0818, 0x0406, 0x0818, 0x0406, 0x0818, 0x0406, 0x0406, 0x0828, 0x0828,
+    0x0406, 0x0406, 0x0828, 0x0828, 0x0406, 0x0416, 0x0426, 0x0838, 0x0406, 0x0416, 0x0426, 0x0838,
+    0x0406, 0x0406, 0x0406, 0x0406, 0x0848, 0x0848, 0x0848, 0x0848, 0x0406, 0x0416, 0x0406, 0x0416,
+    0x0446, 0x0858, 0x0446, 0x0858, 0x0406, 0x0406, 0x0426, 0x0426, 0x0446, 0x0446, 0x0868, 0x0868,
+    0x0406, 0x0416, 0x0426, 0x0436, 0x0446, 0x0456, 0x0466, 0x0878, 0x0808, 0x0808, 0x0808, 0x0808,
+    0x0808, 0x0808, 0x0808, 0x0808, 0x0406, 0x0818, 0x0406, 0x0818, 0x0406, 0x0818, 0x0406, 0x0818,
+    0x0406, 0x0406, 0x0828, 0x0828, 0x0406, 0x0406, 0x0828, 0x0828, 0x0406, 0x0416, 0x0426, 0x0838,
+    0x0406, 0x0416, 0x0426, 0x0838, 0x0406, 0x0406, 0x0406, 0x0406, 0x0848, 0x0848, 0x0848, 0x0848,
+    0x0406, 0x0416, 0x0406, 0x0416, 0x0446, 0x0858, 0x0446, 0x0858, 0x0406, 0x0406, 0x0426, 0x0426,
+    0x0446, 0x0446, 0x0868, 0x0868, 0x0406, 0x0416, 0x0426, 0x0436, 0x0446, 0x0456, 0x0466, 0x0878,
+    0x0808, 0x0808, 0x0808, 0x0808, 0x0808, 0x0808, 0x0808, 0x0808, 0x0406, 0x0818, 0x0406, 0x0818,
+    0x0406, 0x0818, 0x0406, 0x0818, 0x0406, 0x0406, 0x0828, 0x0828, 0x0406, 0x0406, 0x0828, 0x0828,
+    0x0406, 0x0416, 0x0426, 0x0838, 0x0406, 0x0416, 0x0426, 0x0838, 0x0406, 0x0406, 0x0406, 0x0406,
+    0x0848, 0x0848, 0x0848, 0x0848, 0x0406, 0x0416, 0x0406, 0x0416, 0x0446, 0x0858, 0x0446, 0x0858,
+    0x0406, 0x0406, 0x0426, 0x0426, 0x0446, 0x0446, 0x0868, 0x0868, 0x0406, 0x0416, 0x0426, 0x0436,
+    0x0446, 0x0456, 0x0466, 0x0878, 0x0808, 0x0808, 0x0808, 0x0808, 0x0808, 0x0808, 0x0808, 0x0808,
+    0x0006, 0x0818, 0x0006, 0x0818, 0x0006, 0x0818, 0x0006, 0x0818, 0x0006, 0x0006, 0x0828, 0x0828,
+    0x0006, 0x0006, 0x0828, 0x0828, 0x0006, 0x0016, 0x0026, 0x0838, 0x0006, 0x0016, 0x0026, 0x0838,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0848, 0x0848, 0x0848, 0x0848, 0x0006, 0x0016, 0x0006, 0x0016,
+    0x0046, 0x0858, 0x0046, 0x0858, 0x0006, 0x0006, 0x0026, 0x0026, 0x0046, 0x0046, 0x0868, 0x0868,
+    0x0006, 0x0016, 0x0026, 0x0036, 0x0046, 0x0056, 0x0066, 0x0878, 0x0808, 0x0808, 0x0808, 0x0808,
+    0x0808, 0x0808, 0x0808, 0x0808, 0x0006, 0x0818, 0x0006, 0x0818, 0x0006, 0x0818, 0x0006, 0x0818,
+    0x0006, 0x0006, 0x0828, 0x0828, 0x0006, 0x0006, 0x0828, 0x0828, 0x0006, 0x0016, 0x0026, 0x0838,
+    0x0006, 0x0016, 0x0026, 0x0838, 0x0006, 0x0006, 0x0006, 0x0006, 0x0848, 0x0848, 0x0848, 0x0848,
+    0x0006, 0x0016, 0x0006, 0x0016, 0x0046, 0x0858, 0x0046, 0x0858, 0x0006, 0x0006, 0x0026, 0x0026,
+    0x0046, 0x0046, 0x0868, 0x0868, 0x0006, 0x0016, 0x0026, 0x0036, 0x0046, 0x0056, 0x0066, 0x0878,
+    0x0808, 0x0808, 0x0808, 0x0808, 0x0808, 0x0808, 0x0808, 0x0808, 0x0006, 0x0818, 0x0006, 0x0818,
+    0x0006, 0x0818, 0x0006, 0x0818, 0x0006, 0x0006, 0x0828, 0x0828, 0x0006, 0x0006, 0x0828, 0x0828,
+    0x0006, 0x0016, 0x0026, 0x0838, 0x0006, 0x0016, 0x0026, 0x0838, 0x0006, 0x0006, 0x0006, 0x0006,
+    0x0848, 0x0848, 0x0848, 0x0848, 0x0006, 0x0016, 0x0006, 0x0016, 0x0046, 0x0858, 0x0046, 0x0858,
+    0x0006, 0x0006, 0x0026, 0x0026, 0x0046, 0x0046, 0x0868, 0x0868, 0x0006, 0x0016, 0x0026, 0x0036,
+    0x0046, 0x0056, 0x0066, 0x0878, 0x0808, 0x0808, 0x0808, 0x0808, 0x0808, 0x0808, 0x0808, 0x0808,
+    0x0006, 0x0818, 0x0006, 0x0818, 0x0006, 0x0818, 0x0006, 0x0818, 0x0006, 0x0006, 0x0828, 0x0828,
+    0x0006, 0x0006, 0x0828, 0x0828, 0x0006, 0x0016, 0x0026, 0x0838, 0x0006, 0x0016, 0x0026, 0x0838,
+    0x0006, 0x0006, 0x0006, 0x0006, 0x0848, 0x0848, 0x0848, 0x0848, 0x0006, 0x0016, 0x0006, 0x0016,
+    0x0046, 0x0858, 0x0046, 0x0858, 0x0006, 0x0006, 0x0026, 0x0026, 0x0046, 0x0046, 0x0868, 0x0868,
+    0x0006, 0x0016, 0x0026, 0x0036, 0x0046, 0x0056, 0x0066, 0x0878, 0x0808, 0x0808, 0x0808, 0x0808,
+    0x0808, 0x0808, 0x0808, 0x0808, 0x0406, 0x0818, 0x0406, 0x0818, 0x0406, 0x0818, 0x0406, 0x0818,
+    0x0406, 0x0406, 0x0828, 0x0828, 0x0406, 0x0406, 0x0828, 0x0828, 0x0406, 0x0416, 0x0426, 0x0838,
+    0x0406, 0x0416, 0x0426, 0x0838, 0x0406, 0x0406, 0x0406, 0x0406, 0x0848, 0x0848, 0x0848, 0x0848,
+    0x0406, 0x0416, 0x0406, 0x0416, 0x0446, 0x0858, 0x0446, 0x0858, 0x0406, 0x0406, 0x0426, 0x0426,
+    0x0446, 0x0446, 0x0868, 0x0868, 0x0406, 0x0416, 0x0426, 0x0436, 0x0446, 0x0456, 0x0466, 0x0878,
+    0x0808, 0x0808, 0x0808, 0x0808, 0x0808, 0x0808, 0x0808, 0x0808, 0x0406, 0x0818, 0x0406, 0x0818,
+    0x0406, 0x0818, 0x0406, 0x0818, 0x0406, 0x0406, 0x0828, 0x0828, 0x0406, 0x0406, 0x0828, 0x0828,
+    0x0406, 0x0416, 0x0426, 0x0838, 0x0406, 0x0416, 0x0426, 0x0838, 0x0406, 0x0406, 0x0406, 0x0406,
+    0x0848, 0x0848, 0x0848, 0x0848, 0x0406, 0x0416, 0x0406, 0x0416, 0x0446, 0x0858, 0x0446, 0x0858,
+    0x0406, 0x0406, 0x0426, 0x0426, 0x0446, 0x0446, 0x0868, 0x0868, 0x0406, 0x0416, 0x0426, 0x0436,
+    0x0446, 0x0456, 0x0466, 0x0878, 0x0808, 0x0808, 0x0808, 0x0808, 0x0808, 0x0808, 0x0808, 0x0808,
+    0x0406, 0x0818, 0x0406, 0x0818, 0x0406, 0x0818, 0x0406, 0x0818, 0x0406, 0x0406, 0x0828, 0x0828,
+    0x0406, 0x0406, 0x0828, 0x0828, 0x0406, 0x0416, 0x0426, 0x0838, 0x0406, 0x0416, 0x0426, 0x0838,
+    0x0406, 0x0406, 0x0406, 0x0406, 0x0848, 0x0848, 0x0848, 0x0848, 0x0406, 0x0416, 0x0406, 0x0416,
+    0x0446, 0x0858, 0x0446, 0x0858, 0x0406, 0x0406, 0x0426, 0x0426, 0x0446, 0x0446, 0x0868, 0x0868,
+    0x0406, 0x0416, 0x0426, 0x0436, 0x0446, 0x0456, 0x0466, 0x0878, 0x0808, 0x0808, 0x0808, 0x0808,
+    0x0808, 0x0808, 0x0808, 0x0808, 0x0406, 0x0818, 0x0406, 0x0818, 0x0406, 0x0818, 0x0406, 0x0818,
+    0x0406, 0x0406, 0x0828, 0x0828, 0x0406, 0x0406, 0x0828, 0x0828, 0x0406, 0x0416, 0x0426, 0x0838,
+    0x0406, 0x0416, 0x0426, 0x0838, 0x0406, 0x0406, 0x0406, 0x0406, 0x0848, 0x0848, 0x0848, 0x0848,
+    0x0406, 0x0416, 0x0406, 0x0416, 0x0446, 0x0858, 0x0446, 0x0858, 0x0406, 0x0406, 0x0426, 0x0426,
+    0x0446, 0x0446, 0x0868, 0x0868, 0x0406, 0x0416, 0x0426, 0x0436, 0x0446, 0x0456, 0x0466, 0x0878,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x0009, 0x1010, 0x0009, 0x1010, 0x0009, 0x1010, 0x0009, 0x1010,
+    0x0009, 0x0009, 0x1020, 0x1020, 0x0009, 0x0009, 0x1020, 0x1020, 0x0009, 0x0019, 0x0029, 0x1030,
+    0x0009, 0x0019, 0x0029, 0x1030, 0x0009, 0x0009, 0x0009, 0x0009, 0x1040, 0x1040, 0x1040, 0x1040,
+    0x0009, 0x0019, 0x0009, 0x0019, 0x0049, 0x1050, 0x0049, 0x1050, 0x0009, 0x0009, 0x0029, 0x0029,
+    0x0049, 0x0049, 0x1060, 0x1060, 0x0009, 0x0019, 0x0029, 0x0039, 0x0049, 0x0059, 0x0069, 0x1070,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x0009, 0x1010, 0x0009, 0x1010,
+    0x0009, 0x1010, 0x0009, 0x1010, 0x0009, 0x0009, 0x1020, 0x1020, 0x0009, 0x0009, 0x1020, 0x1020,
+    0x0009, 0x0019, 0x0029, 0x1030, 0x0009, 0x0019, 0x0029, 0x1030, 0x0009, 0x0009, 0x0009, 0x0009,
+    0x1040, 0x1040, 0x1040, 0x1040, 0x0009, 0x0019, 0x0009, 0x0019, 0x0049, 0x1050, 0x0049, 0x1050,
+    0x0009, 0x0009, 0x0029, 0x0029, 0x0049, 0x0049, 0x1060, 0x1060, 0x0009, 0x0019, 0x0029, 0x0039,
+    0x0049, 0x0059, 0x0069, 0x1070, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x0009, 0x1010, 0x0009, 0x1010, 0x0009, 0x1010, 0x0009, 0x1010, 0x0009, 0x0009, 0x1020, 0x1020,
+    0x0009, 0x0009, 0x1020, 0x1020, 0x0009, 0x0019, 0x0029, 0x1030, 0x0009, 0x0019, 0x0029, 0x1030,
+    0x0009, 0x0009, 0x0009, 0x0009, 0x1040, 0x1040, 0x1040, 0x1040, 0x0009, 0x0019, 0x0009, 0x0019,
+    0x0049, 0x1050, 0x0049, 0x1050, 0x0009, 0x0009, 0x0029, 0x0029, 0x0049, 0x0049, 0x1060, 0x1060,
+    0x0009, 0x0019, 0x0029, 0x0039, 0x0049, 0x0059, 0x0069, 0x1070, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x0009, 0x1010, 0x0009, 0x1010, 0x0009, 0x1010, 0x0009, 0x1010,
+    0x0009, 0x0009, 0x1020, 0x1020, 0x0009, 0x0009, 0x1020, 0x1020, 0x0009, 0x0019, 0x0029, 0x1030,
+    0x0009, 0x0019, 0x0029, 0x1030, 0x0009, 0x0009, 0x0009, 0x0009, 0x1040, 0x1040, 0x1040, 0x1040,
+    0x0009, 0x0019, 0x0009, 0x0019, 0x0049, 0x1050, 0x0049, 0x1050, 0x0009, 0x0009, 0x0029, 0x0029,
+    0x0049, 0x0049, 0x1060, 0x1060, 0x0009, 0x0019, 0x0029, 0x0039, 0x0049, 0x0059, 0x0069, 0x1070,
+    0x1400, 0x1400, 0x1400, 0x1400, 0x1400, 0x1400, 0x1400, 0x1400, 0x0409, 0x1410, 0x0409, 0x1410,
+    0x0409, 0x1410, 0x0409, 0x1410, 0x0409, 0x0409, 0x1420, 0x1420, 0x0409, 0x0409, 0x1420, 0x1420,
+    0x0409, 0x0419, 0x0429, 0x1430, 0x0409, 0x0419, 0x0429, 0x1430, 0x0409, 0x0409, 0x0409, 0x0409,
+    0x1440, 0x1440, 0x1440, 0x1440, 0x0409, 0x0419, 0x0409, 0x0419, 0x0449, 0x1450, 0x0449, 0x1450,
+    0x0409, 0x0409, 0x0429, 0x0429, 0x0449, 0x0449, 0x1460, 0x1460, 0x0409, 0x0419, 0x0429, 0x0439,
+    0x0449, 0x0459, 0x0469, 0x1470, 0x1400, 0x1400, 0x1400, 0x1400, 0x1400, 0x1400, 0x1400, 0x1400,
+    0x0409, 0x1410, 0x0409, 0x1410, 0x0409, 0x1410, 0x0409, 0x1410, 0x0409, 0x0409, 0x1420, 0x1420,
+    0x0409, 0x0409, 0x1420, 0x1420, 0x0409, 0x0419, 0x0429, 0x1430, 0x0409, 0x0419, 0x0429, 0x1430,
+    0x0409, 0x0409, 0x0409, 0x0409, 0x1440, 0x1440, 0x1440, 0x1440, 0x0409, 0x0419, 0x0409, 0x0419,
+    0x0449, 0x1450, 0x0449, 0x1450, 0x0409, 0x0409, 0x0429, 0x0429, 0x0449, 0x0449, 0x1460, 0x1460,
+    0x0409, 0x0419, 0x0429, 0x0439, 0x0449, 0x0459, 0x0469, 0x1470, 0x1400, 0x1400, 0x1400, 0x1400,
+    0x1400, 0x1400, 0x1400, 0x1400, 0x0409, 0x1410, 0x0409, 0x1410, 0x0409, 0x1410, 0x0409, 0x1410,
+    0x0409, 0x0409, 0x1420, 0x1420, 0x0409, 0x0409, 0x1420, 0x1420, 0x0409, 0x0419, 0x0429, 0x1430,
+    0x0409, 0x0419, 0x0429, 0x1430, 0x0409, 0x0409, 0x0409, 0x0409, 0x1440, 0x1440, 0x1440, 0x1440,
+    0x0409, 0x0419, 0x0409, 0x0419, 0x0449, 0x1450, 0x0449, 0x1450, 0x0409, 0x0409, 0x0429, 0x0429,
+    0x0449, 0x0449, 0x1460, 0x1460, 0x0409, 0x0419, 0x0429, 0x0439, 0x0449, 0x0459, 0x0469, 0x1470,
+    0x1400, 0x1400, 0x1400, 0x1400, 0x1400, 0x1400, 0x1400, 0x1400, 0x0409, 0x1410, 0x0409, 0x1410,
+    0x0409, 0x1410, 0x0409, 0x1410, 0x0409, 0x0409, 0x1420, 0x1420, 0x0409, 0x0409, 0x1420, 0x1420,
+    0x0409, 0x0419, 0x0429, 0x1430, 0x0409, 0x0419, 0x0429, 0x1430, 0x0409, 0x0409, 0x0409, 0x0409,
+    0x1440, 0x1440, 0x1440, 0x1440, 0x0409, 0x0419, 0x0409, 0x0419, 0x0449, 0x1450, 0x0449, 0x1450,
+    0x0409, 0x0409, 0x0429, 0x0429, 0x0449, 0x0449, 0x1460, 0x1460, 0x0409, 0x0419, 0x0429, 0x0439,
+    0x0449, 0x0459, 0x0469, 0x1470, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x0009, 0x1010, 0x0009, 0x1010, 0x0009, 0x1010, 0x0009, 0x1010, 0x0009, 0x0009, 0x1020, 0x1020,
+    0x0009, 0x0009, 0x1020, 0x1020, 0x0009, 0x0019, 0x0029, 0x1030, 0x0009, 0x0019, 0x0029, 0x1030,
+    0x0009, 0x0009, 0x0009, 0x0009, 0x1040, 0x1040, 0x1040, 0x1040, 0x0009, 0x0019, 0x0009, 0x0019,
+    0x0049, 0x1050, 0x0049, 0x1050, 0x0009, 0x0009, 0x0029, 0x0029, 0x0049, 0x0049, 0x1060, 0x1060,
+    0x0009, 0x0019, 0x0029, 0x0039, 0x0049, 0x0059, 0x0069, 0x1070, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x0009, 0x1010, 0x0009, 0x1010, 0x0009, 0x1010, 0x0009, 0x1010,
+    0x0009, 0x0009, 0x1020, 0x1020, 0x0009, 0x0009, 0x1020, 0x1020, 0x0009, 0x0019, 0x0029, 0x1030,
+    0x0009, 0x0019, 0x0029, 0x1030, 0x0009, 0x0009, 0x0009, 0x0009, 0x1040, 0x1040, 0x1040, 0x1040,
+    0x0009, 0x0019, 0x0009, 0x0019, 0x0049, 0x1050, 0x0049, 0x1050, 0x0009, 0x0009, 0x0029, 0x0029,
+    0x0049, 0x0049, 0x1060, 0x1060, 0x0009, 0x0019, 0x0029, 0x0039, 0x0049, 0x0059, 0x0069, 0x1070,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x0009, 0x1010, 0x0009, 0x1010,
+    0x0009, 0x1010, 0x0009, 0x1010, 0x0009, 0x0009, 0x1020, 0x1020, 0x0009, 0x0009, 0x1020, 0x1020,
+    0x0009, 0x0019, 0x0029, 0x1030, 0x0009, 0x0019, 0x0029, 0x1030, 0x0009, 0x0009, 0x0009, 0x0009,
+    0x1040, 0x1040, 0x1040, 0x1040, 0x0009, 0x0019, 0x0009, 0x0019, 0x0049, 0x1050, 0x0049, 0x1050,
+    0x0009, 0x0009, 0x0029, 0x0029, 0x0049, 0x0049, 0x1060, 0x1060, 0x0009, 0x0019, 0x0029, 0x0039,
+    0x0049, 0x0059, 0x0069, 0x1070, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x0009, 0x1010, 0x0009, 0x1010, 0x0009, 0x1010, 0x0009, 0x1010, 0x0009, 0x0009, 0x1020, 0x1020,
+    0x0009, 0x0009, 0x1020, 0x1020, 0x0009, 0x0019, 0x0029, 0x1030, 0x0009, 0x0019, 0x0029, 0x1030,
+    0x0009, 0x0009, 0x0009, 0x0009, 0x1040, 0x1040, 0x1040, 0x1040, 0x0009, 0x0019, 0x0009, 0x0019,
+    0x0049, 0x1050, 0x0049, 0x1050, 0x0009, 0x0009, 0x0029, 0x0029, 0x0049, 0x0049, 0x1060, 0x1060,
+    0x0009, 0x0019, 0x0029, 0x0039, 0x0049, 0x0059, 0x0069, 0x1070, 0x080a, 0x081a, 0x082a, 0x083a,
+    0x084a, 0x085a, 0x086a, 0x087a, 0x0409, 0x080a, 0x0409, 0x082a, 0x0409, 0x084a, 0x0409, 0x086a,
+    0x0409, 0x0409, 0x080a, 0x081a, 0x0409, 0x0409, 0x084a, 0x085a, 0x0409, 0x0419, 0x0429, 0x080a,
+    0x0409, 0x0419, 0x0429, 0x084a, 0x0409, 0x0409, 0x0409, 0x0409, 0x080a, 0x081a, 0x082a, 0x083a,
+    0x0409, 0x0419, 0x0409, 0x0419, 0x0449, 0x080a, 0x0449, 0x082a, 0x0409, 0x0409, 0x0429, 0x0429,
+    0x0449, 0x0449, 0x080a, 0x081a, 0x0409, 0x0419, 0x0429, 0x0439, 0x0449, 0x0459, 0x0469, 0x080a,
+    0x080a, 0x081a, 0x082a, 0x083a, 0x084a, 0x085a, 0x086a, 0x087a, 0x0409, 0x080a, 0x0409, 0x082a,
+    0x0409, 0x084a, 0x0409, 0x086a, 0x0409, 0x0409, 0x080a, 0x081a, 0x0409, 0x0409, 0x084a, 0x085a,
+    0x0409, 0x0419, 0x0429, 0x080a, 0x0409, 0x0419, 0x0429, 0x084a, 0x0409, 0x0409, 0x0409, 0x0409,
+    0x080a, 0x081a, 0x082a, 0x083a, 0x0409, 0x0419, 0x0409, 0x0419, 0x0449, 0x080a, 0x0449, 0x082a,
+    0x0409, 0x0409, 0x0429, 0x0429, 0x0449, 0x0449, 0x080a, 0x081a, 0x0409, 0x0419, 0x0429, 0x0439,
+    0x0449, 0x0459, 0x0469, 0x080a, 0x080a, 0x081a, 0x082a, 0x083a, 0x084a, 0x085a, 0x086a, 0x087a,
+    0x0409, 0x080a, 0x0409, 0x082a, 0x0409, 0x084a, 0x0409, 0x086a, 0x0409, 0x0409, 0x080a, 0x081a,
+    0x0409, 0x0409, 0x084a, 0x085a, 0x0409, 0x0419, 0x0429, 0x080a, 0x0409, 0x0419, 0x0429, 0x084a,
+    0x0409, 0x0409, 0x0409, 0x0409, 0x080a, 0x081a, 0x082a, 0x083a, 0x0409, 0x0419, 0x0409, 0x0419,
+    0x0449, 0x080a, 0x0449, 0x082a, 0x0409, 0x0409, 0x0429, 0x0429, 0x0449, 0x0449, 0x080a, 0x081a,
+    0x0409, 0x0419, 0x0429, 0x0439, 0x0449, 0x0459, 0x0469, 0x080a, 0x080a, 0x081a, 0x082a, 0x083a,
+    0x084a, 0x085a, 0x086a, 0x087a, 0x0409, 0x080a, 0x0409, 0x082a, 0x0409, 0x084a, 0x0409, 0x086a,
+    0x0409, 0x0409, 0x080a, 0x081a, 0x0409, 0x0409, 0x084a, 0x085a, 0x0409, 0x0419, 0x0429, 0x080a,
+    0x0409, 0x0419, 0x0429, 0x084a, 0x0409, 0x0409, 0x0409, 0x0409, 0x080a, 0x081a, 0x082a, 0x083a,
+    0x0409, 0x0419, 0x0409, 0x0419, 0x0449, 0x080a, 0x0449, 0x082a, 0x0409, 0x0409, 0x0429, 0x0429,
+    0x0449, 0x0449, 0x080a, 0x081a, 0x0409, 0x0419, 0x0429, 0x0439, 0x0449, 0x0459, 0x0469, 0x080a,
+    0x080a, 0x081a, 0x082a, 0x083a, 0x084a, 0x085a, 0x086a, 0x087a, 0x0009, 0x080a, 0x0009, 0x082a,
+    0x0009, 0x084a, 0x0009, 0x086a, 0x0009, 0x0009, 0x080a, 0x081a, 0x0009, 0x0009, 0x084a, 0x085a,
+    0x0009, 0x0019, 0x0029, 0x080a, 0x0009, 0x0019, 0x0029, 0x084a, 0x0009, 0x0009, 0x0009, 0x0009,
+    0x080a, 0x081a, 0x082a, 0x083a, 0x0009, 0x0019, 0x0009, 0x0019, 0x0049, 0x080a, 0x0049, 0x082a,
+    0x0009, 0x0009, 0x0029, 0x0029, 0x0049, 0x0049, 0x080a, 0x081a, 0x0009, 0x0019, 0x0029, 0x0039,
+    0x0049, 0x0059, 0x0069, 0x080a, 0x080a, 0x081a, 0x082a, 0x083a, 0x084a, 0x085a, 0x086a, 0x087a,
+    0x0009, 0x080a, 0x0009, 0x082a, 0x0009, 0x084a, 0x0009, 0x086a, 0x0009, 0x0009, 0x080a, 0x081a,
+    0x0009, 0x0009, 0x084a, 0x085a, 0x0009, 0x0019, 0x0029, 0x080a, 0x0009, 0x0019, 0x0029, 0x084a,
+    0x0009, 0x0009, 0x0009, 0x0009, 0x080a, 0x081a, 0x082a, 0x083a, 0x0009, 0x0019, 0x0009, 0x0019,
+    0x0049, 0x080a, 0x0049, 0x082a, 0x0009, 0x0009, 0x0029, 0x0029, 0x0049, 0x0049, 0x080a, 0x081a,
+    0x0009, 0x0019, 0x0029, 0x0039, 0x0049, 0x0059, 0x0069, 0x080a, 0x080a, 0x081a, 0x082a, 0x083a,
+    0x084a, 0x085a, 0x086a, 0x087a, 0x0009, 0x080a, 0x0009, 0x082a, 0x0009, 0x084a, 0x0009, 0x086a,
+    0x0009, 0x0009, 0x080a, 0x081a, 0x0009, 0x0009, 0x084a, 0x085a, 0x0009, 0x0019, 0x0029, 0x080a,
+    0x0009, 0x0019, 0x0029, 0x084a, 0x0009, 0x0009, 0x0009, 0x0009, 0x080a, 0x081a, 0x082a, 0x083a,
+    0x0009, 0x0019, 0x0009, 0x0019, 0x0049, 0x080a, 0x0049, 0x082a, 0x0009, 0x0009, 0x0029, 0x0029,
+    0x0049, 0x0049, 0x080a, 0x081a, 0x0009, 0x0019, 0x0029, 0x0039, 0x0049, 0x0059, 0x0069, 0x080a,
+    0x080a, 0x081a, 0x082a, 0x083a, 0x084a, 0x085a, 0x086a, 0x087a, 0x0009, 0x080a, 0x0009, 0x082a,
+    0x0009, 0x084a, 0x0009, 0x086a, 0x0009, 0x0009, 0x080a, 0x081a, 0x0009, 0x0009, 0x084a, 0x085a,
+    0x0009, 0x0019, 0x0029, 0x080a, 0x0009, 0x0019, 0x0029, 0x084a, 0x0009, 0x0009, 0x0009, 0x0009,
+    0x080a, 0x081a, 0x082a, 0x083a, 0x0009, 0x0019, 0x0009, 0x0019, 0x0049, 0x080a, 0x0049, 0x082a,
+    0x0009, 0x0009, 0x0029, 0x0029, 0x0049, 0x0049, 0x080a, 0x081a, 0x0009, 0x0019, 0x0029, 0x0039,
+    0x0049, 0x0059, 0x0069, 0x080a, 0x080a, 0x081a, 0x082a, 0x083a, 0x084a, 0x085a, 0x086a, 0x087a,
+    0x0409, 0x080a, 0x0409, 0x082a, 0x0409, 0x084a, 0x0409, 0x086a, 0x0409, 0x0409, 0x080a, 0x081a,
+    0x0409, 0x0409, 0x084a, 0x085a, 0x0409, 0x0419, 0x0429, 0x080a, 0x0409, 0x0419, 0x0429, 0x084a,
+    0x0409, 0x0409, 0x0409, 0x0409, 0x080a, 0x081a, 0x082a, 0x083a, 0x0409, 0x0419, 0x0409, 0x0419,
+    0x0449, 0x080a, 0x0449, 0x082a, 0x0409, 0x0409, 0x0429, 0x0429, 0x0449, 0x0449, 0x080a, 0x081a,
+    0x0409, 0x0419, 0x0429, 0x0439, 0x0449, 0x0459, 0x0469, 0x080a, 0x080a, 0x081a, 0x082a, 0x083a,
+    0x084a, 0x085a, 0x086a, 0x087a, 0x0409, 0x080a, 0x0409, 0x082a, 0x0409, 0x084a, 0x0409, 0x086a,
+    0x0409, 0x0409, 0x080a, 0x081a, 0x0409, 0x0409, 0x084a, 0x085a, 0x0409, 0x0419, 0x0429, 0x080a,
+    0x0409, 0x0419, 0x0429, 0x084a, 0x0409, 0x0409, 0x0409, 0x0409, 0x080a, 0x081a, 0x082a, 0x083a,
+    0x0409, 0x0419, 0x0409, 0x0419, 0x0449, 0x080a, 0x0449, 0x082a, 0x0409, 0x0409, 0x0429, 0x0429,
+    0x0449, 0x0449, 0x080a, 0x081a, 0x0409, 0x0419, 0x0429, 0x0439, 0x0449, 0x0459, 0x0469, 0x080a,
+    0x080a, 0x081a, 0x082a, 0x083a, 0x084a, 0x085a, 0x086a, 0x087a, 0x0409, 0x080a, 0x0409, 0x082a,
+    0x0409, 0x084a, 0x0409, 0x086a, 0x0409, 0x0409, 0x080a, 0x081a, 0x0409, 0x0409, 0x084a, 0x085a,
+    0x0409, 0x0419, 0x0429, 0x080a, 0x0409, 0x0419, 0x0429, 0x084a, 0x0409, 0x0409, 0x0409, 0x0409,
+    0x080a, 0x081a, 0x082a, 0x083a, 0x0409, 0x0419, 0x0409, 0x0419, 0x0449, 0x080a, 0x0449, 0x082a,
+    0x0409, 0x0409, 0x0429, 0x0429, 0x0449, 0x0449, 0x080a, 0x081a, 0x0409, 0x0419, 0x0429, 0x0439,
+    0x0449, 0x0459, 0x0469, 0x080a, 0x080a, 0x081a, 0x082a, 0x083a, 0x084a, 0x085a, 0x086a, 0x087a,
+    0x0409, 0x080a, 0x0409, 0x082a, 0x0409, 0x084a, 0x0409, 0x086a, 0x0409, 0x0409, 0x080a, 0x081a,
+    0x0409, 0x0409, 0x084a, 0x085a, 0x0409, 0x0419, 0x0429, 0x080a, 0x0409, 0x0419, 0x0429, 0x084a,
+    0x0409, 0x0409, 0x0409, 0x0409, 0x080a, 0x081a, 0x082a, 0x083a, 0x0409, 0x0419, 0x0409, 0x0419,
+    0x0449, 0x080a, 0x0449, 0x082a, 0x0409, 0x0409, 0x0429, 0x0429, 0x0449, 0x0449, 0x080a, 0x081a,
+    0x0409, 0x0419, 0x0429, 0x0439, 0x0449, 0x0459, 0x0469, 0x080a, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x000b, 0x1010, 0x000b, 0x1010, 0x000b, 0x1010, 0x000b, 0x1010, 0x000b, 0x000b, 0x1020, 0x1020,
+    0x000b, 0x000b, 0x1020, 0x1020, 0x000b, 0x001b, 0x002b, 0x1030, 0x000b, 0x001b, 0x002b, 0x1030,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x1040, 0x1040, 0x1040, 0x1040, 0x000b, 0x001b, 0x000b, 0x001b,
+    0x004b, 0x1050, 0x004b, 0x1050, 0x000b, 0x000b, 0x002b, 0x002b, 0x004b, 0x004b, 0x1060, 0x1060,
+    0x000b, 0x001b, 0x002b, 0x003b, 0x004b, 0x005b, 0x006b, 0x1070, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x000b, 0x1010, 0x000b, 0x1010, 0x000b, 0x1010, 0x000b, 0x1010,
+    0x000b, 0x000b, 0x1020, 0x1020, 0x000b, 0x000b, 0x1020, 0x1020, 0x000b, 0x001b, 0x002b, 0x1030,
+    0x000b, 0x001b, 0x002b, 0x1030, 0x000b, 0x000b, 0x000b, 0x000b, 0x1040, 0x1040, 0x1040, 0x1040,
+    0x000b, 0x001b, 0x000b, 0x001b, 0x004b, 0x1050, 0x004b, 0x1050, 0x000b, 0x000b, 0x002b, 0x002b,
+    0x004b, 0x004b, 0x1060, 0x1060, 0x000b, 0x001b, 0x002b, 0x003b, 0x004b, 0x005b, 0x006b, 0x1070,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x000b, 0x1010, 0x000b, 0x1010,
+    0x000b, 0x1010, 0x000b, 0x1010, 0x000b, 0x000b, 0x1020, 0x1020, 0x000b, 0x000b, 0x1020, 0x1020,
+    0x000b, 0x001b, 0x002b, 0x1030, 0x000b, 0x001b, 0x002b, 0x1030, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x1040, 0x1040, 0x1040, 0x1040, 0x000b, 0x001b, 0x000b, 0x001b, 0x004b, 0x1050, 0x004b, 0x1050,
+    0x000b, 0x000b, 0x002b, 0x002b, 0x004b, 0x004b, 0x1060, 0x1060, 0x000b, 0x001b, 0x002b, 0x003b,
+    0x004b, 0x005b, 0x006b, 0x1070, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x000b, 0x1010, 0x000b, 0x1010, 0x000b, 0x1010, 0x000b, 0x1010, 0x000b, 0x000b, 0x1020, 0x1020,
+    0x000b, 0x000b, 0x1020, 0x1020, 0x000b, 0x001b, 0x002b, 0x1030, 0x000b, 0x001b, 0x002b, 0x1030,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x1040, 0x1040, 0x1040, 0x1040, 0x000b, 0x001b, 0x000b, 0x001b,
+    0x004b, 0x1050, 0x004b, 0x1050, 0x000b, 0x000b, 0x002b, 0x002b, 0x004b, 0x004b, 0x1060, 0x1060,
+    0x000b, 0x001b, 0x002b, 0x003b, 0x004b, 0x005b, 0x006b, 0x1070, 0x1400, 0x1400, 0x1400, 0x1400,
+    0x1400, 0x1400, 0x1400, 0x1400, 0x040b, 0x1410, 0x040b, 0x1410, 0x040b, 0x1410, 0x040b, 0x1410,
+    0x040b, 0x040b, 0x1420, 0x1420, 0x040b, 0x040b, 0x1420, 0x1420, 0x040b, 0x041b, 0x042b, 0x1430,
+    0x040b, 0x041b, 0x042b, 0x1430, 0x040b, 0x040b, 0x040b, 0x040b, 0x1440, 0x1440, 0x1440, 0x1440,
+    0x040b, 0x041b, 0x040b, 0x041b, 0x044b, 0x1450, 0x044b, 0x1450, 0x040b, 0x040b, 0x042b, 0x042b,
+    0x044b, 0x044b, 0x1460, 0x1460, 0x040b, 0x041b, 0x042b, 0x043b, 0x044b, 0x045b, 0x046b, 0x1470,
+    0x1400, 0x1400, 0x1400, 0x1400, 0x1400, 0x1400, 0x1400, 0x1400, 0x040b, 0x1410, 0x040b, 0x1410,
+    0x040b, 0x1410, 0x040b, 0x1410, 0x040b, 0x040b, 0x1420, 0x1420, 0x040b, 0x040b, 0x1420, 0x1420,
+    0x040b, 0x041b, 0x042b, 0x1430, 0x040b, 0x041b, 0x042b, 0x1430, 0x040b, 0x040b, 0x040b, 0x040b,
+    0x1440, 0x1440, 0x1440, 0x1440, 0x040b, 0x041b, 0x040b, 0x041b, 0x044b, 0x1450, 0x044b, 0x1450,
+    0x040b, 0x040b, 0x042b, 0x042b, 0x044b, 0x044b, 0x1460, 0x1460, 0x040b, 0x041b, 0x042b, 0x043b,
+    0x044b, 0x045b, 0x046b, 0x1470, 0x1400, 0x1400, 0x1400, 0x1400, 0x1400, 0x1400, 0x1400, 0x1400,
+    0x040b, 0x1410, 0x040b, 0x1410, 0x040b, 0x1410, 0x040b, 0x1410, 0x040b, 0x040b, 0x1420, 0x1420,
+    0x040b, 0x040b, 0x1420, 0x1420, 0x040b, 0x041b, 0x042b, 0x1430, 0x040b, 0x041b, 0x042b, 0x1430,
+    0x040b, 0x040b, 0x040b, 0x040b, 0x1440, 0x1440, 0x1440, 0x1440, 0x040b, 0x041b, 0x040b, 0x041b,
+    0x044b, 0x1450, 0x044b, 0x1450, 0x040b, 0x040b, 0x042b, 0x042b, 0x044b, 0x044b, 0x1460, 0x1460,
+    0x040b, 0x041b, 0x042b, 0x043b, 0x044b, 0x045b, 0x046b, 0x1470, 0x1400, 0x1400, 0x1400, 0x1400,
+    0x1400, 0x1400, 0x1400, 0x1400, 0x040b, 0x1410, 0x040b, 0x1410, 0x040b, 0x1410, 0x040b, 0x1410,
+    0x040b, 0x040b, 0x1420, 0x1420, 0x040b, 0x040b, 0x1420, 0x1420, 0x040b, 0x041b, 0x042b, 0x1430,
+    0x040b, 0x041b, 0x042b, 0x1430, 0x040b, 0x040b, 0x040b, 0x040b, 0x1440, 0x1440, 0x1440, 0x1440,
+    0x040b, 0x041b, 0x040b, 0x041b, 0x044b, 0x1450, 0x044b, 0x1450, 0x040b, 0x040b, 0x042b, 0x042b,
+    0x044b, 0x044b, 0x1460, 0x1460, 0x040b, 0x041b, 0x042b, 0x043b, 0x044b, 0x045b, 0x046b, 0x1470,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x000b, 0x1010, 0x000b, 0x1010,
+    0x000b, 0x1010, 0x000b, 0x1010, 0x000b, 0x000b, 0x1020, 0x1020, 0x000b, 0x000b, 0x1020, 0x1020,
+    0x000b, 0x001b, 0x002b, 0x1030, 0x000b, 0x001b, 0x002b, 0x1030, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x1040, 0x1040, 0x1040, 0x1040, 0x000b, 0x001b, 0x000b, 0x001b, 0x004b, 0x1050, 0x004b, 0x1050,
+    0x000b, 0x000b, 0x002b, 0x002b, 0x004b, 0x004b, 0x1060, 0x1060, 0x000b, 0x001b, 0x002b, 0x003b,
+    0x004b, 0x005b, 0x006b, 0x1070, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x000b, 0x1010, 0x000b, 0x1010, 0x000b, 0x1010, 0x000b, 0x1010, 0x000b, 0x000b, 0x1020, 0x1020,
+    0x000b, 0x000b, 0x1020, 0x1020, 0x000b, 0x001b, 0x002b, 0x1030, 0x000b, 0x001b, 0x002b, 0x1030,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x1040, 0x1040, 0x1040, 0x1040, 0x000b, 0x001b, 0x000b, 0x001b,
+    0x004b, 0x1050, 0x004b, 0x1050, 0x000b, 0x000b, 0x002b, 0x002b, 0x004b, 0x004b, 0x1060, 0x1060,
+    0x000b, 0x001b, 0x002b, 0x003b, 0x004b, 0x005b, 0x006b, 0x1070, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x000b, 0x1010, 0x000b, 0x1010, 0x000b, 0x1010, 0x000b, 0x1010,
+    0x000b, 0x000b, 0x1020, 0x1020, 0x000b, 0x000b, 0x1020, 0x1020, 0x000b, 0x001b, 0x002b, 0x1030,
+    0x000b, 0x001b, 0x002b, 0x1030, 0x000b, 0x000b, 0x000b, 0x000b, 0x1040, 0x1040, 0x1040, 0x1040,
+    0x000b, 0x001b, 0x000b, 0x001b, 0x004b, 0x1050, 0x004b, 0x1050, 0x000b, 0x000b, 0x002b, 0x002b,
+    0x004b, 0x004b, 0x1060, 0x1060, 0x000b, 0x001b, 0x002b, 0x003b, 0x004b, 0x005b, 0x006b, 0x1070,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x000b, 0x1010, 0x000b, 0x1010,
+    0x000b, 0x1010, 0x000b, 0x1010, 0x000b, 0x000b, 0x1020, 0x1020, 0x000b, 0x000b, 0x1020, 0x1020,
+    0x000b, 0x001b, 0x002b, 0x1030, 0x000b, 0x001b, 0x002b, 0x1030, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x1040, 0x1040, 0x1040, 0x1040, 0x000b, 0x001b, 0x000b, 0x001b, 0x004b, 0x1050, 0x004b, 0x1050,
+    0x000b, 0x000b, 0x002b, 0x002b, 0x004b, 0x004b, 0x1060, 0x1060, 0x000b, 0x001b, 0x002b, 0x003b,
+    0x004b, 0x005b, 0x006b, 0x1070, 0x080c, 0x081c, 0x082c, 0x083c, 0x084c, 0x085c, 0x086c, 0x087c,
+    0x040b, 0x080c, 0x040b, 0x082c, 0x040b, 0x084c, 0x040b, 0x086c, 0x040b, 0x040b, 0x080c, 0x081c,
+    0x040b, 0x040b, 0x084c, 0x085c, 0x040b, 0x041b, 0x042b, 0x080c, 0x040b, 0x041b, 0x042b, 0x084c,
+    0x040b, 0x040b, 0x040b, 0x040b, 0x080c, 0x081c, 0x082c, 0x083c, 0x040b, 0x041b, 0x040b, 0x041b,
+    0x044b, 0x080c, 0x044b, 0x082c, 0x040b, 0x040b, 0x042b, 0x042b, 0x044b, 0x044b, 0x080c, 0x081c,
+    0x040b, 0x041b, 0x042b, 0x043b, 0x044b, 0x045b, 0x046b, 0x080c, 0x080c, 0x081c, 0x082c, 0x083c,
+    0x084c, 0x085c, 0x086c, 0x087c, 0x040b, 0x080c, 0x040b, 0x082c, 0x040b, 0x084c, 0x040b, 0x086c,
+    0x040b, 0x040b, 0x080c, 0x081c, 0x040b, 0x040b, 0x084c, 0x085c, 0x040b, 0x041b, 0x042b, 0x080c,
+    0x040b, 0x041b, 0x042b, 0x084c, 0x040b, 0x040b, 0x040b, 0x040b, 0x080c, 0x081c, 0x082c, 0x083c,
+    0x040b, 0x041b, 0x040b, 0x041b, 0x044b, 0x080c, 0x044b, 0x082c, 0x040b, 0x040b, 0x042b, 0x042b,
+    0x044b, 0x044b, 0x080c, 0x081c, 0x040b, 0x041b, 0x042b, 0x043b, 0x044b, 0x045b, 0x046b, 0x080c,
+    0x080c, 0x081c, 0x082c, 0x083c, 0x084c, 0x085c, 0x086c, 0x087c, 0x040b, 0x080c, 0x040b, 0x082c,
+    0x040b, 0x084c, 0x040b, 0x086c, 0x040b, 0x040b, 0x080c, 0x081c, 0x040b, 0x040b, 0x084c, 0x085c,
+    0x040b, 0x041b, 0x042b, 0x080c, 0x040b, 0x041b, 0x042b, 0x084c, 0x040b, 0x040b, 0x040b, 0x040b,
+    0x080c, 0x081c, 0x082c, 0x083c, 0x040b, 0x041b, 0x040b, 0x041b, 0x044b, 0x080c, 0x044b, 0x082c,
+    0x040b, 0x040b, 0x042b, 0x042b, 0x044b, 0x044b, 0x080c, 0x081c, 0x040b, 0x041b, 0x042b, 0x043b,
+    0x044b, 0x045b, 0x046b, 0x080c, 0x080c, 0x081c, 0x082c, 0x083c, 0x084c, 0x085c, 0x086c, 0x087c,
+    0x040b, 0x080c, 0x040b, 0x082c, 0x040b, 0x084c, 0x040b, 0x086c, 0x040b, 0x040b, 0x080c, 0x081c,
+    0x040b, 0x040b, 0x084c, 0x085c, 0x040b, 0x041b, 0x042b, 0x080c, 0x040b, 0x041b, 0x042b, 0x084c,
+    0x040b, 0x040b, 0x040b, 0x040b, 0x080c, 0x081c, 0x082c, 0x083c, 0x040b, 0x041b, 0x040b, 0x041b,
+    0x044b, 0x080c, 0x044b, 0x082c, 0x040b, 0x040b, 0x042b, 0x042b, 0x044b, 0x044b, 0x080c, 0x081c,
+    0x040b, 0x041b, 0x042b, 0x043b, 0x044b, 0x045b, 0x046b, 0x080c, 0x080c, 0x081c, 0x082c, 0x083c,
+    0x084c, 0x085c, 0x086c, 0x087c, 0x000b, 0x080c, 0x000b, 0x082c, 0x000b, 0x084c, 0x000b, 0x086c,
+    0x000b, 0x000b, 0x080c, 0x081c, 0x000b, 0x000b, 0x084c, 0x085c, 0x000b, 0x001b, 0x002b, 0x080c,
+    0x000b, 0x001b, 0x002b, 0x084c, 0x000b, 0x000b, 0x000b, 0x000b, 0x080c, 0x081c, 0x082c, 0x083c,
+    0x000b, 0x001b, 0x000b, 0x001b, 0x004b, 0x080c, 0x004b, 0x082c, 0x000b, 0x000b, 0x002b, 0x002b,
+    0x004b, 0x004b, 0x080c, 0x081c, 0x000b, 0x001b, 0x002b, 0x003b, 0x004b, 0x005b, 0x006b, 0x080c,
+    0x080c, 0x081c, 0x082c, 0x083c, 0x084c, 0x085c, 0x086c, 0x087c, 0x000b, 0x080c, 0x000b, 0x082c,
+    0x000b, 0x084c, 0x000b, 0x086c, 0x000b, 0x000b, 0x080c, 0x081c, 0x000b, 0x000b, 0x084c, 0x085c,
+    0x000b, 0x001b, 0x002b, 0x080c, 0x000b, 0x001b, 0x002b, 0x084c, 0x000b, 0x000b, 0x000b, 0x000b,
+    0x080c, 0x081c, 0x082c, 0x083c, 0x000b, 0x001b, 0x000b, 0x001b, 0x004b, 0x080c, 0x004b, 0x082c,
+    0x000b, 0x000b, 0x002b, 0x002b, 0x004b, 0x004b, 0x080c, 0x081c, 0x000b, 0x001b, 0x002b, 0x003b,
+    0x004b, 0x005b, 0x006b, 0x080c, 0x080c, 0x081c, 0x082c, 0x083c, 0x084c, 0x085c, 0x086c, 0x087c,
+    0x000b, 0x080c, 0x000b, 0x082c, 0x000b, 0x084c, 0x000b, 0x086c, 0x000b, 0x000b, 0x080c, 0x081c,
+    0x000b, 0x000b, 0x084c, 0x085c, 0x000b, 0x001b, 0x002b, 0x080c, 0x000b, 0x001b, 0x002b, 0x084c,
+    0x000b, 0x000b, 0x000b, 0x000b, 0x080c, 0x081c, 0x082c, 0x083c, 0x000b, 0x001b, 0x000b, 0x001b,
+    0x004b, 0x080c, 0x004b, 0x082c, 0x000b, 0x000b, 0x002b, 0x002b, 0x004b, 0x004b, 0x080c, 0x081c,
+    0x000b, 0x001b, 0x002b, 0x003b, 0x004b, 0x005b, 0x006b, 0x080c, 0x080c, 0x081c, 0x082c, 0x083c,
+    0x084c, 0x085c, 0x086c, 0x087c, 0x000b, 0x080c, 0x000b, 0x082c, 0x000b, 0x084c, 0x000b, 0x086c,
+    0x000b, 0x000b, 0x080c, 0x081c, 0x000b, 0x000b, 0x084c, 0x085c, 0x000b, 0x001b, 0x002b, 0x080c,
+    0x000b, 0x001b, 0x002b, 0x084c, 0x000b, 0x000b, 0x000b, 0x000b, 0x080c, 0x081c, 0x082c, 0x083c,
+    0x000b, 0x001b, 0x000b, 0x001b, 0x004b, 0x080c, 0x004b, 0x082c, 0x000b, 0x000b, 0x002b, 0x002b,
+    0x004b, 0x004b, 0x080c, 0x081c, 0x000b, 0x001b, 0x002b, 0x003b, 0x004b, 0x005b, 0x006b, 0x080c,
+    0x080c, 0x081c, 0x082c, 0x083c, 0x084c, 0x085c, 0x086c, 0x087c, 0x040b, 0x080c, 0x040b, 0x082c,
+    0x040b, 0x084c, 0x040b, 0x086c, 0x040b, 0x040b, 0x080c, 0x081c, 0x040b, 0x040b, 0x084c, 0x085c,
+    0x040b, 0x041b, 0x042b, 0x080c, 0x040b, 0x041b, 0x042b, 0x084c, 0x040b, 0x040b, 0x040b, 0x040b,
+    0x080c, 0x081c, 0x082c, 0x083c, 0x040b, 0x041b, 0x040b, 0x041b, 0x044b, 0x080c, 0x044b, 0x082c,
+    0x040b, 0x040b, 0x042b, 0x042b, 0x044b, 0x044b, 0x080c, 0x081c, 0x040b, 0x041b, 0x042b, 0x043b,
+    0x044b, 0x045b, 0x046b, 0x080c, 0x080c, 0x081c, 0x082c, 0x083c, 0x084c, 0x085c, 0x086c, 0x087c,
+    0x040b, 0x080c, 0x040b, 0x082c, 0x040b, 0x084c, 0x040b, 0x086c, 0x040b, 0x040b, 0x080c, 0x081c,
+    0x040b, 0x040b, 0x084c, 0x085c, 0x040b, 0x041b, 0x042b, 0x080c, 0x040b, 0x041b, 0x042b, 0x084c,
+    0x040b, 0x040b, 0x040b, 0x040b, 0x080c, 0x081c, 0x082c, 0x083c, 0x040b, 0x041b, 0x040b, 0x041b,
+    0x044b, 0x080c, 0x044b, 0x082c, 0x040b, 0x040b, 0x042b, 0x042b, 0x044b, 0x044b, 0x080c, 0x081c,
+    0x040b, 0x041b, 0x042b, 0x043b, 0x044b, 0x045b, 0x046b, 0x080c, 0x080c, 0x081c, 0x082c, 0x083c,
+    0x084c, 0x085c, 0x086c, 0x087c, 0x040b, 0x080c, 0x040b, 0x082c, 0x040b, 0x084c, 0x040b, 0x086c,
+    0x040b, 0x040b, 0x080c, 0x081c, 0x040b, 0x040b, 0x084c, 0x085c, 0x040b, 0x041b, 0x042b, 0x080c,
+    0x040b, 0x041b, 0x042b, 0x084c, 0x040b, 0x040b, 0x040b, 0x040b, 0x080c, 0x081c, 0x082c, 0x083c,
+    0x040b, 0x041b, 0x040b, 0x041b, 0x044b, 0x080c, 0x044b, 0x082c, 0x040b, 0x040b, 0x042b, 0x042b,
+    0x044b, 0x044b, 0x080c, 0x081c, 0x040b, 0x041b, 0x042b, 0x043b, 0x044b, 0x045b, 0x046b, 0x080c,
+    0x080c, 0x081c, 0x082c, 0x083c, 0x084c, 0x085c, 0x086c, 0x087c, 0x040b, 0x080c, 0x040b, 0x082c,
+    0x040b, 0x084c, 0x040b, 0x086c, 0x040b, 0x040b, 0x080c, 0x081c, 0x040b, 0x040b, 0x084c, 0x085c,
+    0x040b, 0x041b, 0x042b, 0x080c, 0x040b, 0x041b, 0x042b, 0x084c, 0x040b, 0x040b, 0x040b, 0x040b,
+    0x080c, 0x081c, 0x082c, 0x083c, 0x040b, 0x041b, 0x040b, 0x041b, 0x044b, 0x080c, 0x044b, 0x082c,
+    0x040b, 0x040b, 0x042b, 0x042b, 0x044b, 0x044b, 0x080c, 0x081c, 0x040b, 0x041b, 0x042b, 0x043b,
+    0x044b, 0x045b, 0x046b, 0x080c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d, 0x100d,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010,
+    0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1030, 0x1030, 0x1030, 0x1030,
+    0x1030, 0x1030, 0x1030, 0x1030, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040,
+    0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1060, 0x1060, 0x1060, 0x1060,
+    0x1060, 0x1060, 0x1060, 0x1060, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1010, 0x1010, 0x1010, 0x1010,
+    0x1010, 0x1010, 0x1010, 0x1010, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020,
+    0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1040, 0x1040, 0x1040, 0x1040,
+    0x1040, 0x1040, 0x1040, 0x1040, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050,
+    0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1070, 0x1070, 0x1070, 0x1070,
+    0x1070, 0x1070, 0x1070, 0x1070, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1020, 0x1020, 0x1020, 0x1020,
+    0x1020, 0x1020, 0x1020, 0x1020, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030,
+    0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1050, 0x1050, 0x1050, 0x1050,
+    0x1050, 0x1050, 0x1050, 0x1050, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060,
+    0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010,
+    0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1030, 0x1030, 0x1030, 0x1030,
+    0x1030, 0x1030, 0x1030, 0x1030, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040,
+    0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1060, 0x1060, 0x1060, 0x1060,
+    0x1060, 0x1060, 0x1060, 0x1060, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1010, 0x1010, 0x1010, 0x1010,
+    0x1010, 0x1010, 0x1010, 0x1010, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020,
+    0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1040, 0x1040, 0x1040, 0x1040,
+    0x1040, 0x1040, 0x1040, 0x1040, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050,
+    0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1070, 0x1070, 0x1070, 0x1070,
+    0x1070, 0x1070, 0x1070, 0x1070, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1020, 0x1020, 0x1020, 0x1020,
+    0x1020, 0x1020, 0x1020, 0x1020, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030,
+    0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1050, 0x1050, 0x1050, 0x1050,
+    0x1050, 0x1050, 0x1050, 0x1050, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060,
+    0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010,
+    0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1030, 0x1030, 0x1030, 0x1030,
+    0x1030, 0x1030, 0x1030, 0x1030, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040,
+    0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1060, 0x1060, 0x1060, 0x1060,
+    0x1060, 0x1060, 0x1060, 0x1060, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1010, 0x1010, 0x1010, 0x1010,
+    0x1010, 0x1010, 0x1010, 0x1010, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020,
+    0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1040, 0x1040, 0x1040, 0x1040,
+    0x1040, 0x1040, 0x1040, 0x1040, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050,
+    0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1070, 0x1070, 0x1070, 0x1070,
+    0x1070, 0x1070, 0x1070, 0x1070, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1020, 0x1020, 0x1020, 0x1020,
+    0x1020, 0x1020, 0x1020, 0x1020, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030,
+    0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1050, 0x1050, 0x1050, 0x1050,
+    0x1050, 0x1050, 0x1050, 0x1050, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060,
+    0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010,
+    0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1030, 0x1030, 0x1030, 0x1030,
+    0x1030, 0x1030, 0x1030, 0x1030, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040,
+    0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1060, 0x1060, 0x1060, 0x1060,
+    0x1060, 0x1060, 0x1060, 0x1060, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1010, 0x1010, 0x1010, 0x1010,
+    0x1010, 0x1010, 0x1010, 0x1010, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020,
+    0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1040, 0x1040, 0x1040, 0x1040,
+    0x1040, 0x1040, 0x1040, 0x1040, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050,
+    0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1070, 0x1070, 0x1070, 0x1070,
+    0x1070, 0x1070, 0x1070, 0x1070, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1020, 0x1020, 0x1020, 0x1020,
+    0x1020, 0x1020, 0x1020, 0x1020, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030,
+    0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1050, 0x1050, 0x1050, 0x1050,
+    0x1050, 0x1050, 0x1050, 0x1050, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060,
+    0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010,
+    0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1030, 0x1030, 0x1030, 0x1030,
+    0x1030, 0x1030, 0x1030, 0x1030, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040,
+    0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1060, 0x1060, 0x1060, 0x1060,
+    0x1060, 0x1060, 0x1060, 0x1060, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1010, 0x1010, 0x1010, 0x1010,
+    0x1010, 0x1010, 0x1010, 0x1010, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020,
+    0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1040, 0x1040, 0x1040, 0x1040,
+    0x1040, 0x1040, 0x1040, 0x1040, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050,
+    0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1070, 0x1070, 0x1070, 0x1070,
+    0x1070, 0x1070, 0x1070, 0x1070, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1020, 0x1020, 0x1020, 0x1020,
+    0x1020, 0x1020, 0x1020, 0x1020, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030,
+    0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1050, 0x1050, 0x1050, 0x1050,
+    0x1050, 0x1050, 0x1050, 0x1050, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060,
+    0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010,
+    0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1030, 0x1030, 0x1030, 0x1030,
+    0x1030, 0x1030, 0x1030, 0x1030, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040,
+    0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1060, 0x1060, 0x1060, 0x1060,
+    0x1060, 0x1060, 0x1060, 0x1060, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1010, 0x1010, 0x1010, 0x1010,
+    0x1010, 0x1010, 0x1010, 0x1010, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020,
+    0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1040, 0x1040, 0x1040, 0x1040,
+    0x1040, 0x1040, 0x1040, 0x1040, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050,
+    0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1070, 0x1070, 0x1070, 0x1070,
+    0x1070, 0x1070, 0x1070, 0x1070, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1020, 0x1020, 0x1020, 0x1020,
+    0x1020, 0x1020, 0x1020, 0x1020, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030,
+    0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1050, 0x1050, 0x1050, 0x1050,
+    0x1050, 0x1050, 0x1050, 0x1050, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060,
+    0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010,
+    0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1030, 0x1030, 0x1030, 0x1030,
+    0x1030, 0x1030, 0x1030, 0x1030, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040,
+    0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1060, 0x1060, 0x1060, 0x1060,
+    0x1060, 0x1060, 0x1060, 0x1060, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1010, 0x1010, 0x1010, 0x1010,
+    0x1010, 0x1010, 0x1010, 0x1010, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020,
+    0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1040, 0x1040, 0x1040, 0x1040,
+    0x1040, 0x1040, 0x1040, 0x1040, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050,
+    0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1070, 0x1070, 0x1070, 0x1070,
+    0x1070, 0x1070, 0x1070, 0x1070, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1020, 0x1020, 0x1020, 0x1020,
+    0x1020, 0x1020, 0x1020, 0x1020, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030,
+    0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1050, 0x1050, 0x1050, 0x1050,
+    0x1050, 0x1050, 0x1050, 0x1050, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060,
+    0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010,
+    0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1030, 0x1030, 0x1030, 0x1030,
+    0x1030, 0x1030, 0x1030, 0x1030, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040,
+    0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1060, 0x1060, 0x1060, 0x1060,
+    0x1060, 0x1060, 0x1060, 0x1060, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070,
+    0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1010, 0x1010, 0x1010, 0x1010,
+    0x1010, 0x1010, 0x1010, 0x1010, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020, 0x1020,
+    0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1040, 0x1040, 0x1040, 0x1040,
+    0x1040, 0x1040, 0x1040, 0x1040, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050, 0x1050,
+    0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1070, 0x1070, 0x1070, 0x1070,
+    0x1070, 0x1070, 0x1070, 0x1070, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000, 0x1000,
+    0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1010, 0x1020, 0x1020, 0x1020, 0x1020,
+    0x1020, 0x1020, 0x1020, 0x1020, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030, 0x1030,
+    0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1040, 0x1050, 0x1050, 0x1050, 0x1050,
+    0x1050, 0x1050, 0x1050, 0x1050, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060, 0x1060,
+    0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x1070, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000
+};
@@ -9,66 +9,11 @@
 
 #include "fsm_common.h"
 #include "fsm_lights.h"
-
-/***** Definitions ***********************************************************/
-
-#define TRANS_COUNT (sizeof(trans_table) / sizeof(*trans_table))
-
-/* States */
-typedef enum
-{
-    ST_ANY = -1, /* Any state */
-    ST_INIT = 0, /* Init state */
-    ST_ALL_OFF,
-    ST_ONE_ON,
-    ST_ONE_ON_ACK,
-    ST_TERM = 255 /* Final state */
-} fsm_state_t;
-
-/* Events */
-typedef enum
-{
-    EV_ANY = -1, /* Any event */
-    EV_NONE = 0, /* No event */
-    EV_CMD_ON,
-    EV_CMD_OFF,
-    EV_CMD_ON_ACK,
-    EV_ERR = 255 /* Error event */
-} fsm_event_t;
-
-/* State transition */
-typedef struct
-{
-    fsm_state_t state;
-    fsm_event_t event;
-    int (*callback)(void);
-    int next_state;
-} transition_t;
-
-/***** Static Functions Declarations *****************************************/
-
-static int callback_init(void);
-static int callback_error(void);
-static int callback_cmd_ON(void);
-static int callback_cmd_OFF(void);
-static int callback_cmd_ON_wait_ACK(void);
-static fsm_event_t get_next_event(fsm_state_t current_state);
-
-/***** Static Variables ******************************************************/
-
-static fsm_state_t state = ST_INIT; /* State of the FSM */
-static uint8_t timer_counter = 0;   /* Timer for 1 second delay, increment each 100ms */
-
-static const transition_t trans_table[] = {
-    {ST_INIT, EV_NONE, &callback_init, ST_ALL_OFF},
-    {ST_ALL_OFF, EV_CMD_ON, &callback_cmd_ON, ST_ONE_ON},
-    {ST_ONE_ON, EV_CMD_OFF, &callback_cmd_OFF, ST_ALL_OFF},
-    {ST_ONE_ON, EV_NONE, &callback_cmd_ON_wait_ACK, ST_ONE_ON},
-    {ST_ONE_ON, EV_CMD_ON_ACK, NULL, ST_ONE_ON_ACK},
-    {ST_ONE_ON_ACK, EV_CMD_OFF, &callback_init, ST_ALL_OFF},
-    {ST_ONE_ON, EV_ERR, &callback_error, ST_TERM},
-    {ST_ANY, EV_ERR, &callback_error, ST_TERM},
-};
+#include "fsm_lights_gen.h"
+#include "probe.h"
+#ifdef WITH_FSM_PRODUCT
+#include "fsm_product.h"
+#endif
 
 /***** Static Functions Definitions ******************************************/
 
@@ -124,6 +69,9 @@ static int callback_cmd_ON(void)
         set_flag_crossing_light(OFF);
         set_flag_highbeam_light(ON);
     }
+
+    timer_counter = 0;
+
     return 0;
 }
 
@@ -156,144 +104,191 @@ static int callback_cmd_OFF(void)
 }
 
 /**
- * \brief Callback for waiting ON ack.
+ * \brief Clear the acknowledge bit of the light switched on.
  * \return int : Negative value for error code.
  */
-static int callback_cmd_ON_wait_ACK(void)
+static int callback_cmd_ON_ack(void)
 {
-    timer_counter++;
+    bit_flag_t bgf_ack = get_bit_flag_bgf_ack();
+
+    if ((get_cmd_position_light() == ON) && (get_flag_position_light() == ON))
+    {
+        CLEAR_BIT(bgf_ack, BGF_ACK_POSITION_LIGHT);
+    }
+    else if ((get_cmd_crossing_light() == ON) && (get_flag_crossing_light() == ON))
+    {
+        CLEAR_BIT(bgf_ack, BGF_ACK_CROSSING_LIGHT);
+    }
+    else if ((get_cmd_highbeam_light() == ON) && (get_flag_highbeam_light() == ON))
+    {
+        CLEAR_BIT(bgf_ack, BGF_ACK_HIGHBEAM_LIGHT);
+    }
+    set_bit_flag_bgf_ack(bgf_ack);
+
     return 0;
 }
 
 /**
- * \brief Get the next event for the FSM.
- * \param current_state : Current FSM state.
- * \return fsm_event_t : Next event value.
+ * \brief Check whether the light switched on has been acknowledged.
+ * \return bool : true when the acknowledge bit of the commanded light is set.
  */
-static fsm_event_t get_next_event(fsm_state_t current_state)
+static bool guard_on_acknowledged(void)
 {
-    fsm_event_t event = EV_NONE;
     bit_flag_t bgf_ack = get_bit_flag_bgf_ack();
 
-    bool position_ON = (get_cmd_position_light() == ON);
-    bool crossing_ON = (get_cmd_crossing_light() == ON);
-    bool highbeam_ON = (get_cmd_highbeam_light() == ON);
-    bool flag_position_ON = (get_flag_position_light() == ON);
-    bool flag_crossing_ON = (get_flag_crossing_light() == ON);
-    bool flag_highbeam_ON = (get_flag_highbeam_light() == ON);
-    bool position_ON_ack = (bgf_ack & BGF_ACK_POSITION_LIGHT);
-    bool crossing_ON_ack = (bgf_ack & BGF_ACK_CROSSING_LIGHT);
-    bool highbeam_ON_ack = (bgf_ack & BGF_ACK_HIGHBEAM_LIGHT);
-
-    /* Build all the events */
-    switch (current_state)
+    if ((get_cmd_position_light() == ON) && (get_flag_position_light() == ON))
     {
-    case ST_ALL_OFF:
-        if (position_ON || crossing_ON || highbeam_ON)
-        {
-            event = EV_CMD_ON;
-        }
-        break;
-
-    case ST_ONE_ON:
-        if (!position_ON && !crossing_ON && !highbeam_ON)
-        {
-            if (flag_position_ON || flag_crossing_ON || flag_highbeam_ON)
-            {
-                event = EV_CMD_OFF;
-            }
-        }
-        else if (timer_counter < TIMER_1S_COUNT_100MS)
-        {
-            if (position_ON && flag_position_ON)
-            {
-                if (position_ON_ack)
-                {
-                    event = EV_CMD_ON_ACK;
-                    /* Clear acknowledge bit */
-                    CLEAR_BIT(bgf_ack, BGF_ACK_POSITION_LIGHT);
-                    set_bit_flag_bgf_ack(bgf_ack);
-                }
-            }
-            else if (crossing_ON && flag_crossing_ON)
-            {
-                if (crossing_ON_ack)
-                {
-                    event = EV_CMD_ON_ACK;
-                    /* Clear acknowledge bit */
-                    CLEAR_BIT(bgf_ack, BGF_ACK_CROSSING_LIGHT);
-                    set_bit_flag_bgf_ack(bgf_ack);
-                }
-            }
-            else if (highbeam_ON && flag_highbeam_ON)
-            {
-                if (highbeam_ON_ack)
-                {
-                    event = EV_CMD_ON_ACK;
-                    /* Clear acknowledge bit */
-                    CLEAR_BIT(bgf_ack, BGF_ACK_HIGHBEAM_LIGHT);
-                    set_bit_flag_bgf_ack(bgf_ack);
-                }
-            }
-        }
-        else
-        {
-            event = EV_ERR;
-        }
-        break;
-
-    case ST_ONE_ON_ACK:
-        if (!position_ON && !crossing_ON && !highbeam_ON)
-        {
-            event = EV_CMD_OFF;
-        }
-        break;
-
-    case ST_TERM:
-    case ST_ANY:
-        event = EV_ERR;
-        break;
-
-    default:
-        break;
+        return (bgf_ack & BGF_ACK_POSITION_LIGHT) != 0;
+    }
+    if ((get_cmd_crossing_light() == ON) && (get_flag_crossing_light() == ON))
+    {
+        return (bgf_ack & BGF_ACK_CROSSING_LIGHT) != 0;
+    }
+    if ((get_cmd_highbeam_light() == ON) && (get_flag_highbeam_light() == ON))
+    {
+        return (bgf_ack & BGF_ACK_HIGHBEAM_LIGHT) != 0;
+    }
+    return false;
+}
+
+#ifdef WITH_FSM_PRODUCT
+/**
+ * \brief Evaluate the FSM once with a single lookup in its precomputed table.
+ * \details Same outcome as fsm_step(), which still handles a state outside the table.
+ * \param tick : true for periodic 100ms evaluation, false for an immediate evaluation not advancing timers
+ * \return int : Return code of transition callback.
+ */
+static int fsm_step_product(bool tick)
+{
+    uint32_t state_index = fsm_product_state_index(state, FSM_PRODUCT_LIGHTS_STATES);
+    bit_flag_t bgf_ack = 0;
+    uint32_t ack_clear = 0;
+    uint32_t flags = 0;
+    uint32_t next_flags = 0;
+    uint32_t changed = 0;
+    uint32_t inputs = 0;
+    uint32_t transition = 0;
+    uint16_t entry = 0;
+    fsm_state_t previous = state;
+
+    if (state_index >= FSM_PRODUCT_LIGHTS_STATES)
+    {
+        return fsm_step(tick);
+    }
+
+    bgf_ack = get_bit_flag_bgf_ack();
+    flags = (uint32_t)get_flag_position_light() | ((uint32_t)get_flag_crossing_light() << 1) |
+            ((uint32_t)get_flag_highbeam_light() << 2);
+    inputs = (uint32_t)get_cmd_position_light() | ((uint32_t)get_cmd_crossing_light() << 1) |
+             ((uint32_t)get_cmd_highbeam_light() << 2) | (flags << 3) |
+             ((uint32_t)(bgf_ack & (BGF_ACK_POSITION_LIGHT | BGF_ACK_CROSSING_LIGHT | BGF_ACK_HIGHBEAM_LIGHT)) << 6);
+    entry = fsm_product_lights[fsm_product_index(inputs, FSM_PRODUCT_LIGHTS_INPUTS, tick,
+                                                  fsm_product_timer_class(timer_counter, TIMER_1S_COUNT_100MS),
+                                                  state_index)];
+
+    fsm_trace_begin(&trace);
+    transition = FSM_PRODUCT_TRANSITION(entry);
+    if (transition != 0)
+    {
+        transition--;
+        fsm_trace_transition(&trace, transition, state, fsm_product_lights_next[transition],
+                             fsm_product_lights_event[transition]);
+        state = (fsm_state_t)fsm_product_lights_next[transition];
     }
 
-    return event;
+    /* Outputs: changed flags, acknowledgement bits to clear and timer */
+    next_flags = FSM_PRODUCT_FLAGS(entry);
+    changed = next_flags ^ flags;
+    if (changed & (1u << 0))
+    {
+        set_flag_position_light((next_flags >> 0) & 0x01u);
+    }
+    if (changed & (1u << 1))
+    {
+        set_flag_crossing_light((next_flags >> 1) & 0x01u);
+    }
+    if (changed & (1u << 2))
+    {
+        set_flag_highbeam_light((next_flags >> 2) & 0x01u);
+    }
+    ack_clear = FSM_PRODUCT_ACK_CLEAR(entry);
+    if (ack_clear != 0)
+    {
+        set_bit_flag_bgf_ack(bgf_ack & (bit_flag_t)~(bit_flag_t)ack_clear);
+    }
+    timer_counter = fsm_product_timer_next(entry, timer_counter);
+    fsm_trace_end(&trace);
+
+    /* Keep the transitions leading to the final state */
+    if ((state == ST_TERM) && (previous != ST_TERM))
+    {
+        fsm_trace_dump("lights", &trace.data);
+    }
+
+    return ((entry & FSM_PRODUCT_ERROR) != 0) ? -1 : 0;
+}
+#endif
+
+/**
+ * \brief Evaluate the FSM with the selected implementation, firing the transition probe on a state change.
+ * \param tick : true for periodic 100ms evaluation, false for an immediate evaluation not advancing timers
+ * \return int : Return code of transition callback.
+ */
+static int fsm_eval(bool tick)
+{
+    int from = (int)state;
+    int ret = 0;
+
+#ifdef WITH_FSM_PRODUCT
+    ret = fsm_step_product(tick);
+#else
+    ret = fsm_step(tick);
+#endif
+    if ((int)state != from)
+    {
+        PROBE3(fsm_transition, "lights", from, (int)state);
+    }
+
+    return ret;
 }
 
 /***** Functions *************************************************************/
 
 int fsm_lights_run(void)
 {
-    size_t i = 0;
-    int ret = 0;
-    fsm_event_t event = EV_NONE;
+    return fsm_eval(true);
+}
+
+int fsm_lights_kick(void)
+{
+    return fsm_eval(false);
+}
+
+int fsm_lights_get_state(void)
+{
+    return (int)state;
+}
 
-    if (state != ST_TERM)
+void fsm_lights_get_trace(fsm_trace_data_t *data)
+{
+    fsm_trace_snapshot(&trace, data);
+}
+
+void fsm_lights_save(uint8_t *saved_state, uint8_t *saved_timer)
+{
+    *saved_state = (uint8_t)state;
+    *saved_timer = timer_counter;
+}
+
+bool fsm_lights_restore(uint8_t saved_state, uint8_t saved_timer)
+{
+    /* A terminated or unknown state is not resumed, the FSM starts over */
+    if (saved_state > ST_ONE_ON_ACK)
     {
-        /* Get event */
-        event = get_next_event(state);
-        /* For each transitions */
-        for (i = 0; i < TRANS_COUNT; i++)
-        {
-            /* If State is current state OR The transition applies to all states ...*/
-            if ((state == trans_table[i].state) || (ST_ANY == trans_table[i].state))
-            {
-                /* If event is the transition event OR the event applies to all */
-                if ((event == trans_table[i].event) || (EV_ANY == trans_table[i].event))
-                {
-                    /* Apply the new state */
-                    state = trans_table[i].next_state;
-                    if (trans_table[i].callback != NULL)
-                    {
-                        /* Call the state function */
-                        ret = (trans_table[i].callback)();
-                    }
-                    break;
-                }
-            }
-        }
+        return false;
     }
+    state = (fsm_state_t)saved_state;
+    timer_counter = saved_timer;
 
-    return ret;
+    return true;
 }
@@ -8,6 +8,12 @@
 #ifndef FSM_LIGHTS_H
 #define FSM_LIGHTS_H
 
+/***** Includes **************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "fsm_trace.h"
+
 /***** Functions *************************************************************/
 
 /**
@@ -16,4 +22,38 @@
  */
 int fsm_lights_run(void);
 
+/**
+ * \brief Evaluate the lights FSM immediately, without advancing its timers.
+ * \details Used to react to an acknowledgement as soon as it is received.
+ * \return int : Return code of transition callback, 0 if none was called.
+ */
+int fsm_lights_kick(void);
+
+/**
+ * \brief Get the current state of the lights FSM.
+ * \return int : Current state value
+ */
+int fsm_lights_get_state(void);
+
+/**
+ * \brief Get a snapshot of the lights FSM instrumentation, from any thread.
+ * \param data : Output instrumentation data
+ */
+void fsm_lights_get_trace(fsm_trace_data_t *data);
+
+/**
+ * \brief Save the state and timer of the lights FSM, for a warm restart.
+ * \param saved_state : Output state
+ * \param saved_timer : Output timer counter
+ */
+void fsm_lights_save(uint8_t *saved_state, uint8_t *saved_timer);
+
+/**
+ * \brief Resume the lights FSM from a saved state and timer, before its first run.
+ * \param saved_state : Saved state
+ * \param saved_timer : Saved timer counter
+ * \return bool : true if resumed, false if terminated or unknown (the FSM starts from ST_INIT)
+ */
+bool fsm_lights_restore(uint8_t saved_state, uint8_t saved_timer);
+
 #endif /* FSM_LIGHTS_H */
\ No newline at end of file
@@ -0,0 +1,169 @@
+/**
+ * \file fsm_lights_gen.h
+ * \brief Generated evaluation of the lights (position, crossing, highbeam) FSM.
+ * \details Generated by generator/gen_fsm.py from generator/fsm/lights.json, do not edit.
+ *          Private to fsm_lights.c, which provides the actions and guards declared here.
+ *          Each state evaluates its own rules and calls the matching transition directly.
+ * \author Raphael CAUSSE
+ */
+
+#ifndef FSM_LIGHTS_GEN_H
+#define FSM_LIGHTS_GEN_H
+
+/***** Definitions ***********************************************************/
+
+/* States */
+typedef enum
+{
+    ST_INIT = 0,   /* Init state */
+    ST_ALL_OFF,    /* All lights off */
+    ST_ONE_ON,     /* One light on, waiting for acknowledgement */
+    ST_ONE_ON_ACK, /* One light on and acknowledged */
+    ST_TERM = 255  /* Final state */
+} fsm_state_t;
+
+/* Events */
+typedef enum
+{
+    EV_NONE = 0,   /* No event */
+    EV_CMD_ON,     /* Command to switch one light on */
+    EV_CMD_OFF,    /* Command to switch lights off */
+    EV_CMD_ON_ACK, /* Acknowledgement of the light switched on */
+    EV_ERR = 255   /* Error event */
+} fsm_event_t;
+
+/***** Static Functions Declarations *****************************************/
+
+static int callback_init(void);
+static int callback_error(void);
+static int callback_cmd_ON(void);
+static int callback_cmd_OFF(void);
+static int callback_cmd_ON_ack(void);
+static bool guard_on_acknowledged(void);
+static int fsm_step(bool tick);
+
+/***** Static Variables ******************************************************/
+
+static fsm_state_t state = ST_INIT; /* State of the FSM */
+static fsm_trace_t trace;           /* Transition instrumentation */
+static uint8_t timer_counter = 0;   /* Timer for 1 second delay, increment each 100ms */
+
+/***** Static Functions Definitions ******************************************/
+
+/**
+ * \brief Evaluate the FSM once.
+ * \param tick : true for periodic 100ms evaluation, false for an immediate evaluation not advancing timers
+ * \return int : Return code of transition callback.
+ */
+static int fsm_step(bool tick)
+{
+    int ret = 0;
+    fsm_state_t previous = state;
+
+    fsm_trace_begin(&trace);
+    switch (state)
+    {
+    case ST_INIT:
+    {
+        fsm_trace_transition(&trace, 0u, ST_INIT, ST_ALL_OFF, EV_NONE);
+        state = ST_ALL_OFF;
+        ret = callback_init();
+        break;
+    }
+
+    case ST_ALL_OFF:
+    {
+        const bool position_on = (get_cmd_position_light() == ON);
+        const bool crossing_on = (get_cmd_crossing_light() == ON);
+        const bool highbeam_on = (get_cmd_highbeam_light() == ON);
+        const bool any_on = (position_on || crossing_on || highbeam_on);
+
+        if (any_on)
+        {
+            fsm_trace_transition(&trace, 1u, ST_ALL_OFF, ST_ONE_ON, EV_CMD_ON);
+            state = ST_ONE_ON;
+            ret = callback_cmd_ON();
+        }
+        break;
+    }
+
+    case ST_ONE_ON:
+    {
+        const bool position_on = (get_cmd_position_light() == ON);
+        const bool crossing_on = (get_cmd_crossing_light() == ON);
+        const bool highbeam_on = (get_cmd_highbeam_light() == ON);
+        const bool any_on = (position_on || crossing_on || highbeam_on);
+        const bool any_flag_on = ((get_flag_position_light() == ON) || (get_flag_crossing_light() == ON) || (get_flag_highbeam_light() == ON));
+
+        if (!any_on && any_flag_on)
+        {
+            fsm_trace_transition(&trace, 2u, ST_ONE_ON, ST_ALL_OFF, EV_CMD_OFF);
+            state = ST_ALL_OFF;
+            ret = callback_cmd_OFF();
+        }
+        else if (!any_on)
+        {
+            fsm_trace_transition(&trace, 3u, ST_ONE_ON, ST_ONE_ON, EV_NONE);
+            state = ST_ONE_ON;
+        }
+        else if (timer_counter >= TIMER_1S_COUNT_100MS)
+        {
+            fsm_trace_transition(&trace, 6u, ST_ONE_ON, ST_TERM, EV_ERR);
+            state = ST_TERM;
+            ret = callback_error();
+        }
+        else if (guard_on_acknowledged())
+        {
+            fsm_trace_transition(&trace, 4u, ST_ONE_ON, ST_ONE_ON_ACK, EV_CMD_ON_ACK);
+            state = ST_ONE_ON_ACK;
+            ret = callback_cmd_ON_ack();
+        }
+        else
+        {
+            fsm_trace_transition(&trace, 3u, ST_ONE_ON, ST_ONE_ON, EV_NONE);
+            state = ST_ONE_ON;
+        }
+        if (tick && (state == ST_ONE_ON))
+        {
+            timer_counter++;
+        }
+        break;
+    }
+
+    case ST_ONE_ON_ACK:
+    {
+        const bool position_on = (get_cmd_position_light() == ON);
+        const bool crossing_on = (get_cmd_crossing_light() == ON);
+        const bool highbeam_on = (get_cmd_highbeam_light() == ON);
+        const bool any_on = (position_on || crossing_on || highbeam_on);
+
+        if (!any_on)
+        {
+            fsm_trace_transition(&trace, 5u, ST_ONE_ON_ACK, ST_ALL_OFF, EV_CMD_OFF);
+            state = ST_ALL_OFF;
+            ret = callback_init();
+        }
+        break;
+    }
+
+    case ST_TERM:
+        break;
+
+    default:
+        fsm_trace_transition(&trace, 7u, state, ST_TERM, EV_ERR);
+        state = ST_TERM;
+        ret = callback_error();
+        break;
+    }
+    fsm_trace_end(&trace);
+
+    /* Keep the transitions leading to the final state */
+    if ((state == ST_TERM) && (previous != ST_TERM))
+    {
+        fsm_trace_dump("lights", &trace.data);
+    }
+
+    return ret;
+}
+
+#endif /* FSM_LIGHTS_GEN_H */
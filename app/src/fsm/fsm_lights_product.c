@@ -0,0 +1,1726 @@
+/**
+ * \file fsm_lights_product.c
+ * \brief Precomputed table of the lights FSM.
+ * \details Generated by generator/gen_fsm_product.c (make fsm_product), do not edit.
+ * \author Raphael CAUSSE
+ */
+
+/***** Includes **************************************************************/
+
+#include "fsm_product.h"
+
+/***** Variables *************************************************************/
+
+const uint8_t fsm_product_lights_next[8] = {1, 2, 1, 2, 3, 1, 255, 0};
+
+const uint8_t fsm_product_lights_event[8] = {0, 1, 2, 0, 3, 2, 255, 0};
+
+const uint16_t fsm_product_lights[20480] = {
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0010, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0020, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0030, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0040, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0050, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0060, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0070, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0000, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0010, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0020, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0030, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0040, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0050, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0060, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0070, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0000, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0010, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0020, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0030, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0040, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0050, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0060, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0070, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0000, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0010, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0020, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0030, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0040, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0050, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0060, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0070, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0000, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0010, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0020, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0030, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0040, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0050, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0060, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0070, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0000, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0010, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0020, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0030, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0040, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0050, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0060, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0070, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0000, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0010, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0020, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0030, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0040, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0050, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0060, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0070, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0000, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0010, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0020, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0030, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0040, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0050, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0060, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0070, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0000, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0010, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0020, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0030, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0040, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0050, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0060, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0070, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0000, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0010, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0020, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0030, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0040, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0050, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0060, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0070, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0000, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0010, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0020, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0030, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0040, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0050, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0060, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0070, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0000, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0010, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0020, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0030, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0040, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0050, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0060, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0070, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0000, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0010, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0020, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0030, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0040, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0050, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0060, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0070, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0000, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0010, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0020, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0030, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0040, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0050, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0060, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0070, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0000, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0010, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0020, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0030, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0040, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0050, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0060, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0070, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0000, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0010, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0020, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0030, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0040, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0050, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0060, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0070, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0000, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0010, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0020, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0030, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0040, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0050, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0060, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0070, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0000, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0010, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0020, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0030, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0040, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0050, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0060, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0070, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0000, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0010, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0020, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0030, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0040, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0050, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0060, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0070, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0000, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0010, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0020, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0030, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0040, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0050, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0060, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0070, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0000, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0010, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0020, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0030, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0040, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0050, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0060, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0070, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0000, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0010, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0020, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0030, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0040, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0050, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0060, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0070, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0000, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0010, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0020, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0030, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0040, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0050, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0060, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0070, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0000, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0010, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0020, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0030, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0040, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0050, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0060, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0070, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0000, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0010, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0020, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0030, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0040, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0050, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0060, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0070, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0000, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0010, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0020, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0030, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0040, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0050, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0060, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0070, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0000, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0010, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0020, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0030, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0040, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0050, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0060, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0070, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0000, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0010, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0020, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0030, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0040, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0050, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0060, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0070, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0000, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0010, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0020, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0030, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0040, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0050, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0060, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0070, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0000, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0010, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0020, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0030, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0040, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0050, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0060, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0070, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0000, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0010, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0020, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0030, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0040, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0050, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0060, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0070, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0000, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0010, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0020, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0030, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0040, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0050, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0060, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0070, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0000, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0010, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0020, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0030, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0040, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0050, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0060, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0070, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0000, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0010, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0020, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0030, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0040, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0050, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0060, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0070, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0000, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0010, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0020, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0030, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0040, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0050, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0060, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0070, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0000, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0010, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0020, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0030, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0040, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0050, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0060, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0070, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0000, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0010, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0020, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0030, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0040, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0050, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0060, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0070, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0000, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0010, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0020, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0030, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0040, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0050, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0060, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0070, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0000, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0010, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0020, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0030, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0040, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0050, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0060, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0070, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0000, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0010, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0020, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0030, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0040, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0050, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0060, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0070, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0000, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0010, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0020, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0030, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0040, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0050, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0060, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0070, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0000, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0010, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0020, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0030, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0040, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0050, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0060, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0070, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0000, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0010, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0020, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0030, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0040, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0050, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0060, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0070, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0000, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0010, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0020, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0030, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0040, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0050, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0060, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0070, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0000, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0010, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0020, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0030, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0040, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0050, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0060, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0070, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0000, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0010, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0020, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0030, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0040, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0050, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0060, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0070, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0000, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0010, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0020, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0030, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0040, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0050, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0060, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0070, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0000, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0010, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0020, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0030, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0040, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0050, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842,
+    0x0060, 0x0812, 0x0822, 0x0822, 0x0842, 0x0842, 0x0842, 0x0842, 0x0070, 0x0812, 0x0822, 0x0822,
+    0x0842, 0x0842, 0x0842, 0x0842, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0803, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014,
+    0x0803, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0803, 0x0034, 0x0034, 0x0034,
+    0x0034, 0x0034, 0x0034, 0x0034, 0x0803, 0x0044, 0x0044, 0x0044, 0x0044, 0x0044, 0x0044, 0x0044,
+    0x0803, 0x0054, 0x0054, 0x0054, 0x0054, 0x0054, 0x0054, 0x0054, 0x0803, 0x0064, 0x0064, 0x0064,
+    0x0064, 0x0064, 0x0064, 0x0064, 0x0803, 0x0074, 0x0074, 0x0074, 0x0074, 0x0074, 0x0074, 0x0074,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0803, 0x0095, 0x0014, 0x0095,
+    0x0014, 0x0095, 0x0014, 0x0095, 0x0803, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024,
+    0x0803, 0x00b5, 0x0034, 0x00b5, 0x0034, 0x00b5, 0x0034, 0x00b5, 0x0803, 0x0044, 0x0044, 0x0044,
+    0x0044, 0x0044, 0x0044, 0x0044, 0x0803, 0x00d5, 0x0054, 0x00d5, 0x0054, 0x00d5, 0x0054, 0x00d5,
+    0x0803, 0x0064, 0x0064, 0x0064, 0x0064, 0x0064, 0x0064, 0x0064, 0x0803, 0x00f5, 0x0074, 0x00f5,
+    0x0074, 0x00f5, 0x0074, 0x00f5, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0803, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0803, 0x0024, 0x0125, 0x0125,
+    0x0024, 0x0024, 0x0125, 0x0125, 0x0803, 0x0034, 0x0135, 0x0034, 0x0034, 0x0034, 0x0135, 0x0034,
+    0x0803, 0x0044, 0x0044, 0x0044, 0x0044, 0x0044, 0x0044, 0x0044, 0x0803, 0x0054, 0x0054, 0x0054,
+    0x0054, 0x0054, 0x0054, 0x0054, 0x0803, 0x0064, 0x0165, 0x0165, 0x0064, 0x0064, 0x0165, 0x0165,
+    0x0803, 0x0074, 0x0175, 0x0074, 0x0074, 0x0074, 0x0175, 0x0074, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0803, 0x0095, 0x0014, 0x0095, 0x0014, 0x0095, 0x0014, 0x0095,
+    0x0803, 0x0024, 0x0125, 0x0125, 0x0024, 0x0024, 0x0125, 0x0125, 0x0803, 0x00b5, 0x0135, 0x00b5,
+    0x0034, 0x00b5, 0x0135, 0x00b5, 0x0803, 0x0044, 0x0044, 0x0044, 0x0044, 0x0044, 0x0044, 0x0044,
+    0x0803, 0x00d5, 0x0054, 0x00d5, 0x0054, 0x00d5, 0x0054, 0x00d5, 0x0803, 0x0064, 0x0165, 0x0165,
+    0x0064, 0x0064, 0x0165, 0x0165, 0x0803, 0x00f5, 0x0175, 0x00f5, 0x0074, 0x00f5, 0x0175, 0x00f5,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0803, 0x0014, 0x0014, 0x0014,
+    0x0014, 0x0014, 0x0014, 0x0014, 0x0803, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024,
+    0x0803, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0803, 0x0044, 0x0044, 0x0044,
+    0x0245, 0x0245, 0x0245, 0x0245, 0x0803, 0x0054, 0x0054, 0x0054, 0x0255, 0x0054, 0x0255, 0x0054,
+    0x0803, 0x0064, 0x0064, 0x0064, 0x0265, 0x0265, 0x0064, 0x0064, 0x0803, 0x0074, 0x0074, 0x0074,
+    0x0275, 0x0074, 0x0074, 0x0074, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0803, 0x0095, 0x0014, 0x0095, 0x0014, 0x0095, 0x0014, 0x0095, 0x0803, 0x0024, 0x0024, 0x0024,
+    0x0024, 0x0024, 0x0024, 0x0024, 0x0803, 0x00b5, 0x0034, 0x00b5, 0x0034, 0x00b5, 0x0034, 0x00b5,
+    0x0803, 0x0044, 0x0044, 0x0044, 0x0245, 0x0245, 0x0245, 0x0245, 0x0803, 0x00d5, 0x0054, 0x00d5,
+    0x0255, 0x00d5, 0x0255, 0x00d5, 0x0803, 0x0064, 0x0064, 0x0064, 0x0265, 0x0265, 0x0064, 0x0064,
+    0x0803, 0x00f5, 0x0074, 0x00f5, 0x0275, 0x00f5, 0x0074, 0x00f5, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0803, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014,
+    0x0803, 0x0024, 0x0125, 0x0125, 0x0024, 0x0024, 0x0125, 0x0125, 0x0803, 0x0034, 0x0135, 0x0034,
+    0x0034, 0x0034, 0x0135, 0x0034, 0x0803, 0x0044, 0x0044, 0x0044, 0x0245, 0x0245, 0x0245, 0x0245,
+    0x0803, 0x0054, 0x0054, 0x0054, 0x0255, 0x0054, 0x0255, 0x0054, 0x0803, 0x0064, 0x0165, 0x0165,
+    0x0265, 0x0265, 0x0165, 0x0165, 0x0803, 0x0074, 0x0175, 0x0074, 0x0275, 0x0074, 0x0175, 0x0074,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0803, 0x0095, 0x0014, 0x0095,
+    0x0014, 0x0095, 0x0014, 0x0095, 0x0803, 0x0024, 0x0125, 0x0125, 0x0024, 0x0024, 0x0125, 0x0125,
+    0x0803, 0x00b5, 0x0135, 0x00b5, 0x0034, 0x00b5, 0x0135, 0x00b5, 0x0803, 0x0044, 0x0044, 0x0044,
+    0x0245, 0x0245, 0x0245, 0x0245, 0x0803, 0x00d5, 0x0054, 0x00d5, 0x0255, 0x00d5, 0x0255, 0x00d5,
+    0x0803, 0x0064, 0x0165, 0x0165, 0x0265, 0x0265, 0x0165, 0x0165, 0x0803, 0x00f5, 0x0175, 0x00f5,
+    0x0275, 0x00f5, 0x0175, 0x00f5, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404,
+    0x0803, 0x0414, 0x0414, 0x0414, 0x0414, 0x0414, 0x0414, 0x0414, 0x0803, 0x0424, 0x0424, 0x0424,
+    0x0424, 0x0424, 0x0424, 0x0424, 0x0803, 0x0434, 0x0434, 0x0434, 0x0434, 0x0434, 0x0434, 0x0434,
+    0x0803, 0x0444, 0x0444, 0x0444, 0x0444, 0x0444, 0x0444, 0x0444, 0x0803, 0x0454, 0x0454, 0x0454,
+    0x0454, 0x0454, 0x0454, 0x0454, 0x0803, 0x0464, 0x0464, 0x0464, 0x0464, 0x0464, 0x0464, 0x0464,
+    0x0803, 0x0474, 0x0474, 0x0474, 0x0474, 0x0474, 0x0474, 0x0474, 0x0404, 0x0404, 0x0404, 0x0404,
+    0x0404, 0x0404, 0x0404, 0x0404, 0x0803, 0x0095, 0x0414, 0x0095, 0x0414, 0x0095, 0x0414, 0x0095,
+    0x0803, 0x0424, 0x0424, 0x0424, 0x0424, 0x0424, 0x0424, 0x0424, 0x0803, 0x00b5, 0x0434, 0x00b5,
+    0x0434, 0x00b5, 0x0434, 0x00b5, 0x0803, 0x0444, 0x0444, 0x0444, 0x0444, 0x0444, 0x0444, 0x0444,
+    0x0803, 0x00d5, 0x0454, 0x00d5, 0x0454, 0x00d5, 0x0454, 0x00d5, 0x0803, 0x0464, 0x0464, 0x0464,
+    0x0464, 0x0464, 0x0464, 0x0464, 0x0803, 0x00f5, 0x0474, 0x00f5, 0x0474, 0x00f5, 0x0474, 0x00f5,
+    0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0803, 0x0414, 0x0414, 0x0414,
+    0x0414, 0x0414, 0x0414, 0x0414, 0x0803, 0x0424, 0x0125, 0x0125, 0x0424, 0x0424, 0x0125, 0x0125,
+    0x0803, 0x0434, 0x0135, 0x0434, 0x0434, 0x0434, 0x0135, 0x0434, 0x0803, 0x0444, 0x0444, 0x0444,
+    0x0444, 0x0444, 0x0444, 0x0444, 0x0803, 0x0454, 0x0454, 0x0454, 0x0454, 0x0454, 0x0454, 0x0454,
+    0x0803, 0x0464, 0x0165, 0x0165, 0x0464, 0x0464, 0x0165, 0x0165, 0x0803, 0x0474, 0x0175, 0x0474,
+    0x0474, 0x0474, 0x0175, 0x0474, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404,
+    0x0803, 0x0095, 0x0414, 0x0095, 0x0414, 0x0095, 0x0414, 0x0095, 0x0803, 0x0424, 0x0125, 0x0125,
+    0x0424, 0x0424, 0x0125, 0x0125, 0x0803, 0x00b5, 0x0135, 0x00b5, 0x0434, 0x00b5, 0x0135, 0x00b5,
+    0x0803, 0x0444, 0x0444, 0x0444, 0x0444, 0x0444, 0x0444, 0x0444, 0x0803, 0x00d5, 0x0454, 0x00d5,
+    0x0454, 0x00d5, 0x0454, 0x00d5, 0x0803, 0x0464, 0x0165, 0x0165, 0x0464, 0x0464, 0x0165, 0x0165,
+    0x0803, 0x00f5, 0x0175, 0x00f5, 0x0474, 0x00f5, 0x0175, 0x00f5, 0x0404, 0x0404, 0x0404, 0x0404,
+    0x0404, 0x0404, 0x0404, 0x0404, 0x0803, 0x0414, 0x0414, 0x0414, 0x0414, 0x0414, 0x0414, 0x0414,
+    0x0803, 0x0424, 0x0424, 0x0424, 0x0424, 0x0424, 0x0424, 0x0424, 0x0803, 0x0434, 0x0434, 0x0434,
+    0x0434, 0x0434, 0x0434, 0x0434, 0x0803, 0x0444, 0x0444, 0x0444, 0x0245, 0x0245, 0x0245, 0x0245,
+    0x0803, 0x0454, 0x0454, 0x0454, 0x0255, 0x0454, 0x0255, 0x0454, 0x0803, 0x0464, 0x0464, 0x0464,
+    0x0265, 0x0265, 0x0464, 0x0464, 0x0803, 0x0474, 0x0474, 0x0474, 0x0275, 0x0474, 0x0474, 0x0474,
+    0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0803, 0x0095, 0x0414, 0x0095,
+    0x0414, 0x0095, 0x0414, 0x0095, 0x0803, 0x0424, 0x0424, 0x0424, 0x0424, 0x0424, 0x0424, 0x0424,
+    0x0803, 0x00b5, 0x0434, 0x00b5, 0x0434, 0x00b5, 0x0434, 0x00b5, 0x0803, 0x0444, 0x0444, 0x0444,
+    0x0245, 0x0245, 0x0245, 0x0245, 0x0803, 0x00d5, 0x0454, 0x00d5, 0x0255, 0x00d5, 0x0255, 0x00d5,
+    0x0803, 0x0464, 0x0464, 0x0464, 0x0265, 0x0265, 0x0464, 0x0464, 0x0803, 0x00f5, 0x0474, 0x00f5,
+    0x0275, 0x00f5, 0x0474, 0x00f5, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404,
+    0x0803, 0x0414, 0x0414, 0x0414, 0x0414, 0x0414, 0x0414, 0x0414, 0x0803, 0x0424, 0x0125, 0x0125,
+    0x0424, 0x0424, 0x0125, 0x0125, 0x0803, 0x0434, 0x0135, 0x0434, 0x0434, 0x0434, 0x0135, 0x0434,
+    0x0803, 0x0444, 0x0444, 0x0444, 0x0245, 0x0245, 0x0245, 0x0245, 0x0803, 0x0454, 0x0454, 0x0454,
+    0x0255, 0x0454, 0x0255, 0x0454, 0x0803, 0x0464, 0x0165, 0x0165, 0x0265, 0x0265, 0x0165, 0x0165,
+    0x0803, 0x0474, 0x0175, 0x0474, 0x0275, 0x0474, 0x0175, 0x0474, 0x0404, 0x0404, 0x0404, 0x0404,
+    0x0404, 0x0404, 0x0404, 0x0404, 0x0803, 0x0095, 0x0414, 0x0095, 0x0414, 0x0095, 0x0414, 0x0095,
+    0x0803, 0x0424, 0x0125, 0x0125, 0x0424, 0x0424, 0x0125, 0x0125, 0x0803, 0x00b5, 0x0135, 0x00b5,
+    0x0434, 0x00b5, 0x0135, 0x00b5, 0x0803, 0x0444, 0x0444, 0x0444, 0x0245, 0x0245, 0x0245, 0x0245,
+    0x0803, 0x00d5, 0x0454, 0x00d5, 0x0255, 0x00d5, 0x0255, 0x00d5, 0x0803, 0x0464, 0x0165, 0x0165,
+    0x0265, 0x0265, 0x0165, 0x0165, 0x0803, 0x00f5, 0x0175, 0x00f5, 0x0275, 0x00f5, 0x0175, 0x00f5,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0803, 0x0014, 0x0014, 0x0014,
+    0x0014, 0x0014, 0x0014, 0x0014, 0x0803, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024,
+    0x0803, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0803, 0x0044, 0x0044, 0x0044,
+    0x0044, 0x0044, 0x0044, 0x0044, 0x0803, 0x0054, 0x0054, 0x0054, 0x0054, 0x0054, 0x0054, 0x0054,
+    0x0803, 0x0064, 0x0064, 0x0064, 0x0064, 0x0064, 0x0064, 0x0064, 0x0803, 0x0074, 0x0074, 0x0074,
+    0x0074, 0x0074, 0x0074, 0x0074, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0803, 0x0095, 0x0014, 0x0095, 0x0014, 0x0095, 0x0014, 0x0095, 0x0803, 0x0024, 0x0024, 0x0024,
+    0x0024, 0x0024, 0x0024, 0x0024, 0x0803, 0x00b5, 0x0034, 0x00b5, 0x0034, 0x00b5, 0x0034, 0x00b5,
+    0x0803, 0x0044, 0x0044, 0x0044, 0x0044, 0x0044, 0x0044, 0x0044, 0x0803, 0x00d5, 0x0054, 0x00d5,
+    0x0054, 0x00d5, 0x0054, 0x00d5, 0x0803, 0x0064, 0x0064, 0x0064, 0x0064, 0x0064, 0x0064, 0x0064,
+    0x0803, 0x00f5, 0x0074, 0x00f5, 0x0074, 0x00f5, 0x0074, 0x00f5, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0803, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014,
+    0x0803, 0x0024, 0x0125, 0x0125, 0x0024, 0x0024, 0x0125, 0x0125, 0x0803, 0x0034, 0x0135, 0x0034,
+    0x0034, 0x0034, 0x0135, 0x0034, 0x0803, 0x0044, 0x0044, 0x0044, 0x0044, 0x0044, 0x0044, 0x0044,
+    0x0803, 0x0054, 0x0054, 0x0054, 0x0054, 0x0054, 0x0054, 0x0054, 0x0803, 0x0064, 0x0165, 0x0165,
+    0x0064, 0x0064, 0x0165, 0x0165, 0x0803, 0x0074, 0x0175, 0x0074, 0x0074, 0x0074, 0x0175, 0x0074,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0803, 0x0095, 0x0014, 0x0095,
+    0x0014, 0x0095, 0x0014, 0x0095, 0x0803, 0x0024, 0x0125, 0x0125, 0x0024, 0x0024, 0x0125, 0x0125,
+    0x0803, 0x00b5, 0x0135, 0x00b5, 0x0034, 0x00b5, 0x0135, 0x00b5, 0x0803, 0x0044, 0x0044, 0x0044,
+    0x0044, 0x0044, 0x0044, 0x0044, 0x0803, 0x00d5, 0x0054, 0x00d5, 0x0054, 0x00d5, 0x0054, 0x00d5,
+    0x0803, 0x0064, 0x0165, 0x0165, 0x0064, 0x0064, 0x0165, 0x0165, 0x0803, 0x00f5, 0x0175, 0x00f5,
+    0x0074, 0x00f5, 0x0175, 0x00f5, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0803, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0014, 0x0803, 0x0024, 0x0024, 0x0024,
+    0x0024, 0x0024, 0x0024, 0x0024, 0x0803, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034, 0x0034,
+    0x0803, 0x0044, 0x0044, 0x0044, 0x0245, 0x0245, 0x0245, 0x0245, 0x0803, 0x0054, 0x0054, 0x0054,
+    0x0255, 0x0054, 0x0255, 0x0054, 0x0803, 0x0064, 0x0064, 0x0064, 0x0265, 0x0265, 0x0064, 0x0064,
+    0x0803, 0x0074, 0x0074, 0x0074, 0x0275, 0x0074, 0x0074, 0x0074, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0803, 0x0095, 0x0014, 0x0095, 0x0014, 0x0095, 0x0014, 0x0095,
+    0x0803, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0024, 0x0803, 0x00b5, 0x0034, 0x00b5,
+    0x0034, 0x00b5, 0x0034, 0x00b5, 0x0803, 0x0044, 0x0044, 0x0044, 0x0245, 0x0245, 0x0245, 0x0245,
+    0x0803, 0x00d5, 0x0054, 0x00d5, 0x0255, 0x00d5, 0x0255, 0x00d5, 0x0803, 0x0064, 0x0064, 0x0064,
+    0x0265, 0x0265, 0x0064, 0x0064, 0x0803, 0x00f5, 0x0074, 0x00f5, 0x0275, 0x00f5, 0x0074, 0x00f5,
+    0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0803, 0x0014, 0x0014, 0x0014,
+    0x0014, 0x0014, 0x0014, 0x0014, 0x0803, 0x0024, 0x0125, 0x0125, 0x0024, 0x0024, 0x0125, 0x0125,
+    0x0803, 0x0034, 0x0135, 0x0034, 0x0034, 0x0034, 0x0135, 0x0034, 0x0803, 0x0044, 0x0044, 0x0044,
+    0x0245, 0x0245, 0x0245, 0x0245, 0x0803, 0x0054, 0x0054, 0x0054, 0x0255, 0x0054, 0x0255, 0x0054,
+    0x0803, 0x0064, 0x0165, 0x0165, 0x0265, 0x0265, 0x0165, 0x0165, 0x0803, 0x0074, 0x0175, 0x0074,
+    0x0275, 0x0074, 0x0175, 0x0074, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
+    0x0803, 0x0095, 0x0014, 0x0095, 0x0014, 0x0095, 0x0014, 0x0095, 0x0803, 0x0024, 0x0125, 0x0125,
+    0x0024, 0x0024, 0x0125, 0x0125, 0x0803, 0x00b5, 0x0135, 0x00b5, 0x0034, 0x00b5, 0x0135, 0x00b5,
+    0x0803, 0x0044, 0x0044, 0x0044, 0x0245, 0x0245, 0x0245, 0x0245, 0x0803, 0x00d5, 0x0054, 0x00d5,
+    0x0255, 0x00d5, 0x0255, 0x00d5, 0x0803, 0x0064, 0x0165, 0x0165, 0x0265, 0x0265, 0x0165, 0x0165,
+    0x0803, 0x00f5, 0x0175, 0x00f5, 0x0275, 0x00f5, 0x0175, 0x00f5, 0x0404, 0x0404, 0x0404, 0x0404,
+    0x0404, 0x0404, 0x0404, 0x0404, 0x0803, 0x0414, 0x0414, 0x0414, 0x0414, 0x0414, 0x0414, 0x0414,
+    0x0803, 0x0424, 0x0424, 0x0424, 0x0424, 0x0424, 0x0424, 0x0424, 0x0803, 0x0434, 0x0434, 0x0434,
+    0x0434, 0x0434, 0x0434, 0x0434, 0x0803, 0x0444, 0x0444, 0x0444, 0x0444, 0x0444, 0x0444, 0x0444,
+    0x0803, 0x0454, 0x0454, 0x0454, 0x0454, 0x0454, 0x0454, 0x0454, 0x0803, 0x0464, 0x0464, 0x0464,
+    0x0464, 0x0464, 0x0464, 0x0464, 0x0803, 0x0474, 0x0474, 0x0474, 0x0474, 0x0474, 0x0474, 0x0474,
+    0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0803, 0x0095, 0x0414, 0x0095,
+    0x0414, 0x0095, 0x0414, 0x0095, 0x0803, 0x0424, 0x0424, 0x0424, 0x0424, 0x0424, 0x0424, 0x0424,
+    0x0803, 0x00b5, 0x0434, 0x00b5, 0x0434, 0x00b5, 0x0434, 0x00b5, 0x0803, 0x0444, 0x0444, 0x0444,
+    0x0444, 0x0444, 0x0444, 0x0444, 0x0803, 0x00d5, 0x0454, 0x00d5, 0x0454, 0x00d5, 0x0454, 0x00d5,
+    0x0803, 0x0464, 0x0464, 0x0464, 0x0464, 0x0464, 0x0464, 0x0464, 0x0803, 0x00f5, 0x0474, 0x00f5,
+    0x0474, 0x00f5, 0x0474, 0x00f5, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404,
+    0x0803, 0x0414, 0x0414, 0x0414, 0x0414, 0x0414, 0x0414, 0x0414, 0x0803, 0x0424, 0x0125, 0x0125,
+    0x0424, 0x0424, 0x0125, 0x0125, 0x0803, 0x0434, 0x0135, 0x0434, 0x0434, 0x0434, 0x0135, 0x0434,
+    0x0803, 0x0444, 0x0444, 0x0444, 0x0444, 0x0444, 0x0444, 0x0444, 0x0803, 0x0454, 0x0454, 0x0454,
+    0x0454, 0x0454, 0x0454, 0x0454, 0x0803, 0x0464, 0x0165, 0x0165, 0x0464, 0x0464, 0x0165, 0x0165,
+    0x0803, 0x0474, 0x0175, 0x0474, 0x0474, 0x0474, 0x0175, 0x0474, 0x0404, 0x0404, 0x0404, 0x0404,
+    0x0404, 0x0404, 0x0404, 0x0404, 0x0803, 0x0095, 0x0414, 0x0095, 0x0414, 0x0095, 0x0414, 0x0095,
+    0x0803, 0x0424, 0x0125, 0x0125, 0x0424, 0x0424, 0x0125, 0x0125, 0x0803, 0x00b5, 0x0135, 0x00b5,
+    0x0434, 0x00b5, 0x0135, 0x00b5, 0x0803, 0x0444, 0x0444, 0x0444, 0x0444, 0x0444, 0x0444, 0x0444,
+    0x0803, 0x00d5, 0x0454, 0x00d5, 0x0454, 0x00d5, 0x0454, 0x00d5, 0x0803, 0x0464, 0x0165, 0x0165,
+    0x0464, 0x0464, 0x0165, 0x0165, 0x0803, 0x00f5, 0x0175, 0x00f5, 0x0474, 0x00f5, 0x0175, 0x00f5,
+    0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0803, 0x0414, 0x0414, 0x0414,
+    0x0414, 0x0414, 0x0414, 0x0414, 0x0803, 0x0424, 0x0424, 0x0424, 0x0424, 0x0424, 0x0424, 0x0424,
+    0x0803, 0x0434, 0x0434, 0x0434, 0x0434, 0x0434, 0x0434, 0x0434, 0x0803, 0x0444, 0x0444, 0x0444,
+    0x0245, 0x0245, 0x0245, 0x0245, 0x0803, 0x0454, 0x0454, 0x0454, 0x0255, 0x0454, 0x0255, 0x0454,
+    0x0803, 0x0464, 0x0464, 0x0464, 0x0265, 0x0265, 0x0464, 0x0464, 0x0803, 0x0474, 0x0474, 0x0474,
+    0x0275, 0x0474, 0x0474, 0x0474, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404,
+    0x0803, 0x0095, 0x0414, 0x0095, 0x0414, 0x0095, 0x0414, 0x0095, 0x0803, 0x0424, 0x0424, 0x0424,
+    0x0424, 0x0424, 0x0424, 0x0424, 0x0803, 0x00b5, 0x0434, 0x00b5, 0x0434, 0x00b5, 0x0434, 0x00b5,
+    0x0803, 0x0444, 0x0444, 0x0444, 0x0245, 0x0245, 0x0245, 0x0245, 0x0803, 0x00d5, 0x0454, 0x00d5,
+    0x0255, 0x00d5, 0x0255, 0x00d5, 0x0803, 0x0464, 0x0464, 0x0464, 0x0265, 0x0265, 0x0464, 0x0464,
+    0x0803, 0x00f5, 0x0474, 0x00f5, 0x0275, 0x00f5, 0x0474, 0x00f5, 0x0404, 0x0404, 0x0404, 0x0404,
+    0x0404, 0x0404, 0x0404, 0x0404, 0x0803, 0x0414, 0x0414, 0x0414, 0x0414, 0x0414, 0x0414, 0x0414,
+    0x0803, 0x0424, 0x0125, 0x0125, 0x0424, 0x0424, 0x0125, 0x0125, 0x0803, 0x0434, 0x0135, 0x0434,
+    0x0434, 0x0434, 0x0135, 0x0434, 0x0803, 0x0444, 0x0444, 0x0444, 0x0245, 0x0245, 0x0245, 0x0245,
+    0x0803, 0x0454, 0x0454, 0x0454, 0x0255, 0x0454, 0x0255, 0x0454, 0x0803, 0x0464, 0x0165, 0x0165,
+    0x0265, 0x0265, 0x0165, 0x0165, 0x0803, 0x0474, 0x0175, 0x0474, 0x0275, 0x0474, 0x0175, 0x0474,
+    0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0404, 0x0803, 0x0095, 0x0414, 0x0095,
+    0x0414, 0x0095, 0x0414, 0x0095, 0x0803, 0x0424, 0x0125, 0x0125, 0x0424, 0x0424, 0x0125, 0x0125,
+    0x0803, 0x00b5, 0x0135, 0x00b5, 0x0434, 0x00b5, 0x0135, 0x00b5, 0x0803, 0x0444, 0x0444, 0x0444,
+    0x0245, 0x0245, 0x0245, 0x0245, 0x0803, 0x00d5, 0x0454, 0x00d5, 0x0255, 0x00d5, 0x0255, 0x00d5,
+    0x0803, 0x0464, 0x0165, 0x0165, 0x0265, 0x0265, 0x0165, 0x0165, 0x0803, 0x00f5, 0x0175, 0x00f5,
+    0x0275, 0x00f5, 0x0175, 0x00f5, 0x0004, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007,
+    0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007,
+    0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007,
+    0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007,
+    0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007,
+    0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x0004, 0x1007, 0x1007, 0x1007,
+    0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007,
+    0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007,
+    0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007,
+    0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007,
+    0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007,
+    0x0004, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007,
+    0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007,
+    0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007,
+    0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007,
+    0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007,
+    0x1007, 0x1007, 0x1007, 0x1007, 0x0004, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007,
+    0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007,
+    0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007,
+    0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007,
+    0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007,
+    0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x0004, 0x1007, 0x1007, 0x1007,
+    0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007,
+    0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007,
+    0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007,
+    0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007,
+    0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007,
+    0x0004, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007,
+    0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007,
+    0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007,
+    0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007,
+    0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007,
+    0x1007, 0x1007, 0x1007, 0x1007, 0x0004, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007,
+    0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007,
+    0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007,
+    0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007,
+    0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007,
+    0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x0004, 0x1007, 0x1007, 0x1007,
+    0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007,
+    0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007,
+    0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007,
+    0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007,
+    0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007,
+    0x0404, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007,
+    0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007,
+    0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007,
+    0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007,
+    0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007,
+    0x1007, 0x1007, 0x1007, 0x1007, 0x0404, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007,
+    0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007,
+    0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007,
+    0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007,
+    0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007,
+    0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x0404, 0x1007, 0x1007, 0x1007,
+    0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007,
+    0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007,
+    0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007,
+    0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007,
+    0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007,
+    0x0404, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007,
+    0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007,
+    0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007,
+    0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007,
+    0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007,
+    0x1007, 0x1007, 0x1007, 0x1007, 0x0404, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007,
+    0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007,
+    0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007,
+    0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007,
+    0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007,
+    0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x0404, 0x1007, 0x1007, 0x1007,
+    0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007,
+    0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007,
+    0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007,
+    0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007,
+    0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007,
+    0x0404, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007,
+    0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007,
+    0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007,
+    0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007,
+    0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007,
+    0x1007, 0x1007, 0x1007, 0x1007, 0x0404, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007,
+    0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007,
+    0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007,
+    0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007,
+    0x1007, 0x1007, 0x1007, 0x1007, 0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007,
+    0x0803, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x1007, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0006, 0x0010, 0x0010, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0006, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0006, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0006, 0x0040, 0x0040, 0x0040,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0006, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0006, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0006, 0x0070, 0x0070, 0x0070,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0006, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0006, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0006, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0006, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0006, 0x0050, 0x0050, 0x0050,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0006, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0006, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0006, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0006, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0006, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0006, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0006, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0006, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0006, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0006, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0006, 0x0010, 0x0010, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0006, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0006, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0006, 0x0040, 0x0040, 0x0040,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0006, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0006, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0006, 0x0070, 0x0070, 0x0070,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0006, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0006, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0006, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0006, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0006, 0x0050, 0x0050, 0x0050,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0006, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0006, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0006, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0006, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0006, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0006, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0006, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0006, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0006, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0006, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0006, 0x0010, 0x0010, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0006, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0006, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0006, 0x0040, 0x0040, 0x0040,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0006, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0006, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0006, 0x0070, 0x0070, 0x0070,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0006, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0006, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0006, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0006, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0006, 0x0050, 0x0050, 0x0050,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0006, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0006, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0006, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0006, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0006, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0006, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0006, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0006, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0006, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0006, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0006, 0x0010, 0x0010, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0006, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0006, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0006, 0x0040, 0x0040, 0x0040,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0006, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0006, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0006, 0x0070, 0x0070, 0x0070,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0006, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0006, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0006, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0006, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0006, 0x0050, 0x0050, 0x0050,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0006, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0006, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0006, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0006, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0006, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0006, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0006, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0006, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0006, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0006, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0006, 0x0010, 0x0010, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0006, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0006, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0006, 0x0040, 0x0040, 0x0040,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0006, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0006, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0006, 0x0070, 0x0070, 0x0070,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0006, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0006, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0006, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0006, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0006, 0x0050, 0x0050, 0x0050,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0006, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0006, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0006, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0006, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0006, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0006, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0006, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0006, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0006, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0006, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0006, 0x0010, 0x0010, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0006, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0006, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0006, 0x0040, 0x0040, 0x0040,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0006, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0006, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0006, 0x0070, 0x0070, 0x0070,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0006, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0006, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0006, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0006, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0006, 0x0050, 0x0050, 0x0050,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0006, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0006, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0006, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0006, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0006, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0006, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0006, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0006, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0006, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0006, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0006, 0x0010, 0x0010, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0006, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0006, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0006, 0x0040, 0x0040, 0x0040,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0006, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0006, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0006, 0x0070, 0x0070, 0x0070,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0006, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0006, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0006, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0006, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0006, 0x0050, 0x0050, 0x0050,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0006, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0006, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0006, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0006, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0006, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0006, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0006, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0006, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0006, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0006, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0006, 0x0010, 0x0010, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0006, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0006, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0006, 0x0040, 0x0040, 0x0040,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0006, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0006, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0006, 0x0070, 0x0070, 0x0070,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0006, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0006, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0006, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0006, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0006, 0x0050, 0x0050, 0x0050,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0006, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0006, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0006, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0006, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0006, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0006, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0006, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0006, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0006, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0006, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0006, 0x0010, 0x0010, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0006, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0006, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0006, 0x0040, 0x0040, 0x0040,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0006, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0006, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0006, 0x0070, 0x0070, 0x0070,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0006, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0006, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0006, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0006, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0006, 0x0050, 0x0050, 0x0050,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0006, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0006, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0006, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0006, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0006, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0006, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0006, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0006, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0006, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0006, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0006, 0x0010, 0x0010, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0006, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0006, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0006, 0x0040, 0x0040, 0x0040,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0006, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0006, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0006, 0x0070, 0x0070, 0x0070,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0006, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0006, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0006, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0006, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0006, 0x0050, 0x0050, 0x0050,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0006, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0006, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0006, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0006, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0006, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0006, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0006, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0006, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0006, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0006, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0006, 0x0010, 0x0010, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0006, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0006, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0006, 0x0040, 0x0040, 0x0040,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0006, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0006, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0006, 0x0070, 0x0070, 0x0070,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0006, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0006, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0006, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0006, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0006, 0x0050, 0x0050, 0x0050,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0006, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0006, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0006, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0006, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0006, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0006, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0006, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0006, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0006, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0006, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0006, 0x0010, 0x0010, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0006, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0006, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0006, 0x0040, 0x0040, 0x0040,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0006, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0006, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0006, 0x0070, 0x0070, 0x0070,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0006, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0006, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0006, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0006, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0006, 0x0050, 0x0050, 0x0050,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0006, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0006, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0006, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0006, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0006, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0006, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0006, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0006, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0006, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0006, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0006, 0x0010, 0x0010, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0006, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0006, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0006, 0x0040, 0x0040, 0x0040,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0006, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0006, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0006, 0x0070, 0x0070, 0x0070,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0006, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0006, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0006, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0006, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0006, 0x0050, 0x0050, 0x0050,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0006, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0006, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0006, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0006, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0006, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0006, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0006, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0006, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0006, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0006, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0006, 0x0010, 0x0010, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0006, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0006, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0006, 0x0040, 0x0040, 0x0040,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0006, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0006, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0006, 0x0070, 0x0070, 0x0070,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0006, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0006, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0006, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0006, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0006, 0x0050, 0x0050, 0x0050,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0006, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0006, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0006, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0006, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0006, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0006, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0006, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0006, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0006, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0006, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0006, 0x0010, 0x0010, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0006, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0006, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0006, 0x0040, 0x0040, 0x0040,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0006, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0006, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0006, 0x0070, 0x0070, 0x0070,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0006, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0006, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0006, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0006, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0006, 0x0050, 0x0050, 0x0050,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0006, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0006, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0006, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0006, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0006, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0006, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0006, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0006, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0006, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0006, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0006, 0x0010, 0x0010, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0006, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0006, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0006, 0x0040, 0x0040, 0x0040,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0006, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0006, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0006, 0x0070, 0x0070, 0x0070,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0006, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0006, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0006, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0006, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0006, 0x0050, 0x0050, 0x0050,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0006, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0006, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0006, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0006, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0006, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0006, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0006, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0006, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0006, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0006, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0060, 0x0060, 0x0060, 0x0060,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0040, 0x0040, 0x0040, 0x0040,
+    0x0040, 0x0040, 0x0040, 0x0040, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050, 0x0050,
+    0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060, 0x0070, 0x0070, 0x0070, 0x0070,
+    0x0070, 0x0070, 0x0070, 0x0070, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
@@ -0,0 +1,141 @@
+/**
+ * \file fsm_product.h
+ * \brief Precomputed next-state and output tables of the FSMs.
+ * \details Optional build mode (make FSM_PRODUCT=1): one evaluation becomes a single table lookup.
+ *          The lights, indicators and windshield washer FSMs share no state and drive disjoint flags and
+ *          acknowledgement bits, so their product automaton is the product of one table per FSM.
+ *          Tables are generated by generator/gen_fsm_product.c (make fsm_product), which runs the FSMs
+ *          themselves over every input and checks the result against them.
+ *
+ *          Table index, from the least significant bit:
+ *          - FSM inputs: commands, then flags, then acknowledgement bits
+ *          - tick: periodic evaluation
+ *          - timer class: below limit - 1, at limit - 1, at or above limit
+ *          - packed state: enum value, final state packed last
+ * \author Raphael CAUSSE
+ */
+
+#ifndef FSM_PRODUCT_H
+#define FSM_PRODUCT_H
+
+/***** Includes **************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/***** Definitions ***********************************************************/
+
+/* Table entry */
+#define FSM_PRODUCT_TRANSITION(entry) ((uint32_t)(entry) & 0x0Fu)        /* Transition index + 1, 0 for none */
+#define FSM_PRODUCT_FLAGS(entry) (((uint32_t)(entry) >> 4) & 0x07u)      /* Flags after evaluation */
+#define FSM_PRODUCT_ACK_CLEAR(entry) (((uint32_t)(entry) >> 7) & 0x07u)  /* Acknowledgement bits to clear */
+#define FSM_PRODUCT_TIMER(entry) (((uint32_t)(entry) >> 10) & 0x03u)     /* Timer operation */
+#define FSM_PRODUCT_ERROR (1u << 12)                                     /* Callback returned an error */
+#define FSM_PRODUCT_ENTRY(transition, flags, ack_clear, timer, error) \
+    ((uint16_t)((transition) | ((flags) << 4) | ((ack_clear) << 7) | ((timer) << 10) | ((error) ? FSM_PRODUCT_ERROR : 0u)))
+
+/* Timer operations */
+#define FSM_PRODUCT_TIMER_KEEP (0u)
+#define FSM_PRODUCT_TIMER_INCR (1u)
+#define FSM_PRODUCT_TIMER_RESET (2u)
+
+#define FSM_PRODUCT_TIMER_CLASSES (3)
+#define FSM_PRODUCT_SIZE(states, inputs) ((uint32_t)(states) << ((inputs) + 3))
+
+/* Lights: 3 commands, 3 flags, 3 acknowledgements */
+#define FSM_PRODUCT_LIGHTS_INPUTS (9)
+#define FSM_PRODUCT_LIGHTS_STATES (5)
+#define FSM_PRODUCT_LIGHTS_TRANSITIONS (8)
+#define FSM_PRODUCT_LIGHTS_SIZE FSM_PRODUCT_SIZE(FSM_PRODUCT_LIGHTS_STATES, FSM_PRODUCT_LIGHTS_INPUTS)
+
+/* Indicators: 3 commands, 3 flags, 2 acknowledgements */
+#define FSM_PRODUCT_INDICATORS_INPUTS (8)
+#define FSM_PRODUCT_INDICATORS_STATES (8)
+#define FSM_PRODUCT_INDICATORS_TRANSITIONS (14)
+#define FSM_PRODUCT_INDICATORS_SIZE FSM_PRODUCT_SIZE(FSM_PRODUCT_INDICATORS_STATES, FSM_PRODUCT_INDICATORS_INPUTS)
+
+/* Windshield washer: 2 commands, 2 flags */
+#define FSM_PRODUCT_WINDSHIELD_WASHER_INPUTS (4)
+#define FSM_PRODUCT_WINDSHIELD_WASHER_STATES (6)
+#define FSM_PRODUCT_WINDSHIELD_WASHER_TRANSITIONS (10)
+#define FSM_PRODUCT_WINDSHIELD_WASHER_SIZE \
+    FSM_PRODUCT_SIZE(FSM_PRODUCT_WINDSHIELD_WASHER_STATES, FSM_PRODUCT_WINDSHIELD_WASHER_INPUTS)
+
+/***** Variables *************************************************************/
+
+extern const uint16_t fsm_product_lights[FSM_PRODUCT_LIGHTS_SIZE];
+extern const uint8_t fsm_product_lights_next[FSM_PRODUCT_LIGHTS_TRANSITIONS];
+extern const uint8_t fsm_product_lights_event[FSM_PRODUCT_LIGHTS_TRANSITIONS];
+
+extern const uint16_t fsm_product_indicators[FSM_PRODUCT_INDICATORS_SIZE];
+extern const uint8_t fsm_product_indicators_next[FSM_PRODUCT_INDICATORS_TRANSITIONS];
+extern const uint8_t fsm_product_indicators_event[FSM_PRODUCT_INDICATORS_TRANSITIONS];
+
+extern const uint16_t fsm_product_windshield_washer[FSM_PRODUCT_WINDSHIELD_WASHER_SIZE];
+extern const uint8_t fsm_product_windshield_washer_next[FSM_PRODUCT_WINDSHIELD_WASHER_TRANSITIONS];
+extern const uint8_t fsm_product_windshield_washer_event[FSM_PRODUCT_WINDSHIELD_WASHER_TRANSITIONS];
+
+/***** Functions *************************************************************/
+
+/**
+ * \brief Pack a state value, the final state (255) taking the last slot.
+ * \param state : State value
+ * \param states : Number of packed states
+ * \return uint32_t : Packed state, states when the value is out of the table.
+ */
+static inline uint32_t fsm_product_state_index(int state, uint32_t states)
+{
+    if (state == 255)
+    {
+        return states - 1;
+    }
+    return ((state >= 0) && ((uint32_t)state < states - 1)) ? (uint32_t)state : states;
+}
+
+/**
+ * \brief Class of a timer against its limit, the only comparisons made by the FSMs.
+ * \param timer : Timer value
+ * \param limit : Timer limit
+ * \return uint32_t : 0 below limit - 1, 1 at limit - 1, 2 at or above limit.
+ */
+static inline uint32_t fsm_product_timer_class(uint8_t timer, uint8_t limit)
+{
+    return (timer + 1u < limit) ? 0u : ((timer < limit) ? 1u : 2u);
+}
+
+/**
+ * \brief Build the table index of one evaluation.
+ * \param inputs : Packed FSM inputs
+ * \param input_bits : Number of FSM input bits
+ * \param tick : true for a periodic evaluation
+ * \param timer_class : Timer class
+ * \param state_index : Packed state
+ * \return uint32_t : Table index.
+ */
+static inline uint32_t fsm_product_index(uint32_t inputs, uint32_t input_bits, bool tick, uint32_t timer_class,
+                                         uint32_t state_index)
+{
+    return inputs | ((uint32_t)tick << input_bits) | (timer_class << (input_bits + 1)) |
+           (state_index << (input_bits + 3));
+}
+
+/**
+ * \brief Apply the timer operation of a table entry.
+ * \param entry : Table entry
+ * \param timer : Timer value before evaluation
+ * \return uint8_t : Timer value after evaluation.
+ */
+static inline uint8_t fsm_product_timer_next(uint16_t entry, uint8_t timer)
+{
+    switch (FSM_PRODUCT_TIMER(entry))
+    {
+    case FSM_PRODUCT_TIMER_INCR:
+        return (uint8_t)(timer + 1);
+    case FSM_PRODUCT_TIMER_RESET:
+        return 0;
+    default:
+        return timer;
+    }
+}
+
+#endif /* FSM_PRODUCT_H */
@@ -0,0 +1,168 @@
+/**
+ * \file fsm_trace.c
+ * \brief Implementation of FSM instrumentation.
+ * \details Record per-transition hit counts, per-state dwell time histograms and the last transitions
+ *          of an FSM in a ring buffer. Written by the thread running the FSM, read at any time from
+ *          another thread through a consistent snapshot (sequence lock), without stopping the FSM.
+ * \author Raphael CAUSSE
+ */
+
+/***** Includes **************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+#include "fsm_trace.h"
+#include "log.h"
+
+/***** Definitions ***********************************************************/
+
+#define FSM_TRACE_REPORT_SIZE (256)
+
+/***** Static Functions ******************************************************/
+
+/**
+ * \brief Get the slot of a state in per-state arrays.
+ */
+static uint32_t fsm_trace_state_slot(int state)
+{
+    return ((state >= 0) && (state < FSM_TRACE_MAX_STATES - 1)) ? (uint32_t)state : FSM_TRACE_MAX_STATES - 1;
+}
+
+/**
+ * \brief Get the histogram bucket of a dwell time.
+ */
+static uint32_t fsm_trace_dwell_bucket(timestamp_t dwell)
+{
+    uint64_t ms = dwell / TIMESTAMP_NS_PER_MS;
+    uint32_t bucket = 0;
+
+    while ((ms > 0) && (bucket < FSM_TRACE_DWELL_BUCKETS - 1))
+    {
+        ms >>= 1;
+        bucket++;
+    }
+
+    return bucket;
+}
+
+/***** Functions *************************************************************/
+
+void fsm_trace_begin(fsm_trace_t *trace)
+{
+    /* Single writer: FSMs run with the context lock held */
+    __atomic_store_n(&trace->seq, trace->seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    trace->data.ticks++;
+}
+
+void fsm_trace_transition(fsm_trace_t *trace, uint32_t transition, int from, int to, int event)
+{
+    fsm_trace_data_t *data = &trace->data;
+    fsm_trace_entry_t *entry = NULL;
+    timestamp_t now = 0;
+    timestamp_t dwell = 0;
+    uint32_t slot = 0;
+
+    if (transition < FSM_TRACE_MAX_TRANSITIONS)
+    {
+        data->hits[transition]++;
+    }
+    if (from == to)
+    {
+        return;
+    }
+
+    /* State change: dwell time of previous state and trace entry */
+    now = timestamp_now();
+    if (data->entered != TIMESTAMP_NONE)
+    {
+        slot = fsm_trace_state_slot(from);
+        dwell = timestamp_elapsed(data->entered, now);
+        data->dwell[slot][fsm_trace_dwell_bucket(dwell)]++;
+        if (dwell > data->dwell_max[slot])
+        {
+            data->dwell_max[slot] = dwell;
+        }
+    }
+    data->entered = now;
+
+    entry = &data->ring[data->changes % FSM_TRACE_RING_SIZE];
+    entry->time = now;
+    entry->transition = (uint8_t)transition;
+    entry->from = (uint8_t)from;
+    entry->to = (uint8_t)to;
+    entry->event = (uint8_t)event;
+    data->changes++;
+}
+
+void fsm_trace_end(fsm_trace_t *trace)
+{
+    __atomic_store_n(&trace->seq, trace->seq + 1, __ATOMIC_RELEASE);
+}
+
+void fsm_trace_snapshot(const fsm_trace_t *trace, fsm_trace_data_t *data)
+{
+    uint32_t seq_begin = 0;
+    uint32_t seq_end = 0;
+
+    do
+    {
+        seq_begin = __atomic_load_n(&trace->seq, __ATOMIC_ACQUIRE);
+        memcpy(data, &trace->data, sizeof(*data));
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        seq_end = __atomic_load_n(&trace->seq, __ATOMIC_RELAXED);
+    } while (((seq_begin & 1U) != 0) || (seq_begin != seq_end));
+}
+
+void fsm_trace_report(const char *name, const fsm_trace_data_t *data)
+{
+    char line[FSM_TRACE_REPORT_SIZE];
+    size_t length = 0;
+
+    /* Non-zero transition hits, as index:count */
+    for (uint32_t i = 0; (i < FSM_TRACE_MAX_TRANSITIONS) && (length < sizeof(line)); i++)
+    {
+        if (data->hits[i] > 0)
+        {
+            length += (size_t)snprintf(&line[length], sizeof(line) - length, " %u:%u", i, data->hits[i]);
+        }
+    }
+    line[(length < sizeof(line)) ? length : sizeof(line) - 1] = '\0';
+    log_info("fsm %s: %u ticks, %u state changes, hits%s", name, data->ticks, data->changes, line);
+
+    /* Dwell times of visited states */
+    for (uint32_t s = 0; s < FSM_TRACE_MAX_STATES; s++)
+    {
+        uint32_t count = 0;
+
+        length = 0;
+        for (uint32_t b = 0; (b < FSM_TRACE_DWELL_BUCKETS) && (length < sizeof(line)); b++)
+        {
+            count += data->dwell[s][b];
+            length += (size_t)snprintf(&line[length], sizeof(line) - length, " %u", data->dwell[s][b]);
+        }
+        line[(length < sizeof(line)) ? length : sizeof(line) - 1] = '\0';
+        if (count > 0)
+        {
+            log_info("fsm %s: state %u dwell n %u, max %llu ms, log2 ms histogram%s", name, s, count,
+                     (unsigned long long)(data->dwell_max[s] / TIMESTAMP_NS_PER_MS), line);
+        }
+    }
+}
+
+void fsm_trace_dump(const char *name, const fsm_trace_data_t *data)
+{
+    uint32_t count = (data->changes < FSM_TRACE_RING_SIZE) ? data->changes : FSM_TRACE_RING_SIZE;
+    uint32_t first = data->changes - count;
+    const fsm_trace_entry_t *last = &data->ring[(data->changes - 1) % FSM_TRACE_RING_SIZE];
+    const fsm_trace_entry_t *entry = NULL;
+
+    /* Times are relative to the last change */
+    for (uint32_t i = first; i < data->changes; i++)
+    {
+        entry = &data->ring[i % FSM_TRACE_RING_SIZE];
+        log_info("fsm %s: change %u, -%llu ms, transition %u: %u -> %u (event %u)", name, i,
+                 (unsigned long long)((last->time - entry->time) / TIMESTAMP_NS_PER_MS),
+                 entry->transition, entry->from, entry->to, entry->event);
+    }
+}
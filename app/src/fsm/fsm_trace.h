@@ -0,0 +1,99 @@
+/**
+ * \file fsm_trace.h
+ * \brief Interface of FSM instrumentation.
+ * \details Record per-transition hit counts, per-state dwell time histograms and the last transitions
+ *          of an FSM in a ring buffer. Written by the thread running the FSM, read at any time from
+ *          another thread through a consistent snapshot (sequence lock), without stopping the FSM.
+ * \author Raphael CAUSSE
+ */
+
+#ifndef FSM_TRACE_H
+#define FSM_TRACE_H
+
+/***** Includes **************************************************************/
+
+#include <stdint.h>
+#include "timestamp.h"
+
+/***** Definitions ***********************************************************/
+
+#define FSM_TRACE_MAX_TRANSITIONS (16)
+#define FSM_TRACE_MAX_STATES (8)     /* Last slot gathers final state and out of range states */
+#define FSM_TRACE_DWELL_BUCKETS (16) /* Bucket 0: < 1ms, bucket k: [2^(k-1), 2^k) ms, last: above */
+#define FSM_TRACE_RING_SIZE (32)
+
+/* State change recorded in trace ring */
+typedef struct
+{
+    timestamp_t time;   /* Time of state change */
+    uint8_t transition; /* Index in transition table */
+    uint8_t from;       /* Previous state */
+    uint8_t to;         /* New state */
+    uint8_t event;      /* Event */
+} fsm_trace_entry_t;
+
+/* Instrumentation data of one FSM */
+typedef struct
+{
+    uint32_t ticks;                                                  /* Evaluations */
+    uint32_t hits[FSM_TRACE_MAX_TRANSITIONS];                        /* Hits per transition */
+    uint32_t dwell[FSM_TRACE_MAX_STATES][FSM_TRACE_DWELL_BUCKETS];   /* Dwell time histogram per state */
+    timestamp_t dwell_max[FSM_TRACE_MAX_STATES];                     /* Longest dwell time per state */
+    timestamp_t entered;                                             /* Time current state was entered */
+    fsm_trace_entry_t ring[FSM_TRACE_RING_SIZE];                     /* Last state changes */
+    uint32_t changes;                                                /* State changes, ring index modulo size */
+} fsm_trace_data_t;
+
+/* FSM instrumentation */
+typedef struct
+{
+    uint32_t seq; /* Odd while data is being written */
+    fsm_trace_data_t data;
+} fsm_trace_t;
+
+/***** Functions *************************************************************/
+
+/**
+ * \brief Start recording one FSM evaluation.
+ * \param trace : FSM instrumentation
+ */
+void fsm_trace_begin(fsm_trace_t *trace);
+
+/**
+ * \brief Record a fired transition.
+ * \param trace : FSM instrumentation
+ * \param transition : Index in transition table
+ * \param from : State before transition
+ * \param to : State after transition
+ * \param event : Event of the transition
+ */
+void fsm_trace_transition(fsm_trace_t *trace, uint32_t transition, int from, int to, int event);
+
+/**
+ * \brief End recording one FSM evaluation.
+ * \param trace : FSM instrumentation
+ */
+void fsm_trace_end(fsm_trace_t *trace);
+
+/**
+ * \brief Get a consistent copy of instrumentation data, from any thread.
+ * \param trace : FSM instrumentation
+ * \param data : Output data
+ */
+void fsm_trace_snapshot(const fsm_trace_t *trace, fsm_trace_data_t *data);
+
+/**
+ * \brief Report transition hits and state dwell times through the logger.
+ * \param name : FSM name
+ * \param data : Instrumentation data
+ */
+void fsm_trace_report(const char *name, const fsm_trace_data_t *data);
+
+/**
+ * \brief Dump the trace ring through the logger, oldest first.
+ * \param name : FSM name
+ * \param data : Instrumentation data
+ */
+void fsm_trace_dump(const char *name, const fsm_trace_data_t *data);
+
+#endif /* FSM_TRACE_H */
@@ -9,73 +9,11 @@
 
 #include "fsm_common.h"
 #include "fsm_windshield_washer.h"
-
-/***** Definitions ***********************************************************/
-
-#define TIMER_2S_COUNT_100MS (20) /* 2 seconds = 20 * 100ms */
-#define TRANS_COUNT (sizeof(trans) / sizeof(*trans))
-
-/* States */
-typedef enum
-{
-    ST_ANY = -1,    /* Any state */
-    ST_INIT = 0,    /* Init state */
-    ST_ALL_OFF,     /* All systems off */
-    ST_WIPER_ON,    /* Only wipers on */
-    ST_BOTH_ON,     /* Both wipers and washer on */
-    ST_WIPER_TIMER, /* Wipers running on timer */
-    ST_TERM = 255   /* Final state */
-} fsm_state_t;
-
-/* Events */
-typedef enum
-{
-    EV_ANY = -1,       /* Any event */
-    EV_NONE = 0,       /* No event */
-    EV_CMD_WIPER_ON,   /* Command to activate wipers */
-    EV_CMD_WIPER_OFF,  /* Command to deactivate wipers */
-    EV_CMD_WASHER_ON,  /* Command to activate washer */
-    EV_CMD_WASHER_OFF, /* Command to deactivate washer */
-    EV_TIMEOUT,        /* 2-second timer expired */
-    EV_ERR = 255       /* Error event */
-} fsm_event_t;
-
-/* Transition structure */
-typedef struct
-{
-    fsm_state_t state;
-    fsm_event_t event;
-    int (*callback)(void);
-    fsm_state_t next_state;
-} transition_t;
-
-/***** Static Functions Declarations *****************************************/
-
-static int callback_init(void);
-static int callback_wiper_on(void);
-static int callback_both_on(void);
-static int callback_timer_tick(void);
-static int callback_error(void);
-static fsm_event_t get_next_event(fsm_state_t current_state);
-
-/***** Static Variables ******************************************************/
-
-/* Static variables */
-static fsm_state_t state = ST_INIT;
-static uint8_t timer_counter = 0;
-
-static transition_t trans[] = {
-    {ST_INIT, EV_NONE, &callback_init, ST_ALL_OFF},
-    {ST_ALL_OFF, EV_CMD_WIPER_ON, &callback_wiper_on, ST_WIPER_ON},
-    {ST_ALL_OFF, EV_CMD_WASHER_ON, &callback_both_on, ST_BOTH_ON},
-    {ST_WIPER_ON, EV_CMD_WIPER_OFF, &callback_init, ST_ALL_OFF},
-    {ST_WIPER_ON, EV_CMD_WASHER_ON, &callback_both_on, ST_BOTH_ON},
-    {ST_BOTH_ON, EV_CMD_WASHER_OFF, NULL, ST_WIPER_TIMER},
-    {ST_WIPER_TIMER, EV_CMD_WASHER_ON, &callback_both_on, ST_BOTH_ON},
-    {ST_WIPER_TIMER, EV_TIMEOUT, &callback_init, ST_ALL_OFF},
-    {ST_WIPER_TIMER, EV_NONE, &callback_timer_tick, ST_WIPER_TIMER},
-    {ST_ANY, EV_ERR, &callback_error, ST_TERM},
-};
+#include "fsm_windshield_washer_gen.h"
+#include "probe.h"
+#ifdef WITH_FSM_PRODUCT
+#include "fsm_product.h"
+#endif
 
 /***** Static Functions Definitions ******************************************/
 
@@ -112,16 +50,6 @@ static int callback_both_on(void)
     return 0;
 }
 
-/**
- * \brief Callback for waiting OFF command input or the timer exceeds 2 seconds.
- * \return int : Negative value for error code.
- */
-static int callback_timer_tick(void)
-{
-    timer_counter++;
-    return 0;
-}
-
 /**
  * \brief Set all flags to OFF.
  * \return int : Negative value for error code.
@@ -133,105 +61,125 @@ static int callback_error(void)
     return -1;
 }
 
+#ifdef WITH_FSM_PRODUCT
 /**
- * \brief Get the next event for the FSM.
- * \param current_state Current FSM state.
- * \return fsm_event_t Next event value.
+ * \brief Evaluate the FSM once with a single lookup in its precomputed table.
+ * \details Same outcome as fsm_step(), which still handles a state outside the table.
+ * \param tick : true for periodic 100ms evaluation, false for an immediate evaluation not advancing timers
+ * \return int : Return code of transition callback.
  */
-static fsm_event_t get_next_event(fsm_state_t current_state)
+static int fsm_step_product(bool tick)
 {
-    fsm_event_t event = EV_NONE;
+    uint32_t state_index = fsm_product_state_index(state, FSM_PRODUCT_WINDSHIELD_WASHER_STATES);
+    uint32_t flags = 0;
+    uint32_t next_flags = 0;
+    uint32_t changed = 0;
+    uint32_t inputs = 0;
+    uint32_t transition = 0;
+    uint16_t entry = 0;
+    fsm_state_t previous = state;
+
+    if (state_index >= FSM_PRODUCT_WINDSHIELD_WASHER_STATES)
+    {
+        return fsm_step(tick);
+    }
+
+    flags = (uint32_t)get_flag_wiper() | ((uint32_t)get_flag_washer() << 1);
+    inputs = (uint32_t)get_cmd_wiper() | ((uint32_t)get_cmd_washer() << 1) |
+             (flags << 2);
+    entry = fsm_product_windshield_washer[fsm_product_index(inputs, FSM_PRODUCT_WINDSHIELD_WASHER_INPUTS, tick,
+                                                  fsm_product_timer_class(timer_counter, TIMER_2S_COUNT_100MS),
+                                                  state_index)];
+
+    fsm_trace_begin(&trace);
+    transition = FSM_PRODUCT_TRANSITION(entry);
+    if (transition != 0)
+    {
+        transition--;
+        fsm_trace_transition(&trace, transition, state, fsm_product_windshield_washer_next[transition],
+                             fsm_product_windshield_washer_event[transition]);
+        state = (fsm_state_t)fsm_product_windshield_washer_next[transition];
+    }
+
+    /* Outputs: changed flags, acknowledgement bits to clear and timer */
+    next_flags = FSM_PRODUCT_FLAGS(entry);
+    changed = next_flags ^ flags;
+    if (changed & (1u << 0))
+    {
+        set_flag_wiper((next_flags >> 0) & 0x01u);
+    }
+    if (changed & (1u << 1))
+    {
+        set_flag_washer((next_flags >> 1) & 0x01u);
+    }
+    timer_counter = fsm_product_timer_next(entry, timer_counter);
+    fsm_trace_end(&trace);
 
-    bool wiper_ON = (get_cmd_wiper() == ON);
-    bool washer_ON = (get_cmd_washer() == ON);
+    /* Keep the transitions leading to the final state */
+    if ((state == ST_TERM) && (previous != ST_TERM))
+    {
+        fsm_trace_dump("windshield_washer", &trace.data);
+    }
+
+    return ((entry & FSM_PRODUCT_ERROR) != 0) ? -1 : 0;
+}
+#endif
+
+/**
+ * \brief Evaluate the FSM with the selected implementation, firing the transition probe on a state change.
+ * \param tick : true for periodic 100ms evaluation, false for an immediate evaluation not advancing timers
+ * \return int : Return code of transition callback.
+ */
+static int fsm_eval(bool tick)
+{
+    int from = (int)state;
+    int ret = 0;
 
-    switch (current_state)
+#ifdef WITH_FSM_PRODUCT
+    ret = fsm_step_product(tick);
+#else
+    ret = fsm_step(tick);
+#endif
+    if ((int)state != from)
     {
-    case ST_ALL_OFF:
-        if (wiper_ON)
-        {
-            event = EV_CMD_WIPER_ON;
-        }
-        else if (washer_ON)
-        {
-            event = EV_CMD_WASHER_ON;
-        }
-        break;
-
-    case ST_WIPER_ON:
-        if (!wiper_ON)
-        {
-            event = EV_CMD_WIPER_OFF;
-        }
-        else if (washer_ON)
-        {
-            event = EV_CMD_WASHER_ON;
-        }
-        break;
-
-    case ST_BOTH_ON:
-        if (!washer_ON)
-        {
-            event = EV_CMD_WASHER_OFF;
-        }
-        break;
-
-    case ST_WIPER_TIMER:
-        if (washer_ON && timer_counter < TIMER_2S_COUNT_100MS)
-        {
-            event = EV_CMD_WASHER_ON;
-        }
-        else if (timer_counter >= TIMER_2S_COUNT_100MS)
-        {
-            event = EV_TIMEOUT;
-        }
-        break;
-
-    case ST_TERM:
-        event = EV_ERR;
-        break;
-
-    default:
-        break;
+        PROBE3(fsm_transition, "windshield_washer", from, (int)state);
     }
 
-    return event;
+    return ret;
 }
 
 /***** Functions *************************************************************/
 
 int fsm_windshield_washer_run(void)
 {
-    int ret = 0;
-    size_t i = 0;
-    fsm_event_t event = EV_NONE;
+    return fsm_eval(true);
+}
 
-    if (state != ST_TERM)
+int fsm_windshield_washer_get_state(void)
+{
+    return (int)state;
+}
+
+void fsm_windshield_washer_get_trace(fsm_trace_data_t *data)
+{
+    fsm_trace_snapshot(&trace, data);
+}
+
+void fsm_windshield_washer_save(uint8_t *saved_state, uint8_t *saved_timer)
+{
+    *saved_state = (uint8_t)state;
+    *saved_timer = timer_counter;
+}
+
+bool fsm_windshield_washer_restore(uint8_t saved_state, uint8_t saved_timer)
+{
+    /* A terminated or unknown state is not resumed, the FSM starts over */
+    if (saved_state > ST_WIPER_TIMER)
     {
-        /* Get event */
-        event = get_next_event(state);
-
-        /* For each transition */
-        for (i = 0; i < TRANS_COUNT; i++)
-        {
-            /* If State is current state OR The transition applies to all states */
-            if ((state == trans[i].state) || (ST_ANY == trans[i].state))
-            {
-                /* If event is the transition event OR the event applies to all */
-                if ((event == trans[i].event) || (EV_ANY == trans[i].event))
-                {
-                    /* Apply the new state */
-                    state = trans[i].next_state;
-                    if (trans[i].callback != NULL)
-                    {
-                        /* Call the state function */
-                        ret = (trans[i].callback)();
-                    }
-                    break;
-                }
-            }
-        }
+        return false;
     }
+    state = (fsm_state_t)saved_state;
+    timer_counter = saved_timer;
 
-    return ret;
-}
\ No newline at end of file
+    return true;
+}
@@ -8,6 +8,12 @@
 #ifndef FSM_WINDSHIELD_WASHER_H
 #define FSM_WINDSHIELD_WASHER_H
 
+/***** Includes **************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "fsm_trace.h"
+
 /**
  * \brief Run the windshield wipers and washer FSM
  *
@@ -15,4 +21,31 @@
  */
 int fsm_windshield_washer_run(void);
 
+/**
+ * \brief Get the current state of the windshield washer FSM.
+ * \return int : Current state value
+ */
+int fsm_windshield_washer_get_state(void);
+
+/**
+ * \brief Get a snapshot of the windshield washer FSM instrumentation, from any thread.
+ * \param data : Output instrumentation data
+ */
+void fsm_windshield_washer_get_trace(fsm_trace_data_t *data);
+
+/**
+ * \brief Save the state and timer of the windshield washer FSM, for a warm restart.
+ * \param saved_state : Output state
+ * \param saved_timer : Output timer counter
+ */
+void fsm_windshield_washer_save(uint8_t *saved_state, uint8_t *saved_timer);
+
+/**
+ * \brief Resume the windshield washer FSM from a saved state and timer, before its first run.
+ * \param saved_state : Saved state
+ * \param saved_timer : Saved timer counter
+ * \return bool : true if resumed, false if terminated or unknown (the FSM starts from ST_INIT)
+ */
+bool fsm_windshield_washer_restore(uint8_t saved_state, uint8_t saved_timer);
+
 #endif /* FSM_WINDSHIELD_WASHER_H */
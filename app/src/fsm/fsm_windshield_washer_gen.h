@@ -0,0 +1,177 @@
+/**
+ * \file fsm_windshield_washer_gen.h
+ * \brief Generated evaluation of the windshield washer and wiper FSM.
+ * \details Generated by generator/gen_fsm.py from generator/fsm/windshield_washer.json, do not edit.
+ *          Private to fsm_windshield_washer.c, which provides the actions and guards declared here.
+ *          Each state evaluates its own rules and calls the matching transition directly.
+ * \author Raphael CAUSSE
+ */
+
+#ifndef FSM_WINDSHIELD_WASHER_GEN_H
+#define FSM_WINDSHIELD_WASHER_GEN_H
+
+/***** Definitions ***********************************************************/
+
+#define TIMER_2S_COUNT_100MS (20) /* 2 seconds = 20 * 100ms */
+
+/* States */
+typedef enum
+{
+    ST_INIT = 0,    /* Init state */
+    ST_ALL_OFF,     /* All systems off */
+    ST_WIPER_ON,    /* Only wipers on */
+    ST_BOTH_ON,     /* Both wipers and washer on */
+    ST_WIPER_TIMER, /* Wipers running on timer */
+    ST_TERM = 255   /* Final state */
+} fsm_state_t;
+
+/* Events */
+typedef enum
+{
+    EV_NONE = 0,       /* No event */
+    EV_CMD_WIPER_ON,   /* Command to activate wipers */
+    EV_CMD_WIPER_OFF,  /* Command to deactivate wipers */
+    EV_CMD_WASHER_ON,  /* Command to activate washer */
+    EV_CMD_WASHER_OFF, /* Command to deactivate washer */
+    EV_TIMEOUT,        /* 2-second timer expired */
+    EV_ERR = 255       /* Error event */
+} fsm_event_t;
+
+/***** Static Functions Declarations *****************************************/
+
+static int callback_init(void);
+static int callback_wiper_on(void);
+static int callback_both_on(void);
+static int callback_error(void);
+static int fsm_step(bool tick);
+
+/***** Static Variables ******************************************************/
+
+static fsm_state_t state = ST_INIT; /* State of the FSM */
+static fsm_trace_t trace;           /* Transition instrumentation */
+static uint8_t timer_counter = 0;   /* Timer for 2 seconds delay, increment each 100ms */
+
+/***** Static Functions Definitions ******************************************/
+
+/**
+ * \brief Evaluate the FSM once.
+ * \param tick : true for periodic 100ms evaluation, false for an immediate evaluation not advancing timers
+ * \return int : Return code of transition callback.
+ */
+static int fsm_step(bool tick)
+{
+    int ret = 0;
+    fsm_state_t previous = state;
+
+    fsm_trace_begin(&trace);
+    switch (state)
+    {
+    case ST_INIT:
+    {
+        fsm_trace_transition(&trace, 0u, ST_INIT, ST_ALL_OFF, EV_NONE);
+        state = ST_ALL_OFF;
+        ret = callback_init();
+        break;
+    }
+
+    case ST_ALL_OFF:
+    {
+        const bool wiper_on = (get_cmd_wiper() == ON);
+        const bool washer_on = (get_cmd_washer() == ON);
+
+        if (wiper_on)
+        {
+            fsm_trace_transition(&trace, 1u, ST_ALL_OFF, ST_WIPER_ON, EV_CMD_WIPER_ON);
+            state = ST_WIPER_ON;
+            ret = callback_wiper_on();
+        }
+        else if (washer_on)
+        {
+            fsm_trace_transition(&trace, 2u, ST_ALL_OFF, ST_BOTH_ON, EV_CMD_WASHER_ON);
+            state = ST_BOTH_ON;
+            ret = callback_both_on();
+        }
+        break;
+    }
+
+    case ST_WIPER_ON:
+    {
+        const bool wiper_on = (get_cmd_wiper() == ON);
+        const bool washer_on = (get_cmd_washer() == ON);
+
+        if (!wiper_on)
+        {
+            fsm_trace_transition(&trace, 3u, ST_WIPER_ON, ST_ALL_OFF, EV_CMD_WIPER_OFF);
+            state = ST_ALL_OFF;
+            ret = callback_init();
+        }
+        else if (washer_on)
+        {
+            fsm_trace_transition(&trace, 4u, ST_WIPER_ON, ST_BOTH_ON, EV_CMD_WASHER_ON);
+            state = ST_BOTH_ON;
+            ret = callback_both_on();
+        }
+        break;
+    }
+
+    case ST_BOTH_ON:
+    {
+        const bool washer_on = (get_cmd_washer() == ON);
+
+        if (!washer_on)
+        {
+            fsm_trace_transition(&trace, 5u, ST_BOTH_ON, ST_WIPER_TIMER, EV_CMD_WASHER_OFF);
+            state = ST_WIPER_TIMER;
+        }
+        break;
+    }
+
+    case ST_WIPER_TIMER:
+    {
+        const bool washer_on = (get_cmd_washer() == ON);
+
+        if (washer_on && (timer_counter < TIMER_2S_COUNT_100MS))
+        {
+            fsm_trace_transition(&trace, 6u, ST_WIPER_TIMER, ST_BOTH_ON, EV_CMD_WASHER_ON);
+            state = ST_BOTH_ON;
+            ret = callback_both_on();
+        }
+        else if (timer_counter >= TIMER_2S_COUNT_100MS)
+        {
+            fsm_trace_transition(&trace, 7u, ST_WIPER_TIMER, ST_ALL_OFF, EV_TIMEOUT);
+            state = ST_ALL_OFF;
+            ret = callback_init();
+        }
+        else
+        {
+            fsm_trace_transition(&trace, 8u, ST_WIPER_TIMER, ST_WIPER_TIMER, EV_NONE);
+            state = ST_WIPER_TIMER;
+        }
+        if (tick && (state == ST_WIPER_TIMER))
+        {
+            timer_counter++;
+        }
+        break;
+    }
+
+    case ST_TERM:
+        break;
+
+    default:
+        fsm_trace_transition(&trace, 9u, state, ST_TERM, EV_ERR);
+        state = ST_TERM;
+        ret = callback_error();
+        break;
+    }
+    fsm_trace_end(&trace);
+
+    /* Keep the transitions leading to the final state */
+    if ((state == ST_TERM) && (previous != ST_TERM))
+    {
+        fsm_trace_dump("windshield_washer", &trace.data);
+    }
+
+    return ret;
+}
+
+#endif /* FSM_WINDSHIELD_WASHER_GEN_H */
@@ -0,0 +1,83 @@
+/**
+ * \file fsm_windshield_washer_product.c
+ * \brief Precomputed table of the windshield_washer FSM.
+ * \details Generated by generator/gen_fsm_product.c (make fsm_product), do not edit.
+ * \author Raphael CAUSSE
+ */
+
+/***** Includes **************************************************************/
+
+#include "fsm_product.h"
+
+/***** Variables *************************************************************/
+
+const uint8_t fsm_product_windshield_washer_next[10] = {1, 2, 3, 1, 3, 4, 3, 1, 4, 0};
+
+const uint8_t fsm_product_windshield_washer_event[10] = {0, 1, 3, 2, 3, 4, 3, 5, 0, 0};
+
+const uint16_t fsm_product_windshield_washer[768] = {
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801, 0x0801,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0012, 0x0033, 0x0012,
+    0x0010, 0x0012, 0x0033, 0x0012, 0x0020, 0x0032, 0x0033, 0x0032, 0x0030, 0x0032, 0x0033, 0x0032,
+    0x0000, 0x0012, 0x0033, 0x0012, 0x0010, 0x0012, 0x0033, 0x0012, 0x0020, 0x0032, 0x0033, 0x0032,
+    0x0030, 0x0032, 0x0033, 0x0032, 0x0000, 0x0012, 0x0033, 0x0012, 0x0010, 0x0012, 0x0033, 0x0012,
+    0x0020, 0x0032, 0x0033, 0x0032, 0x0030, 0x0032, 0x0033, 0x0032, 0x0000, 0x0012, 0x0033, 0x0012,
+    0x0010, 0x0012, 0x0033, 0x0012, 0x0020, 0x0032, 0x0033, 0x0032, 0x0030, 0x0032, 0x0033, 0x0032,
+    0x0000, 0x0012, 0x0033, 0x0012, 0x0010, 0x0012, 0x0033, 0x0012, 0x0020, 0x0032, 0x0033, 0x0032,
+    0x0030, 0x0032, 0x0033, 0x0032, 0x0000, 0x0012, 0x0033, 0x0012, 0x0010, 0x0012, 0x0033, 0x0012,
+    0x0020, 0x0032, 0x0033, 0x0032, 0x0030, 0x0032, 0x0033, 0x0032, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0804, 0x0000, 0x0804, 0x0035, 0x0804, 0x0010, 0x0804, 0x0035,
+    0x0804, 0x0020, 0x0804, 0x0035, 0x0804, 0x0030, 0x0804, 0x0035, 0x0804, 0x0000, 0x0804, 0x0035,
+    0x0804, 0x0010, 0x0804, 0x0035, 0x0804, 0x0020, 0x0804, 0x0035, 0x0804, 0x0030, 0x0804, 0x0035,
+    0x0804, 0x0000, 0x0804, 0x0035, 0x0804, 0x0010, 0x0804, 0x0035, 0x0804, 0x0020, 0x0804, 0x0035,
+    0x0804, 0x0030, 0x0804, 0x0035, 0x0804, 0x0000, 0x0804, 0x0035, 0x0804, 0x0010, 0x0804, 0x0035,
+    0x0804, 0x0020, 0x0804, 0x0035, 0x0804, 0x0030, 0x0804, 0x0035, 0x0804, 0x0000, 0x0804, 0x0035,
+    0x0804, 0x0010, 0x0804, 0x0035, 0x0804, 0x0020, 0x0804, 0x0035, 0x0804, 0x0030, 0x0804, 0x0035,
+    0x0804, 0x0000, 0x0804, 0x0035, 0x0804, 0x0010, 0x0804, 0x0035, 0x0804, 0x0020, 0x0804, 0x0035,
+    0x0804, 0x0030, 0x0804, 0x0035, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0006, 0x0006, 0x0000, 0x0000, 0x0016, 0x0016, 0x0010, 0x0010, 0x0026, 0x0026, 0x0020, 0x0020,
+    0x0036, 0x0036, 0x0030, 0x0030, 0x0006, 0x0006, 0x0000, 0x0000, 0x0016, 0x0016, 0x0010, 0x0010,
+    0x0026, 0x0026, 0x0020, 0x0020, 0x0036, 0x0036, 0x0030, 0x0030, 0x0006, 0x0006, 0x0000, 0x0000,
+    0x0016, 0x0016, 0x0010, 0x0010, 0x0026, 0x0026, 0x0020, 0x0020, 0x0036, 0x0036, 0x0030, 0x0030,
+    0x0006, 0x0006, 0x0000, 0x0000, 0x0016, 0x0016, 0x0010, 0x0010, 0x0026, 0x0026, 0x0020, 0x0020,
+    0x0036, 0x0036, 0x0030, 0x0030, 0x0006, 0x0006, 0x0000, 0x0000, 0x0016, 0x0016, 0x0010, 0x0010,
+    0x0026, 0x0026, 0x0020, 0x0020, 0x0036, 0x0036, 0x0030, 0x0030, 0x0006, 0x0006, 0x0000, 0x0000,
+    0x0016, 0x0016, 0x0010, 0x0010, 0x0026, 0x0026, 0x0020, 0x0020, 0x0036, 0x0036, 0x0030, 0x0030,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0009, 0x0009, 0x0037, 0x0037,
+    0x0019, 0x0019, 0x0037, 0x0037, 0x0029, 0x0029, 0x0037, 0x0037, 0x0039, 0x0039, 0x0037, 0x0037,
+    0x0409, 0x0409, 0x0037, 0x0037, 0x0419, 0x0419, 0x0037, 0x0037, 0x0429, 0x0429, 0x0037, 0x0037,
+    0x0439, 0x0439, 0x0037, 0x0037, 0x0009, 0x0009, 0x0037, 0x0037, 0x0019, 0x0019, 0x0037, 0x0037,
+    0x0029, 0x0029, 0x0037, 0x0037, 0x0039, 0x0039, 0x0037, 0x0037, 0x0409, 0x0409, 0x0037, 0x0037,
+    0x0419, 0x0419, 0x0037, 0x0037, 0x0429, 0x0429, 0x0037, 0x0037, 0x0439, 0x0439, 0x0037, 0x0037,
+    0x0808, 0x0808, 0x0808, 0x0808, 0x0808, 0x0808, 0x0808, 0x0808, 0x0808, 0x0808, 0x0808, 0x0808,
+    0x0808, 0x0808, 0x0808, 0x0808, 0x0808, 0x0808, 0x0808, 0x0808, 0x0808, 0x0808, 0x0808, 0x0808,
+    0x0808, 0x0808, 0x0808, 0x0808, 0x0808, 0x0808, 0x0808, 0x0808, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0030, 0x0030, 0x0030, 0x0030, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0020, 0x0020, 0x0020, 0x0020, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0010, 0x0010, 0x0010, 0x0010, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0000, 0x0000, 0x0000, 0x0000, 0x0010, 0x0010, 0x0010, 0x0010,
+    0x0020, 0x0020, 0x0020, 0x0020, 0x0030, 0x0030, 0x0030, 0x0030, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0010, 0x0010, 0x0010, 0x0010, 0x0020, 0x0020, 0x0020, 0x0020, 0x0030, 0x0030, 0x0030, 0x0030,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0010, 0x0010, 0x0010, 0x0010, 0x0020, 0x0020, 0x0020, 0x0020,
+    0x0030, 0x0030, 0x0030, 0x0030, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+};
@@ -0,0 +1,90 @@
+/**
+ * \file metrics.c
+ * \brief Implementation of runtime metrics.
+ * \details Collect latency samples (count, min, max, mean, last) and report them through the logger.
+ * \author Raphael CAUSSE
+ */
+
+/***** Includes **************************************************************/
+
+#include <string.h>
+#include <pthread.h>
+#include "metrics.h"
+#include "log.h"
+
+/***** Static Variables ******************************************************/
+
+static metric_stat_t metrics[METRIC_COUNT];
+static pthread_mutex_t metrics_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static const char *const metric_names[METRIC_COUNT] = {
+    "mux_age_at_encode",
+    "comodo_age_at_bgf_write",
+    "bgf_ack_to_state_change",
+    "bgf_ack_rtt",
+    "cycle_duration",
+};
+
+/***** Functions *************************************************************/
+
+void metrics_record(metric_id_t id, timestamp_t value)
+{
+    metric_stat_t *stat = NULL;
+
+    if (id >= METRIC_COUNT)
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&metrics_mutex);
+    stat = &metrics[id];
+    if ((stat->count == 0) || (value < stat->min))
+    {
+        stat->min = value;
+    }
+    if (value > stat->max)
+    {
+        stat->max = value;
+    }
+    stat->sum += value;
+    stat->last = value;
+    stat->count++;
+    pthread_mutex_unlock(&metrics_mutex);
+}
+
+void metrics_get(metric_id_t id, metric_stat_t *stat)
+{
+    if ((id < METRIC_COUNT) && (stat != NULL))
+    {
+        pthread_mutex_lock(&metrics_mutex);
+        *stat = metrics[id];
+        pthread_mutex_unlock(&metrics_mutex);
+    }
+}
+
+void metrics_reset(void)
+{
+    pthread_mutex_lock(&metrics_mutex);
+    memset(metrics, 0, sizeof(metrics));
+    pthread_mutex_unlock(&metrics_mutex);
+}
+
+void metrics_report(void)
+{
+    metric_stat_t stat;
+
+    for (int id = 0; id < METRIC_COUNT; id++)
+    {
+        metrics_get(id, &stat);
+        if (stat.count > 0)
+        {
+            log_info("%s: n=%u min=%lluus avg=%lluus max=%lluus last=%lluus",
+                     metric_names[id],
+                     stat.count,
+                     (unsigned long long)(stat.min / TIMESTAMP_NS_PER_US),
+                     (unsigned long long)(stat.sum / stat.count / TIMESTAMP_NS_PER_US),
+                     (unsigned long long)(stat.max / TIMESTAMP_NS_PER_US),
+                     (unsigned long long)(stat.last / TIMESTAMP_NS_PER_US));
+        }
+    }
+}
@@ -0,0 +1,66 @@
+/**
+ * \file metrics.h
+ * \brief Interface of runtime metrics.
+ * \details Collect latency samples (count, min, max, mean, last) and report them through the logger.
+ *          Functions are thread-safe.
+ * \author Raphael CAUSSE
+ */
+
+#ifndef METRICS_H
+#define METRICS_H
+
+/***** Includes **************************************************************/
+
+#include <stdint.h>
+#include "timestamp.h"
+
+/***** Definitions ***********************************************************/
+
+/* Metrics identifiers */
+typedef enum
+{
+    METRIC_MUX_AGE_AT_ENCODE = 0, /* Age of MUX 100ms data when encoded in MUX 200ms frame */
+    METRIC_COMODO_AGE_AT_BGF_WRITE, /* Age of COMODO command when the resulting BGF message is written */
+    METRIC_BGF_ACK_TO_STATE_CHANGE, /* Delay between BGF acknowledgement reception and FSM state change */
+    METRIC_BGF_ACK_RTT, /* Round trip time between BGF message and its acknowledgement */
+    METRIC_CYCLE_DURATION, /* Processing time of one cycle, from MUX frame reception to last write */
+    METRIC_COUNT
+} metric_id_t;
+
+/* Latency statistics of one metric */
+typedef struct
+{
+    uint32_t count;  /* Number of samples */
+    timestamp_t min; /* Minimum value (ns) */
+    timestamp_t max; /* Maximum value (ns) */
+    timestamp_t sum; /* Sum of all values (ns) */
+    timestamp_t last; /* Last value (ns) */
+} metric_stat_t;
+
+/***** Functions *************************************************************/
+
+/**
+ * \brief Record a latency sample.
+ * \param id : Metric identifier
+ * \param value : Sample value (ns)
+ */
+void metrics_record(metric_id_t id, timestamp_t value);
+
+/**
+ * \brief Get a copy of the statistics of a metric.
+ * \param id : Metric identifier
+ * \param stat : Output statistics
+ */
+void metrics_get(metric_id_t id, metric_stat_t *stat);
+
+/**
+ * \brief Reset all metrics.
+ */
+void metrics_reset(void);
+
+/**
+ * \brief Log statistics of all metrics having at least one sample.
+ */
+void metrics_report(void);
+
+#endif /* METRICS_H */
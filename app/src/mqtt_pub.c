@@ -0,0 +1,484 @@
+/**
+ * \file mqtt_pub.c
+ * \brief Implementation of MQTT publisher.
+ * \details Publish context fields and FSM states, one topic per value, to an MQTT broker.
+ *          A value is published when it moves by more than its deadband since its last publication,
+ *          or when its heartbeat interval expires. Publication runs in a dedicated thread fed by a bounded queue.
+ *          Broker connection requires libmosquitto (build with MQTT=1).
+ * \author Raphael CAUSSE
+ */
+
+/***** Includes **************************************************************/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#ifdef WITH_MQTT
+#include <mosquitto.h>
+#endif
+#include "mqtt_pub.h"
+#include "bcgv_api.h"
+#include "fsm_lights.h"
+#include "fsm_indicators.h"
+#include "fsm_windshield_washer.h"
+#include "log.h"
+#include "timestamp.h"
+#include "rt_profile.h"
+
+/***** Definitions ***********************************************************/
+
+#define MQTT_PUB_SERVICE_PERIOD_MS (100) /* Network servicing and reconnection period */
+#define MQTT_PUB_TOPIC_SIZE (64)
+#define MQTT_PUB_PAYLOAD_SIZE (24)
+
+/* Value waiting to be published */
+typedef struct
+{
+    mqtt_field_t field;
+    int64_t value;
+} mqtt_pub_msg_t;
+
+/***** Static Variables ******************************************************/
+
+static const char *const mqtt_field_names[MQTT_FIELD_COUNT] = {
+    "speed",
+    "distance",
+    "fuel_level",
+    "engine_rpm",
+    "chassis_issues",
+    "motor_issues",
+    "battery_issues",
+    "flag/position_light",
+    "flag/crossing_light",
+    "flag/highbeam_light",
+    "flag/indic_left",
+    "flag/indic_right",
+    "flag/indic_hazard",
+    "flag/wiper",
+    "flag/washer",
+    "fsm/lights",
+    "fsm/indicators",
+    "fsm/windshield_washer",
+};
+
+static mqtt_pub_config_t mqtt_config;
+
+static pthread_t mqtt_thread;
+static pthread_mutex_t mqtt_mutex; /* Priority inheritance, locked by the main loop every cycle */
+static pthread_cond_t mqtt_cond;
+static volatile bool mqtt_running = false;
+
+/* Bounded queue, shared with the main loop */
+static mqtt_pub_msg_t mqtt_queue[MQTT_PUB_QUEUE_SIZE];
+static uint32_t mqtt_queue_head = 0;
+static uint32_t mqtt_queue_count = 0;
+static mqtt_pub_stats_t mqtt_stats;
+
+/* Last published values, owned by the main loop */
+static int64_t mqtt_last_value[MQTT_FIELD_COUNT];
+static timestamp_t mqtt_last_time[MQTT_FIELD_COUNT];
+
+/* Owned by the publication thread */
+static mqtt_pub_msg_t mqtt_batch[MQTT_PUB_QUEUE_SIZE];
+
+#ifdef WITH_MQTT
+static struct mosquitto *mqtt_client = NULL;
+#endif
+
+/***** Static Functions ******************************************************/
+
+#ifdef WITH_MQTT
+
+/**
+ * \brief Create the client and connect to the broker.
+ * \return bool : true on success, false otherwise
+ */
+static bool mqtt_pub_connect(void)
+{
+    int rc = 0;
+
+    mosquitto_lib_init();
+    mqtt_client = mosquitto_new(NULL, true, NULL);
+    if (mqtt_client == NULL)
+    {
+        log_error("error while creating MQTT client: %s", strerror(errno));
+        mosquitto_lib_cleanup();
+        return false;
+    }
+
+    rc = mosquitto_connect(mqtt_client, mqtt_config.host, mqtt_config.port, MQTT_PUB_KEEPALIVE_S);
+    if (rc != MOSQ_ERR_SUCCESS)
+    {
+        log_error("error while connecting to MQTT broker %s:%u: %s", mqtt_config.host, mqtt_config.port,
+                  mosquitto_strerror(rc));
+        mosquitto_destroy(mqtt_client);
+        mosquitto_lib_cleanup();
+        mqtt_client = NULL;
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * \brief Publish one value, retained so that new subscribers get the current state.
+ * \return bool : true on success, false otherwise
+ */
+static bool mqtt_pub_publish(const char *topic, const char *payload)
+{
+    int rc = mosquitto_publish(mqtt_client, NULL, topic, (int)strlen(payload), payload, 0, true);
+
+    return (rc == MOSQ_ERR_SUCCESS);
+}
+
+/**
+ * \brief Service network traffic without blocking, reconnecting if the connection is lost.
+ */
+static void mqtt_pub_service(void)
+{
+    int rc = mosquitto_loop(mqtt_client, 0, 1);
+
+    if ((rc == MOSQ_ERR_NO_CONN) || (rc == MOSQ_ERR_CONN_LOST))
+    {
+        rc = mosquitto_reconnect(mqtt_client);
+        if (rc != MOSQ_ERR_SUCCESS)
+        {
+            log_warn("MQTT reconnection failed: %s", mosquitto_strerror(rc));
+        }
+    }
+}
+
+/**
+ * \brief Disconnect from the broker and release the client.
+ */
+static void mqtt_pub_disconnect(void)
+{
+    mosquitto_loop(mqtt_client, 0, 1); /* Flush pending messages */
+    mosquitto_disconnect(mqtt_client);
+    mosquitto_destroy(mqtt_client);
+    mosquitto_lib_cleanup();
+    mqtt_client = NULL;
+}
+
+#else
+
+static bool mqtt_pub_connect(void)
+{
+    log_error("MQTT support not built in (build with MQTT=1)", NULL);
+    return false;
+}
+
+static bool mqtt_pub_publish(const char *topic, const char *payload)
+{
+    (void)topic;
+    (void)payload;
+    return false;
+}
+
+static void mqtt_pub_service(void)
+{
+}
+
+static void mqtt_pub_disconnect(void)
+{
+}
+
+#endif /* WITH_MQTT */
+
+/**
+ * \brief Publication thread main function.
+ * \param arg : Unused
+ * \return void* : Unused
+ */
+static void *mqtt_pub_thread_main(void *arg)
+{
+    struct timespec deadline;
+    char topic[MQTT_PUB_TOPIC_SIZE];
+    char payload[MQTT_PUB_PAYLOAD_SIZE];
+    uint32_t count = 0;
+    uint32_t published = 0;
+    bool running = true;
+
+    (void)arg;
+    while (running == true)
+    {
+        clock_gettime(CLOCK_MONOTONIC, &deadline);
+        deadline.tv_nsec += MQTT_PUB_SERVICE_PERIOD_MS * 1000000L;
+        if (deadline.tv_nsec >= 1000000000L)
+        {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000L;
+        }
+
+        /* Take all queued values, the main loop waits at most for this copy */
+        pthread_mutex_lock(&mqtt_mutex);
+        while ((mqtt_running == true) && (mqtt_queue_count == 0))
+        {
+            if (pthread_cond_timedwait(&mqtt_cond, &mqtt_mutex, &deadline) == ETIMEDOUT)
+            {
+                break;
+            }
+        }
+        running = mqtt_running;
+        for (count = 0; mqtt_queue_count > 0; count++)
+        {
+            mqtt_batch[count] = mqtt_queue[mqtt_queue_head];
+            mqtt_queue_head = (mqtt_queue_head + 1) % MQTT_PUB_QUEUE_SIZE;
+            mqtt_queue_count--;
+        }
+        pthread_mutex_unlock(&mqtt_mutex);
+
+        published = 0;
+        for (uint32_t i = 0; i < count; i++)
+        {
+            snprintf(topic, sizeof(topic), "%s/%s", mqtt_config.prefix, mqtt_field_names[mqtt_batch[i].field]);
+            snprintf(payload, sizeof(payload), "%lld", (long long)mqtt_batch[i].value);
+            if (mqtt_pub_publish(topic, payload) == true)
+            {
+                published++;
+            }
+        }
+        mqtt_pub_service();
+
+        pthread_mutex_lock(&mqtt_mutex);
+        mqtt_stats.published += published;
+        mqtt_stats.errors += count - published;
+        pthread_mutex_unlock(&mqtt_mutex);
+    }
+
+    return NULL;
+}
+
+/**
+ * \brief Read the current value of a published field.
+ * \param field : Field
+ * \return int64_t : Current value
+ */
+static int64_t mqtt_pub_read(mqtt_field_t field)
+{
+    int64_t value = 0;
+
+    switch (field)
+    {
+    case MQTT_FIELD_SPEED:
+        value = get_speed();
+        break;
+    case MQTT_FIELD_DISTANCE:
+        value = get_distance();
+        break;
+    case MQTT_FIELD_FUEL_LEVEL:
+        value = get_fuel_level();
+        break;
+    case MQTT_FIELD_ENGINE_RPM:
+        value = get_engine_rpm();
+        break;
+    case MQTT_FIELD_CHASSIS_ISSUES:
+        value = get_chassis_issues();
+        break;
+    case MQTT_FIELD_MOTOR_ISSUES:
+        value = get_motor_issues();
+        break;
+    case MQTT_FIELD_BATTERY_ISSUES:
+        value = get_battery_issues();
+        break;
+    case MQTT_FIELD_FLAG_POSITION_LIGHT:
+        value = get_flag_position_light();
+        break;
+    case MQTT_FIELD_FLAG_CROSSING_LIGHT:
+        value = get_flag_crossing_light();
+        break;
+    case MQTT_FIELD_FLAG_HIGHBEAM_LIGHT:
+        value = get_flag_highbeam_light();
+        break;
+    case MQTT_FIELD_FLAG_INDIC_LEFT:
+        value = get_flag_indic_left();
+        break;
+    case MQTT_FIELD_FLAG_INDIC_RIGHT:
+        value = get_flag_indic_right();
+        break;
+    case MQTT_FIELD_FLAG_INDIC_HAZARD:
+        value = get_flag_indic_hazard();
+        break;
+    case MQTT_FIELD_FLAG_WIPER:
+        value = get_flag_wiper();
+        break;
+    case MQTT_FIELD_FLAG_WASHER:
+        value = get_flag_washer();
+        break;
+    case MQTT_FIELD_FSM_LIGHTS:
+        value = fsm_lights_get_state();
+        break;
+    case MQTT_FIELD_FSM_INDICATORS:
+        value = fsm_indicators_get_state();
+        break;
+    case MQTT_FIELD_FSM_WINDSHIELD_WASHER:
+        value = fsm_windshield_washer_get_state();
+        break;
+    default:
+        break;
+    }
+
+    return value;
+}
+
+/***** Functions *************************************************************/
+
+void mqtt_pub_default(mqtt_pub_config_t *config)
+{
+    config->host = MQTT_PUB_DEFAULT_HOST;
+    config->port = MQTT_PUB_DEFAULT_PORT;
+    config->prefix = MQTT_PUB_DEFAULT_PREFIX;
+    config->heartbeat_ms = MQTT_PUB_DEFAULT_HEARTBEAT_MS;
+    memset(config->deadband, 0, sizeof(config->deadband));
+    config->deadband[MQTT_FIELD_SPEED] = 1;       /* km/h */
+    config->deadband[MQTT_FIELD_FUEL_LEVEL] = 1;  /* litres */
+    config->deadband[MQTT_FIELD_ENGINE_RPM] = 50; /* rpm */
+}
+
+bool mqtt_pub_set_deadband(mqtt_pub_config_t *config, const char *name, uint32_t deadband)
+{
+    for (uint32_t i = 0; i < MQTT_FIELD_COUNT; i++)
+    {
+        if (strcmp(name, mqtt_field_names[i]) == 0)
+        {
+            config->deadband[i] = deadband;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool mqtt_pub_start(const mqtt_pub_config_t *config)
+{
+    pthread_condattr_t attr;
+    pthread_attr_t thread_attr;
+    int ret = 0;
+
+    if (mqtt_running == true)
+    {
+        return true;
+    }
+
+    mqtt_config = *config;
+    if (mqtt_pub_connect() == false)
+    {
+        return false;
+    }
+
+    mqtt_queue_head = 0;
+    mqtt_queue_count = 0;
+    memset(&mqtt_stats, 0, sizeof(mqtt_stats));
+    memset(mqtt_last_time, 0, sizeof(mqtt_last_time)); /* Every value is published on first sample */
+
+    ret = rt_profile_mutex_init(&mqtt_mutex);
+    if (ret != 0)
+    {
+        log_error("error while creating MQTT mutex (%d)", ret);
+        mqtt_pub_disconnect();
+        return false;
+    }
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&mqtt_cond, &attr);
+    pthread_condattr_destroy(&attr);
+
+    mqtt_running = true;
+    ret = rt_profile_helper_attr_init(&thread_attr);
+    if (ret == 0)
+    {
+        ret = pthread_create(&mqtt_thread, &thread_attr, &mqtt_pub_thread_main, NULL);
+        pthread_attr_destroy(&thread_attr);
+    }
+    if (ret != 0)
+    {
+        log_error("error while creating MQTT thread (%d)", ret);
+        mqtt_running = false;
+        pthread_cond_destroy(&mqtt_cond);
+        pthread_mutex_destroy(&mqtt_mutex);
+        mqtt_pub_disconnect();
+        return false;
+    }
+
+    return true;
+}
+
+void mqtt_pub_stop(void)
+{
+    if (mqtt_running == true)
+    {
+        pthread_mutex_lock(&mqtt_mutex);
+        mqtt_running = false;
+        pthread_cond_signal(&mqtt_cond);
+        pthread_mutex_unlock(&mqtt_mutex);
+
+        pthread_join(mqtt_thread, NULL);
+        pthread_cond_destroy(&mqtt_cond);
+        pthread_mutex_destroy(&mqtt_mutex);
+        mqtt_pub_disconnect();
+    }
+}
+
+void mqtt_pub_sample(void)
+{
+    timestamp_t now = 0;
+    timestamp_t heartbeat = 0;
+    int64_t value = 0;
+    int64_t delta = 0;
+    uint32_t tail = 0;
+    bool queued = false;
+
+    if (mqtt_running == false)
+    {
+        return;
+    }
+
+    now = timestamp_now();
+    heartbeat = (timestamp_t)mqtt_config.heartbeat_ms * TIMESTAMP_NS_PER_MS;
+
+    pthread_mutex_lock(&mqtt_mutex);
+    for (uint32_t i = 0; i < MQTT_FIELD_COUNT; i++)
+    {
+        value = mqtt_pub_read((mqtt_field_t)i);
+        delta = (value > mqtt_last_value[i]) ? (value - mqtt_last_value[i]) : (mqtt_last_value[i] - value);
+
+        /* Publish on first sample, change beyond deadband or heartbeat expiry */
+        if ((mqtt_last_time[i] != TIMESTAMP_NONE) && (delta <= (int64_t)mqtt_config.deadband[i]) &&
+            (timestamp_elapsed(mqtt_last_time[i], now) < heartbeat))
+        {
+            mqtt_stats.suppressed++;
+            continue;
+        }
+
+        if (mqtt_queue_count == MQTT_PUB_QUEUE_SIZE)
+        {
+            mqtt_stats.dropped++;
+            continue;
+        }
+        tail = (mqtt_queue_head + mqtt_queue_count) % MQTT_PUB_QUEUE_SIZE;
+        mqtt_queue[tail].field = (mqtt_field_t)i;
+        mqtt_queue[tail].value = value;
+        mqtt_queue_count++;
+        mqtt_stats.queued++;
+        queued = true;
+
+        mqtt_last_value[i] = value;
+        mqtt_last_time[i] = now;
+    }
+    if (queued == true)
+    {
+        pthread_cond_signal(&mqtt_cond);
+    }
+    pthread_mutex_unlock(&mqtt_mutex);
+}
+
+void mqtt_pub_get_stats(mqtt_pub_stats_t *stats)
+{
+    pthread_mutex_lock(&mqtt_mutex);
+    *stats = mqtt_stats;
+    pthread_mutex_unlock(&mqtt_mutex);
+}
@@ -0,0 +1,115 @@
+/**
+ * \file mqtt_pub.h
+ * \brief Interface of MQTT publisher.
+ * \details Publish context fields and FSM states, one topic per value, to an MQTT broker.
+ *          A value is published when it moves by more than its deadband since its last publication,
+ *          or when its heartbeat interval expires. Publication runs in a dedicated thread fed by a bounded queue.
+ *          Broker connection requires libmosquitto (build with MQTT=1).
+ * \author Raphael CAUSSE
+ */
+
+#ifndef MQTT_PUB_H
+#define MQTT_PUB_H
+
+/***** Includes **************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/***** Definitions ***********************************************************/
+
+#define MQTT_PUB_DEFAULT_HOST "127.0.0.1"
+#define MQTT_PUB_DEFAULT_PORT (1883)
+#define MQTT_PUB_DEFAULT_PREFIX "bcgv"
+#define MQTT_PUB_DEFAULT_HEARTBEAT_MS (5000)
+#define MQTT_PUB_QUEUE_SIZE (128) /* Messages waiting to be published */
+#define MQTT_PUB_KEEPALIVE_S (10)
+
+/* Published values, one topic each */
+typedef enum
+{
+    MQTT_FIELD_SPEED = 0,
+    MQTT_FIELD_DISTANCE,
+    MQTT_FIELD_FUEL_LEVEL,
+    MQTT_FIELD_ENGINE_RPM,
+    MQTT_FIELD_CHASSIS_ISSUES,
+    MQTT_FIELD_MOTOR_ISSUES,
+    MQTT_FIELD_BATTERY_ISSUES,
+    MQTT_FIELD_FLAG_POSITION_LIGHT,
+    MQTT_FIELD_FLAG_CROSSING_LIGHT,
+    MQTT_FIELD_FLAG_HIGHBEAM_LIGHT,
+    MQTT_FIELD_FLAG_INDIC_LEFT,
+    MQTT_FIELD_FLAG_INDIC_RIGHT,
+    MQTT_FIELD_FLAG_INDIC_HAZARD,
+    MQTT_FIELD_FLAG_WIPER,
+    MQTT_FIELD_FLAG_WASHER,
+    MQTT_FIELD_FSM_LIGHTS,
+    MQTT_FIELD_FSM_INDICATORS,
+    MQTT_FIELD_FSM_WINDSHIELD_WASHER,
+    MQTT_FIELD_COUNT
+} mqtt_field_t;
+
+/* MQTT publisher configuration */
+typedef struct
+{
+    const char *host;                       /* Broker address */
+    uint16_t port;                          /* Broker port */
+    const char *prefix;                     /* Topic prefix, topics are <prefix>/<field> */
+    uint32_t heartbeat_ms;                  /* Maximum delay between two publications of a value */
+    uint32_t deadband[MQTT_FIELD_COUNT];    /* Change needed to publish a value before heartbeat */
+} mqtt_pub_config_t;
+
+/* MQTT publisher counters */
+typedef struct
+{
+    uint32_t queued;     /* Values queued for publication */
+    uint32_t suppressed; /* Value samples within deadband, not published */
+    uint32_t published;  /* Values published */
+    uint32_t dropped;    /* Values dropped because the queue was full */
+    uint32_t errors;     /* Values lost on publication error */
+} mqtt_pub_stats_t;
+
+/***** Functions *************************************************************/
+
+/**
+ * \brief Get the default MQTT publisher configuration.
+ * \details Analog values have a deadband, flags and FSM states are published on every change.
+ * \param config : Output configuration
+ */
+void mqtt_pub_default(mqtt_pub_config_t *config);
+
+/**
+ * \brief Set the deadband of a value by its topic name.
+ * \param config : Configuration to update
+ * \param name : Topic name of the value (without prefix)
+ * \param deadband : Deadband value
+ * \return bool : true on success, false if the name is unknown
+ */
+bool mqtt_pub_set_deadband(mqtt_pub_config_t *config, const char *name, uint32_t deadband);
+
+/**
+ * \brief Connect to the broker and start the publication thread.
+ * \param config : MQTT publisher configuration
+ * \return bool : true on success, false otherwise
+ */
+bool mqtt_pub_start(const mqtt_pub_config_t *config);
+
+/**
+ * \brief Stop the publication thread, publishing queued values, and disconnect.
+ */
+void mqtt_pub_stop(void);
+
+/**
+ * \brief Sample context fields and FSM states, queueing the ones to publish.
+ * \details Called from the main loop with the context lock held. Never blocks on the network,
+ *          does nothing if the publisher is not started.
+ */
+void mqtt_pub_sample(void);
+
+/**
+ * \brief Get a copy of MQTT publisher counters, between mqtt_pub_start() and mqtt_pub_stop().
+ * \param stats : Output counters
+ */
+void mqtt_pub_get_stats(mqtt_pub_stats_t *stats);
+
+#endif /* MQTT_PUB_H */
@@ -11,6 +11,10 @@
 #include "crc8.h"
 #include "log.h"
 #include "bit_utils.h"
+#include "metrics.h"
+#include "probe.h"
+#include "debug_trace.h"
+#include "trip_stats.h"
 
 /***** Definitions ***********************************************************/
 
@@ -46,6 +50,9 @@ static uint8_t mux_frame_200ms[DRV_UDP_200MS_FRAME_SIZE] = {0};
 
 static frame_number_t expected_frame_number = FRAME_NUMBER_MIN;
 
+static timestamp_t mux_frame_100ms_timestamp = TIMESTAMP_NONE; /* Reception time of last read frame */
+static timestamp_t mux_decoded_timestamp = TIMESTAMP_NONE;     /* Reception time of data stored in app context */
+
 /***** Functions *************************************************************/
 
 bool mux_read_frame_100ms(int32_t drv_fd)
@@ -55,11 +62,14 @@ bool mux_read_frame_100ms(int32_t drv_fd)
     {
         log_error("error while reading from MUX 100ms frame", NULL);
     }
+    else
+    {
+        mux_frame_100ms_timestamp = timestamp_now();
+    }
+    PROBE2(mux_read, mux_frame_100ms[0], ret);
 
 #ifdef DEBUG
-    printf("\n===================== MUX READ =====================\n");
-    mux_print_raw(mux_frame_100ms, DRV_UDP_100MS_FRAME_SIZE);
-    printf("====================================================\n");
+    debug_trace_record(DEBUG_TRACE_MUX_READ, mux_frame_100ms, DRV_UDP_100MS_FRAME_SIZE);
 #endif
 
     return (ret == DRV_SUCCESS);
@@ -72,6 +82,7 @@ bool mux_write_frame_200ms(int32_t drv_fd)
     {
         log_error("error while writing to MUX 200ms frame", NULL);
     }
+    PROBE1(mux_write, ret);
 
     return (ret == DRV_SUCCESS);
 }
@@ -91,6 +102,22 @@ void mux_incr_frame_number(void)
     expected_frame_number = (expected_frame_number % FRAME_NUMBER_MAX) + 1;
 }
 
+frame_number_t mux_get_expected_frame_number(void)
+{
+    return expected_frame_number;
+}
+
+bool mux_set_expected_frame_number(frame_number_t frame_number)
+{
+    if ((frame_number < FRAME_NUMBER_MIN) || (frame_number > FRAME_NUMBER_MAX))
+    {
+        return false;
+    }
+    expected_frame_number = frame_number;
+
+    return true;
+}
+
 bool mux_decode_frame_100ms(void)
 {
     bool ret = false;
@@ -104,12 +131,17 @@ bool mux_decode_frame_100ms(void)
     issues_t battery_issues = 0;
     crc8_t frame_crc8 = 0;
     crc8_t computed_crc8 = 0;
+    trip_stats_frame_t trip_frame;
+#ifdef DEBUG
+    debug_trace_mux_decoded_t decoded;
+#endif
 
     /* Decode frame only if CRC8 is valid */
     frame_crc8 = mux_frame_100ms[DRV_UDP_100MS_FRAME_SIZE - 1];
     computed_crc8 = crc8_compute(mux_frame_100ms, DRV_UDP_100MS_FRAME_SIZE - 1);
     if (frame_crc8 != computed_crc8)
     {
+        PROBE3(mux_crc_error, mux_frame_100ms[0], frame_crc8, computed_crc8);
         log_error("invalid CRC8: 0x%02X (computed 0x%02X)", frame_crc8, computed_crc8);
         ret = false;
     }
@@ -135,11 +167,31 @@ bool mux_decode_frame_100ms(void)
         set_engine_rpm(engine_rpm);
         set_battery_issues(battery_issues);
         set_crc8(frame_crc8);
+        mux_decoded_timestamp = mux_frame_100ms_timestamp;
+
+        /* Aggregate trip statistics */
+        trip_frame.time = mux_frame_100ms_timestamp;
+        trip_frame.distance = distance;
+        trip_frame.speed = speed;
+        trip_frame.chassis_issues = chassis_issues;
+        trip_frame.motor_issues = motor_issues;
+        trip_frame.fuel_level = fuel_level;
+        trip_frame.engine_rpm = engine_rpm;
+        trip_frame.battery_issues = battery_issues;
+        trip_stats_update(&trip_frame);
+        PROBE4(mux_decode, frame_number, speed, fuel_level, engine_rpm);
 
 #ifdef DEBUG
-        printf("==================== MUX DECODE ====================\n");
-        mux_print_decoded();
-        printf("====================================================\n");
+        decoded.distance = distance;
+        decoded.engine_rpm = engine_rpm;
+        decoded.frame_number = frame_number;
+        decoded.speed = speed;
+        decoded.chassis_issues = chassis_issues;
+        decoded.motor_issues = motor_issues;
+        decoded.fuel_level = fuel_level;
+        decoded.battery_issues = battery_issues;
+        decoded.crc8 = frame_crc8;
+        debug_trace_record(DEBUG_TRACE_MUX_DECODE, &decoded, sizeof(decoded));
 #endif
 
         ret = true;
@@ -165,6 +217,12 @@ void mux_encode_frame_200ms(void)
     flag_t flag_wiper = get_flag_wiper();
     flag_t flag_washer = get_flag_washer();
 
+    /* Measure age of MUX data being forwarded */
+    if (mux_decoded_timestamp != TIMESTAMP_NONE)
+    {
+        metrics_record(METRIC_MUX_AGE_AT_ENCODE, timestamp_elapsed(mux_decoded_timestamp, timestamp_now()));
+    }
+
     /* Set first 8 bits */
     byte |= (flag_position_light & 1U) << 7;
     byte |= (flag_crossing_light & 1U) << 6;
@@ -197,93 +255,26 @@ void mux_encode_frame_200ms(void)
     MUX_200MS_SET_UINT16_AT(8, engine_rpm);
 
 #ifdef DEBUG
-    printf("==================== MUX ENCODE ====================\n");
-    mux_print_raw(mux_frame_200ms, DRV_UDP_200MS_FRAME_SIZE);
-    printf("====================================================\n");
+    debug_trace_record(DEBUG_TRACE_MUX_ENCODE, mux_frame_200ms, DRV_UDP_200MS_FRAME_SIZE);
 #endif
 }
 
-void mux_print_raw(const uint8_t *frame, const size_t length)
+timestamp_t mux_get_decoded_timestamp(void)
 {
-    printf("MUX [ ");
-    for (size_t i = 0; i < length; i++)
-    {
-        printf("%02X ", frame[i]);
-    }
-    printf("]\n");
+    return mux_decoded_timestamp;
 }
 
-void mux_print_decoded(void)
+const uint8_t *mux_get_frame_100ms(void)
 {
-    frame_number_t frame_number = get_frame_number();
-    distance_t distance = get_distance();
-    speed_t speed = get_speed();
-    issues_t chassis_issues = get_chassis_issues();
-    issues_t motor_issues = get_motor_issues();
-    fuel_level_t fuel_level = get_fuel_level();
-    engine_rpm_t engine_rpm = get_engine_rpm();
-    issues_t battery_issues = get_battery_issues();
-    crc8_t crc8 = get_crc8();
+    return mux_frame_100ms;
+}
 
-    printf("Frame number: %u\n", frame_number);
-    printf("Distance: %u km\n", distance);
-    printf("Speed: %u km/h\n", speed);
-    printf("Chassis issues: ");
-    if (chassis_issues == CHASSIS_ISSUE_NONE)
-    {
-        printf("None");
-    }
-    else
-    {
-        if (chassis_issues & CHASSIS_ISSUE_TYRES_PRESSION)
-        {
-            printf("Tyres ");
-        }
-        if (chassis_issues & CHASSIS_ISSUE_BRAKES)
-        {
-            printf("Brakes ");
-        }
-    }
-    printf("\n");
-    printf("Motor issues: ");
-    if (motor_issues == MOTOR_ISSUE_NONE)
-    {
-        printf("None");
-    }
-    else
-    {
-        if (motor_issues & MOTOR_ISSUE_PRESSION)
-        {
-            printf("Pression ");
-        }
-        if (motor_issues & MOTOR_ISSUE_TEMPERATURE_LDR)
-        {
-            printf("Temperature LDR ");
-        }
-        if (motor_issues & MOTOR_ISSUE_OIL_OVERHEAT)
-        {
-            printf("Oil Overheating ");
-        }
-    }
-    printf("\n");
-    printf("Fuel level: %u\n", fuel_level);
-    printf("Engine RPM: %u\n", engine_rpm);
-    printf("Battery issues: ");
-    if (battery_issues == BATTERY_ISSUES_NONE)
-    {
-        printf("None");
-    }
-    else
-    {
-        if (battery_issues & BATTERY_ISSUES_DISCHARGED)
-        {
-            printf("Discharged ");
-        }
-        if (battery_issues & BATTERY_ISSUES_KO)
-        {
-            printf("KO ");
-        }
-    }
-    printf("\n");
-    printf("CRC8: %02X\n", crc8);
-}
\ No newline at end of file
+timestamp_t mux_get_frame_100ms_timestamp(void)
+{
+    return mux_frame_100ms_timestamp;
+}
+
+const uint8_t *mux_get_frame_200ms(void)
+{
+    return mux_frame_200ms;
+}
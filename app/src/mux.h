@@ -12,6 +12,7 @@
 
 #include "drv_api.h"
 #include "bcgv_api.h"
+#include "timestamp.h"
 
 /***** Functions *************************************************************/
 
@@ -41,6 +42,19 @@ void mux_check_frame_number(void);
  */
 void mux_incr_frame_number(void);
 
+/**
+ * \brief Get the frame number expected in the next frame, for a warm restart.
+ * \return frame_number_t : Expected frame number
+ */
+frame_number_t mux_get_expected_frame_number(void);
+
+/**
+ * \brief Set the frame number expected in the next frame, when resuming from a warm restart.
+ * \param frame_number : Expected frame number, ignored if out of range
+ * \return bool : true if set, false otherwise
+ */
+bool mux_set_expected_frame_number(frame_number_t frame_number);
+
 /**
  * \brief Decode MUX 100ms UDP frame and update application data.
  * \details Frame format (15 bytes, Big endian):
@@ -63,15 +77,28 @@ bool mux_decode_frame_100ms(void);
 void mux_encode_frame_200ms(void);
 
 /**
- * \brief Print raw bytes of a MUX frame.
- * \param frame : Pointer to the MUX frame buffer
- * \param length : Number of bytes in MUX frame
+ * \brief Get the reception time of the MUX data currently stored in app context.
+ * \details Updated each time a MUX 100ms frame is successfully decoded.
+ * \return timestamp_t : Reception time of the frame, TIMESTAMP_NONE if no frame decoded yet
+ */
+timestamp_t mux_get_decoded_timestamp(void);
+
+/**
+ * \brief Get the last read MUX 100ms frame.
+ * \return const uint8_t* : Pointer to the frame (DRV_UDP_100MS_FRAME_SIZE bytes)
+ */
+const uint8_t *mux_get_frame_100ms(void);
+
+/**
+ * \brief Get the reception time of the last read MUX 100ms frame.
+ * \return timestamp_t : Reception time of the frame, TIMESTAMP_NONE if no frame read yet
  */
-void mux_print_raw(const uint8_t *frame, const size_t length);
+timestamp_t mux_get_frame_100ms_timestamp(void);
 
 /**
- * \brief Print decoded data extracted from MUX 100ms UDP frame.
+ * \brief Get the last encoded MUX 200ms frame.
+ * \return const uint8_t* : Pointer to the frame (DRV_UDP_200MS_FRAME_SIZE bytes)
  */
-void mux_print_decoded(void);
+const uint8_t *mux_get_frame_200ms(void);
 
 #endif /* MUX_H */
\ No newline at end of file
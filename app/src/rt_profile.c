@@ -0,0 +1,323 @@
+/**
+ * \file rt_profile.c
+ * \brief Implementation of real-time execution profile.
+ * \details Prepare the calling thread for the control loop: lock and prefault memory, pin it to a CPU,
+ *          raise it to SCHED_FIFO and pre-touch its stack. Each step is checked and reported through the logger.
+ * \author Raphael CAUSSE
+ */
+
+/***** Includes **************************************************************/
+
+#define _GNU_SOURCE /* CPU affinity */
+
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <unistd.h>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+#include "rt_profile.h"
+#include "log.h"
+
+/***** Static Variables ******************************************************/
+
+static cpu_set_t rt_profile_helper_cpus;        /* CPUs left to helper threads by the control loop pinning */
+static bool rt_profile_helper_pinned = false;   /* Helper threads affinity to set */
+
+/***** Static Functions ******************************************************/
+
+/**
+ * \brief Get the number of page faults of the process.
+ * \return long : Minor and major page faults
+ */
+static long rt_profile_page_faults(void)
+{
+    struct rusage usage;
+
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+    {
+        return 0;
+    }
+
+    return usage.ru_minflt + usage.ru_majflt;
+}
+
+/**
+ * \brief Lock current and future memory in RAM.
+ * \return bool : true on success
+ */
+static bool rt_profile_lock_memory(void)
+{
+    if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0)
+    {
+        log_error("mlockall failed: %s", strerror(errno));
+        return false;
+    }
+    log_info("memory locked", NULL);
+
+    return true;
+}
+
+/**
+ * \brief Prefault heap memory and keep it in the allocator.
+ * \param size : Heap size (bytes)
+ * \return bool : true on success
+ */
+static bool rt_profile_prefault_heap(size_t size)
+{
+    long page_size = sysconf(_SC_PAGESIZE);
+    long faults = rt_profile_page_faults();
+    volatile char *heap = NULL;
+
+#ifdef __GLIBC__
+    /* Freed memory must stay in the process instead of being trimmed or unmapped */
+    if ((mallopt(M_TRIM_THRESHOLD, -1) == 0) || (mallopt(M_MMAP_MAX, 0) == 0))
+    {
+        log_error("mallopt failed", NULL);
+        return false;
+    }
+#endif
+
+    heap = malloc(size);
+    if (heap == NULL)
+    {
+        log_error("heap prefault allocation failed (%lu bytes)", (unsigned long)size);
+        return false;
+    }
+    for (size_t i = 0; i < size; i += (size_t)page_size)
+    {
+        heap[i] = 0;
+    }
+    free((void *)heap);
+    log_info("heap prefaulted: %lu bytes, %ld page faults", (unsigned long)size, rt_profile_page_faults() - faults);
+
+    return true;
+}
+
+/**
+ * \brief Pre-touch the stack of the calling thread.
+ * \details Not inlined so that the touched area lies below the caller frames.
+ * \param size : Stack size (bytes)
+ * \return bool : true on success
+ */
+static __attribute__((noinline)) bool rt_profile_prefault_stack(size_t size)
+{
+    long page_size = sysconf(_SC_PAGESIZE);
+    long faults = rt_profile_page_faults();
+    struct rlimit limit;
+    volatile char *stack = NULL;
+
+    if ((getrlimit(RLIMIT_STACK, &limit) == 0) && (limit.rlim_cur != RLIM_INFINITY) && (size >= limit.rlim_cur / 2))
+    {
+        log_error("stack prefault size too large: %lu bytes (limit %lu)", (unsigned long)size, (unsigned long)limit.rlim_cur);
+        return false;
+    }
+
+    /* Variable length array on the stack, touched one page at a time */
+    {
+        char area[size];
+
+        stack = area;
+        for (size_t i = 0; i < size; i += (size_t)page_size)
+        {
+            stack[i] = 0;
+        }
+        stack[size - 1] = 0;
+    }
+    log_info("stack prefaulted: %lu bytes, %ld page faults", (unsigned long)size, rt_profile_page_faults() - faults);
+
+    return true;
+}
+
+/**
+ * \brief Pin the calling thread to a CPU and check the resulting affinity.
+ * \param cpu : CPU index
+ * \return bool : true on success
+ */
+static bool rt_profile_pin_cpu(int32_t cpu)
+{
+    cpu_set_t set;
+    int ret = 0;
+
+    if ((cpu < 0) || (cpu >= CPU_SETSIZE))
+    {
+        log_error("invalid CPU: %d", cpu);
+        return false;
+    }
+
+    /* Helper threads keep the other CPUs of the current affinity, if any */
+    CPU_ZERO(&set);
+    if (pthread_getaffinity_np(pthread_self(), sizeof(set), &set) == 0)
+    {
+        CPU_CLR(cpu, &set);
+        if (CPU_COUNT(&set) > 0)
+        {
+            rt_profile_helper_cpus = set;
+            rt_profile_helper_pinned = true;
+        }
+    }
+
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    ret = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    if (ret != 0)
+    {
+        log_error("CPU pinning failed: %s", strerror(ret));
+        return false;
+    }
+
+    CPU_ZERO(&set);
+    ret = pthread_getaffinity_np(pthread_self(), sizeof(set), &set);
+    if ((ret != 0) || (CPU_COUNT(&set) != 1) || (CPU_ISSET(cpu, &set) == 0))
+    {
+        log_error("CPU pinning not effective", NULL);
+        return false;
+    }
+    log_info("pinned to CPU %d", cpu);
+
+    return true;
+}
+
+/**
+ * \brief Set SCHED_FIFO policy to the calling thread and check the resulting policy.
+ * \param priority : SCHED_FIFO priority
+ * \return bool : true on success
+ */
+static bool rt_profile_set_fifo(int32_t priority)
+{
+    struct sched_param param;
+    int policy = 0;
+    int ret = 0;
+
+    if ((priority < sched_get_priority_min(SCHED_FIFO)) || (priority > sched_get_priority_max(SCHED_FIFO)))
+    {
+        log_error("invalid SCHED_FIFO priority: %d", priority);
+        return false;
+    }
+
+    memset(&param, 0, sizeof(param));
+    param.sched_priority = priority;
+    ret = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+    if (ret != 0)
+    {
+        log_error("SCHED_FIFO failed: %s", strerror(ret));
+        return false;
+    }
+
+    ret = pthread_getschedparam(pthread_self(), &policy, &param);
+    if ((ret != 0) || (policy != SCHED_FIFO) || (param.sched_priority != priority))
+    {
+        log_error("SCHED_FIFO not effective", NULL);
+        return false;
+    }
+    log_info("SCHED_FIFO priority %d", priority);
+
+    return true;
+}
+
+/***** Functions *************************************************************/
+
+void rt_profile_default(rt_profile_config_t *config)
+{
+    config->cpu = RT_PROFILE_CPU_NONE;
+    config->priority = RT_PROFILE_DEFAULT_PRIORITY;
+    config->heap_size = RT_PROFILE_DEFAULT_HEAP_SIZE;
+    config->stack_size = RT_PROFILE_DEFAULT_STACK_SIZE;
+}
+
+bool rt_profile_apply(const rt_profile_config_t *config)
+{
+    bool success = true;
+
+    /* Memory first: pages touched afterwards are locked as soon as they are mapped */
+    success &= rt_profile_lock_memory();
+    if (config->heap_size > 0)
+    {
+        success &= rt_profile_prefault_heap(config->heap_size);
+    }
+    if (config->stack_size > 0)
+    {
+        success &= rt_profile_prefault_stack(config->stack_size);
+    }
+
+    if (config->cpu != RT_PROFILE_CPU_NONE)
+    {
+        success &= rt_profile_pin_cpu(config->cpu);
+    }
+    if (config->priority > 0)
+    {
+        success &= rt_profile_set_fifo(config->priority);
+    }
+
+    if (success == true)
+    {
+        log_info("real-time profile applied", NULL);
+    }
+    else
+    {
+        log_warn("real-time profile partially applied", NULL);
+    }
+
+    return success;
+}
+
+int rt_profile_helper_attr_init(pthread_attr_t *attr)
+{
+    struct sched_param param;
+    int ret = 0;
+
+    ret = pthread_attr_init(attr);
+    if (ret != 0)
+    {
+        return ret;
+    }
+
+    /* Explicit time-sharing policy, whatever the policy of the creating thread */
+    memset(&param, 0, sizeof(param));
+    ret = pthread_attr_setinheritsched(attr, PTHREAD_EXPLICIT_SCHED);
+    if (ret == 0)
+    {
+        ret = pthread_attr_setschedpolicy(attr, SCHED_OTHER);
+    }
+    if (ret == 0)
+    {
+        ret = pthread_attr_setschedparam(attr, &param);
+    }
+    if ((ret == 0) && (rt_profile_helper_pinned == true))
+    {
+        ret = pthread_attr_setaffinity_np(attr, sizeof(rt_profile_helper_cpus), &rt_profile_helper_cpus);
+    }
+    if (ret != 0)
+    {
+        pthread_attr_destroy(attr);
+    }
+
+    return ret;
+}
+
+int rt_profile_mutex_init(pthread_mutex_t *mutex)
+{
+    pthread_mutexattr_t attr;
+    int ret = 0;
+
+    ret = pthread_mutexattr_init(&attr);
+    if (ret != 0)
+    {
+        return ret;
+    }
+
+    /* A helper thread holding the mutex runs at the priority of the control loop waiting for it */
+    ret = pthread_mutexattr_setprotocol(&attr, PTHREAD_PRIO_INHERIT);
+    if (ret == 0)
+    {
+        ret = pthread_mutex_init(mutex, &attr);
+    }
+    pthread_mutexattr_destroy(&attr);
+
+    return ret;
+}
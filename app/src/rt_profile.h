@@ -0,0 +1,71 @@
+/**
+ * \file rt_profile.h
+ * \brief Interface of real-time execution profile.
+ * \details Prepare the calling thread for the control loop: lock and prefault memory, pin it to a CPU,
+ *          raise it to SCHED_FIFO and pre-touch its stack. Each step is checked and reported through the logger.
+ * \author Raphael CAUSSE
+ */
+
+#ifndef RT_PROFILE_H
+#define RT_PROFILE_H
+
+/***** Includes **************************************************************/
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/***** Definitions ***********************************************************/
+
+#define RT_PROFILE_CPU_NONE (-1)                  /* Do not pin */
+#define RT_PROFILE_DEFAULT_PRIORITY (50)          /* SCHED_FIFO priority */
+#define RT_PROFILE_DEFAULT_HEAP_SIZE (1024 * 1024) /* Heap prefaulted and kept by the allocator */
+#define RT_PROFILE_DEFAULT_STACK_SIZE (256 * 1024) /* Stack pre-touched */
+
+/* Real-time profile configuration */
+typedef struct
+{
+    int32_t cpu;       /* CPU to pin the thread to, RT_PROFILE_CPU_NONE to keep current affinity */
+    int32_t priority;  /* SCHED_FIFO priority, 0 to keep current policy */
+    size_t heap_size;  /* Heap size to prefault (bytes) */
+    size_t stack_size; /* Stack size to pre-touch (bytes) */
+} rt_profile_config_t;
+
+/***** Functions *************************************************************/
+
+/**
+ * \brief Get the default real-time profile configuration.
+ * \param config : Output configuration
+ */
+void rt_profile_default(rt_profile_config_t *config);
+
+/**
+ * \brief Apply the real-time profile to the calling thread.
+ * \details Threads created afterwards inherit CPU affinity and scheduling policy, except helper threads
+ *          created with rt_profile_helper_attr_init() attributes. All steps are attempted even if one fails.
+ * \param config : Real-time profile configuration
+ * \return bool : true if every step succeeded, false otherwise
+ */
+bool rt_profile_apply(const rt_profile_config_t *config);
+
+/**
+ * \brief Initialize the attributes of a helper thread (telemetry, MQTT, dumps), which must not compete
+ *        with the control loop.
+ * \details The thread runs under SCHED_OTHER whatever the policy of its creator and, if the control loop
+ *          is pinned, on the other CPUs. Attributes are to be destroyed by the caller after creation.
+ * \param attr : Output thread attributes
+ * \return int : 0 on success, error number otherwise (attributes not initialized)
+ */
+int rt_profile_helper_attr_init(pthread_attr_t *attr);
+
+/**
+ * \brief Initialize a mutex shared by the control loop and a helper thread, with priority inheritance.
+ * \details A helper thread preempted while holding the mutex cannot delay the control loop beyond its own
+ *          critical section. The mutex is to be destroyed by the caller.
+ * \param mutex : Output mutex
+ * \return int : 0 on success, error number otherwise (mutex not initialized)
+ */
+int rt_profile_mutex_init(pthread_mutex_t *mutex);
+
+#endif /* RT_PROFILE_H */
@@ -1,14 +1,175 @@
 /**
  * \file serial.c
- * \brief
+ * \brief Implementation of serial reception.
+ * \details Read serial frames from driver and dispatch them to BGF and COMODO systems,
+ *          either from the main loop or from a dedicated reception thread.
  * \author Raphael CAUSSE
  */
 
 /***** Includes **************************************************************/
 
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+#include <time.h>
 #include "serial.h"
+#include "bgf.h"
+#include "comodo.h"
+#include "ctx_lock.h"
+#include "fsm_lights.h"
+#include "fsm_indicators.h"
+#include "log.h"
+#include "timestamp.h"
+#include "trace_rec.h"
+#include "probe.h"
 
 /***** Extern Variables ******************************************************/
 
 serial_frame_t serial_buffer_read[DRV_MAX_FRAMES] = {0};
-serial_frame_t serial_buffer_write[DRV_MAX_FRAMES] = {0};
\ No newline at end of file
+serial_frame_t serial_buffer_write[DRV_MAX_FRAMES] = {0};
+
+/***** Static Variables ******************************************************/
+
+static pthread_t serial_rx_thread;
+static volatile bool serial_rx_running = false;
+static int32_t serial_rx_drv_fd = 0;
+static bool serial_rx_kick_fsm = false;
+
+/* Reception thread owns its own buffer, serial_buffer_read stays for the main loop */
+static serial_frame_t serial_rx_buffer[DRV_MAX_FRAMES];
+
+/***** Static Functions ******************************************************/
+
+/**
+ * \brief Dispatch received frames to BGF and COMODO systems.
+ * \details Must be called with the context lock held.
+ * \param frames : Received frames
+ * \param count : Number of received frames
+ * \param rx_timestamp : Reception time of the frames
+ * \return int32_t : Number of acknowledgements received
+ */
+static int32_t serial_dispatch(const serial_frame_t *frames, uint32_t count, timestamp_t rx_timestamp)
+{
+    int32_t acks = 0;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        if (bgf_handle_frame(&frames[i], rx_timestamp) == true)
+        {
+            acks++;
+        }
+        comodo_handle_frame(&frames[i], rx_timestamp);
+        PROBE3(serial_read, frames[i].serNum, frames[i].frameSize, frames[i].frame[0]);
+        trace_rec_serial(&frames[i]);
+    }
+
+    return acks;
+}
+
+/**
+ * \brief Serial reception thread main function.
+ * \param arg : Unused
+ * \return void* : Unused
+ */
+static void *serial_rx_thread_main(void *arg)
+{
+    int32_t ret = 0;
+    int32_t acks = 0;
+    uint32_t serial_data_len = 0;
+    const struct timespec poll_period = {0, SERIAL_RX_POLL_PERIOD_US * 1000L};
+
+    (void)arg;
+    while (serial_rx_running == true)
+    {
+        ret = drv_read_ser(serial_rx_drv_fd, serial_rx_buffer, &serial_data_len);
+        if (ret == DRV_ERROR)
+        {
+            log_error("error while reading from driver", NULL);
+        }
+        else if (serial_data_len > 0)
+        {
+            ctx_lock();
+            acks = serial_dispatch(serial_rx_buffer, serial_data_len, timestamp_now());
+            if ((acks > 0) && (serial_rx_kick_fsm == true))
+            {
+                fsm_lights_kick();
+                fsm_indicators_kick();
+                bgf_ack_latency_update();
+            }
+            ctx_unlock();
+        }
+
+        /* Retransmit unacknowledged messages without waiting next cycle */
+        ctx_lock();
+        bgf_retry_frames(serial_rx_drv_fd);
+        ctx_unlock();
+
+        nanosleep(&poll_period, NULL);
+    }
+
+    return NULL;
+}
+
+/***** Functions *************************************************************/
+
+int32_t serial_read_frames(int32_t drv_fd)
+{
+    int32_t ret = 0;
+    int32_t count = 0;
+    uint32_t serial_data_len = 0;
+
+    if (serial_rx_running == true)
+    {
+        return 0;
+    }
+
+    /* Pull all available frames */
+    do
+    {
+        ret = drv_read_ser(drv_fd, serial_buffer_read, &serial_data_len);
+        if (ret == DRV_ERROR)
+        {
+            log_error("error while reading from driver", NULL);
+            return DRV_ERROR;
+        }
+
+        serial_dispatch(serial_buffer_read, serial_data_len, timestamp_now());
+        count += serial_data_len;
+    } while (serial_data_len > 0);
+
+    return count;
+}
+
+bool serial_rx_start(int32_t drv_fd, bool kick_fsm)
+{
+    int ret = 0;
+
+    if (serial_rx_running == true)
+    {
+        return true;
+    }
+
+    serial_rx_drv_fd = drv_fd;
+    serial_rx_kick_fsm = kick_fsm;
+    serial_rx_running = true;
+
+    /* Default attributes: unlike helper threads, reception inherits the real-time profile of the control loop */
+    ret = pthread_create(&serial_rx_thread, NULL, &serial_rx_thread_main, NULL);
+    if (ret != 0)
+    {
+        log_error("error while creating serial reception thread (%d)", ret);
+        serial_rx_running = false;
+        return false;
+    }
+
+    return true;
+}
+
+void serial_rx_stop(void)
+{
+    if (serial_rx_running == true)
+    {
+        serial_rx_running = false;
+        pthread_join(serial_rx_thread, NULL);
+    }
+}
@@ -1,6 +1,8 @@
 /**
  * \file serial.h
- * \brief
+ * \brief Interface of serial reception.
+ * \details Read serial frames from driver and dispatch them to BGF and COMODO systems,
+ *          either from the main loop or from a dedicated reception thread.
  * \author Raphael CAUSSE
  */
 
@@ -9,11 +11,42 @@
 
 /***** Includes **************************************************************/
 
+#include <stdbool.h>
 #include "drv_api.h"
 
+/***** Definitions ***********************************************************/
+
+#define SERIAL_RX_POLL_PERIOD_US (1000) /* Reception thread polling period */
+
 /***** Extern Variables ******************************************************/
 
 extern serial_frame_t serial_buffer_read[DRV_MAX_FRAMES];
 extern serial_frame_t serial_buffer_write[DRV_MAX_FRAMES];
 
-#endif /* SERIAL_H */
\ No newline at end of file
+/***** Functions *************************************************************/
+
+/**
+ * \brief Read all available serial frames and dispatch them to BGF and COMODO.
+ * \details Does nothing when the reception thread is running.
+ * \param drv_fd : Driver file descriptor
+ * \return int32_t : Number of frames read, or DRV_ERROR if an error occured
+ */
+int32_t serial_read_frames(int32_t drv_fd);
+
+/**
+ * \brief Start the serial reception thread.
+ * \details Frames are read and dispatched as soon as they arrive, under the context lock.
+ *          If kick_fsm is set, the lights and indicators FSMs are evaluated right after
+ *          an acknowledgement is received, without advancing their timers.
+ * \param drv_fd : Driver file descriptor
+ * \param kick_fsm : Evaluate FSMs immediately on acknowledgement
+ * \return bool : true if the thread is started, false otherwise
+ */
+bool serial_rx_start(int32_t drv_fd, bool kick_fsm);
+
+/**
+ * \brief Stop the serial reception thread and wait for its termination.
+ */
+void serial_rx_stop(void);
+
+#endif /* SERIAL_H */
@@ -0,0 +1,402 @@
+/**
+ * \file telemetry.c
+ * \brief Implementation of telemetry exporter.
+ * \details Sample application context and runtime counters from the main loop and send them
+ *          as Influx line protocol over UDP (telegraf socket listener), from a dedicated thread.
+ *          Samples are queued in a bounded queue and batched, several samples per datagram.
+ * \author Raphael CAUSSE
+ */
+
+/***** Includes **************************************************************/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+#include "telemetry.h"
+#include "drv_api.h"
+#include "bcgv_api.h"
+#include "bgf.h"
+#include "metrics.h"
+#include "mux.h"
+#include "log.h"
+#include "rt_profile.h"
+
+/***** Definitions ***********************************************************/
+
+#define TELEMETRY_LINE_SIZE (768) /* Maximum size of the lines of one sample */
+
+/* One sample of context and runtime counters */
+typedef struct
+{
+    int64_t time_ns; /* Wall clock time, as expected by Influx */
+    distance_t distance;
+    speed_t speed;
+    uint8_t fuel_percent;
+    engine_rpm_t engine_rpm;
+    flag_t flag_position_light;
+    flag_t flag_crossing_light;
+    flag_t flag_highbeam_light;
+    flag_t flag_indic_right;
+    flag_t flag_indic_left;
+    uint8_t warnings[2]; /* Warning lights bytes of MUX 200ms frame */
+    timestamp_t cycle_duration;
+    uint32_t bgf_sent;
+    uint32_t bgf_retries;
+    uint32_t bgf_acked;
+    uint32_t bgf_expired;
+} telemetry_sample_t;
+
+/***** Static Variables ******************************************************/
+
+static telemetry_config_t telemetry_config;
+static int telemetry_socket = -1;
+static struct sockaddr_in telemetry_addr;
+
+static pthread_t telemetry_thread;
+static pthread_mutex_t telemetry_mutex; /* Priority inheritance, locked by the main loop every cycle */
+static pthread_cond_t telemetry_cond;
+static volatile bool telemetry_running = false;
+
+/* Bounded queue, shared with the main loop */
+static telemetry_sample_t telemetry_queue[TELEMETRY_QUEUE_SIZE];
+static uint32_t telemetry_queue_head = 0;
+static uint32_t telemetry_queue_count = 0;
+static telemetry_stats_t telemetry_stats;
+
+/* Owned by the telemetry thread */
+static telemetry_sample_t telemetry_batch[TELEMETRY_MAX_BATCH];
+static char telemetry_datagram[TELEMETRY_DATAGRAM_SIZE];
+static bool telemetry_send_failing = false;
+
+/***** Static Functions ******************************************************/
+
+/**
+ * \brief Format one sample as Influx line protocol.
+ * \param sample : Sample to format
+ * \param line : Output buffer
+ * \param size : Output buffer size
+ * \return int : Number of characters written, negative or >= size if truncated
+ */
+static int telemetry_format(const telemetry_sample_t *sample, char *line, size_t size)
+{
+    const uint8_t w0 = sample->warnings[0];
+    const uint8_t w1 = sample->warnings[1];
+
+    /* Field names follow the Grafana dashboard of the archive */
+    return snprintf(line, size,
+                    "bcgv speed=%ui,km=%lui,fuel=%ui,engine_speed=%lui,"
+                    "feu_pos=%ui,feu_crois=%ui,feu_route=%ui,feu_clign_d=%ui,feu_clign_g=%ui,"
+                    "voy_pos=%ui,voy_crois=%ui,voy_route=%ui,voy_ess=%ui,voy_def_mot=%ui,voy_press_pneu=%ui,"
+                    "voy_bat_dech=%ui,voy_warn=%ui,voy_bat_hs=%ui,voy_LDR=%ui,voy_press_mot=%ui,voy_sur_huile=%ui,"
+                    "voy_freins=%ui,voy_ess_glaces=%ui,voy_lav_glaces=%ui %lld\n"
+                    "bcgv_runtime cycle_duration_ns=%llui,bgf_sent=%ui,bgf_retries=%ui,bgf_acked=%ui,bgf_expired=%ui %lld\n",
+                    (unsigned)sample->speed, (unsigned long)sample->distance, (unsigned)sample->fuel_percent,
+                    (unsigned long)sample->engine_rpm,
+                    (unsigned)sample->flag_position_light, (unsigned)sample->flag_crossing_light,
+                    (unsigned)sample->flag_highbeam_light, (unsigned)sample->flag_indic_right,
+                    (unsigned)sample->flag_indic_left,
+                    (w0 >> 7) & 1U, (w0 >> 6) & 1U, (w0 >> 5) & 1U, (w0 >> 4) & 1U, (w0 >> 3) & 1U, (w0 >> 2) & 1U,
+                    w0 & 1U, (w1 >> 7) & 1U, (w1 >> 6) & 1U, (w1 >> 5) & 1U, (w1 >> 4) & 1U, (w1 >> 3) & 1U,
+                    (w1 >> 2) & 1U, (w1 >> 1) & 1U, w1 & 1U, (long long)sample->time_ns,
+                    (unsigned long long)sample->cycle_duration, sample->bgf_sent, sample->bgf_retries,
+                    sample->bgf_acked, sample->bgf_expired, (long long)sample->time_ns);
+}
+
+/**
+ * \brief Send a datagram without blocking.
+ * \param length : Datagram length
+ * \param samples : Number of samples in datagram
+ */
+static void telemetry_send(size_t length, uint32_t samples)
+{
+    ssize_t ret = sendto(telemetry_socket, telemetry_datagram, length, MSG_DONTWAIT,
+                         (const struct sockaddr *)&telemetry_addr, sizeof(telemetry_addr));
+
+    pthread_mutex_lock(&telemetry_mutex);
+    if (ret == (ssize_t)length)
+    {
+        telemetry_stats.sent += samples;
+        telemetry_stats.datagrams++;
+    }
+    else
+    {
+        telemetry_stats.send_errors += samples;
+    }
+    pthread_mutex_unlock(&telemetry_mutex);
+
+    /* Report only the first failure of a series */
+    if ((ret != (ssize_t)length) && (telemetry_send_failing == false))
+    {
+        log_warn("telemetry datagram not sent: %s", (ret < 0) ? strerror(errno) : "truncated");
+    }
+    telemetry_send_failing = (ret != (ssize_t)length);
+}
+
+/**
+ * \brief Format and send a batch of samples, splitting datagrams that would overflow.
+ * \param count : Number of samples in telemetry_batch
+ */
+static void telemetry_send_batch(uint32_t count)
+{
+    char line[TELEMETRY_LINE_SIZE];
+    size_t length = 0;
+    uint32_t samples = 0;
+    int ret = 0;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        ret = telemetry_format(&telemetry_batch[i], line, sizeof(line));
+        if ((ret < 0) || ((size_t)ret >= sizeof(line)))
+        {
+            continue;
+        }
+        if (length + (size_t)ret > sizeof(telemetry_datagram))
+        {
+            telemetry_send(length, samples);
+            length = 0;
+            samples = 0;
+        }
+        memcpy(&telemetry_datagram[length], line, (size_t)ret);
+        length += (size_t)ret;
+        samples++;
+    }
+    if (samples > 0)
+    {
+        telemetry_send(length, samples);
+    }
+}
+
+/**
+ * \brief Telemetry thread main function.
+ * \param arg : Unused
+ * \return void* : Unused
+ */
+static void *telemetry_thread_main(void *arg)
+{
+    struct timespec deadline;
+    uint32_t count = 0;
+    bool running = true;
+
+    (void)arg;
+    while (running == true)
+    {
+        clock_gettime(CLOCK_MONOTONIC, &deadline);
+        deadline.tv_sec += TELEMETRY_FLUSH_PERIOD_MS / 1000;
+        deadline.tv_nsec += (TELEMETRY_FLUSH_PERIOD_MS % 1000) * 1000000L;
+        if (deadline.tv_nsec >= 1000000000L)
+        {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000L;
+        }
+
+        /* Wait for a full batch, flush incomplete batches periodically */
+        pthread_mutex_lock(&telemetry_mutex);
+        while ((telemetry_running == true) && (telemetry_queue_count < telemetry_config.batch))
+        {
+            if (pthread_cond_timedwait(&telemetry_cond, &telemetry_mutex, &deadline) == ETIMEDOUT)
+            {
+                break;
+            }
+        }
+        running = telemetry_running || (telemetry_queue_count > 0);
+
+        count = 0;
+        while ((count < telemetry_config.batch) && (telemetry_queue_count > 0))
+        {
+            telemetry_batch[count++] = telemetry_queue[telemetry_queue_head];
+            telemetry_queue_head = (telemetry_queue_head + 1) % TELEMETRY_QUEUE_SIZE;
+            telemetry_queue_count--;
+        }
+        pthread_mutex_unlock(&telemetry_mutex);
+
+        telemetry_send_batch(count);
+    }
+
+    return NULL;
+}
+
+/***** Functions *************************************************************/
+
+void telemetry_default(telemetry_config_t *config)
+{
+    config->host = TELEMETRY_DEFAULT_HOST;
+    config->port = TELEMETRY_DEFAULT_PORT;
+    config->batch = TELEMETRY_DEFAULT_BATCH;
+    config->drop_policy = TELEMETRY_DROP_OLDEST;
+}
+
+bool telemetry_start(const telemetry_config_t *config)
+{
+    pthread_condattr_t attr;
+    pthread_attr_t thread_attr;
+    int ret = 0;
+
+    if (telemetry_running == true)
+    {
+        return true;
+    }
+    if ((config->batch == 0) || (config->batch > TELEMETRY_MAX_BATCH))
+    {
+        log_error("invalid telemetry batch size: %u (1 to %u)", config->batch, TELEMETRY_MAX_BATCH);
+        return false;
+    }
+
+    memset(&telemetry_addr, 0, sizeof(telemetry_addr));
+    telemetry_addr.sin_family = AF_INET;
+    telemetry_addr.sin_port = htons(config->port);
+    if (inet_pton(AF_INET, config->host, &telemetry_addr.sin_addr) != 1)
+    {
+        log_error("invalid telemetry address: %s", config->host);
+        return false;
+    }
+
+    telemetry_socket = socket(AF_INET, SOCK_DGRAM, 0);
+    if ((telemetry_socket < 0) || (fcntl(telemetry_socket, F_SETFL, O_NONBLOCK) != 0))
+    {
+        log_error("error while opening telemetry socket: %s", strerror(errno));
+        if (telemetry_socket >= 0)
+        {
+            close(telemetry_socket);
+            telemetry_socket = -1;
+        }
+        return false;
+    }
+
+    telemetry_config = *config;
+    telemetry_queue_head = 0;
+    telemetry_queue_count = 0;
+    memset(&telemetry_stats, 0, sizeof(telemetry_stats));
+    telemetry_send_failing = false;
+
+    ret = rt_profile_mutex_init(&telemetry_mutex);
+    if (ret != 0)
+    {
+        log_error("error while creating telemetry mutex (%d)", ret);
+        close(telemetry_socket);
+        telemetry_socket = -1;
+        return false;
+    }
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&telemetry_cond, &attr);
+    pthread_condattr_destroy(&attr);
+
+    telemetry_running = true;
+    ret = rt_profile_helper_attr_init(&thread_attr);
+    if (ret == 0)
+    {
+        ret = pthread_create(&telemetry_thread, &thread_attr, &telemetry_thread_main, NULL);
+        pthread_attr_destroy(&thread_attr);
+    }
+    if (ret != 0)
+    {
+        log_error("error while creating telemetry thread (%d)", ret);
+        telemetry_running = false;
+        pthread_cond_destroy(&telemetry_cond);
+        pthread_mutex_destroy(&telemetry_mutex);
+        close(telemetry_socket);
+        telemetry_socket = -1;
+        return false;
+    }
+
+    return true;
+}
+
+void telemetry_stop(void)
+{
+    if (telemetry_running == true)
+    {
+        pthread_mutex_lock(&telemetry_mutex);
+        telemetry_running = false;
+        pthread_cond_signal(&telemetry_cond);
+        pthread_mutex_unlock(&telemetry_mutex);
+
+        pthread_join(telemetry_thread, NULL);
+        pthread_cond_destroy(&telemetry_cond);
+        pthread_mutex_destroy(&telemetry_mutex);
+        close(telemetry_socket);
+        telemetry_socket = -1;
+    }
+}
+
+void telemetry_sample(void)
+{
+    telemetry_sample_t sample;
+    struct timespec now;
+    metric_stat_t cycle_stat;
+    bgf_msg_stats_t bgf_stats;
+    const uint8_t *mux_frame = NULL;
+    uint32_t tail = 0;
+
+    if (telemetry_running == false)
+    {
+        return;
+    }
+
+    /* Raw values only, formatting is done by the telemetry thread */
+    memset(&sample, 0, sizeof(sample));
+    clock_gettime(CLOCK_REALTIME, &now);
+    sample.time_ns = (int64_t)now.tv_sec * 1000000000LL + now.tv_nsec;
+    mux_frame = mux_get_frame_200ms();
+    sample.distance = get_distance();
+    sample.speed = get_speed();
+    sample.fuel_percent = mux_frame[7];
+    sample.engine_rpm = get_engine_rpm();
+    sample.flag_position_light = get_flag_position_light();
+    sample.flag_crossing_light = get_flag_crossing_light();
+    sample.flag_highbeam_light = get_flag_highbeam_light();
+    sample.flag_indic_right = get_flag_indic_right();
+    sample.flag_indic_left = get_flag_indic_left();
+    sample.warnings[0] = mux_frame[0];
+    sample.warnings[1] = mux_frame[1];
+    metrics_get(METRIC_CYCLE_DURATION, &cycle_stat);
+    sample.cycle_duration = cycle_stat.last;
+    for (uint8_t id = 1; id <= BGF_NUM_MSG; id++)
+    {
+        bgf_get_msg_stats(id, &bgf_stats);
+        sample.bgf_sent += bgf_stats.sent;
+        sample.bgf_retries += bgf_stats.retries;
+        sample.bgf_acked += bgf_stats.acked;
+        sample.bgf_expired += bgf_stats.expired;
+    }
+
+    /* Queue sample according to drop policy */
+    pthread_mutex_lock(&telemetry_mutex);
+    telemetry_stats.sampled++;
+    if (telemetry_queue_count == TELEMETRY_QUEUE_SIZE)
+    {
+        telemetry_stats.dropped++;
+        if (telemetry_config.drop_policy == TELEMETRY_DROP_OLDEST)
+        {
+            telemetry_queue_head = (telemetry_queue_head + 1) % TELEMETRY_QUEUE_SIZE;
+            telemetry_queue_count--;
+        }
+    }
+    if (telemetry_queue_count < TELEMETRY_QUEUE_SIZE)
+    {
+        tail = (telemetry_queue_head + telemetry_queue_count) % TELEMETRY_QUEUE_SIZE;
+        telemetry_queue[tail] = sample;
+        telemetry_queue_count++;
+    }
+    if (telemetry_queue_count >= telemetry_config.batch)
+    {
+        pthread_cond_signal(&telemetry_cond);
+    }
+    pthread_mutex_unlock(&telemetry_mutex);
+}
+
+void telemetry_get_stats(telemetry_stats_t *stats)
+{
+    pthread_mutex_lock(&telemetry_mutex);
+    *stats = telemetry_stats;
+    pthread_mutex_unlock(&telemetry_mutex);
+}
@@ -0,0 +1,87 @@
+/**
+ * \file telemetry.h
+ * \brief Interface of telemetry exporter.
+ * \details Sample application context and runtime counters from the main loop and send them
+ *          as Influx line protocol over UDP (telegraf socket listener), from a dedicated thread.
+ *          Samples are queued in a bounded queue and batched, several samples per datagram.
+ * \author Raphael CAUSSE
+ */
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+/***** Includes **************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/***** Definitions ***********************************************************/
+
+#define TELEMETRY_DEFAULT_HOST "127.0.0.1"
+#define TELEMETRY_DEFAULT_PORT (534)
+#define TELEMETRY_DEFAULT_BATCH (5)       /* One datagram each 500ms at 100ms cycle */
+#define TELEMETRY_MAX_BATCH (16)          /* Samples per datagram */
+#define TELEMETRY_QUEUE_SIZE (64)         /* Samples waiting to be sent */
+#define TELEMETRY_DATAGRAM_SIZE (8192)    /* Local UDP, no fragmentation on loopback */
+#define TELEMETRY_FLUSH_PERIOD_MS (1000)  /* Incomplete batches are sent after this delay */
+
+/* Policy when the queue is full */
+typedef enum
+{
+    TELEMETRY_DROP_OLDEST = 0, /* Replace the oldest queued sample */
+    TELEMETRY_DROP_NEWEST      /* Discard the new sample */
+} telemetry_drop_policy_t;
+
+/* Telemetry configuration */
+typedef struct
+{
+    const char *host;                    /* Destination IPv4 address */
+    uint16_t port;                       /* Destination UDP port */
+    uint32_t batch;                      /* Samples per datagram, 1 to TELEMETRY_MAX_BATCH */
+    telemetry_drop_policy_t drop_policy; /* Policy when the queue is full */
+} telemetry_config_t;
+
+/* Telemetry counters */
+typedef struct
+{
+    uint32_t sampled;      /* Samples taken */
+    uint32_t sent;         /* Samples sent */
+    uint32_t datagrams;    /* Datagrams sent */
+    uint32_t dropped;      /* Samples dropped because the queue was full */
+    uint32_t send_errors;  /* Samples lost because a datagram could not be sent */
+} telemetry_stats_t;
+
+/***** Functions *************************************************************/
+
+/**
+ * \brief Get the default telemetry configuration.
+ * \param config : Output configuration
+ */
+void telemetry_default(telemetry_config_t *config);
+
+/**
+ * \brief Open the UDP socket and start the telemetry thread.
+ * \param config : Telemetry configuration
+ * \return bool : true on success, false otherwise
+ */
+bool telemetry_start(const telemetry_config_t *config);
+
+/**
+ * \brief Stop the telemetry thread, sending queued samples, and close the socket.
+ */
+void telemetry_stop(void);
+
+/**
+ * \brief Sample application context and runtime counters.
+ * \details Called from the main loop with the context lock held. Never blocks on the network,
+ *          does nothing if the telemetry thread is not started.
+ */
+void telemetry_sample(void);
+
+/**
+ * \brief Get a copy of telemetry counters, between telemetry_start() and telemetry_stop().
+ * \param stats : Output counters
+ */
+void telemetry_get_stats(telemetry_stats_t *stats);
+
+#endif /* TELEMETRY_H */
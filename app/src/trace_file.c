@@ -0,0 +1,804 @@
+/**
+ * \file trace_file.c
+ * \brief Implementation of columnar trace files.
+ * \details Each column of a block is encoded with the smallest of its encodings, sizes being computed
+ *          before encoding. Bit-packed values are stored least significant bit first.
+ * \author Raphael CAUSSE
+ */
+
+/***** Includes **************************************************************/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include "trace_file.h"
+
+/***** Definitions ***********************************************************/
+
+#define TRACE_FILE_MAGIC "BCGVTRC"   /* 8 bytes with terminating null character */
+#define TRACE_BLOCK_MAGIC (0x4B4C4254u) /* "TBLK" */
+#define TRACE_INDEX_MAGIC (0x58444954u) /* "TIDX" */
+
+#define TRACE_BLOCK_HEADERS_SIZE (TRACE_FILE_BLOCK_HEADER_SIZE + TRACE_COL_COUNT * TRACE_FILE_CHUNK_HEADER_SIZE)
+#define TRACE_INDEX_INITIAL_CAPACITY (64) /* Index entries, doubled when full */
+
+/***** Static Variables ******************************************************/
+
+static const char *const trace_column_names[TRACE_COL_COUNT] = {
+    "time_ms",
+    "frame_number",
+    "distance",
+    "speed",
+    "chassis_issues",
+    "motor_issues",
+    "fuel_level",
+    "engine_rpm",
+    "battery_issues",
+    "crc8",
+    "mux_valid",
+    "out_warnings",
+    "out_distance",
+    "out_speed",
+    "out_fuel_percent",
+    "out_engine_rpm",
+    "bgf_rx",
+    "bgf_rx_count",
+    "comodo_rx",
+    "comodo_rx_count",
+};
+
+/***** Static Functions ******************************************************/
+
+static void trace_put_u16(uint8_t *p, uint16_t value)
+{
+    p[0] = (uint8_t)value;
+    p[1] = (uint8_t)(value >> 8);
+}
+
+static void trace_put_u32(uint8_t *p, uint32_t value)
+{
+    p[0] = (uint8_t)value;
+    p[1] = (uint8_t)(value >> 8);
+    p[2] = (uint8_t)(value >> 16);
+    p[3] = (uint8_t)(value >> 24);
+}
+
+static void trace_put_u64(uint8_t *p, uint64_t value)
+{
+    trace_put_u32(p, (uint32_t)value);
+    trace_put_u32(p + 4, (uint32_t)(value >> 32));
+}
+
+static uint16_t trace_get_u16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t trace_get_u32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint64_t trace_get_u64(const uint8_t *p)
+{
+    return (uint64_t)trace_get_u32(p) | ((uint64_t)trace_get_u32(p + 4) << 32);
+}
+
+/**
+ * \brief Get the number of bits needed by a value.
+ * \param value : Value
+ * \return uint8_t : Bits, 0 for 0.
+ */
+static uint8_t trace_width(uint32_t value)
+{
+    uint8_t width = 0;
+
+    while (value != 0)
+    {
+        width++;
+        value >>= 1;
+    }
+
+    return width;
+}
+
+/**
+ * \brief Get the size of a varint.
+ * \param value : Value
+ * \return size_t : Bytes, 7 bits per byte.
+ */
+static size_t trace_varint_size(uint32_t value)
+{
+    size_t size = 1;
+
+    while (value >= 0x80u)
+    {
+        value >>= 7;
+        size++;
+    }
+
+    return size;
+}
+
+static size_t trace_put_varint(uint8_t *p, uint32_t value)
+{
+    size_t size = 0;
+
+    while (value >= 0x80u)
+    {
+        p[size++] = (uint8_t)(value | 0x80u);
+        value >>= 7;
+    }
+    p[size++] = (uint8_t)value;
+
+    return size;
+}
+
+/**
+ * \brief Read a varint.
+ * \param p : Input, advanced past the varint
+ * \param end : End of input
+ * \param value : Output value
+ * \return bool : true on success, false if truncated or too long.
+ */
+static bool trace_get_varint(const uint8_t **p, const uint8_t *end, uint32_t *value)
+{
+    uint32_t result = 0;
+
+    for (uint32_t shift = 0; shift < 35; shift += 7)
+    {
+        if (*p >= end)
+        {
+            return false;
+        }
+        result |= (uint32_t)(**p & 0x7Fu) << shift;
+        if ((*(*p)++ & 0x80u) == 0)
+        {
+            *value = result;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * \brief Pack values minus a bias, width bits each.
+ * \param values : Values
+ * \param count : Number of values
+ * \param bias : Subtracted from each value
+ * \param width : Bits per value, 0 to 32
+ * \param out : Output
+ * \return size_t : Bytes written
+ */
+static size_t trace_pack(const uint32_t *values, uint32_t count, uint32_t bias, uint8_t width, uint8_t *out)
+{
+    uint64_t acc = 0;
+    uint32_t bits = 0;
+    size_t size = 0;
+
+    if (width == 0)
+    {
+        return 0;
+    }
+    for (uint32_t i = 0; i < count; i++)
+    {
+        acc |= (uint64_t)(values[i] - bias) << bits;
+        bits += width;
+        while (bits >= 8)
+        {
+            out[size++] = (uint8_t)acc;
+            acc >>= 8;
+            bits -= 8;
+        }
+    }
+    if (bits > 0)
+    {
+        out[size++] = (uint8_t)acc;
+    }
+
+    return size;
+}
+
+/**
+ * \brief Unpack values packed by trace_pack().
+ * \param in : Input, at least (count * width + 7) / 8 bytes
+ * \param count : Number of values
+ * \param bias : Added to each value
+ * \param width : Bits per value, 0 to 32
+ * \param values : Output values
+ */
+static void trace_unpack(const uint8_t *in, uint32_t count, uint32_t bias, uint8_t width, uint32_t *values)
+{
+    const uint64_t mask = (width == 32) ? 0xFFFFFFFFull : ((1ull << width) - 1);
+    uint64_t acc = 0;
+    uint32_t bits = 0;
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        while (bits < width)
+        {
+            acc |= (uint64_t)*in++ << bits;
+            bits += 8;
+        }
+        values[i] = bias + (uint32_t)(acc & mask);
+        acc >>= width;
+        bits -= width;
+    }
+}
+
+static size_t trace_packed_size(uint32_t count, uint8_t width)
+{
+    return ((size_t)count * width + 7) / 8;
+}
+
+/**
+ * \brief Encode one column, with the smallest encoding.
+ * \param values : Column values
+ * \param count : Number of values
+ * \param chunk : Output chunk, offset already set
+ * \param out : Output payload
+ */
+static void trace_encode_column(const uint32_t *values, uint32_t count, trace_chunk_t *chunk, uint8_t *out)
+{
+    uint32_t deltas[TRACE_FILE_BLOCK_ROWS];
+    uint32_t min = values[0];
+    uint32_t max = values[0];
+    int32_t delta_min = 0;
+    int32_t delta_max = 0;
+    uint8_t delta_width = 0;
+    size_t delta_size = SIZE_MAX;
+    size_t rle_size = 0;
+    size_t size = 0;
+    uint32_t run = 1;
+
+    for (uint32_t i = 1; i < count; i++)
+    {
+        min = (values[i] < min) ? values[i] : min;
+        max = (values[i] > max) ? values[i] : max;
+    }
+    chunk->min = min;
+    chunk->max = max;
+    chunk->width = 0;
+    chunk->encoding = TRACE_ENC_CONSTANT;
+    chunk->size = 0;
+    if (min == max)
+    {
+        return;
+    }
+
+    /* Deltas, two's complement: a wrapping counter gives a single large delta */
+    if (count > 1)
+    {
+        for (uint32_t i = 1; i < count; i++)
+        {
+            deltas[i - 1] = values[i] - values[i - 1];
+        }
+        delta_min = (int32_t)deltas[0];
+        delta_max = (int32_t)deltas[0];
+        for (uint32_t i = 1; i < count - 1; i++)
+        {
+            delta_min = ((int32_t)deltas[i] < delta_min) ? (int32_t)deltas[i] : delta_min;
+            delta_max = ((int32_t)deltas[i] > delta_max) ? (int32_t)deltas[i] : delta_max;
+        }
+        delta_width = trace_width((uint32_t)((int64_t)delta_max - delta_min));
+        delta_size = 8 + trace_packed_size(count - 1, delta_width);
+    }
+
+    /* Runs */
+    for (uint32_t i = 1; i <= count; i++)
+    {
+        if ((i < count) && (values[i] == values[i - 1]))
+        {
+            run++;
+            continue;
+        }
+        rle_size += trace_varint_size(run) + trace_varint_size(values[i - 1] - min);
+        run = 1;
+    }
+
+    chunk->width = trace_width(max - min);
+    size = trace_packed_size(count, chunk->width);
+    if ((size <= delta_size) && (size <= rle_size))
+    {
+        chunk->encoding = TRACE_ENC_BITPACK;
+        chunk->size = (uint32_t)trace_pack(values, count, min, chunk->width, out);
+    }
+    else if (delta_size <= rle_size)
+    {
+        chunk->encoding = TRACE_ENC_DELTA;
+        chunk->width = delta_width;
+        trace_put_u32(out, values[0]);
+        trace_put_u32(out + 4, (uint32_t)delta_min);
+        chunk->size = 8 + (uint32_t)trace_pack(deltas, count - 1, (uint32_t)delta_min, delta_width, out + 8);
+    }
+    else
+    {
+        chunk->encoding = TRACE_ENC_RLE;
+        chunk->width = 0;
+        run = 1;
+        for (uint32_t i = 1; i <= count; i++)
+        {
+            if ((i < count) && (values[i] == values[i - 1]))
+            {
+                run++;
+                continue;
+            }
+            size = trace_put_varint(out + chunk->size, run);
+            chunk->size += (uint32_t)size;
+            size = trace_put_varint(out + chunk->size, values[i - 1] - min);
+            chunk->size += (uint32_t)size;
+            run = 1;
+        }
+    }
+}
+
+/**
+ * \brief Parse the block index at the end of a file.
+ * \param reader : Reader, file opened
+ * \param file_size : File size
+ * \return bool : true if the file has a valid index, false otherwise.
+ */
+static bool trace_reader_load_index(trace_reader_t *reader, uint64_t file_size)
+{
+    uint8_t bytes[TRACE_FILE_INDEX_ENTRY_SIZE];
+    uint64_t index_offset = 0;
+    uint32_t blocks = 0;
+
+    if ((file_size < TRACE_FILE_HEADER_SIZE + TRACE_FILE_TRAILER_SIZE) ||
+        (fseeko(reader->file, (off_t)(file_size - TRACE_FILE_TRAILER_SIZE), SEEK_SET) != 0) ||
+        (fread(bytes, 1, TRACE_FILE_TRAILER_SIZE, reader->file) != TRACE_FILE_TRAILER_SIZE) ||
+        (trace_get_u32(bytes + 12) != TRACE_INDEX_MAGIC))
+    {
+        return false;
+    }
+    index_offset = trace_get_u64(bytes);
+    blocks = trace_get_u32(bytes + 8);
+    if ((index_offset < TRACE_FILE_HEADER_SIZE) ||
+        (index_offset + (uint64_t)blocks * TRACE_FILE_INDEX_ENTRY_SIZE + TRACE_FILE_TRAILER_SIZE != file_size) ||
+        (fseeko(reader->file, (off_t)index_offset, SEEK_SET) != 0))
+    {
+        return false;
+    }
+
+    reader->index = malloc(((size_t)blocks + 1) * sizeof(trace_index_entry_t));
+    if (reader->index == NULL)
+    {
+        return false;
+    }
+    for (uint32_t i = 0; i < blocks; i++)
+    {
+        if (fread(bytes, 1, TRACE_FILE_INDEX_ENTRY_SIZE, reader->file) != TRACE_FILE_INDEX_ENTRY_SIZE)
+        {
+            free(reader->index);
+            reader->index = NULL;
+            return false;
+        }
+        reader->index[i].offset = trace_get_u64(bytes);
+        reader->index[i].first_row = trace_get_u32(bytes + 8);
+        reader->index[i].rows = trace_get_u32(bytes + 12);
+        reader->index[i].time_min = trace_get_u32(bytes + 16);
+        reader->index[i].time_max = trace_get_u32(bytes + 20);
+        reader->index[i].frame_min = trace_get_u32(bytes + 24);
+        reader->index[i].frame_max = trace_get_u32(bytes + 28);
+    }
+    reader->blocks = blocks;
+    reader->complete = true;
+
+    return true;
+}
+
+/**
+ * \brief Rebuild the block index of an interrupted recording from block headers.
+ * \details Stops at the first truncated or corrupted block.
+ * \param reader : Reader, file opened
+ * \param file_size : File size
+ * \return bool : true on success, false if out of memory.
+ */
+static bool trace_reader_scan_index(trace_reader_t *reader, uint64_t file_size)
+{
+    trace_block_t block;
+    trace_index_entry_t *index = NULL;
+    uint32_t capacity = 0;
+    uint64_t offset = TRACE_FILE_HEADER_SIZE;
+
+    reader->blocks = 0;
+    reader->complete = false;
+    while ((offset + TRACE_BLOCK_HEADERS_SIZE <= file_size) &&
+           (fseeko(reader->file, (off_t)offset, SEEK_SET) == 0) &&
+           (fread(reader->buffer, 1, TRACE_BLOCK_HEADERS_SIZE, reader->file) == TRACE_BLOCK_HEADERS_SIZE))
+    {
+        /* Payloads are not read, only checked to be in the file */
+        block.size = trace_get_u32(reader->buffer + 4);
+        if ((block.size > TRACE_FILE_BLOCK_MAX_SIZE) || (offset + block.size > file_size) ||
+            (trace_file_parse_block(reader->buffer, block.size, &block) == false))
+        {
+            break;
+        }
+        if (reader->blocks == capacity)
+        {
+            capacity = (capacity == 0) ? TRACE_INDEX_INITIAL_CAPACITY : capacity * 2;
+            index = realloc(reader->index, (size_t)capacity * sizeof(trace_index_entry_t));
+            if (index == NULL)
+            {
+                return false;
+            }
+            reader->index = index;
+        }
+        reader->index[reader->blocks].offset = offset;
+        reader->index[reader->blocks].first_row = block.first_row;
+        reader->index[reader->blocks].rows = block.rows;
+        reader->index[reader->blocks].time_min = block.chunks[TRACE_COL_TIME_MS].min;
+        reader->index[reader->blocks].time_max = block.chunks[TRACE_COL_TIME_MS].max;
+        reader->index[reader->blocks].frame_min = block.chunks[TRACE_COL_FRAME_NUMBER].min;
+        reader->index[reader->blocks].frame_max = block.chunks[TRACE_COL_FRAME_NUMBER].max;
+        reader->blocks++;
+        offset += block.size;
+    }
+
+    return true;
+}
+
+/***** Functions *************************************************************/
+
+const char *trace_file_column_name(trace_column_t column)
+{
+    if ((unsigned)column >= TRACE_COL_COUNT)
+    {
+        return "unknown";
+    }
+    return trace_column_names[column];
+}
+
+bool trace_file_parse_header(const uint8_t *data, size_t size, int64_t *start_time_ns, uint32_t *block_rows)
+{
+    if ((size < TRACE_FILE_HEADER_SIZE) || (memcmp(data, TRACE_FILE_MAGIC, sizeof(TRACE_FILE_MAGIC)) != 0) ||
+        (trace_get_u16(data + 8) != TRACE_FILE_VERSION) || (trace_get_u16(data + 10) != TRACE_COL_COUNT) ||
+        (trace_get_u32(data + 12) == 0) || (trace_get_u32(data + 12) > TRACE_FILE_BLOCK_ROWS))
+    {
+        return false;
+    }
+    *start_time_ns = (int64_t)trace_get_u64(data + 16);
+    *block_rows = trace_get_u32(data + 12);
+
+    return true;
+}
+
+size_t trace_file_encode_block(const trace_rows_t rows, uint32_t count, uint32_t first_row, uint8_t *out)
+{
+    trace_chunk_t chunk;
+    uint8_t *header = NULL;
+    uint32_t size = TRACE_BLOCK_HEADERS_SIZE;
+
+    for (uint32_t column = 0; column < TRACE_COL_COUNT; column++)
+    {
+        chunk.offset = size;
+        trace_encode_column(rows[column], count, &chunk, out + size);
+        size += chunk.size;
+
+        header = out + TRACE_FILE_BLOCK_HEADER_SIZE + column * TRACE_FILE_CHUNK_HEADER_SIZE;
+        header[0] = chunk.encoding;
+        header[1] = chunk.width;
+        trace_put_u16(header + 2, 0);
+        trace_put_u32(header + 4, chunk.min);
+        trace_put_u32(header + 8, chunk.max);
+        trace_put_u32(header + 12, chunk.offset);
+        trace_put_u32(header + 16, chunk.size);
+    }
+
+    trace_put_u32(out, TRACE_BLOCK_MAGIC);
+    trace_put_u32(out + 4, size);
+    trace_put_u32(out + 8, first_row);
+    trace_put_u32(out + 12, count);
+
+    return size;
+}
+
+bool trace_file_parse_block(const uint8_t *data, size_t size, trace_block_t *block)
+{
+    const uint8_t *header = NULL;
+    trace_chunk_t *chunk = NULL;
+
+    if ((size < TRACE_BLOCK_HEADERS_SIZE) || (trace_get_u32(data) != TRACE_BLOCK_MAGIC))
+    {
+        return false;
+    }
+    block->data = data;
+    block->size = trace_get_u32(data + 4);
+    block->first_row = trace_get_u32(data + 8);
+    block->rows = trace_get_u32(data + 12);
+    if ((block->size < TRACE_BLOCK_HEADERS_SIZE) || (block->size > size) || (block->rows == 0) ||
+        (block->rows > TRACE_FILE_BLOCK_ROWS))
+    {
+        return false;
+    }
+
+    for (uint32_t column = 0; column < TRACE_COL_COUNT; column++)
+    {
+        header = data + TRACE_FILE_BLOCK_HEADER_SIZE + column * TRACE_FILE_CHUNK_HEADER_SIZE;
+        chunk = &block->chunks[column];
+        chunk->encoding = header[0];
+        chunk->width = header[1];
+        chunk->min = trace_get_u32(header + 4);
+        chunk->max = trace_get_u32(header + 8);
+        chunk->offset = trace_get_u32(header + 12);
+        chunk->size = trace_get_u32(header + 16);
+        if ((chunk->encoding > TRACE_ENC_RLE) || (chunk->width > 32) || (trace_get_u16(header + 2) != 0) ||
+            (chunk->offset < TRACE_BLOCK_HEADERS_SIZE) || (chunk->offset > block->size) ||
+            (chunk->size > block->size - chunk->offset))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool trace_file_decode_column(const trace_block_t *block, trace_column_t column, uint32_t *values)
+{
+    const trace_chunk_t *chunk = &block->chunks[column];
+    const uint8_t *payload = block->data + chunk->offset;
+    const uint8_t *end = payload + chunk->size;
+    uint32_t rows = block->rows;
+    uint32_t run = 0;
+    uint32_t value = 0;
+    uint32_t count = 0;
+
+    switch (chunk->encoding)
+    {
+    case TRACE_ENC_CONSTANT:
+        for (uint32_t i = 0; i < rows; i++)
+        {
+            values[i] = chunk->min;
+        }
+        return true;
+
+    case TRACE_ENC_BITPACK:
+        if (chunk->size < trace_packed_size(rows, chunk->width))
+        {
+            return false;
+        }
+        trace_unpack(payload, rows, chunk->min, chunk->width, values);
+        return true;
+
+    case TRACE_ENC_DELTA:
+        if (chunk->size < 8 + trace_packed_size(rows - 1, chunk->width))
+        {
+            return false;
+        }
+        values[0] = trace_get_u32(payload);
+        trace_unpack(payload + 8, rows - 1, trace_get_u32(payload + 4), chunk->width, values + 1);
+        for (uint32_t i = 1; i < rows; i++)
+        {
+            values[i] += values[i - 1];
+        }
+        return true;
+
+    case TRACE_ENC_RLE:
+        while (count < rows)
+        {
+            if ((trace_get_varint(&payload, end, &run) == false) ||
+                (trace_get_varint(&payload, end, &value) == false) || (run == 0) || (run > rows - count))
+            {
+                return false;
+            }
+            for (uint32_t i = 0; i < run; i++)
+            {
+                values[count++] = chunk->min + value;
+            }
+        }
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+bool trace_writer_open(trace_writer_t *writer, const char *path, int64_t start_time_ns)
+{
+    uint8_t header[TRACE_FILE_HEADER_SIZE];
+
+    memset(header, 0, sizeof(header));
+    memcpy(header, TRACE_FILE_MAGIC, sizeof(TRACE_FILE_MAGIC));
+    trace_put_u16(header + 8, TRACE_FILE_VERSION);
+    trace_put_u16(header + 10, TRACE_COL_COUNT);
+    trace_put_u32(header + 12, TRACE_FILE_BLOCK_ROWS);
+    trace_put_u64(header + 16, (uint64_t)start_time_ns);
+
+    writer->index = NULL;
+    writer->blocks = 0;
+    writer->capacity = 0;
+    writer->offset = TRACE_FILE_HEADER_SIZE;
+    writer->file = fopen(path, "wb");
+    if (writer->file == NULL)
+    {
+        return false;
+    }
+    if ((fwrite(header, 1, sizeof(header), writer->file) != sizeof(header)) || (fflush(writer->file) != 0))
+    {
+        fclose(writer->file);
+        writer->file = NULL;
+        return false;
+    }
+
+    return true;
+}
+
+size_t trace_writer_write_block(trace_writer_t *writer, const trace_rows_t rows, uint32_t count, uint32_t first_row)
+{
+    trace_index_entry_t *index = NULL;
+    trace_block_t block;
+    uint32_t capacity = 0;
+    size_t size = 0;
+
+    if (writer->blocks == writer->capacity)
+    {
+        /* Capacity kept on failure, the next block tries to grow again */
+        capacity = (writer->capacity == 0) ? TRACE_INDEX_INITIAL_CAPACITY : writer->capacity * 2;
+        index = realloc(writer->index, (size_t)capacity * sizeof(trace_index_entry_t));
+        if (index == NULL)
+        {
+            return 0;
+        }
+        writer->index = index;
+        writer->capacity = capacity;
+    }
+
+    size = trace_file_encode_block(rows, count, first_row, writer->buffer);
+    if ((fwrite(writer->buffer, 1, size, writer->file) != size) || (fflush(writer->file) != 0))
+    {
+        /* Next blocks are written after the partial one, readers stop at it */
+        return 0;
+    }
+
+    trace_file_parse_block(writer->buffer, size, &block);
+    writer->index[writer->blocks].offset = writer->offset;
+    writer->index[writer->blocks].first_row = first_row;
+    writer->index[writer->blocks].rows = count;
+    writer->index[writer->blocks].time_min = block.chunks[TRACE_COL_TIME_MS].min;
+    writer->index[writer->blocks].time_max = block.chunks[TRACE_COL_TIME_MS].max;
+    writer->index[writer->blocks].frame_min = block.chunks[TRACE_COL_FRAME_NUMBER].min;
+    writer->index[writer->blocks].frame_max = block.chunks[TRACE_COL_FRAME_NUMBER].max;
+    writer->blocks++;
+    writer->offset += size;
+
+    return size;
+}
+
+bool trace_writer_close(trace_writer_t *writer)
+{
+    uint8_t bytes[TRACE_FILE_INDEX_ENTRY_SIZE];
+    bool success = true;
+
+    if (writer->file == NULL)
+    {
+        return false;
+    }
+
+    for (uint32_t i = 0; (i < writer->blocks) && (success == true); i++)
+    {
+        trace_put_u64(bytes, writer->index[i].offset);
+        trace_put_u32(bytes + 8, writer->index[i].first_row);
+        trace_put_u32(bytes + 12, writer->index[i].rows);
+        trace_put_u32(bytes + 16, writer->index[i].time_min);
+        trace_put_u32(bytes + 20, writer->index[i].time_max);
+        trace_put_u32(bytes + 24, writer->index[i].frame_min);
+        trace_put_u32(bytes + 28, writer->index[i].frame_max);
+        success = (fwrite(bytes, 1, TRACE_FILE_INDEX_ENTRY_SIZE, writer->file) == TRACE_FILE_INDEX_ENTRY_SIZE);
+    }
+    trace_put_u64(bytes, writer->offset);
+    trace_put_u32(bytes + 8, writer->blocks);
+    trace_put_u32(bytes + 12, TRACE_INDEX_MAGIC);
+    success = success && (fwrite(bytes, 1, TRACE_FILE_TRAILER_SIZE, writer->file) == TRACE_FILE_TRAILER_SIZE);
+    success = (fclose(writer->file) == 0) && success;
+
+    writer->file = NULL;
+    free(writer->index);
+    writer->index = NULL;
+
+    return success;
+}
+
+bool trace_reader_open(trace_reader_t *reader, const char *path)
+{
+    uint8_t header[TRACE_FILE_HEADER_SIZE];
+    uint64_t file_size = 0;
+
+    reader->index = NULL;
+    reader->blocks = 0;
+    reader->complete = false;
+    reader->file = fopen(path, "rb");
+    if (reader->file == NULL)
+    {
+        return false;
+    }
+
+    if ((fread(header, 1, sizeof(header), reader->file) != sizeof(header)) ||
+        (trace_file_parse_header(header, sizeof(header), &reader->start_time_ns, &reader->block_rows) == false) ||
+        (fseeko(reader->file, 0, SEEK_END) != 0))
+    {
+        trace_reader_close(reader);
+        return false;
+    }
+    file_size = (uint64_t)ftello(reader->file);
+
+    if ((trace_reader_load_index(reader, file_size) == false) &&
+        (trace_reader_scan_index(reader, file_size) == false))
+    {
+        trace_reader_close(reader);
+        return false;
+    }
+
+    return true;
+}
+
+void trace_reader_close(trace_reader_t *reader)
+{
+    if (reader->file != NULL)
+    {
+        fclose(reader->file);
+        reader->file = NULL;
+    }
+    free(reader->index);
+    reader->index = NULL;
+    reader->blocks = 0;
+}
+
+uint32_t trace_reader_seek(const trace_reader_t *reader, uint32_t time_ms)
+{
+    uint32_t low = 0;
+    uint32_t high = reader->blocks;
+    uint32_t middle = 0;
+
+    /* Rows are in time order, so are blocks */
+    while (low < high)
+    {
+        middle = low + (high - low) / 2;
+        if (reader->index[middle].time_max < time_ms)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    return low;
+}
+
+uint32_t trace_reader_find_frame(const trace_reader_t *reader, uint32_t from, uint32_t frame_number)
+{
+    uint32_t number = from;
+
+    /* Frame numbers wrap around, blocks are not ordered by them */
+    while ((number < reader->blocks) &&
+           ((frame_number < reader->index[number].frame_min) || (frame_number > reader->index[number].frame_max)))
+    {
+        number++;
+    }
+
+    return number;
+}
+
+bool trace_reader_read_block(trace_reader_t *reader, uint32_t number, trace_block_t *block)
+{
+    uint32_t size = 0;
+
+    if ((number >= reader->blocks) || (fseeko(reader->file, (off_t)reader->index[number].offset, SEEK_SET) != 0) ||
+        (fread(reader->buffer, 1, TRACE_FILE_BLOCK_HEADER_SIZE, reader->file) != TRACE_FILE_BLOCK_HEADER_SIZE))
+    {
+        return false;
+    }
+    size = trace_get_u32(reader->buffer + 4);
+    if ((size < TRACE_FILE_BLOCK_HEADER_SIZE) || (size > TRACE_FILE_BLOCK_MAX_SIZE) ||
+        (fread(reader->buffer + TRACE_FILE_BLOCK_HEADER_SIZE, 1, size - TRACE_FILE_BLOCK_HEADER_SIZE, reader->file) !=
+         size - TRACE_FILE_BLOCK_HEADER_SIZE))
+    {
+        return false;
+    }
+
+    return trace_file_parse_block(reader->buffer, size, block);
+}
@@ -0,0 +1,253 @@
+/**
+ * \file trace_file.h
+ * \brief Interface of columnar trace files.
+ * \details Long recordings of MUX frames and serial channels, one row per cycle. Rows are grouped in
+ *          fixed-size blocks, each column of a block being encoded on its own (constant, bit-packed,
+ *          delta or run-length, whichever is smallest) with its minimum and maximum in the block header.
+ *          An index of blocks with their time and MUX frame number ranges ends the file, so a reader seeks
+ *          to a time range or a frame number and decodes only the columns it needs.
+ *
+ *          File layout, little endian:
+ *          - Header (TRACE_FILE_HEADER_SIZE bytes): magic, version, columns, rows per block, start time
+ *          - Blocks: block header, one chunk header per column, chunk payloads
+ *          - Index: one entry per block, then trailer (index offset, blocks, magic)
+ *          A file whose recording was interrupted has no index, readers rebuild it from block headers.
+ * \author Raphael CAUSSE
+ */
+
+#ifndef TRACE_FILE_H
+#define TRACE_FILE_H
+
+/***** Includes **************************************************************/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/***** Definitions ***********************************************************/
+
+#define TRACE_FILE_VERSION (2)
+#define TRACE_FILE_BLOCK_ROWS (1024) /* Rows per block, 102.4 seconds at 100ms cycle */
+
+#define TRACE_FILE_HEADER_SIZE (32)
+#define TRACE_FILE_BLOCK_HEADER_SIZE (16)
+#define TRACE_FILE_CHUNK_HEADER_SIZE (20)
+#define TRACE_FILE_INDEX_ENTRY_SIZE (32)
+#define TRACE_FILE_TRAILER_SIZE (16)
+
+/* Columns, one row per cycle */
+typedef enum
+{
+    TRACE_COL_TIME_MS = 0,      /* MUX frame reception, milliseconds since start of recording */
+    TRACE_COL_FRAME_NUMBER,     /* MUX 100ms frame, as received */
+    TRACE_COL_DISTANCE,
+    TRACE_COL_SPEED,
+    TRACE_COL_CHASSIS_ISSUES,
+    TRACE_COL_MOTOR_ISSUES,
+    TRACE_COL_FUEL_LEVEL,
+    TRACE_COL_ENGINE_RPM,
+    TRACE_COL_BATTERY_ISSUES,
+    TRACE_COL_CRC8,
+    TRACE_COL_MUX_VALID,        /* 1 if the MUX 100ms frame was decoded (valid CRC8) */
+    TRACE_COL_OUT_WARNINGS,     /* MUX 200ms frame, warning lights bytes */
+    TRACE_COL_OUT_DISTANCE,
+    TRACE_COL_OUT_SPEED,
+    TRACE_COL_OUT_FUEL_PERCENT,
+    TRACE_COL_OUT_ENGINE_RPM,
+    TRACE_COL_BGF_RX,           /* Serial channel 11, last frame received in the cycle */
+    TRACE_COL_BGF_RX_COUNT,     /* Serial channel 11, frames received in the cycle */
+    TRACE_COL_COMODO_RX,        /* Serial channel 12, last frame received in the cycle */
+    TRACE_COL_COMODO_RX_COUNT,  /* Serial channel 12, frames received in the cycle */
+    TRACE_COL_COUNT
+} trace_column_t;
+
+/* Largest encoded block: bit-packing never needs more than 4 bytes per value */
+#define TRACE_FILE_BLOCK_MAX_SIZE \
+    (TRACE_FILE_BLOCK_HEADER_SIZE + TRACE_COL_COUNT * (TRACE_FILE_CHUNK_HEADER_SIZE + 4 * TRACE_FILE_BLOCK_ROWS))
+
+/* Column encodings */
+typedef enum
+{
+    TRACE_ENC_CONSTANT = 0, /* All values equal to the minimum, no payload */
+    TRACE_ENC_BITPACK,      /* Values minus minimum, width bits each */
+    TRACE_ENC_DELTA,        /* First value, minimum delta, deltas minus minimum delta, width bits each */
+    TRACE_ENC_RLE           /* Runs of (length, value minus minimum), varints */
+} trace_encoding_t;
+
+/* Rows of a block, column major */
+typedef uint32_t trace_rows_t[TRACE_COL_COUNT][TRACE_FILE_BLOCK_ROWS];
+
+/* One encoded column of a block */
+typedef struct
+{
+    uint8_t encoding; /* See trace_encoding_t */
+    uint8_t width;    /* Bits per packed value */
+    uint32_t min;     /* Minimum value in block */
+    uint32_t max;     /* Maximum value in block */
+    uint32_t offset;  /* Payload offset from block start */
+    uint32_t size;    /* Payload size */
+} trace_chunk_t;
+
+/* Encoded block, parsed from memory */
+typedef struct
+{
+    const uint8_t *data; /* Block start */
+    uint32_t size;       /* Block size, headers included */
+    uint32_t first_row;  /* Row number of the first row, counted from start of recording */
+    uint32_t rows;       /* Rows in block */
+    trace_chunk_t chunks[TRACE_COL_COUNT];
+} trace_block_t;
+
+/* Block index entry */
+typedef struct
+{
+    uint64_t offset;    /* Block offset in file */
+    uint32_t first_row; /* Row number of the first row */
+    uint32_t rows;      /* Rows in block */
+    uint32_t time_min;  /* First row time (ms) */
+    uint32_t time_max;  /* Last row time (ms) */
+    uint32_t frame_min; /* Smallest MUX frame number */
+    uint32_t frame_max; /* Largest MUX frame number */
+} trace_index_entry_t;
+
+/* Trace writer */
+typedef struct
+{
+    FILE *file;
+    uint64_t offset;             /* Next block offset */
+    trace_index_entry_t *index;  /* Blocks written */
+    uint32_t blocks;
+    uint32_t capacity;           /* Allocated index entries */
+    uint8_t buffer[TRACE_FILE_BLOCK_MAX_SIZE];
+} trace_writer_t;
+
+/* Trace reader */
+typedef struct
+{
+    FILE *file;
+    int64_t start_time_ns;       /* Wall clock time of start of recording */
+    uint32_t block_rows;         /* Rows per block */
+    trace_index_entry_t *index;  /* All blocks of the file */
+    uint32_t blocks;
+    bool complete;               /* false if the index was rebuilt from an interrupted recording */
+    uint8_t buffer[TRACE_FILE_BLOCK_MAX_SIZE];
+} trace_reader_t;
+
+/***** Functions *************************************************************/
+
+/**
+ * \brief Get the name of a column.
+ * \param column : Column
+ * \return const char* : Column name, "unknown" for an unknown column.
+ */
+const char *trace_file_column_name(trace_column_t column);
+
+/**
+ * \brief Parse the header of a trace file.
+ * \param data : File start
+ * \param size : Bytes available from file start
+ * \param start_time_ns : Output wall clock time of start of recording
+ * \param block_rows : Output rows per block
+ * \return bool : true on success, false if not a trace file of this version.
+ */
+bool trace_file_parse_header(const uint8_t *data, size_t size, int64_t *start_time_ns, uint32_t *block_rows);
+
+/**
+ * \brief Encode a block.
+ * \param rows : Rows, column major
+ * \param count : Number of rows, 1 to TRACE_FILE_BLOCK_ROWS
+ * \param first_row : Row number of the first row
+ * \param out : Output buffer, at least TRACE_FILE_BLOCK_MAX_SIZE bytes
+ * \return size_t : Block size
+ */
+size_t trace_file_encode_block(const trace_rows_t rows, uint32_t count, uint32_t first_row, uint8_t *out);
+
+/**
+ * \brief Parse the headers of an encoded block.
+ * \param data : Block start
+ * \param size : Bytes available from block start
+ * \param block : Output block
+ * \return bool : true on success, false if the block is truncated or corrupted.
+ */
+bool trace_file_parse_block(const uint8_t *data, size_t size, trace_block_t *block);
+
+/**
+ * \brief Decode one column of a parsed block.
+ * \param block : Parsed block
+ * \param column : Column to decode
+ * \param values : Output values, block->rows values
+ * \return bool : true on success, false if the payload is corrupted.
+ */
+bool trace_file_decode_column(const trace_block_t *block, trace_column_t column, uint32_t *values);
+
+/**
+ * \brief Create a trace file and write its header.
+ * \param writer : Writer
+ * \param path : File path, truncated if it exists
+ * \param start_time_ns : Wall clock time of start of recording
+ * \return bool : true on success, false otherwise
+ */
+bool trace_writer_open(trace_writer_t *writer, const char *path, int64_t start_time_ns);
+
+/**
+ * \brief Encode and write a block.
+ * \details The block is flushed to the file, it can be read back if the recording is interrupted.
+ * \param writer : Writer
+ * \param rows : Rows, column major
+ * \param count : Number of rows, 1 to TRACE_FILE_BLOCK_ROWS
+ * \param first_row : Row number of the first row
+ * \return size_t : Bytes written, 0 on error
+ */
+size_t trace_writer_write_block(trace_writer_t *writer, const trace_rows_t rows, uint32_t count, uint32_t first_row);
+
+/**
+ * \brief Write the block index and close the file.
+ * \param writer : Writer
+ * \return bool : true on success, false otherwise
+ */
+bool trace_writer_close(trace_writer_t *writer);
+
+/**
+ * \brief Open a trace file and load its block index.
+ * \param reader : Reader
+ * \param path : File path
+ * \return bool : true on success, false otherwise
+ */
+bool trace_reader_open(trace_reader_t *reader, const char *path);
+
+/**
+ * \brief Close a trace file.
+ * \param reader : Reader
+ */
+void trace_reader_close(trace_reader_t *reader);
+
+/**
+ * \brief Find the first block ending at or after a time.
+ * \param reader : Reader
+ * \param time_ms : Time since start of recording (ms)
+ * \return uint32_t : Block number, reader->blocks if all blocks end before.
+ */
+uint32_t trace_reader_seek(const trace_reader_t *reader, uint32_t time_ms);
+
+/**
+ * \brief Find the next block whose frame number range holds a MUX frame number.
+ * \details Frame numbers wrap around, the same number is found again in later blocks.
+ * \param reader : Reader
+ * \param from : First block number to look at
+ * \param frame_number : MUX 100ms frame number
+ * \return uint32_t : Block number, reader->blocks if no block from `from` holds it.
+ */
+uint32_t trace_reader_find_frame(const trace_reader_t *reader, uint32_t from, uint32_t frame_number);
+
+/**
+ * \brief Read a block from the file and parse its headers.
+ * \details The block stays valid until the next read.
+ * \param reader : Reader
+ * \param number : Block number
+ * \param block : Output block
+ * \return bool : true on success, false otherwise
+ */
+bool trace_reader_read_block(trace_reader_t *reader, uint32_t number, trace_block_t *block);
+
+#endif /* TRACE_FILE_H */
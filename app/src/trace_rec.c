@@ -0,0 +1,319 @@
+/**
+ * \file trace_rec.c
+ * \brief Implementation of trace recorder.
+ * \details Two blocks of rows: the main loop fills one while the recorder thread writes the other.
+ *          A full block is dropped if the previous one is still being written.
+ * \author Raphael CAUSSE
+ */
+
+/***** Includes **************************************************************/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <pthread.h>
+#include <string.h>
+#include <time.h>
+#include "trace_rec.h"
+#include "trace_file.h"
+#include "mux.h"
+#include "log.h"
+#include "timestamp.h"
+#include "rt_profile.h"
+
+/***** Definitions ***********************************************************/
+
+#define TRACE_REC_BGF_CHANNEL (11)    /* Serial channel of BGF, see bgf.c */
+#define TRACE_REC_COMODO_CHANNEL (12) /* Serial channel of COMODO, see comodo.c */
+
+/***** Static Variables ******************************************************/
+
+static pthread_t trace_rec_thread;
+static pthread_mutex_t trace_rec_mutex; /* Priority inheritance, locked by the main loop on each block */
+static pthread_cond_t trace_rec_cond = PTHREAD_COND_INITIALIZER;
+static volatile bool trace_rec_running = false;
+
+static trace_rows_t trace_rec_rows[2];
+
+/* Owned by the main loop (serial frames: under the context lock) */
+static uint32_t trace_rec_fill = 0;      /* Block being filled */
+static uint32_t trace_rec_count = 0;     /* Rows in block being filled */
+static uint32_t trace_rec_first_row = 0; /* Row number of its first row */
+static uint32_t trace_rec_row = 0;       /* Row number of the next row, rows recorded */
+static timestamp_t trace_rec_start_time = TIMESTAMP_NONE;
+static uint32_t trace_rec_bgf_rx = 0;
+static uint32_t trace_rec_bgf_rx_count = 0;
+static uint32_t trace_rec_comodo_rx = 0;
+static uint32_t trace_rec_comodo_rx_count = 0;
+
+/* Block handed to the recorder thread, shared with the main loop */
+static bool trace_rec_pending = false;
+static uint32_t trace_rec_pending_block = 0;
+static uint32_t trace_rec_pending_count = 0;
+static uint32_t trace_rec_pending_first_row = 0;
+static trace_rec_stats_t trace_rec_stats;
+
+/* Owned by the recorder thread, then by trace_rec_stop() */
+static trace_writer_t trace_rec_writer;
+
+/***** Static Functions ******************************************************/
+
+/**
+ * \brief Read a big endian 32 bits value of a MUX frame.
+ * \param p : First byte
+ * \return uint32_t : Value
+ */
+static uint32_t trace_rec_get_be32(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+}
+
+/**
+ * \brief Write a block and update counters.
+ * \param block : Block of trace_rec_rows
+ * \param count : Rows in block
+ * \param first_row : Row number of the first row
+ */
+static void trace_rec_write(uint32_t block, uint32_t count, uint32_t first_row)
+{
+    const uint32_t(*rows)[TRACE_FILE_BLOCK_ROWS] = (const uint32_t(*)[TRACE_FILE_BLOCK_ROWS])trace_rec_rows[block];
+    size_t size = trace_writer_write_block(&trace_rec_writer, rows, count, first_row);
+
+    if (size == 0)
+    {
+        log_warn("trace block not written: %s", strerror(errno));
+    }
+
+    pthread_mutex_lock(&trace_rec_mutex);
+    if (size > 0)
+    {
+        trace_rec_stats.blocks++;
+        trace_rec_stats.bytes += size;
+    }
+    else
+    {
+        trace_rec_stats.write_errors++;
+    }
+    pthread_mutex_unlock(&trace_rec_mutex);
+}
+
+/**
+ * \brief Hand the filled block to the recorder thread and start a new one.
+ */
+static void trace_rec_submit(void)
+{
+    pthread_mutex_lock(&trace_rec_mutex);
+    if (trace_rec_pending == true)
+    {
+        /* Block refilled in place */
+        trace_rec_stats.dropped += trace_rec_count;
+    }
+    else
+    {
+        trace_rec_pending = true;
+        trace_rec_pending_block = trace_rec_fill;
+        trace_rec_pending_count = trace_rec_count;
+        trace_rec_pending_first_row = trace_rec_first_row;
+        trace_rec_fill ^= 1u;
+        pthread_cond_signal(&trace_rec_cond);
+    }
+    pthread_mutex_unlock(&trace_rec_mutex);
+
+    trace_rec_count = 0;
+    trace_rec_first_row = trace_rec_row;
+}
+
+/**
+ * \brief Recorder thread main function.
+ * \param arg : Unused
+ * \return void* : Unused
+ */
+static void *trace_rec_thread_main(void *arg)
+{
+    uint32_t block = 0;
+    uint32_t count = 0;
+    uint32_t first_row = 0;
+
+    (void)arg;
+    pthread_mutex_lock(&trace_rec_mutex);
+    while ((trace_rec_running == true) || (trace_rec_pending == true))
+    {
+        if (trace_rec_pending == false)
+        {
+            pthread_cond_wait(&trace_rec_cond, &trace_rec_mutex);
+            continue;
+        }
+        block = trace_rec_pending_block;
+        count = trace_rec_pending_count;
+        first_row = trace_rec_pending_first_row;
+        pthread_mutex_unlock(&trace_rec_mutex);
+
+        trace_rec_write(block, count, first_row);
+
+        pthread_mutex_lock(&trace_rec_mutex);
+        trace_rec_pending = false;
+    }
+    pthread_mutex_unlock(&trace_rec_mutex);
+
+    return NULL;
+}
+
+/***** Functions *************************************************************/
+
+bool trace_rec_start(const char *path)
+{
+    struct timespec now;
+    pthread_attr_t thread_attr;
+    int ret = 0;
+
+    if (trace_rec_running == true)
+    {
+        return true;
+    }
+
+    ret = rt_profile_mutex_init(&trace_rec_mutex);
+    if (ret != 0)
+    {
+        log_error("error while creating trace recorder mutex (%d)", ret);
+        return false;
+    }
+
+    clock_gettime(CLOCK_REALTIME, &now);
+    if (trace_writer_open(&trace_rec_writer, path, (int64_t)now.tv_sec * 1000000000LL + now.tv_nsec) == false)
+    {
+        log_error("error while creating trace file %s: %s", path, strerror(errno));
+        pthread_mutex_destroy(&trace_rec_mutex);
+        return false;
+    }
+
+    trace_rec_fill = 0;
+    trace_rec_count = 0;
+    trace_rec_first_row = 0;
+    trace_rec_row = 0;
+    trace_rec_start_time = timestamp_now();
+    trace_rec_bgf_rx_count = 0;
+    trace_rec_comodo_rx_count = 0;
+    trace_rec_pending = false;
+    memset(&trace_rec_stats, 0, sizeof(trace_rec_stats));
+
+    trace_rec_running = true;
+    ret = rt_profile_helper_attr_init(&thread_attr);
+    if (ret == 0)
+    {
+        ret = pthread_create(&trace_rec_thread, &thread_attr, &trace_rec_thread_main, NULL);
+        pthread_attr_destroy(&thread_attr);
+    }
+    if (ret != 0)
+    {
+        log_error("error while creating trace recorder thread (%d)", ret);
+        trace_rec_running = false;
+        trace_writer_close(&trace_rec_writer);
+        pthread_mutex_destroy(&trace_rec_mutex);
+        return false;
+    }
+
+    return true;
+}
+
+void trace_rec_stop(void)
+{
+    if (trace_rec_running == true)
+    {
+        pthread_mutex_lock(&trace_rec_mutex);
+        trace_rec_running = false;
+        pthread_cond_signal(&trace_rec_cond);
+        pthread_mutex_unlock(&trace_rec_mutex);
+        pthread_join(trace_rec_thread, NULL);
+
+        if (trace_rec_count > 0)
+        {
+            trace_rec_write(trace_rec_fill, trace_rec_count, trace_rec_first_row);
+        }
+        if (trace_writer_close(&trace_rec_writer) == false)
+        {
+            log_warn("trace index not written: %s", strerror(errno));
+        }
+        pthread_mutex_destroy(&trace_rec_mutex);
+    }
+}
+
+void trace_rec_serial(const serial_frame_t *frame)
+{
+    uint32_t value = 0;
+
+    if (trace_rec_running == false)
+    {
+        return;
+    }
+
+    for (size_t i = 0; (i < frame->frameSize) && (i < SER_MAX_FRAME_SIZE); i++)
+    {
+        value = (value << 8) | frame->frame[i];
+    }
+    if (frame->serNum == TRACE_REC_BGF_CHANNEL)
+    {
+        trace_rec_bgf_rx = value;
+        trace_rec_bgf_rx_count++;
+    }
+    else if (frame->serNum == TRACE_REC_COMODO_CHANNEL)
+    {
+        trace_rec_comodo_rx = value;
+        trace_rec_comodo_rx_count++;
+    }
+}
+
+void trace_rec_sample(bool mux_valid)
+{
+    const uint8_t *in = NULL;
+    const uint8_t *out = NULL;
+    uint32_t(*rows)[TRACE_FILE_BLOCK_ROWS] = NULL;
+    uint32_t row = trace_rec_count;
+
+    if (trace_rec_running == false)
+    {
+        return;
+    }
+
+    /* Raw frames, a frame with an invalid CRC8 is recorded as received */
+    in = mux_get_frame_100ms();
+    out = mux_get_frame_200ms();
+    rows = trace_rec_rows[trace_rec_fill];
+    rows[TRACE_COL_TIME_MS][row] =
+        (uint32_t)(timestamp_elapsed(trace_rec_start_time, mux_get_frame_100ms_timestamp()) / TIMESTAMP_NS_PER_MS);
+    rows[TRACE_COL_FRAME_NUMBER][row] = in[0];
+    rows[TRACE_COL_DISTANCE][row] = trace_rec_get_be32(&in[1]);
+    rows[TRACE_COL_SPEED][row] = in[5];
+    rows[TRACE_COL_CHASSIS_ISSUES][row] = in[6];
+    rows[TRACE_COL_MOTOR_ISSUES][row] = in[7];
+    rows[TRACE_COL_FUEL_LEVEL][row] = in[8];
+    rows[TRACE_COL_ENGINE_RPM][row] = trace_rec_get_be32(&in[9]);
+    rows[TRACE_COL_BATTERY_ISSUES][row] = in[13];
+    rows[TRACE_COL_CRC8][row] = in[14];
+    rows[TRACE_COL_MUX_VALID][row] = (mux_valid == true) ? 1u : 0u;
+    rows[TRACE_COL_OUT_WARNINGS][row] = ((uint32_t)out[0] << 8) | out[1];
+    rows[TRACE_COL_OUT_DISTANCE][row] = trace_rec_get_be32(&out[2]);
+    rows[TRACE_COL_OUT_SPEED][row] = out[6];
+    rows[TRACE_COL_OUT_FUEL_PERCENT][row] = out[7];
+    rows[TRACE_COL_OUT_ENGINE_RPM][row] = ((uint32_t)out[8] << 8) | out[9];
+    rows[TRACE_COL_BGF_RX][row] = trace_rec_bgf_rx;
+    rows[TRACE_COL_BGF_RX_COUNT][row] = trace_rec_bgf_rx_count;
+    rows[TRACE_COL_COMODO_RX][row] = trace_rec_comodo_rx;
+    rows[TRACE_COL_COMODO_RX_COUNT][row] = trace_rec_comodo_rx_count;
+    trace_rec_bgf_rx_count = 0;
+    trace_rec_comodo_rx_count = 0;
+
+    trace_rec_count++;
+    trace_rec_row++;
+    if (trace_rec_count == TRACE_FILE_BLOCK_ROWS)
+    {
+        trace_rec_submit();
+    }
+}
+
+void trace_rec_get_stats(trace_rec_stats_t *stats)
+{
+    pthread_mutex_lock(&trace_rec_mutex);
+    *stats = trace_rec_stats;
+    pthread_mutex_unlock(&trace_rec_mutex);
+    stats->rows = trace_rec_row;
+}
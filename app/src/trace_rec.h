@@ -0,0 +1,66 @@
+/**
+ * \file trace_rec.h
+ * \brief Interface of trace recorder.
+ * \details Record MUX frames and serial channels of each cycle into a columnar trace file (see trace_file.h).
+ *          The main loop fills a block of rows, a dedicated thread encodes and writes full blocks.
+ * \author Raphael CAUSSE
+ */
+
+#ifndef TRACE_REC_H
+#define TRACE_REC_H
+
+/***** Includes **************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "drv_api.h"
+
+/***** Definitions ***********************************************************/
+
+/* Recorder counters */
+typedef struct
+{
+    uint32_t rows;         /* Rows recorded */
+    uint32_t blocks;       /* Blocks written */
+    uint64_t bytes;        /* Bytes of blocks written */
+    uint32_t dropped;      /* Rows dropped, previous block still being written */
+    uint32_t write_errors; /* Blocks that could not be written */
+} trace_rec_stats_t;
+
+/***** Functions *************************************************************/
+
+/**
+ * \brief Create the trace file and start the recorder thread.
+ * \param path : Trace file path, truncated if it exists
+ * \return bool : true on success, false otherwise
+ */
+bool trace_rec_start(const char *path);
+
+/**
+ * \brief Stop the recorder thread, write the last rows and the block index, and close the file.
+ */
+void trace_rec_stop(void);
+
+/**
+ * \brief Record a received serial frame in the row of the current cycle.
+ * \details Called with the context lock held, from the main loop or the serial reception thread.
+ *          Does nothing if the recorder is not started.
+ * \param frame : Received serial frame
+ */
+void trace_rec_serial(const serial_frame_t *frame);
+
+/**
+ * \brief Record the row of the current cycle.
+ * \details Called from the main loop with the context lock held, after the MUX 200ms frame is encoded.
+ *          Never blocks on the file, does nothing if the recorder is not started.
+ * \param mux_valid : true if the MUX 100ms frame of the cycle was decoded
+ */
+void trace_rec_sample(bool mux_valid);
+
+/**
+ * \brief Get a copy of recorder counters, from the main loop while recording.
+ * \param stats : Output counters
+ */
+void trace_rec_get_stats(trace_rec_stats_t *stats);
+
+#endif /* TRACE_REC_H */
@@ -0,0 +1,475 @@
+/**
+ * \file trip_stats.c
+ * \brief Implementation of streaming trip statistics.
+ * \details Mean and variance use Welford's update. Quantiles come from a merging t-digest: values are
+ *          buffered, then sorted and merged into a bounded number of weighted centroids, the centroids
+ *          near the tails being kept small so that extreme quantiles stay accurate. A merge costs
+ *          O(TRIP_DIGEST_CENTROIDS + TRIP_DIGEST_BUFFER^2) once per TRIP_DIGEST_BUFFER values.
+ * \author Raphael CAUSSE
+ */
+
+/***** Includes **************************************************************/
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+#include "trip_stats.h"
+#include "log.h"
+
+/***** Definitions ***********************************************************/
+
+#define TRIP_DIGEST_COMPRESSION (100.0) /* Higher is more accurate, at most compression + 1 centroids */
+#define TRIP_DIGEST_CENTROIDS (128)
+#define TRIP_DIGEST_PI (3.14159265358979323846)
+#define TRIP_DIGEST_BUFFER (32)
+
+#define TRIP_STATS_REPORT_LINE_SIZE (256)
+
+/* Weighted centroid of a t-digest */
+typedef struct
+{
+    double mean;
+    uint32_t weight;
+} trip_centroid_t;
+
+/* Merging t-digest */
+typedef struct
+{
+    trip_centroid_t centroids[TRIP_DIGEST_CENTROIDS]; /* Sorted by mean */
+    uint32_t count;                                    /* Centroids used */
+    uint64_t weight;                                   /* Total weight of centroids */
+    uint32_t buffer[TRIP_DIGEST_BUFFER];               /* Values not merged yet */
+    uint32_t buffered;
+} trip_digest_t;
+
+/* Running statistics of one signal */
+typedef struct
+{
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    double mean;
+    double m2; /* Sum of squared differences from the mean */
+    uint32_t histogram[TRIP_STATS_HISTOGRAM_BUCKETS];
+    trip_digest_t digest;
+} trip_signal_acc_t;
+
+/* Running statistics of a trip */
+typedef struct
+{
+    uint32_t frames;
+    timestamp_t first_time;
+    timestamp_t last_time;
+    distance_t last_distance;
+    fuel_level_t last_fuel_level;
+    uint8_t last_flags;       /* Bit i set if flag i was set in the last frame */
+    uint32_t distance;
+    uint32_t fuel_used;
+    timestamp_t flag_time[TRIP_FLAG_COUNT];
+    trip_signal_acc_t signals[TRIP_SIGNAL_COUNT];
+} trip_stats_t;
+
+/***** Static Variables ******************************************************/
+
+static trip_stats_t trip_stats;
+static pthread_mutex_t trip_stats_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static const double trip_stats_quantiles[TRIP_STATS_QUANTILE_COUNT] = TRIP_STATS_QUANTILES;
+
+static const uint32_t trip_signal_bucket_widths[TRIP_SIGNAL_COUNT] = {10, 500};
+static const uint32_t trip_signal_buckets[TRIP_SIGNAL_COUNT] = {
+    UINT8_MAX / 10 + 1,     /* 0 to 259 km/h */
+    ENGINE_RPM_MAX / 500 + 1, /* 0 to 9999 RPM, then above */
+};
+
+static const char *const trip_signal_names[TRIP_SIGNAL_COUNT] = {
+    "speed",
+    "engine_rpm",
+};
+
+static const char *const trip_flag_names[TRIP_FLAG_COUNT] = {
+    "tyres_pression",
+    "brakes",
+    "motor_pression",
+    "motor_temperature_ldr",
+    "motor_oil_overheat",
+    "battery_discharged",
+    "battery_ko",
+};
+
+/***** Static Functions ******************************************************/
+
+/**
+ * \brief Get the highest quantile a centroid starting at a quantile can reach.
+ * \details Scale function k(q) = compression / (2 * pi) * asin(2 * q - 1), a centroid spans at most one unit
+ *          of k. Centroids are small near q = 0 and q = 1, and there are at most compression + 1 of them.
+ * \param q : Quantile at the left of the centroid
+ * \return double : Quantile limit at the right of the centroid
+ */
+static double trip_digest_limit(double q)
+{
+    double k = TRIP_DIGEST_COMPRESSION / (2.0 * TRIP_DIGEST_PI) * asin(2.0 * q - 1.0) + 1.0;
+
+    if (k >= TRIP_DIGEST_COMPRESSION / 4.0)
+    {
+        return 1.0;
+    }
+    return (sin(k * 2.0 * TRIP_DIGEST_PI / TRIP_DIGEST_COMPRESSION) + 1.0) / 2.0;
+}
+
+/**
+ * \brief Merge the buffered values of a digest into its centroids.
+ * \details Buffered values and centroids are walked in ascending order, each one being merged into the
+ *          current centroid while it stays within the limit of the scale function.
+ * \param digest : Digest
+ */
+static void trip_digest_flush(trip_digest_t *digest)
+{
+    trip_centroid_t merged[TRIP_DIGEST_CENTROIDS];
+    trip_centroid_t current;
+    trip_centroid_t next;
+    uint32_t count = 0;
+    uint32_t c = 0;
+    uint32_t b = 0;
+    uint32_t value = 0;
+    uint64_t before = 0;
+    double total = 0;
+    double limit = 0;
+
+    if (digest->buffered == 0)
+    {
+        return;
+    }
+
+    /* Insertion sort, the buffer is small */
+    for (uint32_t i = 1; i < digest->buffered; i++)
+    {
+        value = digest->buffer[i];
+        for (b = i; (b > 0) && (digest->buffer[b - 1] > value); b--)
+        {
+            digest->buffer[b] = digest->buffer[b - 1];
+        }
+        digest->buffer[b] = value;
+    }
+
+    total = (double)(digest->weight + digest->buffered);
+    b = 0;
+    if ((digest->count > 0) && (digest->centroids[0].mean <= digest->buffer[0]))
+    {
+        current = digest->centroids[c++];
+    }
+    else
+    {
+        current.mean = digest->buffer[b++];
+        current.weight = 1;
+    }
+    limit = total * trip_digest_limit(0.0);
+
+    while ((c < digest->count) || (b < digest->buffered))
+    {
+        if ((b >= digest->buffered) || ((c < digest->count) && (digest->centroids[c].mean <= digest->buffer[b])))
+        {
+            next = digest->centroids[c++];
+        }
+        else
+        {
+            next.mean = digest->buffer[b++];
+            next.weight = 1;
+        }
+
+        /* The last centroid absorbs the rest should the bound ever be reached */
+        if (((double)(before + current.weight + next.weight) <= limit) || (count == (TRIP_DIGEST_CENTROIDS - 1)))
+        {
+            current.weight += next.weight;
+            current.mean += (next.mean - current.mean) * next.weight / current.weight;
+        }
+        else
+        {
+            before += current.weight;
+            merged[count++] = current;
+            current = next;
+            limit = total * trip_digest_limit((double)before / total);
+        }
+    }
+    merged[count++] = current;
+
+    memcpy(digest->centroids, merged, count * sizeof(trip_centroid_t));
+    digest->count = count;
+    digest->weight += digest->buffered;
+    digest->buffered = 0;
+}
+
+/**
+ * \brief Estimate a quantile from a flushed digest.
+ * \details Interpolates between centroid centers, from the exact minimum to the exact maximum.
+ * \param digest : Digest, no buffered value
+ * \param q : Quantile, 0 to 1
+ * \param min : Minimum value
+ * \param max : Maximum value
+ * \return double : Estimated value, 0 if the digest is empty
+ */
+static double trip_digest_quantile(const trip_digest_t *digest, double q, uint32_t min, uint32_t max)
+{
+    double target = 0;
+    double before = 0;
+    double center = 0;
+    double prev_center = 0;
+    double prev_mean = min;
+
+    if (digest->count == 0)
+    {
+        return 0;
+    }
+
+    target = q * (double)digest->weight;
+    for (uint32_t c = 0; c < digest->count; c++)
+    {
+        center = before + digest->centroids[c].weight / 2.0;
+        if (target < center)
+        {
+            return prev_mean + (digest->centroids[c].mean - prev_mean) * (target - prev_center) / (center - prev_center);
+        }
+        prev_center = center;
+        prev_mean = digest->centroids[c].mean;
+        before += digest->centroids[c].weight;
+    }
+
+    if (before <= prev_center)
+    {
+        return max;
+    }
+    return prev_mean + (max - prev_mean) * (target - prev_center) / (before - prev_center);
+}
+
+/**
+ * \brief Add a sample to the running statistics of a signal.
+ * \param signal : Signal
+ * \param value : Sample value
+ */
+static void trip_signal_add(trip_signal_t signal, uint32_t value)
+{
+    trip_signal_acc_t *acc = &trip_stats.signals[signal];
+    uint32_t bucket = value / trip_signal_bucket_widths[signal];
+    double delta = 0;
+
+    if ((acc->count == 0) || (value < acc->min))
+    {
+        acc->min = value;
+    }
+    if (value > acc->max)
+    {
+        acc->max = value;
+    }
+    acc->count++;
+    delta = value - acc->mean;
+    acc->mean += delta / acc->count;
+    acc->m2 += delta * (value - acc->mean);
+
+    if (bucket >= trip_signal_buckets[signal])
+    {
+        bucket = trip_signal_buckets[signal] - 1;
+    }
+    acc->histogram[bucket]++;
+
+    acc->digest.buffer[acc->digest.buffered++] = value;
+    if (acc->digest.buffered == TRIP_DIGEST_BUFFER)
+    {
+        trip_digest_flush(&acc->digest);
+    }
+}
+
+/**
+ * \brief Get the issue flags of a frame.
+ * \param frame : Decoded values
+ * \return uint8_t : Bit i set if flag i is set
+ */
+static uint8_t trip_stats_flags(const trip_stats_frame_t *frame)
+{
+    uint8_t flags = 0;
+
+    flags |= ((frame->chassis_issues & CHASSIS_ISSUE_TYRES_PRESSION) ? 1U : 0U) << TRIP_FLAG_TYRES_PRESSION;
+    flags |= ((frame->chassis_issues & CHASSIS_ISSUE_BRAKES) ? 1U : 0U) << TRIP_FLAG_BRAKES;
+    flags |= ((frame->motor_issues & MOTOR_ISSUE_PRESSION) ? 1U : 0U) << TRIP_FLAG_MOTOR_PRESSION;
+    flags |= ((frame->motor_issues & MOTOR_ISSUE_TEMPERATURE_LDR) ? 1U : 0U) << TRIP_FLAG_MOTOR_TEMPERATURE_LDR;
+    flags |= ((frame->motor_issues & MOTOR_ISSUE_OIL_OVERHEAT) ? 1U : 0U) << TRIP_FLAG_MOTOR_OIL_OVERHEAT;
+    flags |= ((frame->battery_issues & BATTERY_ISSUES_DISCHARGED) ? 1U : 0U) << TRIP_FLAG_BATTERY_DISCHARGED;
+    flags |= ((frame->battery_issues & BATTERY_ISSUES_KO) ? 1U : 0U) << TRIP_FLAG_BATTERY_KO;
+
+    return flags;
+}
+
+/***** Functions *************************************************************/
+
+void trip_stats_update(const trip_stats_frame_t *frame)
+{
+    timestamp_t elapsed = 0;
+
+    if (frame == NULL)
+    {
+        return;
+    }
+
+    pthread_mutex_lock(&trip_stats_mutex);
+
+    if (trip_stats.frames == 0)
+    {
+        trip_stats.first_time = frame->time;
+    }
+    else
+    {
+        /* Previous flags held until this frame */
+        elapsed = timestamp_elapsed(trip_stats.last_time, frame->time);
+        for (uint32_t flag = 0; flag < TRIP_FLAG_COUNT; flag++)
+        {
+            if ((trip_stats.last_flags & (1U << flag)) != 0)
+            {
+                trip_stats.flag_time[flag] += elapsed;
+            }
+        }
+
+        if (frame->distance > trip_stats.last_distance)
+        {
+            trip_stats.distance += frame->distance - trip_stats.last_distance;
+        }
+        if (frame->fuel_level < trip_stats.last_fuel_level)
+        {
+            trip_stats.fuel_used += trip_stats.last_fuel_level - frame->fuel_level;
+        }
+    }
+
+    trip_stats.frames++;
+    if (frame->time > trip_stats.last_time)
+    {
+        trip_stats.last_time = frame->time;
+    }
+    trip_stats.last_distance = frame->distance;
+    trip_stats.last_fuel_level = frame->fuel_level;
+    trip_stats.last_flags = trip_stats_flags(frame);
+
+    trip_signal_add(TRIP_SIGNAL_SPEED, frame->speed);
+    trip_signal_add(TRIP_SIGNAL_ENGINE_RPM, frame->engine_rpm);
+
+    pthread_mutex_unlock(&trip_stats_mutex);
+}
+
+void trip_stats_snapshot(trip_stats_snapshot_t *snapshot)
+{
+    trip_signal_acc_t *acc = NULL;
+    trip_signal_stats_t *stats = NULL;
+    double hours = 0;
+
+    if (snapshot == NULL)
+    {
+        return;
+    }
+
+    memset(snapshot, 0, sizeof(trip_stats_snapshot_t));
+
+    pthread_mutex_lock(&trip_stats_mutex);
+
+    snapshot->frames = trip_stats.frames;
+    snapshot->duration = trip_stats.last_time - trip_stats.first_time;
+    snapshot->distance = trip_stats.distance;
+    snapshot->fuel_used = trip_stats.fuel_used;
+
+    for (uint32_t flag = 0; flag < TRIP_FLAG_COUNT; flag++)
+    {
+        if (snapshot->duration > 0)
+        {
+            snapshot->duty[flag] = (double)trip_stats.flag_time[flag] / (double)snapshot->duration;
+        }
+    }
+
+    for (uint32_t signal = 0; signal < TRIP_SIGNAL_COUNT; signal++)
+    {
+        acc = &trip_stats.signals[signal];
+        stats = &snapshot->signals[signal];
+
+        trip_digest_flush(&acc->digest);
+
+        stats->count = acc->count;
+        stats->min = acc->min;
+        stats->max = acc->max;
+        stats->mean = acc->mean;
+        stats->variance = (acc->count > 0) ? acc->m2 / acc->count : 0;
+        for (uint32_t q = 0; q < TRIP_STATS_QUANTILE_COUNT; q++)
+        {
+            stats->quantiles[q] = trip_digest_quantile(&acc->digest, trip_stats_quantiles[q], acc->min, acc->max);
+        }
+        stats->bucket_width = trip_signal_bucket_widths[signal];
+        stats->buckets = trip_signal_buckets[signal];
+        memcpy(stats->histogram, acc->histogram, sizeof(stats->histogram));
+    }
+
+    pthread_mutex_unlock(&trip_stats_mutex);
+
+    if (snapshot->distance > 0)
+    {
+        snapshot->fuel_per_100km = 100.0 * snapshot->fuel_used / snapshot->distance;
+    }
+    hours = (double)snapshot->duration / (3600.0 * TIMESTAMP_NS_PER_S);
+    if (hours > 0)
+    {
+        snapshot->fuel_per_hour = snapshot->fuel_used / hours;
+    }
+}
+
+void trip_stats_reset(void)
+{
+    pthread_mutex_lock(&trip_stats_mutex);
+    memset(&trip_stats, 0, sizeof(trip_stats));
+    pthread_mutex_unlock(&trip_stats_mutex);
+}
+
+const char *trip_stats_signal_name(trip_signal_t signal)
+{
+    return (signal < TRIP_SIGNAL_COUNT) ? trip_signal_names[signal] : "unknown";
+}
+
+const char *trip_stats_flag_name(trip_flag_t flag)
+{
+    return (flag < TRIP_FLAG_COUNT) ? trip_flag_names[flag] : "unknown";
+}
+
+void trip_stats_report(void)
+{
+    trip_stats_snapshot_t snapshot;
+    const trip_signal_stats_t *stats = NULL;
+    char line[TRIP_STATS_REPORT_LINE_SIZE];
+    size_t length = 0;
+
+    trip_stats_snapshot(&snapshot);
+    if (snapshot.frames == 0)
+    {
+        return;
+    }
+
+    log_info("trip: %u frames over %llus, %u km, fuel %u l (%.1f l/100km, %.2f l/h)",
+             snapshot.frames,
+             (unsigned long long)(snapshot.duration / TIMESTAMP_NS_PER_S),
+             snapshot.distance, snapshot.fuel_used, snapshot.fuel_per_100km, snapshot.fuel_per_hour);
+
+    for (uint32_t signal = 0; signal < TRIP_SIGNAL_COUNT; signal++)
+    {
+        stats = &snapshot.signals[signal];
+        log_info("%s: mean=%.1f sd=%.1f min=%u p50=%.0f p90=%.0f p99=%.0f max=%u",
+                 trip_signal_names[signal], stats->mean, sqrt(stats->variance), stats->min,
+                 stats->quantiles[0], stats->quantiles[1], stats->quantiles[2], stats->max);
+    }
+
+    /* Flags that were set at some point of the trip */
+    line[0] = '\0';
+    for (uint32_t flag = 0; (flag < TRIP_FLAG_COUNT) && (length < sizeof(line)); flag++)
+    {
+        if (snapshot.duty[flag] > 0)
+        {
+            length += (size_t)snprintf(&line[length], sizeof(line) - length, " %s=%.1f%%",
+                                       trip_flag_names[flag], 100.0 * snapshot.duty[flag]);
+        }
+    }
+    if (length > 0)
+    {
+        log_info("issue duty:%s", line);
+    }
+}
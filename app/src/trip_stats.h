@@ -0,0 +1,128 @@
+/**
+ * \file trip_stats.h
+ * \brief Interface of streaming trip statistics.
+ * \details Aggregate the values of each decoded MUX 100ms frame without keeping any history: running
+ *          mean and variance, fixed-bucket histograms and quantiles (t-digest sketch) of speed and engine
+ *          RPM, fuel usage and time-weighted duty cycles of the issue flags. An update costs O(1) amortized
+ *          and memory is constant whatever the trip duration. Functions are thread-safe.
+ * \author Raphael CAUSSE
+ */
+
+#ifndef TRIP_STATS_H
+#define TRIP_STATS_H
+
+/***** Includes **************************************************************/
+
+#include <stdint.h>
+#include "bcgv_api.h"
+#include "timestamp.h"
+
+/***** Definitions ***********************************************************/
+
+#define TRIP_STATS_HISTOGRAM_BUCKETS (26) /* Buckets of the widest histogram */
+
+/* Reported quantiles */
+#define TRIP_STATS_QUANTILE_COUNT (3)
+#define TRIP_STATS_QUANTILES {0.50, 0.90, 0.99}
+
+/* Distributed signals */
+typedef enum
+{
+    TRIP_SIGNAL_SPEED = 0, /* km/h, buckets of 10 km/h */
+    TRIP_SIGNAL_ENGINE_RPM, /* RPM, buckets of 500 RPM */
+    TRIP_SIGNAL_COUNT
+} trip_signal_t;
+
+/* Issue flags */
+typedef enum
+{
+    TRIP_FLAG_TYRES_PRESSION = 0,
+    TRIP_FLAG_BRAKES,
+    TRIP_FLAG_MOTOR_PRESSION,
+    TRIP_FLAG_MOTOR_TEMPERATURE_LDR,
+    TRIP_FLAG_MOTOR_OIL_OVERHEAT,
+    TRIP_FLAG_BATTERY_DISCHARGED,
+    TRIP_FLAG_BATTERY_KO,
+    TRIP_FLAG_COUNT
+} trip_flag_t;
+
+/* Values of one decoded MUX 100ms frame */
+typedef struct
+{
+    timestamp_t time; /* Frame reception (ns) */
+    distance_t distance;
+    speed_t speed;
+    issues_t chassis_issues;
+    issues_t motor_issues;
+    fuel_level_t fuel_level;
+    engine_rpm_t engine_rpm;
+    issues_t battery_issues;
+} trip_stats_frame_t;
+
+/* Distribution of one signal */
+typedef struct
+{
+    uint32_t count;   /* Number of samples */
+    uint32_t min;     /* Minimum value */
+    uint32_t max;     /* Maximum value */
+    double mean;      /* Mean value */
+    double variance;  /* Population variance */
+    double quantiles[TRIP_STATS_QUANTILE_COUNT]; /* Estimated quantiles, see TRIP_STATS_QUANTILES */
+    uint32_t bucket_width; /* Histogram bucket width */
+    uint32_t buckets;      /* Histogram buckets used, the last one also counts values above it */
+    uint32_t histogram[TRIP_STATS_HISTOGRAM_BUCKETS];
+} trip_signal_stats_t;
+
+/* Snapshot of the trip statistics */
+typedef struct
+{
+    uint32_t frames;         /* Number of frames aggregated */
+    timestamp_t duration;    /* Time from first to last frame (ns) */
+    uint32_t distance;       /* Distance traveled (km) */
+    uint32_t fuel_used;      /* Fuel consumed (l), sum of level decreases, refills excluded */
+    double fuel_per_100km;   /* Fuel usage rate (l/100km), 0 if no distance */
+    double fuel_per_hour;    /* Fuel usage rate (l/h), 0 if no duration */
+    trip_signal_stats_t signals[TRIP_SIGNAL_COUNT];
+    double duty[TRIP_FLAG_COUNT]; /* Fraction of time each flag was set, 0 to 1 */
+} trip_stats_snapshot_t;
+
+/***** Functions *************************************************************/
+
+/**
+ * \brief Aggregate the values of a decoded frame.
+ * \details Flags hold their state until the next frame, frames must come in time order.
+ * \param frame : Decoded values
+ */
+void trip_stats_update(const trip_stats_frame_t *frame);
+
+/**
+ * \brief Get a snapshot of the trip statistics.
+ * \param snapshot : Output snapshot
+ */
+void trip_stats_snapshot(trip_stats_snapshot_t *snapshot);
+
+/**
+ * \brief Reset the trip statistics, starting a new trip.
+ */
+void trip_stats_reset(void);
+
+/**
+ * \brief Get the name of a signal.
+ * \param signal : Signal
+ * \return const char* : Signal name, "unknown" for an unknown signal.
+ */
+const char *trip_stats_signal_name(trip_signal_t signal);
+
+/**
+ * \brief Get the name of an issue flag.
+ * \param flag : Flag
+ * \return const char* : Flag name, "unknown" for an unknown flag.
+ */
+const char *trip_stats_flag_name(trip_flag_t flag);
+
+/**
+ * \brief Log the trip statistics, if at least one frame was aggregated.
+ */
+void trip_stats_report(void);
+
+#endif /* TRIP_STATS_H */
@@ -1,35 +1,444 @@
 /**
- * \file log.h
+ * \file log.c
  * \brief Implementation of logging module.
  * \author Raphael CAUSSE
  */
 
 /***** Includes **************************************************************/
 
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <pthread.h>
 #include <stdarg.h>
+#include <string.h>
 #include <time.h>
+#include <unistd.h>
 #include "log.h"
+#include "timestamp.h"
 
-/***** Functions *************************************************************/
+/***** Definitions ***********************************************************/
+
+#define LOG_MESSAGE_SIZE (512) /* Fits LOG_BINARY_MAX_WORDS as a string */
+#define LOG_TIME_SIZE (20) /* "YYYY-MM-DD HH:MM:SS" */
+#define LOG_LINE_SIZE (LOG_MESSAGE_SIZE + 128) /* Message with time, level and call site */
+#define LOG_HASH_OFFSET (2166136261u) /* FNV-1a */
+#define LOG_HASH_PRIME (16777619u)
+
+/***** Extern Variables ******************************************************/
+
+log_level_t log_level = LOG_LEVEL_INFO;
+
+/***** Static Variables ******************************************************/
+
+/* Serializes the registration of call sites and the binary log writer */
+static pthread_mutex_t log_mutex = PTHREAD_MUTEX_INITIALIZER;
+static log_site_t *log_sites = NULL; /* Atomic head, sites are published complete */
+static uint32_t log_site_count = 0;
+static uint32_t log_burst = LOG_RATE_BURST; /* Atomic */
+static bool log_binary_mode = false;        /* Atomic, binary log file open */
+
+static const char *const log_level_names[LOG_LEVEL_NONE] = {"INFO", "WARN", "ERR"};
+
+/* Wall clock second formatted once per thread, lines add the monotonic time elapsed since its start */
+static __thread char log_time_text[LOG_TIME_SIZE];
+static __thread timestamp_t log_time_start = TIMESTAMP_NONE; /* Monotonic time at the start of the second (ns) */
+
+/***** Static Functions ******************************************************/
+
+/**
+ * \brief Format the wall clock second of the calling thread.
+ * \param now : Current monotonic time (ns)
+ */
+static void log_time_update(timestamp_t now)
+{
+    struct timespec wall;
+    struct tm local_time;
+
+    clock_gettime(CLOCK_REALTIME, &wall);
+    localtime_r(&wall.tv_sec, &local_time);
+    strftime(log_time_text, sizeof(log_time_text), "%Y-%m-%d %H:%M:%S", &local_time);
+    log_time_start = now - (timestamp_t)wall.tv_nsec;
+}
+
+/**
+ * \brief Write one line with a single write call, so that lines of concurrent threads are not mixed.
+ * \param now : Current monotonic time (ns)
+ * \param level : Logging level
+ * \param func : Function where the log call is made
+ * \param line : Line number in the source file
+ * \param message : Formatted message
+ */
+static void log_print(timestamp_t now, log_level_t level, const char *func, int line, const char *message)
+{
+    char text[LOG_LINE_SIZE];
+    const char *data = text;
+    size_t length = 0;
+    ssize_t written = 0;
+    int ret = 0;
+
+    /* Time formatted again only when the second changes */
+    if ((log_time_start == TIMESTAMP_NONE) || (now < log_time_start) ||
+        (now - log_time_start >= TIMESTAMP_NS_PER_S))
+    {
+        log_time_update(now);
+    }
+
+    ret = snprintf(text, sizeof(text), "[%s.%03u] [%s] %s:%d: %s\n", log_time_text,
+                   (unsigned)((now - log_time_start) / TIMESTAMP_NS_PER_MS), log_level_names[level], func, line,
+                   message);
+    if (ret < 0)
+    {
+        return;
+    }
+    length = (size_t)ret;
+    if (length >= sizeof(text))
+    {
+        /* Truncated, still ends the line */
+        length = sizeof(text) - 1;
+        text[length - 1] = '\n';
+    }
+
+    while (length > 0)
+    {
+        written = write(STDOUT_FILENO, data, length);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return;
+        }
+        data += written;
+        length -= (size_t)written;
+    }
+}
+
+/**
+ * \brief Write a binary record of a call site, defining the site first in a new file, with the mutex held.
+ * \details On a write error, the binary log file is closed and messages go back to text lines.
+ * \param now : Current monotonic time (ns)
+ * \param site : Call site state
+ * \param type : Record type
+ * \param words : Payload words
+ * \param count : Number of payload words
+ * \return bool : true if written, false if not in binary mode or on error
+ */
+static bool log_emit(timestamp_t now, log_site_t *site, log_binary_type_t type, const uint64_t *words,
+                     uint32_t count)
+{
+    if (log_binary_active() == false)
+    {
+        return false;
+    }
+
+    if (((site->generation == log_binary_generation()) ||
+         (log_binary_write_site(site->id, now, &site->binary, site->file, site->func, site->fmt) == true)) &&
+        (log_binary_write(type, site->id, now, words, count) == true))
+    {
+        site->generation = log_binary_generation();
+        return true;
+    }
+
+    log_binary_close();
+    __atomic_store_n(&log_binary_mode, false, __ATOMIC_RELAXED);
+    log_print(now, LOG_LEVEL_ERROR, __func__, __LINE__, "binary log file cannot grow, back to text");
+
+    return false;
+}
+
+/**
+ * \brief Write a binary record if in binary mode, taking the mutex only then.
+ * \param now : Current monotonic time (ns)
+ * \param site : Call site state
+ * \param type : Record type
+ * \param words : Payload words
+ * \param count : Number of payload words
+ * \return bool : true if written, false if not in binary mode or on error
+ */
+static bool log_emit_locked(timestamp_t now, log_site_t *site, log_binary_type_t type, const uint64_t *words,
+                            uint32_t count)
+{
+    bool written = false;
+
+    if (__atomic_load_n(&log_binary_mode, __ATOMIC_RELAXED) == false)
+    {
+        return false;
+    }
+
+    pthread_mutex_lock(&log_mutex);
+    written = log_emit(now, site, type, words, count);
+    pthread_mutex_unlock(&log_mutex);
+
+    return written;
+}
+
+/**
+ * \brief Write a repetition or suppression count of a call site.
+ * \param now : Current monotonic time (ns)
+ * \param site : Call site state
+ * \param type : LOG_BINARY_REPEATED or LOG_BINARY_SUPPRESSED
+ * \param count : Count, nothing written if 0
+ */
+static void log_print_count(timestamp_t now, log_site_t *site, log_binary_type_t type, uint32_t count)
+{
+    char message[LOG_MESSAGE_SIZE];
+    uint64_t word = count;
+
+    if ((count == 0) || (log_emit_locked(now, site, type, &word, 1) == true))
+    {
+        return;
+    }
+
+    if (type == LOG_BINARY_REPEATED)
+    {
+        snprintf(message, sizeof(message), "last message repeated %u times", count);
+    }
+    else
+    {
+        snprintf(message, sizeof(message), "%u messages suppressed", count);
+    }
+    log_print(now, site->level, site->func, site->line, message);
+}
 
-void log_write(const char *level, const char *func, int line, const char *fmt, ...)
+/**
+ * \brief Write the pending counts of a call site.
+ * \param now : Current monotonic time (ns)
+ * \param site : Call site state
+ */
+static void log_print_pending(timestamp_t now, log_site_t *site)
 {
-    /* Get the current time */
-    time_t now = time(NULL);
-    struct tm *local_time = localtime(&now);
+    log_print_count(now, site, LOG_BINARY_REPEATED, __atomic_exchange_n(&site->repeated, 0, __ATOMIC_RELAXED));
+    log_print_count(now, site, LOG_BINARY_SUPPRESSED, __atomic_exchange_n(&site->suppressed, 0, __ATOMIC_RELAXED));
+}
 
-    /* Format the time */
-    char time_buf[20];
-    strftime(time_buf, sizeof(time_buf), "%Y-%m-%d %H:%M:%S", local_time);
+/**
+ * \brief Register a call site at its first use.
+ * \param site : Call site state
+ * \param level : Logging level
+ * \param file : Source file
+ * \param func : Function
+ * \param line : Line number
+ * \param fmt : Format string
+ */
+static void log_register(log_site_t *site, log_level_t level, const char *file, const char *func, int line,
+                         const char *fmt)
+{
+    pthread_mutex_lock(&log_mutex);
+    if (site->registered == false)
+    {
+        site->level = level;
+        site->file = file;
+        site->func = func;
+        site->fmt = fmt;
+        site->line = line;
+        site->id = log_site_count++;
+        site->binary.line = (uint32_t)line;
+        site->binary.level = (uint8_t)level;
+        site->binary.text = (log_binary_parse(fmt, site->binary.kinds, &site->binary.args) == true) ? 0 : 1;
+        site->next = log_sites;
+        __atomic_store_n(&log_sites, site, __ATOMIC_RELEASE);
+        __atomic_store_n(&site->registered, true, __ATOMIC_RELEASE);
+    }
+    pthread_mutex_unlock(&log_mutex);
+}
 
-    /* Write the log message */
-    fprintf(stdout, "[%s] [%s] %s:%d: ", time_buf, level, func, line);
+/**
+ * \brief Check the rate limit of a call site, opening a new window when the period has elapsed.
+ * \param now : Current monotonic time (ns)
+ * \param site : Call site state
+ * \param burst : Messages per period
+ * \return bool : true if the window is full
+ */
+static bool log_rate_limited(timestamp_t now, log_site_t *site, uint32_t burst)
+{
+    uint64_t start = __atomic_load_n(&site->window_start, __ATOMIC_RELAXED);
+
+    /* The thread opening a new window reports what the previous one dropped */
+    if (((start == TIMESTAMP_NONE) || ((now > start) && (now - start >= LOG_RATE_PERIOD))) &&
+        (__atomic_compare_exchange_n(&site->window_start, &start, now, false, __ATOMIC_RELAXED,
+                                     __ATOMIC_RELAXED) == true))
+    {
+        __atomic_store_n(&site->window_count, 0, __ATOMIC_RELAXED);
+        log_print_count(now, site, LOG_BINARY_SUPPRESSED,
+                        __atomic_exchange_n(&site->suppressed, 0, __ATOMIC_RELAXED));
+    }
 
+    return __atomic_load_n(&site->window_count, __ATOMIC_RELAXED) >= burst;
+}
+
+/**
+ * \brief Hash a message.
+ * \param data : Formatted message, or argument words in binary mode
+ * \param size : Size (bytes)
+ * \return uint32_t : FNV-1a hash
+ */
+static uint32_t log_hash(const void *data, size_t size)
+{
+    const uint8_t *bytes = (const uint8_t *)data;
+    uint32_t hash = LOG_HASH_OFFSET;
+
+    for (size_t i = 0; i < size; i++)
+    {
+        hash = (hash ^ bytes[i]) * LOG_HASH_PRIME;
+    }
+
+    return hash;
+}
+
+/***** Functions *************************************************************/
+
+/*
+ * Every log_warn and log_error call site owns a static state, allocated by the macro, used to:
+ * - suppress a message identical to the previous one of the same site, reported later as
+ *   "last message repeated N times";
+ * - write at most LOG_RATE_BURST messages per site every LOG_RATE_PERIOD, further messages are
+ *   counted and reported as "N messages suppressed".
+ * log_info messages, reports and notices, are always written.
+ * Call site states are updated with atomic operations, so a message suppressed or rate limited takes no lock.
+ * Lines are formatted by the calling thread and written with a single write() call, only the first use of a
+ * call site and binary records are serialized by log_mutex. The date and time are formatted only when the
+ * second changes. In binary mode, messages are written as records without being formatted and rendered
+ * offline by tools/bin/log_decode.
+ */
+void log_write(log_site_t *site, log_level_t level, const char *file, const char *func, int line, const char *fmt,
+               ...)
+{
+    char message[LOG_MESSAGE_SIZE];
+    uint64_t words[LOG_BINARY_MAX_WORDS];
+    uint32_t count = 0;
+    uint32_t burst = 0;
+    bool binary = false;
+    timestamp_t now = TIMESTAMP_NONE;
+    timestamp_t last_time = TIMESTAMP_NONE;
+    uint32_t hash = 0;
+    bool limited = false;
     va_list args;
+
+    if ((uint32_t)level >= LOG_LEVEL_NONE)
+    {
+        return;
+    }
+
+    if (__atomic_load_n(&site->registered, __ATOMIC_ACQUIRE) == false)
+    {
+        log_register(site, level, file, func, line, fmt);
+    }
+    now = timestamp_now();
+    burst = __atomic_load_n(&log_burst, __ATOMIC_RELAXED);
+    limited = (level > LOG_LEVEL_INFO) && (burst > 0);
+
+    /* Dropped before formatting */
+    if ((limited == true) && (log_rate_limited(now, site, burst) == true))
+    {
+        __atomic_fetch_add(&site->suppressed, 1, __ATOMIC_RELAXED);
+        return;
+    }
+
+    /* Binary mode keeps arguments as they are, unless the format is not supported */
+    binary = __atomic_load_n(&log_binary_mode, __ATOMIC_RELAXED);
     va_start(args, fmt);
-    vfprintf(stdout, fmt, args);
+    if ((binary == true) && (site->binary.text == 0))
+    {
+        count = log_binary_pack(site->binary.kinds, site->binary.args, args, words);
+    }
+    else
+    {
+        vsnprintf(message, sizeof(message), fmt, args);
+        if (binary == true)
+        {
+            count = log_binary_pack_string(message, sizeof(message), words);
+        }
+    }
     va_end(args);
 
-    fprintf(stdout, "\n");
-    fflush(stdout);
-}
\ No newline at end of file
+    if (limited == true)
+    {
+        /* Same message as the last one written, until written again after LOG_REPEAT_PERIOD */
+        hash = (binary == true) ? log_hash(words, count * sizeof(uint64_t)) : log_hash(message, strlen(message));
+        last_time = __atomic_load_n(&site->last_time, __ATOMIC_RELAXED);
+        if ((last_time != TIMESTAMP_NONE) && (hash == __atomic_load_n(&site->hash, __ATOMIC_RELAXED)) &&
+            ((now < last_time) || (now - last_time < LOG_REPEAT_PERIOD)))
+        {
+            __atomic_fetch_add(&site->repeated, 1, __ATOMIC_RELAXED);
+            return;
+        }
+
+        /* Slot taken in the window, another thread may have filled it meanwhile */
+        if (__atomic_fetch_add(&site->window_count, 1, __ATOMIC_RELAXED) >= burst)
+        {
+            __atomic_fetch_add(&site->suppressed, 1, __ATOMIC_RELAXED);
+            return;
+        }
+        __atomic_store_n(&site->hash, hash, __ATOMIC_RELAXED);
+        __atomic_store_n(&site->last_time, now, __ATOMIC_RELAXED);
+        log_print_count(now, site, LOG_BINARY_REPEATED, __atomic_exchange_n(&site->repeated, 0, __ATOMIC_RELAXED));
+    }
+
+    if (binary == false)
+    {
+        log_print(now, level, func, line, message);
+    }
+    else if (log_emit_locked(now, site, LOG_BINARY_MESSAGE, words, count) == false)
+    {
+        va_start(args, fmt);
+        vsnprintf(message, sizeof(message), fmt, args);
+        va_end(args);
+        log_print(now, level, func, line, message);
+    }
+}
+
+void log_set_level(log_level_t level)
+{
+    log_level = level;
+}
+
+void log_set_rate_limit(uint32_t burst)
+{
+    __atomic_store_n(&log_burst, burst, __ATOMIC_RELAXED);
+}
+
+bool log_open_binary(const char *path)
+{
+    bool success = false;
+
+    pthread_mutex_lock(&log_mutex);
+    success = log_binary_open(path, timestamp_now());
+    __atomic_store_n(&log_binary_mode, log_binary_active(), __ATOMIC_RELAXED);
+    pthread_mutex_unlock(&log_mutex);
+
+    return success;
+}
+
+void log_close_binary(void)
+{
+    char message[LOG_MESSAGE_SIZE];
+    bool truncated = true;
+
+    log_flush();
+
+    pthread_mutex_lock(&log_mutex);
+    truncated = log_binary_close();
+    if (truncated == false)
+    {
+        snprintf(message, sizeof(message), "cannot truncate binary log file: %s", strerror(errno));
+    }
+    __atomic_store_n(&log_binary_mode, false, __ATOMIC_RELAXED);
+    pthread_mutex_unlock(&log_mutex);
+
+    if (truncated == false)
+    {
+        log_print(timestamp_now(), LOG_LEVEL_WARN, __func__, __LINE__, message);
+    }
+}
+
+void log_flush(void)
+{
+    timestamp_t now = timestamp_now();
+
+    for (log_site_t *site = __atomic_load_n(&log_sites, __ATOMIC_ACQUIRE); site != NULL; site = site->next)
+    {
+        log_print_pending(now, site);
+    }
+}
@@ -1,6 +1,8 @@
 /**
  * \file log.h
  * \brief Interface of logging module.
+ * \details log_warn and log_error messages are deduplicated and rate limited per call site, optionally written
+ *          as binary records (see log_binary.h). Messages below LOG_MIN_LEVEL compile to nothing.
  * \author Raphael CAUSSE
  */
 
@@ -9,23 +11,152 @@
 
 /***** Includes **************************************************************/
 
+#include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
+#include "log_binary.h"
+
+/***** Definitions ***********************************************************/
+
+/* Logging levels, messages below current level are not written. Macros rather than an enum, so that
+   LOG_MIN_LEVEL can be given by name and compared by the preprocessor */
+#define LOG_LEVEL_INFO (0)
+#define LOG_LEVEL_WARN (1)
+#define LOG_LEVEL_ERROR (2)
+#define LOG_LEVEL_NONE (3)
+
+typedef int32_t log_level_t;
+
+/* Minimum level compiled in, as a number or a level name (-DLOG_MIN_LEVEL=LOG_LEVEL_WARN). Messages below
+   compile to nothing: their arguments are not evaluated but still count as used */
+#ifndef LOG_MIN_LEVEL
+#define LOG_MIN_LEVEL LOG_LEVEL_INFO
+#endif
+#if (LOG_MIN_LEVEL < LOG_LEVEL_INFO) || (LOG_MIN_LEVEL > LOG_LEVEL_NONE)
+#error "LOG_MIN_LEVEL must be 0 to 3, or LOG_LEVEL_INFO to LOG_LEVEL_NONE"
+#endif
+
+#define LOG_RATE_BURST (10)                     /* Default messages per site and period, 0 for no limit */
+#define LOG_RATE_PERIOD (1000000000ULL)         /* Rate limiting period (ns) */
+#define LOG_REPEAT_PERIOD (10000000000ULL)      /* Repeated message written again after this delay (ns) */
+
+/* Call site state, zero-initialized */
+typedef struct log_site
+{
+    struct log_site *next;    /* Registered sites, see log_flush() */
+    log_level_t level;        /* Level */
+    const char *file;         /* Source file */
+    const char *func;         /* Function name */
+    const char *fmt;          /* Format string */
+    int line;                 /* Line number */
+    bool registered;          /* In the list of sites, fields above and below set */
+    uint32_t id;              /* Call site id, in order of first use */
+    uint32_t generation;      /* Binary log file the site is defined in */
+    log_binary_site_t binary; /* Definition in binary log files */
+    /* Atomic accesses only */
+    uint32_t hash;            /* Hash of the last message written */
+    uint32_t repeated;        /* Messages identical to the last one, not written */
+    uint64_t last_time;       /* Time the last message was written (ns) */
+    uint64_t window_start;    /* Start of the rate limiting window (ns) */
+    uint32_t window_count;    /* Messages written in the window */
+    uint32_t suppressed;      /* Messages dropped by rate limiting in the window */
+} log_site_t;
+
+/***** Extern Variables ******************************************************/
+
+extern log_level_t log_level;
 
 /***** Macros ****************************************************************/
 
-#define log_info(fmt, ...) log_write("INFO", __func__, __LINE__, fmt, ##__VA_ARGS__)
-#define log_warn(fmt, ...) log_write("WARN", __func__, __LINE__, fmt, ##__VA_ARGS__)
-#define log_error(fmt, ...) log_write("ERR", __func__, __LINE__, fmt, ##__VA_ARGS__)
+#define log_site_write(lvl, fmt, ...)                                                     \
+    do                                                                                    \
+    {                                                                                     \
+        static log_site_t log_site_;                                                      \
+        if (log_level <= (lvl))                                                           \
+        {                                                                                 \
+            log_write(&log_site_, lvl, __FILE__, __func__, __LINE__, fmt, ##__VA_ARGS__); \
+        }                                                                                 \
+    } while (0)
+
+/* Compiled out, arguments are not evaluated */
+#define log_discard(fmt, ...)                                                             \
+    do                                                                                    \
+    {                                                                                     \
+        if (0)                                                                            \
+        {                                                                                 \
+            log_check(fmt, ##__VA_ARGS__);                                                \
+        }                                                                                 \
+    } while (0)
+
+#if LOG_MIN_LEVEL <= LOG_LEVEL_INFO
+#define log_info(fmt, ...) log_site_write(LOG_LEVEL_INFO, fmt, ##__VA_ARGS__)
+#else
+#define log_info(fmt, ...) log_discard(fmt, ##__VA_ARGS__)
+#endif
+
+#if LOG_MIN_LEVEL <= LOG_LEVEL_WARN
+#define log_warn(fmt, ...) log_site_write(LOG_LEVEL_WARN, fmt, ##__VA_ARGS__)
+#else
+#define log_warn(fmt, ...) log_discard(fmt, ##__VA_ARGS__)
+#endif
+
+#if LOG_MIN_LEVEL <= LOG_LEVEL_ERROR
+#define log_error(fmt, ...) log_site_write(LOG_LEVEL_ERROR, fmt, ##__VA_ARGS__)
+#else
+#define log_error(fmt, ...) log_discard(fmt, ##__VA_ARGS__)
+#endif
 
 /***** Functions *************************************************************/
 
 /**
- * \brief Writes a log message to the log file or console.
- * \param level : Logging level (e.g., "INFO", "WARN", "ERROR").
+ * \brief Writes a log message to the log file or console, unless repeated or rate limited.
+ * \param site : Call site state
+ * \param level : Logging level
+ * \param file : Source file of the log call.
  * \param func : Function where the log call is made.
  * \param line : Line number in the source file.
  * \param fmt : Format string (similar to printf).
  */
-void log_write(const char *level, const char *func, int line, const char *fmt, ...);
+void log_write(log_site_t *site, log_level_t level, const char *file, const char *func, int line, const char *fmt,
+               ...);
+
+/**
+ * \brief Sink of compiled out messages, never called.
+ * \param fmt : Format string
+ */
+static inline void log_check(const char *fmt, ...)
+{
+    (void)fmt;
+}
+
+/**
+ * \brief Set the minimum level of written log messages.
+ * \param level : Minimum logging level
+ */
+void log_set_level(log_level_t level);
+
+/**
+ * \brief Set the number of messages written per call site and LOG_RATE_PERIOD.
+ * \param burst : Messages per period, 0 to disable rate limiting and repetition suppression
+ */
+void log_set_rate_limit(uint32_t burst);
+
+/**
+ * \brief Write messages as binary records to a file instead of text lines.
+ * \param path : File path, truncated if it exists
+ * \return bool : true on success, false otherwise
+ */
+bool log_open_binary(const char *path);
+
+/**
+ * \brief Close the binary log file, messages are written as text lines again.
+ * \details A failure to truncate the file to its records is logged as a warning, the file stays readable.
+ */
+void log_close_binary(void);
+
+/**
+ * \brief Write the pending repetition and suppression counts of every call site.
+ */
+void log_flush(void);
 
-#endif /* LOG_H */
\ No newline at end of file
+#endif /* LOG_H */
@@ -0,0 +1,425 @@
+/**
+ * \file log_binary.c
+ * \brief Implementation of the binary log format.
+ * \author Raphael CAUSSE
+ */
+
+/***** Includes **************************************************************/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "log_binary.h"
+
+/***** Definitions ***********************************************************/
+
+#define LOG_BINARY_WORD_SIZE (sizeof(uint64_t))
+#define LOG_BINARY_NS_PER_S (1000000000ULL)
+
+/***** Static Variables ******************************************************/
+
+static int log_binary_fd = -1;
+static uint8_t *log_binary_window = NULL;  /* Mapped window */
+static uint64_t log_binary_offset = 0;     /* File offset of the window, page aligned */
+static uint64_t log_binary_used = 0;       /* Bytes used in the window */
+static uint32_t log_binary_generations = 0;
+
+/***** Static Functions ******************************************************/
+
+/**
+ * \brief Map the window starting at a file offset, growing the file.
+ * \param offset : File offset, page aligned
+ * \return bool : true on success, false otherwise
+ */
+static bool log_binary_map(uint64_t offset)
+{
+    void *window = NULL;
+
+    if (ftruncate(log_binary_fd, (off_t)(offset + LOG_BINARY_WINDOW_SIZE)) != 0)
+    {
+        return false;
+    }
+    window = mmap(NULL, LOG_BINARY_WINDOW_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, log_binary_fd, (off_t)offset);
+    if (window == MAP_FAILED)
+    {
+        return false;
+    }
+
+    log_binary_window = (uint8_t *)window;
+    log_binary_offset = offset;
+
+    return true;
+}
+
+/**
+ * \brief Reserve space for a record, moving the window forward when full.
+ * \param size : Record size (bytes), multiple of 8
+ * \return uint8_t * : Record address, NULL on error
+ */
+static uint8_t *log_binary_reserve(uint64_t size)
+{
+    uint64_t end = log_binary_offset + log_binary_used;
+    uint64_t offset = 0;
+
+    if (log_binary_window == NULL)
+    {
+        return NULL;
+    }
+
+    if (log_binary_used + size > LOG_BINARY_WINDOW_SIZE)
+    {
+        offset = end - (end % (uint64_t)sysconf(_SC_PAGESIZE));
+
+        /* Records already written stay in the file, the new window starts at their last page */
+        munmap(log_binary_window, LOG_BINARY_WINDOW_SIZE);
+        log_binary_window = NULL;
+        if (log_binary_map(offset) == false)
+        {
+            return NULL;
+        }
+        log_binary_used = end - offset;
+    }
+
+    return &log_binary_window[log_binary_used];
+}
+
+/***** Functions *************************************************************/
+
+int log_binary_next_conversion(const char *fmt, log_binary_conversion_t *conversion)
+{
+    const char *c = strchr(fmt, '%');
+    uint32_t longs = 0;
+    char length = '\0';
+
+    if (c == NULL)
+    {
+        return 0;
+    }
+    conversion->start = c++;
+
+    /* Flags, width, precision */
+    while ((*c == '-') || (*c == '+') || (*c == ' ') || (*c == '#') || (*c == '0'))
+    {
+        c++;
+    }
+    while ((*c >= '0') && (*c <= '9'))
+    {
+        c++;
+    }
+    if (*c == '.')
+    {
+        c++;
+        while ((*c >= '0') && (*c <= '9'))
+        {
+            c++;
+        }
+    }
+
+    /* Length modifier */
+    if ((*c == 'h') || (*c == 'z') || (*c == 'j') || (*c == 't'))
+    {
+        length = *c++;
+        if ((length == 'h') && (*c == 'h'))
+        {
+            c++;
+        }
+    }
+    while ((*c == 'l') && (longs < 2))
+    {
+        longs++;
+        c++;
+    }
+
+    switch (*c)
+    {
+    case 'd':
+    case 'i':
+        conversion->kind = (longs == 2)     ? LOG_ARG_LLONG
+                           : (longs == 1)   ? LOG_ARG_LONG
+                           : (length == 'z') ? LOG_ARG_SIZE
+                           : (length == 'j') ? LOG_ARG_INTMAX
+                           : (length == 't') ? LOG_ARG_PTRDIFF
+                                             : LOG_ARG_INT;
+        break;
+    case 'o':
+    case 'u':
+    case 'x':
+    case 'X':
+        conversion->kind = (longs == 2)     ? LOG_ARG_ULLONG
+                           : (longs == 1)   ? LOG_ARG_ULONG
+                           : (length == 'z') ? LOG_ARG_SIZE
+                           : (length == 'j') ? LOG_ARG_UINTMAX
+                           : (length == 't') ? LOG_ARG_PTRDIFF
+                                             : LOG_ARG_UINT;
+        break;
+    case 'c':
+        conversion->kind = LOG_ARG_INT;
+        break;
+    case 'f':
+    case 'F':
+    case 'e':
+    case 'E':
+    case 'g':
+    case 'G':
+    case 'a':
+    case 'A':
+        conversion->kind = LOG_ARG_DOUBLE;
+        break;
+    case 's':
+        conversion->kind = LOG_ARG_STRING;
+        break;
+    case 'p':
+        conversion->kind = LOG_ARG_POINTER;
+        break;
+    case '%':
+        conversion->kind = LOG_ARG_NONE;
+        break;
+    default:
+        return -1;
+    }
+
+    /* Wide characters and strings */
+    if ((longs > 0) && ((*c == 'c') || (*c == 's')))
+    {
+        return -1;
+    }
+
+    conversion->length = (size_t)(c + 1 - conversion->start);
+
+    return 1;
+}
+
+bool log_binary_parse(const char *fmt, uint8_t *kinds, uint8_t *args)
+{
+    log_binary_conversion_t conversion;
+    int found = 0;
+
+    *args = 0;
+    while ((found = log_binary_next_conversion(fmt, &conversion)) == 1)
+    {
+        fmt = conversion.start + conversion.length;
+        if (conversion.kind == LOG_ARG_NONE)
+        {
+            continue;
+        }
+        if (*args == LOG_BINARY_MAX_ARGS)
+        {
+            return false;
+        }
+        kinds[(*args)++] = (uint8_t)conversion.kind;
+    }
+
+    return found == 0;
+}
+
+uint32_t log_binary_pack(const uint8_t *kinds, uint8_t args, va_list list, uint64_t *words)
+{
+    uint32_t count = 0;
+    double value = 0;
+
+    for (uint8_t arg = 0; arg < args; arg++)
+    {
+        switch (kinds[arg])
+        {
+        case LOG_ARG_INT:
+            words[count++] = (uint64_t)(int64_t)va_arg(list, int);
+            break;
+        case LOG_ARG_UINT:
+            words[count++] = (uint64_t)va_arg(list, unsigned int);
+            break;
+        case LOG_ARG_LONG:
+            words[count++] = (uint64_t)(int64_t)va_arg(list, long);
+            break;
+        case LOG_ARG_ULONG:
+            words[count++] = (uint64_t)va_arg(list, unsigned long);
+            break;
+        case LOG_ARG_LLONG:
+            words[count++] = (uint64_t)va_arg(list, long long);
+            break;
+        case LOG_ARG_ULLONG:
+            words[count++] = (uint64_t)va_arg(list, unsigned long long);
+            break;
+        case LOG_ARG_SIZE:
+            words[count++] = (uint64_t)va_arg(list, size_t);
+            break;
+        case LOG_ARG_INTMAX:
+            words[count++] = (uint64_t)va_arg(list, intmax_t);
+            break;
+        case LOG_ARG_UINTMAX:
+            words[count++] = (uint64_t)va_arg(list, uintmax_t);
+            break;
+        case LOG_ARG_PTRDIFF:
+            words[count++] = (uint64_t)va_arg(list, ptrdiff_t);
+            break;
+        case LOG_ARG_DOUBLE:
+            value = va_arg(list, double);
+            memcpy(&words[count++], &value, sizeof(value));
+            break;
+        case LOG_ARG_STRING:
+            count += log_binary_pack_string(va_arg(list, const char *), LOG_BINARY_STRING_SIZE, &words[count]);
+            break;
+        case LOG_ARG_POINTER:
+            words[count++] = (uint64_t)(uintptr_t)va_arg(list, void *);
+            break;
+        default:
+            break;
+        }
+    }
+
+    return count;
+}
+
+uint32_t log_binary_pack_string(const char *string, size_t size, uint64_t *words)
+{
+    size_t length = (string != NULL) ? strnlen(string, size - 1) : 0;
+    uint32_t count = (uint32_t)((length + LOG_BINARY_WORD_SIZE - 1) / LOG_BINARY_WORD_SIZE);
+
+    words[0] = length;
+    if (count > 0)
+    {
+        words[count] = 0; /* Padding of the last word */
+        memcpy(&words[1], string, length);
+    }
+
+    return 1 + count;
+}
+
+bool log_binary_open(const char *path, uint64_t now)
+{
+    log_binary_header_t *header = NULL;
+    struct timespec wall;
+
+    log_binary_close();
+
+    log_binary_fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (log_binary_fd == -1)
+    {
+        return false;
+    }
+    if (log_binary_map(0) == false)
+    {
+        close(log_binary_fd);
+        log_binary_fd = -1;
+        return false;
+    }
+
+    clock_gettime(CLOCK_REALTIME, &wall);
+    header = (log_binary_header_t *)log_binary_window;
+    memcpy(header->magic, LOG_BINARY_MAGIC, sizeof(header->magic));
+    header->version = LOG_BINARY_VERSION;
+    header->word_size = LOG_BINARY_WORD_SIZE;
+    header->start_time = now;
+    header->start_wall = ((uint64_t)wall.tv_sec * LOG_BINARY_NS_PER_S) + (uint64_t)wall.tv_nsec;
+    log_binary_used = sizeof(log_binary_header_t);
+    log_binary_generations++;
+
+    return true;
+}
+
+bool log_binary_close(void)
+{
+    uint64_t end = log_binary_offset + log_binary_used;
+    bool truncated = true;
+    int error = 0;
+
+    if (log_binary_fd == -1)
+    {
+        return true;
+    }
+
+    if (log_binary_window != NULL)
+    {
+        msync(log_binary_window, LOG_BINARY_WINDOW_SIZE, MS_SYNC);
+        munmap(log_binary_window, LOG_BINARY_WINDOW_SIZE);
+        log_binary_window = NULL;
+    }
+    /* Left at the window size on failure, the zeroed space after the last record reads as LOG_BINARY_END */
+    if (ftruncate(log_binary_fd, (off_t)end) != 0)
+    {
+        truncated = false;
+        error = errno;
+    }
+    close(log_binary_fd);
+    log_binary_fd = -1;
+    log_binary_offset = 0;
+    log_binary_used = 0;
+
+    if (truncated == false)
+    {
+        errno = error;
+    }
+
+    return truncated;
+}
+
+bool log_binary_active(void)
+{
+    return log_binary_window != NULL;
+}
+
+uint32_t log_binary_generation(void)
+{
+    return log_binary_generations;
+}
+
+bool log_binary_write(log_binary_type_t type, uint32_t site, uint64_t now, const uint64_t *words, uint32_t count)
+{
+    uint64_t size = sizeof(log_binary_record_t) + (count * LOG_BINARY_WORD_SIZE);
+    uint8_t *address = log_binary_reserve(size);
+    log_binary_record_t *record = (log_binary_record_t *)address;
+
+    if (address == NULL)
+    {
+        return false;
+    }
+
+    /* Payload first, the record reads as LOG_BINARY_END until its type is set */
+    memcpy(address + sizeof(log_binary_record_t), words, count * LOG_BINARY_WORD_SIZE);
+    record->words = (uint16_t)count;
+    record->site = site;
+    record->time = now;
+    record->type = (uint8_t)type;
+    log_binary_used += size;
+
+    return true;
+}
+
+bool log_binary_write_site(uint32_t id, uint64_t now, const log_binary_site_t *site, const char *file,
+                           const char *func, const char *fmt)
+{
+    size_t lengths[3] = {strlen(file) + 1, strlen(func) + 1, strlen(fmt) + 1};
+    const char *strings[3] = {file, func, fmt};
+    uint64_t payload = sizeof(log_binary_site_t) + lengths[0] + lengths[1] + lengths[2];
+    uint32_t count = (uint32_t)((payload + LOG_BINARY_WORD_SIZE - 1) / LOG_BINARY_WORD_SIZE);
+    uint64_t size = sizeof(log_binary_record_t) + (count * LOG_BINARY_WORD_SIZE);
+    uint8_t *address = (count <= UINT16_MAX) ? log_binary_reserve(size) : NULL;
+    log_binary_record_t *record = (log_binary_record_t *)address;
+    uint8_t *data = NULL;
+
+    if (address == NULL)
+    {
+        return false;
+    }
+    data = address + sizeof(log_binary_record_t);
+
+    memset(data, 0, count * LOG_BINARY_WORD_SIZE);
+    memcpy(data, site, sizeof(log_binary_site_t));
+    data += sizeof(log_binary_site_t);
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        memcpy(data, strings[i], lengths[i]);
+        data += lengths[i];
+    }
+    record->words = (uint16_t)count;
+    record->site = id;
+    record->time = now;
+    record->type = LOG_BINARY_SITE;
+    log_binary_used += size;
+
+    return true;
+}
@@ -0,0 +1,203 @@
+/**
+ * \file log_binary.h
+ * \brief Interface of the binary log format.
+ * \details In binary mode, log messages are not formatted: a record holds the id of its call site, a monotonic
+ *          timestamp and the raw words of its arguments, string arguments being copied. The first record of a
+ *          call site defines it (level, file, function, line and format string), so a log file carries its own
+ *          table of call sites and tools/bin/log_decode renders it offline as the text logger would have.
+ *          Records are appended to a window of the file mapped in memory, the file grows by one window when
+ *          it is full. The writer is not thread-safe, log.c serializes it.
+ *
+ *          File layout, host byte order (decode on the same architecture), in 8-byte words:
+ *          - Header (log_binary_header_t)
+ *          - Records: log_binary_record_t followed by its payload words, until a record of type
+ *            LOG_BINARY_END (zeroed space left by a crash) or the end of the file
+ *          Payloads:
+ *          - LOG_BINARY_SITE: log_binary_site_t, then file, function and format strings, NUL-terminated
+ *          - LOG_BINARY_MESSAGE: one word per argument, strings as a length word followed by their bytes
+ *          - LOG_BINARY_REPEATED, LOG_BINARY_SUPPRESSED: one word, the count
+ * \author Raphael CAUSSE
+ */
+
+#ifndef LOG_BINARY_H
+#define LOG_BINARY_H
+
+/***** Includes **************************************************************/
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/***** Definitions ***********************************************************/
+
+#define LOG_BINARY_MAGIC "BLOG"
+#define LOG_BINARY_VERSION (1)
+#define LOG_BINARY_MAX_ARGS (8)
+#define LOG_BINARY_STRING_SIZE (64)             /* String arguments longer than this are truncated */
+#define LOG_BINARY_MAX_WORDS (80)               /* Payload words of a record */
+#define LOG_BINARY_WINDOW_SIZE (1024 * 1024)    /* Mapped window, file growth step (bytes) */
+
+/* Record types */
+typedef enum
+{
+    LOG_BINARY_END = 0,
+    LOG_BINARY_SITE,
+    LOG_BINARY_MESSAGE,
+    LOG_BINARY_REPEATED,
+    LOG_BINARY_SUPPRESSED
+} log_binary_type_t;
+
+/* Argument kinds, after default promotions */
+typedef enum
+{
+    LOG_ARG_NONE = 0, /* "%%" */
+    LOG_ARG_INT,
+    LOG_ARG_UINT,
+    LOG_ARG_LONG,
+    LOG_ARG_ULONG,
+    LOG_ARG_LLONG,
+    LOG_ARG_ULLONG,
+    LOG_ARG_SIZE,
+    LOG_ARG_INTMAX,
+    LOG_ARG_UINTMAX,
+    LOG_ARG_PTRDIFF,
+    LOG_ARG_DOUBLE,
+    LOG_ARG_STRING,
+    LOG_ARG_POINTER
+} log_arg_t;
+
+/* One conversion of a format string */
+typedef struct
+{
+    const char *start; /* '%' */
+    size_t length;     /* Up to the conversion character included */
+    log_arg_t kind;    /* Argument consumed */
+} log_binary_conversion_t;
+
+/* File header, 32 bytes */
+typedef struct
+{
+    char magic[4];        /* LOG_BINARY_MAGIC */
+    uint16_t version;     /* LOG_BINARY_VERSION */
+    uint16_t word_size;   /* sizeof(uint64_t) */
+    uint32_t reserved;
+    uint32_t reserved2;
+    uint64_t start_time;  /* Monotonic time at opening (ns) */
+    uint64_t start_wall;  /* Wall clock time at opening (ns since the Epoch) */
+} log_binary_header_t;
+
+/* Record header, 16 bytes */
+typedef struct
+{
+    uint8_t type;   /* See log_binary_type_t */
+    uint8_t reserved;
+    uint16_t words; /* Payload words following */
+    uint32_t site;  /* Call site id */
+    uint64_t time;  /* Monotonic time (ns) */
+} log_binary_record_t;
+
+/* Call site definition, 16 bytes, followed by its strings */
+typedef struct
+{
+    uint32_t line;  /* Line number */
+    uint8_t level;  /* See LOG_LEVEL_INFO to LOG_LEVEL_ERROR */
+    uint8_t args;   /* Arguments in a message record */
+    uint8_t text;   /* Format not supported, messages hold the formatted text as one string */
+    uint8_t reserved;
+    uint8_t kinds[LOG_BINARY_MAX_ARGS]; /* See log_arg_t */
+} log_binary_site_t;
+
+/***** Functions *************************************************************/
+
+/**
+ * \brief Find the next conversion of a format string.
+ * \details Flags, width, precision and length modifiers hh, h, l, ll, z, j, t are supported. "*" width or
+ *          precision, L, %n and wide characters are not.
+ * \param fmt : Format string, after the previous conversion
+ * \param conversion : Output conversion
+ * \return int : 1 if found, 0 at the end of the format, -1 if not supported
+ */
+int log_binary_next_conversion(const char *fmt, log_binary_conversion_t *conversion);
+
+/**
+ * \brief Get the argument kinds of a format string.
+ * \param fmt : Format string
+ * \param kinds : Output kinds, LOG_BINARY_MAX_ARGS
+ * \param args : Output number of arguments
+ * \return bool : true if supported, false otherwise
+ */
+bool log_binary_parse(const char *fmt, uint8_t *kinds, uint8_t *args);
+
+/**
+ * \brief Copy arguments as payload words.
+ * \param kinds : Argument kinds
+ * \param args : Number of arguments
+ * \param list : Arguments
+ * \param words : Output words, LOG_BINARY_MAX_WORDS
+ * \return uint32_t : Words used
+ */
+uint32_t log_binary_pack(const uint8_t *kinds, uint8_t args, va_list list, uint64_t *words);
+
+/**
+ * \brief Copy a string as payload words, a length word followed by its bytes.
+ * \param string : String
+ * \param size : Longest length kept, terminating NUL included
+ * \param words : Output words, at least 1 + size / 8
+ * \return uint32_t : Words used
+ */
+uint32_t log_binary_pack_string(const char *string, size_t size, uint64_t *words);
+
+/**
+ * \brief Create the binary log file, truncated if it exists.
+ * \param path : File path
+ * \param now : Current monotonic time (ns)
+ * \return bool : true on success, false otherwise
+ */
+bool log_binary_open(const char *path, uint64_t now);
+
+/**
+ * \brief Flush and close the binary log file, truncated to its records.
+ * \details If the truncation fails, the file is closed at its mapped size and stays readable: the zeroed space
+ *          after the last record reads as LOG_BINARY_END.
+ * \return bool : true if closed and truncated or if no file is open, false if the truncation failed (errno set)
+ */
+bool log_binary_close(void);
+
+/**
+ * \brief Check whether a binary log file is open.
+ * \return bool : true if open
+ */
+bool log_binary_active(void);
+
+/**
+ * \brief Get the generation of the open file, call sites are defined again in each file.
+ * \return uint32_t : Generation, incremented at each opening
+ */
+uint32_t log_binary_generation(void);
+
+/**
+ * \brief Append a record.
+ * \param type : Record type
+ * \param site : Call site id
+ * \param now : Current monotonic time (ns)
+ * \param words : Payload words
+ * \param count : Number of payload words
+ * \return bool : true on success, false if the file cannot grow
+ */
+bool log_binary_write(log_binary_type_t type, uint32_t site, uint64_t now, const uint64_t *words, uint32_t count);
+
+/**
+ * \brief Append a call site definition.
+ * \param id : Call site id
+ * \param now : Current monotonic time (ns)
+ * \param site : Definition
+ * \param file : Source file
+ * \param func : Function
+ * \param fmt : Format string
+ * \return bool : true on success, false otherwise
+ */
+bool log_binary_write_site(uint32_t id, uint64_t now, const log_binary_site_t *site, const char *file,
+                           const char *func, const char *fmt);
+
+#endif /* LOG_BINARY_H */
@@ -0,0 +1,111 @@
+/**
+ * \file probe.h
+ * \brief Static tracepoints (USDT).
+ * \details PROBEn(name, args...) places a probe "bcgv:name" with n arguments. A probe is a single nop and an
+ *          ELF note (.note.stapsdt) describing where its arguments live, nothing runs unless a tracer such as
+ *          bpftrace or perf attaches to it. Arguments are passed as 64-bit signed integers, pointers to
+ *          strings included.
+ *          The notes come from <sys/sdt.h> (systemtap-sdt-dev) when available, otherwise they are emitted
+ *          here in the same format on x86-64 and AArch64. Probes compile to nothing on other targets or
+ *          when built with NO_PROBES.
+ *          List the probes of a binary with: readelf -n bin/app | grep -A3 stapsdt
+ * \author Raphael CAUSSE
+ */
+
+#ifndef PROBE_H
+#define PROBE_H
+
+/***** Includes **************************************************************/
+
+#include <stdint.h>
+
+/***** Definitions ***********************************************************/
+
+#define PROBE_PROVIDER bcgv
+
+#if defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#define PROBE_HAVE_SDT_H
+#endif
+#endif
+
+/***** Macros ****************************************************************/
+
+#if defined(NO_PROBES)
+
+#define PROBE0(name) do { } while (0)
+#define PROBE1(name, a1) do { (void)(a1); } while (0)
+#define PROBE2(name, a1, a2) do { (void)(a1); (void)(a2); } while (0)
+#define PROBE3(name, a1, a2, a3) do { (void)(a1); (void)(a2); (void)(a3); } while (0)
+#define PROBE4(name, a1, a2, a3, a4) do { (void)(a1); (void)(a2); (void)(a3); (void)(a4); } while (0)
+
+#elif defined(PROBE_HAVE_SDT_H)
+
+#include <sys/sdt.h>
+
+#define PROBE0(name) DTRACE_PROBE(PROBE_PROVIDER, name)
+#define PROBE1(name, a1) DTRACE_PROBE1(PROBE_PROVIDER, name, (int64_t)(a1))
+#define PROBE2(name, a1, a2) DTRACE_PROBE2(PROBE_PROVIDER, name, (int64_t)(a1), (int64_t)(a2))
+#define PROBE3(name, a1, a2, a3) \
+    DTRACE_PROBE3(PROBE_PROVIDER, name, (int64_t)(a1), (int64_t)(a2), (int64_t)(a3))
+#define PROBE4(name, a1, a2, a3, a4) \
+    DTRACE_PROBE4(PROBE_PROVIDER, name, (int64_t)(a1), (int64_t)(a2), (int64_t)(a3), (int64_t)(a4))
+
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__aarch64__))
+
+/* SystemTap SDT note, version 3: probe address, base address, semaphore (none), provider, name, arguments */
+#define PROBE_NOTE(name, args)                                               \
+    "990: nop\n"                                                             \
+    ".pushsection .note.stapsdt,\"?\",\"note\"\n"                            \
+    ".balign 4\n"                                                            \
+    ".4byte 992f-991f, 994f-993f, 3\n"                                       \
+    "991: .asciz \"stapsdt\"\n"                                              \
+    "992: .balign 4\n"                                                       \
+    "993: .8byte 990b\n"                                                     \
+    ".8byte _.stapsdt.base\n"                                                \
+    ".8byte 0\n"                                                             \
+    ".asciz \"" PROBE_STRING(PROBE_PROVIDER) "\"\n"                          \
+    ".asciz \"" #name "\"\n"                                                 \
+    ".asciz \"" args "\"\n"                                                  \
+    "994: .balign 4\n"                                                       \
+    ".popsection\n"                                                          \
+    ".ifndef _.stapsdt.base\n"                                               \
+    ".pushsection .stapsdt.base,\"aG\",\"progbits\",.stapsdt.base,comdat\n"  \
+    ".weak _.stapsdt.base\n"                                                 \
+    ".hidden _.stapsdt.base\n"                                               \
+    "_.stapsdt.base: .space 1\n"                                             \
+    ".size _.stapsdt.base, 1\n"                                              \
+    ".popsection\n"                                                          \
+    ".endif\n"
+
+#define PROBE_STRING_(x) #x
+#define PROBE_STRING(x) PROBE_STRING_(x)
+
+/* Signed 8 bytes, in a register, in memory or immediate */
+#define PROBE_ARG(n) "-8@%[a" #n "]"
+
+#define PROBE0(name) __asm__ __volatile__(PROBE_NOTE(name, "") ::)
+#define PROBE1(name, x1) \
+    __asm__ __volatile__(PROBE_NOTE(name, PROBE_ARG(1)) :: [a1] "nor"((int64_t)(x1)))
+#define PROBE2(name, x1, x2)                                              \
+    __asm__ __volatile__(PROBE_NOTE(name, PROBE_ARG(1) " " PROBE_ARG(2)) \
+                         :: [a1] "nor"((int64_t)(x1)), [a2] "nor"((int64_t)(x2)))
+#define PROBE3(name, x1, x2, x3)                                                             \
+    __asm__ __volatile__(PROBE_NOTE(name, PROBE_ARG(1) " " PROBE_ARG(2) " " PROBE_ARG(3)) \
+                         :: [a1] "nor"((int64_t)(x1)), [a2] "nor"((int64_t)(x2)), [a3] "nor"((int64_t)(x3)))
+#define PROBE4(name, x1, x2, x3, x4)                                                                        \
+    __asm__ __volatile__(PROBE_NOTE(name, PROBE_ARG(1) " " PROBE_ARG(2) " " PROBE_ARG(3) " " PROBE_ARG(4)) \
+                         :: [a1] "nor"((int64_t)(x1)), [a2] "nor"((int64_t)(x2)), [a3] "nor"((int64_t)(x3)), \
+                            [a4] "nor"((int64_t)(x4)))
+
+#else
+
+#define PROBE0(name) do { } while (0)
+#define PROBE1(name, a1) do { (void)(a1); } while (0)
+#define PROBE2(name, a1, a2) do { (void)(a1); (void)(a2); } while (0)
+#define PROBE3(name, a1, a2, a3) do { (void)(a1); (void)(a2); (void)(a3); } while (0)
+#define PROBE4(name, a1, a2, a3, a4) do { (void)(a1); (void)(a2); (void)(a3); (void)(a4); } while (0)
+
+#endif
+
+#endif /* PROBE_H */
@@ -0,0 +1,33 @@
+/**
+ * \file timestamp.c
+ * \brief Implementation of monotonic timestamps.
+ * \author Raphael CAUSSE
+ */
+
+/***** Includes **************************************************************/
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <time.h>
+#include "timestamp.h"
+
+/***** Functions *************************************************************/
+
+timestamp_t timestamp_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((timestamp_t)ts.tv_sec * TIMESTAMP_NS_PER_S) + (timestamp_t)ts.tv_nsec;
+}
+
+timestamp_t timestamp_elapsed(timestamp_t since, timestamp_t now)
+{
+    if ((since == TIMESTAMP_NONE) || (now < since))
+    {
+        return 0;
+    }
+
+    return now - since;
+}
@@ -0,0 +1,42 @@
+/**
+ * \file timestamp.h
+ * \brief Interface of monotonic timestamps.
+ * \author Raphael CAUSSE
+ */
+
+#ifndef TIMESTAMP_H
+#define TIMESTAMP_H
+
+/***** Includes **************************************************************/
+
+#include <stdint.h>
+
+/***** Definitions ***********************************************************/
+
+#define TIMESTAMP_NONE (0)
+
+#define TIMESTAMP_NS_PER_US (1000ULL)
+#define TIMESTAMP_NS_PER_MS (1000000ULL)
+#define TIMESTAMP_NS_PER_S (1000000000ULL)
+
+/* Monotonic timestamp (nanoseconds) */
+typedef uint64_t timestamp_t;
+
+/***** Functions *************************************************************/
+
+/**
+ * \brief Get the current monotonic time.
+ * \details Uses CLOCK_MONOTONIC, never goes backward and is not affected by wall clock changes.
+ * \return timestamp_t : Current time (ns)
+ */
+timestamp_t timestamp_now(void);
+
+/**
+ * \brief Compute elapsed time since a timestamp.
+ * \param since : Reference timestamp
+ * \param now : Current timestamp
+ * \return timestamp_t : Elapsed time (ns), 0 if the reference is unset or in the future
+ */
+timestamp_t timestamp_elapsed(timestamp_t since, timestamp_t now);
+
+#endif /* TIMESTAMP_H */
@@ -0,0 +1,218 @@
+/**
+ * \file bench.c
+ * \brief Implementation of micro benchmark framework.
+ * \details Run a benchmark function with warmup and repetitions, compute outlier-robust
+ *          statistics (median, median absolute deviation, filtered mean) and emit JSON results.
+ * \author Raphael CAUSSE
+ */
+
+/***** Includes **************************************************************/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#include "bench.h"
+
+/***** Static Functions ******************************************************/
+
+/**
+ * \brief Compare two doubles for qsort.
+ */
+static int bench_compare(const void *a, const void *b)
+{
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+
+    return (x > y) - (x < y);
+}
+
+/**
+ * \brief Compute the median of a sorted array.
+ */
+static double bench_median(const double *sorted, uint32_t count)
+{
+    if ((count % 2) == 0)
+    {
+        return (sorted[count / 2 - 1] + sorted[count / 2]) / 2.0;
+    }
+
+    return sorted[count / 2];
+}
+
+/**
+ * \brief Compute outlier-robust statistics of samples.
+ * \param samples : Samples (sorted in place)
+ * \param count : Number of samples
+ * \param stat : Output statistics
+ * \return uint32_t : Number of outliers
+ */
+static uint32_t bench_stat_compute(double *samples, uint32_t count, bench_stat_t *stat)
+{
+    double deviations[BENCH_MAX_REPETITIONS];
+    double sum = 0.0;
+    uint32_t kept = 0;
+
+    qsort(samples, count, sizeof(*samples), bench_compare);
+    stat->median = bench_median(samples, count);
+    stat->min = samples[0];
+    stat->max = samples[count - 1];
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        deviations[i] = (samples[i] > stat->median) ? (samples[i] - stat->median) : (stat->median - samples[i]);
+    }
+    qsort(deviations, count, sizeof(*deviations), bench_compare);
+    stat->mad = bench_median(deviations, count);
+
+    /* Mean without outliers */
+    for (uint32_t i = 0; i < count; i++)
+    {
+        if ((samples[i] >= stat->median - 3.0 * stat->mad) && (samples[i] <= stat->median + 3.0 * stat->mad))
+        {
+            sum += samples[i];
+            kept++;
+        }
+    }
+    stat->mean = (kept > 0) ? (sum / kept) : stat->median;
+
+    return count - kept;
+}
+
+/***** Functions *************************************************************/
+
+uint64_t bench_ticks(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#elif defined(__aarch64__)
+    uint64_t value;
+    __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(value));
+    return value;
+#else
+    return 0;
+#endif
+}
+
+uint64_t bench_tick_hz(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+    static uint64_t hz = 0;
+    uint64_t start_ns = 0;
+    uint64_t start_ticks = 0;
+    uint64_t elapsed_ns = 0;
+
+    if (hz == 0)
+    {
+        start_ns = bench_now_ns();
+        start_ticks = bench_ticks();
+        do
+        {
+            elapsed_ns = bench_now_ns() - start_ns;
+        } while (elapsed_ns < BENCH_TICK_CALIBRATION_NS);
+        hz = (uint64_t)((double)(bench_ticks() - start_ticks) * 1e9 / (double)elapsed_ns);
+    }
+
+    return hz;
+#elif defined(__aarch64__)
+    uint64_t value;
+    __asm__ __volatile__("mrs %0, cntfrq_el0" : "=r"(value));
+    return value;
+#else
+    return 0;
+#endif
+}
+
+uint64_t bench_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+void bench_run(const bench_config_t *config, const char *name, bench_fn_t fn, bench_result_t *result)
+{
+    double ns_samples[BENCH_MAX_REPETITIONS];
+    double ticks_samples[BENCH_MAX_REPETITIONS];
+    uint32_t repetitions = config->repetitions;
+    uint64_t iterations = 1;
+    uint64_t start_ns = 0;
+    uint64_t elapsed_ns = 0;
+    uint64_t start_ticks = 0;
+    uint64_t elapsed_ticks = 0;
+
+    if (repetitions > BENCH_MAX_REPETITIONS)
+    {
+        repetitions = BENCH_MAX_REPETITIONS;
+    }
+    if (repetitions == 0)
+    {
+        repetitions = 1;
+    }
+
+    /* Calibrate iterations per repetition */
+    do
+    {
+        iterations *= 2;
+        start_ns = bench_now_ns();
+        fn(iterations);
+        elapsed_ns = bench_now_ns() - start_ns;
+    } while (elapsed_ns < BENCH_MIN_BATCH_NS);
+
+    /* Warmup */
+    for (uint32_t i = 0; i < config->warmup; i++)
+    {
+        fn(iterations);
+    }
+
+    /* Measure */
+    for (uint32_t i = 0; i < repetitions; i++)
+    {
+        start_ns = bench_now_ns();
+        start_ticks = bench_ticks();
+        fn(iterations);
+        elapsed_ticks = bench_ticks() - start_ticks;
+        elapsed_ns = bench_now_ns() - start_ns;
+
+        ns_samples[i] = (double)elapsed_ns / (double)iterations;
+        ticks_samples[i] = (double)elapsed_ticks / (double)iterations;
+    }
+
+    memset(result, 0, sizeof(*result));
+    result->name = name;
+    result->iterations = iterations;
+    result->repetitions = repetitions;
+    result->outliers = bench_stat_compute(ns_samples, repetitions, &result->ns);
+    bench_stat_compute(ticks_samples, repetitions, &result->ticks);
+}
+
+void bench_write_json(FILE *out, const char *suite, const bench_result_t *results, uint32_t count)
+{
+    fprintf(out, "{\n");
+    fprintf(out, "  \"suite\": \"%s\",\n", suite);
+#ifdef __VERSION__
+    fprintf(out, "  \"compiler\": \"%s\",\n", __VERSION__);
+#endif
+    fprintf(out, "  \"tick_hz\": %llu,\n", (unsigned long long)bench_tick_hz());
+    fprintf(out, "  \"benchmarks\": [\n");
+    for (uint32_t i = 0; i < count; i++)
+    {
+        const bench_result_t *r = &results[i];
+
+        fprintf(out, "    {\"name\": \"%s\", \"iterations\": %llu, \"repetitions\": %u, \"outliers\": %u,\n",
+                r->name, (unsigned long long)r->iterations, r->repetitions, r->outliers);
+        fprintf(out, "     \"ns_per_op\": {\"median\": %.3f, \"mad\": %.3f, \"mean\": %.3f, \"min\": %.3f, \"max\": %.3f},\n",
+                r->ns.median, r->ns.mad, r->ns.mean, r->ns.min, r->ns.max);
+        fprintf(out, "     \"ticks_per_op\": {\"median\": %.3f, \"mad\": %.3f, \"mean\": %.3f, \"min\": %.3f, \"max\": %.3f}}%s\n",
+                r->ticks.median, r->ticks.mad, r->ticks.mean, r->ticks.min, r->ticks.max,
+                (i + 1 < count) ? "," : "");
+    }
+    fprintf(out, "  ]\n");
+    fprintf(out, "}\n");
+}
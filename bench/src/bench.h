@@ -0,0 +1,107 @@
+/**
+ * \file bench.h
+ * \brief Interface of micro benchmark framework.
+ * \details Run a benchmark function with warmup and repetitions, compute outlier-robust
+ *          statistics (median, median absolute deviation, filtered mean) and emit JSON results.
+ * \author Raphael CAUSSE
+ */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+/***** Includes **************************************************************/
+
+#include <stdint.h>
+#include <stdio.h>
+
+/***** Definitions ***********************************************************/
+
+#define BENCH_MAX_REPETITIONS (101)
+#define BENCH_DEFAULT_REPETITIONS (31)
+#define BENCH_DEFAULT_WARMUP (3)
+#define BENCH_MIN_BATCH_NS (2000000ULL) /* Each repetition lasts at least 2ms */
+#define BENCH_TICK_CALIBRATION_NS (10000000ULL) /* TSC frequency measured over 10ms */
+
+/* Benchmark function, runs the measured operation `iterations` times */
+typedef void (*bench_fn_t)(uint64_t iterations);
+
+/* Statistics of one measured quantity (per operation) */
+typedef struct
+{
+    double median; /* Median of repetitions */
+    double mad;    /* Median absolute deviation */
+    double mean;   /* Mean of repetitions within median +/- 3 MAD */
+    double min;    /* Fastest repetition */
+    double max;    /* Slowest repetition */
+} bench_stat_t;
+
+/* Result of one benchmark */
+typedef struct
+{
+    const char *name;      /* Benchmark name */
+    uint64_t iterations;   /* Operations per repetition */
+    uint32_t repetitions;  /* Measured repetitions */
+    uint32_t outliers;     /* Repetitions out of median +/- 3 MAD */
+    bench_stat_t ns;       /* Nanoseconds per operation */
+    bench_stat_t ticks;    /* Counter ticks per operation, see bench_tick_hz() */
+} bench_result_t;
+
+/* Benchmark configuration */
+typedef struct
+{
+    uint32_t warmup;      /* Unmeasured repetitions */
+    uint32_t repetitions; /* Measured repetitions */
+} bench_config_t;
+
+/***** Functions *************************************************************/
+
+/**
+ * \brief Read the processor tick counter.
+ * \details Reference counter at a fixed frequency, not core cycles: invariant TSC on x86, generic timer
+ *          (tens of MHz) on AArch64. Convert with bench_tick_hz() before comparing machines.
+ * \return uint64_t : Tick count, 0 if not available on this architecture
+ */
+uint64_t bench_ticks(void);
+
+/**
+ * \brief Get the frequency of the tick counter.
+ * \details Read from CNTFRQ_EL0 on AArch64, calibrated once against the monotonic clock on x86.
+ * \return uint64_t : Frequency (Hz), 0 if not available on this architecture
+ */
+uint64_t bench_tick_hz(void);
+
+/**
+ * \brief Read the monotonic clock.
+ * \return uint64_t : Time (ns)
+ */
+uint64_t bench_now_ns(void);
+
+/**
+ * \brief Run one benchmark.
+ * \details Iterations per repetition are calibrated so that one repetition lasts at least BENCH_MIN_BATCH_NS.
+ * \param config : Benchmark configuration
+ * \param name : Benchmark name
+ * \param fn : Benchmark function
+ * \param result : Output result
+ */
+void bench_run(const bench_config_t *config, const char *name, bench_fn_t fn, bench_result_t *result);
+
+/**
+ * \brief Write benchmark results as a JSON document.
+ * \param out : Output stream
+ * \param suite : Suite name
+ * \param results : Results array
+ * \param count : Number of results
+ */
+void bench_write_json(FILE *out, const char *suite, const bench_result_t *results, uint32_t count);
+
+/**
+ * \brief Prevent the compiler from optimizing away a value.
+ * \param value : Value to keep
+ */
+static inline void bench_keep(uint64_t value)
+{
+    __asm__ __volatile__("" : : "r"(value) : "memory");
+}
+
+#endif /* BENCH_H */
@@ -0,0 +1,408 @@
+/**
+ * \file bench_latency.c
+ * \brief End-to-end input to actuation latency benchmark.
+ * \details Run the application cycle against the simulated driver and measure, for each loop mode,
+ *          log level and background load, the latency from an input change to its actuation:
+ *          COMODO command to BGF message, COMODO command to MUX 200ms flag, MUX 100ms fuel level to
+ *          MUX 200ms warning. The application thread optionally runs with the real-time profile.
+ *          Results are written as JSON on standard output.
+ * \author Raphael CAUSSE
+ */
+
+/***** Includes **************************************************************/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "bench.h"
+#include "drv_sim.h"
+#include "bcgv_api.h"
+#include "cycle.h"
+#include "serial.h"
+#include "log.h"
+#include "rt_profile.h"
+
+/***** Definitions ***********************************************************/
+
+#define LATENCY_DEFAULT_SAMPLES (20)
+#define LATENCY_DEFAULT_PERIOD_MS (10)
+#define LATENCY_DEFAULT_ACK_DELAY_MS (2)
+#define LATENCY_MAX_SAMPLES (1000)
+#define LATENCY_MAX_LOAD_THREADS (64)
+#define LATENCY_LOG_LEVELS (2)
+#define LATENCY_LOADS (2)
+#define LATENCY_TIMEOUT_PERIODS (20) /* Actuation is missed after 20 periods */
+
+#define COMODO_POSITION (1 << 6)
+#define BGF_MSG_ID_POSITION (1)
+#define MUX_BYTE_LIGHTS (0)
+#define MUX_BIT_POSITION (7)
+#define MUX_BIT_FUEL_LOW (4)
+#define FUEL_LEVEL_LOW (1)
+#define FUEL_LEVEL_NORMAL (40)
+
+/* Loop mode of the application */
+typedef enum
+{
+    LATENCY_MODE_POLLED = 0, /* Serial frames read once per cycle */
+    LATENCY_MODE_RX_THREAD,  /* Serial frames read by reception thread */
+    LATENCY_MODE_RX_KICK,    /* Reception thread evaluates FSMs on acknowledgement */
+    LATENCY_MODE_COUNT
+} latency_mode_t;
+
+/* Measured paths */
+typedef enum
+{
+    LATENCY_PATH_COMODO_TO_BGF = 0,
+    LATENCY_PATH_COMODO_TO_MUX,
+    LATENCY_PATH_FUEL_TO_MUX,
+    LATENCY_PATH_COUNT
+} latency_path_t;
+
+/* Latency samples of one path */
+typedef struct
+{
+    uint64_t ns[LATENCY_MAX_SAMPLES];
+    uint32_t count;
+    uint32_t timeouts;
+} latency_samples_t;
+
+/* Latency distribution of one path in one configuration (microseconds) */
+typedef struct
+{
+    latency_mode_t mode;
+    uint32_t log_level;
+    uint32_t load_threads;
+    latency_path_t path;
+    uint32_t samples;
+    uint32_t timeouts;
+    double min;
+    double p50;
+    double p90;
+    double p99;
+    double max;
+    double mean;
+} latency_result_t;
+
+/***** Static Variables ******************************************************/
+
+static const char *mode_names[LATENCY_MODE_COUNT] = {"polled", "rx_thread", "rx_thread_kick"};
+static const char *path_names[LATENCY_PATH_COUNT] = {"comodo_to_bgf", "comodo_to_mux", "fuel_to_mux"};
+static const log_level_t log_levels[LATENCY_LOG_LEVELS] = {LOG_LEVEL_INFO, LOG_LEVEL_NONE};
+static const char *log_level_names[LATENCY_LOG_LEVELS] = {"info", "none"};
+
+static volatile bool app_running = false;
+static bool app_real_time = false;
+static rt_profile_config_t app_rt_config;
+static volatile bool load_running = false;
+static int32_t app_fd = 0;
+static uint32_t random_state = 1;
+
+static latency_samples_t samples[LATENCY_PATH_COUNT];
+static latency_result_t results[LATENCY_MODE_COUNT * LATENCY_LOG_LEVELS * LATENCY_LOADS * LATENCY_PATH_COUNT];
+static uint32_t result_count = 0;
+
+/***** Static Functions ******************************************************/
+
+/**
+ * \brief Application main loop, as in app.c.
+ */
+static void *latency_app_thread(void *arg)
+{
+    (void)arg;
+
+    if (app_real_time == true)
+    {
+        (void)rt_profile_apply(&app_rt_config);
+    }
+
+    while (app_running == true)
+    {
+        cycle_run(app_fd);
+    }
+
+    return NULL;
+}
+
+/**
+ * \brief Background load: spin until stopped.
+ */
+static void *latency_load_thread(void *arg)
+{
+    volatile uint64_t counter = 0;
+
+    (void)arg;
+    while (load_running == true)
+    {
+        counter++;
+    }
+
+    return NULL;
+}
+
+/**
+ * \brief Sleep for a random duration in [0, max_ns), so inputs arrive at a random phase of the cycle.
+ */
+static void latency_random_sleep(uint64_t max_ns)
+{
+    struct timespec ts;
+    uint64_t ns = 0;
+
+    random_state = random_state * 1103515245U + 12345U;
+    ns = ((uint64_t)(random_state >> 8) * max_ns) >> 24;
+    ts.tv_sec = (time_t)(ns / 1000000000ULL);
+    ts.tv_nsec = (long)(ns % 1000000000ULL);
+    nanosleep(&ts, NULL);
+}
+
+/**
+ * \brief Record one latency sample.
+ */
+static void latency_record(latency_path_t path, uint64_t start, uint64_t end)
+{
+    latency_samples_t *s = &samples[path];
+
+    if (end == 0)
+    {
+        s->timeouts++;
+    }
+    else if (s->count < LATENCY_MAX_SAMPLES)
+    {
+        s->ns[s->count++] = end - start;
+    }
+}
+
+static int latency_compare(const void *a, const void *b)
+{
+    uint64_t va = *(const uint64_t *)a;
+    uint64_t vb = *(const uint64_t *)b;
+
+    return (va > vb) - (va < vb);
+}
+
+/**
+ * \brief Get a percentile of sorted samples (nearest rank), in microseconds.
+ */
+static double latency_percentile(const latency_samples_t *s, uint32_t percent)
+{
+    uint32_t rank = (percent * s->count + 99) / 100;
+
+    if (rank > 0)
+    {
+        rank--;
+    }
+
+    return (double)s->ns[rank] / 1000.0;
+}
+
+/**
+ * \brief Measure all paths once.
+ */
+static void latency_measure(uint64_t period_ns, uint64_t timeout_ns)
+{
+    uint64_t start = 0;
+    uint64_t end = 0;
+
+    /* COMODO command ON to BGF message and MUX flag */
+    latency_random_sleep(period_ns);
+    start = drv_sim_inject_comodo(COMODO_POSITION);
+    end = drv_sim_wait_bgf(BGF_MSG_ID_POSITION, 1, start, timeout_ns);
+    latency_record(LATENCY_PATH_COMODO_TO_BGF, start, end);
+    end = drv_sim_wait_mux_bit(MUX_BYTE_LIGHTS, MUX_BIT_POSITION, true, start, timeout_ns);
+    latency_record(LATENCY_PATH_COMODO_TO_MUX, start, end);
+
+    /* Back to idle */
+    start = drv_sim_inject_comodo(0);
+    (void)drv_sim_wait_bgf(BGF_MSG_ID_POSITION, 0, start, timeout_ns);
+    (void)drv_sim_wait_mux_bit(MUX_BYTE_LIGHTS, MUX_BIT_POSITION, false, start, timeout_ns);
+
+    /* MUX fuel level to MUX low fuel warning */
+    latency_random_sleep(period_ns);
+    start = drv_sim_inject_fuel_level(FUEL_LEVEL_LOW);
+    end = drv_sim_wait_mux_bit(MUX_BYTE_LIGHTS, MUX_BIT_FUEL_LOW, true, start, timeout_ns);
+    latency_record(LATENCY_PATH_FUEL_TO_MUX, start, end);
+
+    /* Back to idle */
+    start = drv_sim_inject_fuel_level(FUEL_LEVEL_NORMAL);
+    (void)drv_sim_wait_mux_bit(MUX_BYTE_LIGHTS, MUX_BIT_FUEL_LOW, false, start, timeout_ns);
+}
+
+/**
+ * \brief Compute latency distributions of one configuration from collected samples.
+ */
+static void latency_summarize(latency_mode_t mode, uint32_t level, uint32_t load)
+{
+    for (uint32_t p = 0; p < LATENCY_PATH_COUNT; p++)
+    {
+        latency_samples_t *s = &samples[p];
+        latency_result_t *r = &results[result_count++];
+        double sum = 0.0;
+
+        memset(r, 0, sizeof(*r));
+        r->mode = mode;
+        r->log_level = level;
+        r->load_threads = load;
+        r->path = (latency_path_t)p;
+        r->samples = s->count;
+        r->timeouts = s->timeouts;
+        if (s->count > 0)
+        {
+            qsort(s->ns, s->count, sizeof(*s->ns), &latency_compare);
+            for (uint32_t i = 0; i < s->count; i++)
+            {
+                sum += (double)s->ns[i];
+            }
+            r->min = (double)s->ns[0] / 1000.0;
+            r->p50 = latency_percentile(s, 50);
+            r->p90 = latency_percentile(s, 90);
+            r->p99 = latency_percentile(s, 99);
+            r->max = (double)s->ns[s->count - 1] / 1000.0;
+            r->mean = sum / (double)s->count / 1000.0;
+        }
+    }
+}
+
+/**
+ * \brief Write latency results as a JSON document.
+ */
+static void latency_write_json(FILE *out, uint32_t period_ms, uint32_t ack_delay_ms)
+{
+    fprintf(out, "{\n  \"suite\": \"latency\",\n  \"period_ms\": %u,\n  \"ack_delay_ms\": %u,\n", period_ms, ack_delay_ms);
+    fprintf(out, "  \"real_time\": %s,\n", (app_real_time == true) ? "true" : "false");
+    fprintf(out, "  \"results\": [\n");
+    for (uint32_t i = 0; i < result_count; i++)
+    {
+        const latency_result_t *r = &results[i];
+
+        fprintf(out, "    {\"mode\": \"%s\", \"log_level\": \"%s\", \"load_threads\": %u, \"path\": \"%s\", ",
+                mode_names[r->mode], log_level_names[r->log_level], r->load_threads, path_names[r->path]);
+        fprintf(out, "\"samples\": %u, \"timeouts\": %u, ", r->samples, r->timeouts);
+        fprintf(out, "\"min_us\": %.1f, \"p50_us\": %.1f, \"p90_us\": %.1f, \"p99_us\": %.1f, ",
+                r->min, r->p50, r->p90, r->p99);
+        fprintf(out, "\"max_us\": %.1f, \"mean_us\": %.1f}%s\n", r->max, r->mean, (i + 1 < result_count) ? "," : "");
+    }
+    fprintf(out, "  ]\n}\n");
+}
+
+/***** Main function *********************************************************/
+
+int main(int argc, char *argv[])
+{
+    drv_sim_config_t sim_config;
+    pthread_t app_thread;
+    pthread_t load_threads[LATENCY_MAX_LOAD_THREADS];
+    uint32_t sample_count = LATENCY_DEFAULT_SAMPLES;
+    uint32_t period_ms = LATENCY_DEFAULT_PERIOD_MS;
+    uint32_t ack_delay_ms = LATENCY_DEFAULT_ACK_DELAY_MS;
+    uint32_t loads[LATENCY_LOADS] = {0, 0};
+    uint64_t timeout_ns = 0;
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    int stdout_fd = 0;
+    int null_fd = 0;
+    int opt = 0;
+
+    rt_profile_default(&app_rt_config);
+    while ((opt = getopt(argc, argv, "n:p:a:tc:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'n':
+            sample_count = (uint32_t)atoi(optarg);
+            break;
+        case 'p':
+            period_ms = (uint32_t)atoi(optarg);
+            break;
+        case 'a':
+            ack_delay_ms = (uint32_t)atoi(optarg);
+            break;
+        case 't':
+            app_real_time = true;
+            break;
+        case 'c':
+            app_real_time = true;
+            app_rt_config.cpu = atoi(optarg);
+            break;
+        default:
+            fprintf(stderr, "Usage: %s [-n samples] [-p period_ms] [-a ack_delay_ms] [-t] [-c cpu]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if ((sample_count == 0) || (sample_count > LATENCY_MAX_SAMPLES) || (period_ms == 0))
+    {
+        fprintf(stderr, "Invalid options\n");
+        return EXIT_FAILURE;
+    }
+
+    /* Loaded runs keep every CPU busy */
+    loads[1] = (cpus > LATENCY_MAX_LOAD_THREADS) ? LATENCY_MAX_LOAD_THREADS : (uint32_t)((cpus > 0) ? cpus : 1);
+
+    sim_config.udp_period_ns = (uint64_t)period_ms * 1000000ULL;
+    sim_config.bgf_ack_delay_ns = (uint64_t)ack_delay_ms * 1000000ULL;
+    timeout_ns = sim_config.udp_period_ns * LATENCY_TIMEOUT_PERIODS;
+    drv_sim_reset(&sim_config);
+    app_fd = drv_open();
+    bcgv_ctx_init();
+
+    /* Logger output is discarded while measuring */
+    fflush(stdout);
+    stdout_fd = dup(STDOUT_FILENO);
+    null_fd = open("/dev/null", O_WRONLY);
+    dup2(null_fd, STDOUT_FILENO);
+
+    for (uint32_t mode = 0; mode < LATENCY_MODE_COUNT; mode++)
+    {
+        for (uint32_t level = 0; level < LATENCY_LOG_LEVELS; level++)
+        {
+            for (uint32_t l = 0; l < LATENCY_LOADS; l++)
+            {
+                memset(samples, 0, sizeof(samples));
+                log_set_level(log_levels[level]);
+
+                load_running = true;
+                for (uint32_t t = 0; t < loads[l]; t++)
+                {
+                    pthread_create(&load_threads[t], NULL, &latency_load_thread, NULL);
+                }
+
+                if (mode != LATENCY_MODE_POLLED)
+                {
+                    serial_rx_start(app_fd, (mode == LATENCY_MODE_RX_KICK));
+                }
+                app_running = true;
+                pthread_create(&app_thread, NULL, &latency_app_thread, NULL);
+
+                for (uint32_t i = 0; i < sample_count; i++)
+                {
+                    latency_measure(sim_config.udp_period_ns, timeout_ns);
+                }
+
+                app_running = false;
+                pthread_join(app_thread, NULL);
+                serial_rx_stop();
+
+                load_running = false;
+                for (uint32_t t = 0; t < loads[l]; t++)
+                {
+                    pthread_join(load_threads[t], NULL);
+                }
+
+                latency_summarize((latency_mode_t)mode, level, loads[l]);
+            }
+        }
+    }
+
+    drv_sim_stop();
+    fflush(stdout);
+    dup2(stdout_fd, STDOUT_FILENO);
+    close(null_fd);
+    close(stdout_fd);
+
+    latency_write_json(stdout, period_ms, ack_delay_ms);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,410 @@
+/**
+ * \file bench_micro.c
+ * \brief Micro benchmarks of application hot functions.
+ * \details Measure CRC8, MUX decode/encode, COMODO decode, FSM runs over scripted inputs,
+ *          logger and context accessors. Results are written as JSON on standard output.
+ * \author Raphael CAUSSE
+ */
+
+/***** Includes **************************************************************/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include "bench.h"
+#include "drv_stub.h"
+#include "bcgv_api.h"
+#include "crc8.h"
+#include "mux.h"
+#include "comodo.h"
+#include "log.h"
+#include "ctx_history.h"
+#include "trip_stats.h"
+#include "checkpoint.h"
+#include "fsm_lights.h"
+#include "fsm_indicators.h"
+#include "fsm_windshield_washer.h"
+
+/***** Definitions ***********************************************************/
+
+#define BENCH_SCRIPT_MAX_STEPS (256)
+#define BENCH_MAX_RESULTS (32)
+#define BENCH_LOG_BINARY_PATH "/tmp/bench_micro.blog"
+#define BENCH_CHECKPOINT_PATH "/tmp/bench_micro.ckpt"
+
+/* COMODO frame bits */
+#define COMODO_HAZARD (1 << 7)
+#define COMODO_POSITION (1 << 6)
+#define COMODO_CROSSING (1 << 5)
+#define COMODO_HIGHBEAM (1 << 4)
+#define COMODO_RIGHT (1 << 3)
+#define COMODO_LEFT (1 << 2)
+#define COMODO_WIPER (1 << 1)
+#define COMODO_WASHER (1 << 0)
+
+/* Scripted input: COMODO frame held for a number of cycles */
+typedef struct
+{
+    uint8_t comodo;
+    uint8_t cycles;
+} bench_step_t;
+
+/* Expanded script, one COMODO frame per cycle */
+typedef struct
+{
+    uint8_t frames[BENCH_SCRIPT_MAX_STEPS];
+    uint32_t count;
+    uint32_t cursor; /* Kept across calls, FSM state persists between repetitions */
+} bench_script_t;
+
+/***** Static Variables ******************************************************/
+
+/* Valid MUX 100ms frame, CRC8 computed at init */
+static uint8_t mux_frame[DRV_UDP_100MS_FRAME_SIZE] = {
+    0x01, 0x00, 0x01, 0xE2, 0x40, 0x5A, 0x01, 0x02, 0x14, 0x00, 0x00, 0x0B, 0xB8, 0x00, 0x00};
+
+static const bench_step_t lights_steps[] = {
+    {0, 3}, {COMODO_POSITION, 5}, {0, 2}, {COMODO_CROSSING, 5}, {0, 2}, {COMODO_HIGHBEAM, 5}, {0, 2}};
+
+/* Hazard is left out: its acknowledgement path ends in the error state, which would stop the FSM */
+static const bench_step_t indicators_steps[] = {
+    {0, 3}, {COMODO_LEFT, 25}, {0, 2}, {COMODO_RIGHT, 25}, {0, 2}};
+
+static const bench_step_t washer_steps[] = {
+    {0, 3}, {COMODO_WIPER, 5}, {COMODO_WIPER | COMODO_WASHER, 5}, {COMODO_WIPER, 2}, {0, 25}, {COMODO_WASHER, 5}, {0, 25}};
+
+static bench_script_t lights_script;
+static bench_script_t indicators_script;
+static bench_script_t washer_script;
+
+static volatile uint8_t sink_u8;
+static volatile uint32_t sink_u32;
+
+/***** Static Functions ******************************************************/
+
+/**
+ * \brief Expand scripted steps into one COMODO frame per cycle.
+ */
+static void bench_script_build(bench_script_t *script, const bench_step_t *steps, uint32_t count)
+{
+    script->count = 0;
+    script->cursor = 0;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        for (uint8_t c = 0; (c < steps[i].cycles) && (script->count < BENCH_SCRIPT_MAX_STEPS); c++)
+        {
+            script->frames[script->count++] = steps[i].comodo;
+        }
+    }
+}
+
+/**
+ * \brief Get next COMODO frame of a script, looping at the end.
+ */
+static uint8_t bench_script_next(bench_script_t *script)
+{
+    uint8_t frame = script->frames[script->cursor];
+
+    script->cursor = (script->cursor + 1) % script->count;
+
+    return frame;
+}
+
+/**
+ * \brief Apply one scripted COMODO frame to context, acknowledging all BGF messages.
+ */
+static void bench_script_apply(uint8_t frame)
+{
+    set_cmd_indic_hazard((frame & COMODO_HAZARD) != 0);
+    set_cmd_position_light((frame & COMODO_POSITION) != 0);
+    set_cmd_crossing_light((frame & COMODO_CROSSING) != 0);
+    set_cmd_highbeam_light((frame & COMODO_HIGHBEAM) != 0);
+    set_cmd_indic_right((frame & COMODO_RIGHT) != 0);
+    set_cmd_indic_left((frame & COMODO_LEFT) != 0);
+    set_cmd_wiper((frame & COMODO_WIPER) != 0);
+    set_cmd_washer((frame & COMODO_WASHER) != 0);
+    set_bit_flag_bgf_ack(BGF_ACK_POSITION_LIGHT | BGF_ACK_CROSSING_LIGHT | BGF_ACK_HIGHBEAM_LIGHT |
+                         BGF_ACK_INDIC_LEFT | BGF_ACK_INDIC_RIGHT);
+}
+
+static void bench_crc8_compute(uint64_t iterations)
+{
+    for (uint64_t i = 0; i < iterations; i++)
+    {
+        bench_keep(crc8_compute(mux_frame, DRV_UDP_100MS_FRAME_SIZE - 1));
+    }
+}
+
+static void bench_mux_decode_frame_100ms(uint64_t iterations)
+{
+    for (uint64_t i = 0; i < iterations; i++)
+    {
+        bench_keep(mux_decode_frame_100ms());
+    }
+}
+
+static void bench_mux_encode_frame_200ms(uint64_t iterations)
+{
+    for (uint64_t i = 0; i < iterations; i++)
+    {
+        mux_encode_frame_200ms();
+    }
+}
+
+static void bench_comodo_decode_frame(uint64_t iterations)
+{
+    for (uint64_t i = 0; i < iterations; i++)
+    {
+        bench_keep(comodo_decode_frame());
+    }
+}
+
+static void bench_fsm_lights_run(uint64_t iterations)
+{
+    for (uint64_t i = 0; i < iterations; i++)
+    {
+        bench_script_apply(bench_script_next(&lights_script));
+        bench_keep(fsm_lights_run());
+    }
+}
+
+static void bench_fsm_indicators_run(uint64_t iterations)
+{
+    for (uint64_t i = 0; i < iterations; i++)
+    {
+        bench_script_apply(bench_script_next(&indicators_script));
+        bench_keep(fsm_indicators_run());
+    }
+}
+
+static void bench_fsm_windshield_washer_run(uint64_t iterations)
+{
+    for (uint64_t i = 0; i < iterations; i++)
+    {
+        bench_script_apply(bench_script_next(&washer_script));
+        bench_keep(fsm_windshield_washer_run());
+    }
+}
+
+static void bench_script_apply_only(uint64_t iterations)
+{
+    for (uint64_t i = 0; i < iterations; i++)
+    {
+        bench_script_apply(bench_script_next(&lights_script));
+    }
+}
+
+static void bench_log_write(uint64_t iterations)
+{
+    /* Every message written */
+    log_set_rate_limit(0);
+    for (uint64_t i = 0; i < iterations; i++)
+    {
+        log_warn("frame number mismatch: %u (expected %u)", (unsigned)(i % 100), (unsigned)((i + 1) % 100));
+    }
+    log_set_rate_limit(LOG_RATE_BURST);
+}
+
+static void bench_log_write_binary(uint64_t iterations)
+{
+    /* Every message written, as a binary record */
+    log_set_rate_limit(0);
+    for (uint64_t i = 0; i < iterations; i++)
+    {
+        log_warn("frame number mismatch: %u (expected %u)", (unsigned)(i % 100), (unsigned)((i + 1) % 100));
+    }
+    log_set_rate_limit(LOG_RATE_BURST);
+}
+
+static void bench_log_write_repeated(uint64_t iterations)
+{
+    /* Persistent fault, the same message at every call */
+    for (uint64_t i = 0; i < iterations; i++)
+    {
+        log_warn("invalid CRC8: %02X (expected %02X)", 0x12u, 0x34u);
+    }
+}
+
+static void bench_ctx_get_all(uint64_t iterations)
+{
+    for (uint64_t i = 0; i < iterations; i++)
+    {
+        uint32_t acc = 0;
+
+        acc += get_cmd_position_light() + get_cmd_crossing_light() + get_cmd_highbeam_light();
+        acc += get_cmd_indic_left() + get_cmd_indic_right() + get_cmd_indic_hazard();
+        acc += get_cmd_wiper() + get_cmd_washer();
+        acc += get_frame_number() + get_distance() + get_speed() + get_chassis_issues();
+        acc += get_motor_issues() + get_fuel_level() + get_engine_rpm() + get_battery_issues() + get_crc8();
+        acc += get_flag_position_light() + get_flag_crossing_light() + get_flag_highbeam_light();
+        acc += get_flag_indic_hazard() + get_flag_indic_left() + get_flag_indic_right();
+        acc += get_flag_wiper() + get_flag_washer() + get_bit_flag_bgf_ack();
+        bench_keep(acc);
+    }
+}
+
+static void bench_ctx_set_ranged(uint64_t iterations)
+{
+    for (uint64_t i = 0; i < iterations; i++)
+    {
+        set_frame_number((frame_number_t)(i % 128));
+        set_fuel_level((fuel_level_t)(i % 64));
+        set_engine_rpm((engine_rpm_t)(i * 37 % 12000));
+    }
+    sink_u8 = get_fuel_level();
+}
+
+static void bench_ctx_set_ranged_noisy(uint64_t iterations)
+{
+    uint32_t noise = 0x12345678u;
+
+    /* Unpredictable mix of valid and out-of-range values, like corrupted MUX data */
+    for (uint64_t i = 0; i < iterations; i++)
+    {
+        noise ^= noise << 13;
+        noise ^= noise >> 17;
+        noise ^= noise << 5;
+        set_frame_number((frame_number_t)(noise & 0x7F));
+        set_fuel_level((fuel_level_t)((noise >> 8) & 0x3F));
+        set_engine_rpm((engine_rpm_t)((noise >> 16) & 0x3FFF));
+    }
+    sink_u8 = get_fuel_level();
+}
+
+static void bench_ctx_history_record(uint64_t iterations)
+{
+    for (uint64_t i = 0; i < iterations; i++)
+    {
+        /* Frame number and speed change every cycle, like MUX data */
+        set_frame_number((frame_number_t)(i % FRAME_NUMBER_MAX + 1));
+        set_speed((speed_t)(i & 0x7F));
+        sink_u32 = ctx_history_record();
+    }
+}
+
+static void bench_trip_stats_update(uint64_t iterations)
+{
+    trip_stats_frame_t frame = {0};
+
+    for (uint64_t i = 0; i < iterations; i++)
+    {
+        /* One frame every 100ms, varying speed and RPM exercise the digest merges */
+        frame.time = i * 100 * TIMESTAMP_NS_PER_MS;
+        frame.distance = (distance_t)(i / 360);
+        frame.speed = (speed_t)((i * 37) & 0x7F);
+        frame.engine_rpm = (engine_rpm_t)((i * 7919) % ENGINE_RPM_MAX);
+        frame.fuel_level = (fuel_level_t)(FUEL_LEVEL_MAX - (i >> 12) % FUEL_LEVEL_MAX);
+        frame.chassis_issues = (issues_t)((i >> 6) & CHASSIS_ISSUE_BRAKES);
+        trip_stats_update(&frame);
+    }
+}
+
+static void bench_checkpoint_save(uint64_t iterations)
+{
+    for (uint64_t i = 0; i < iterations; i++)
+    {
+        checkpoint_save();
+    }
+}
+
+static void bench_ctx_set_get_cmd(uint64_t iterations)
+{
+    for (uint64_t i = 0; i < iterations; i++)
+    {
+        set_cmd_wiper((i & 1) != 0);
+        sink_u8 = get_cmd_wiper();
+    }
+}
+
+static void bench_ctx_set_get_u32(uint64_t iterations)
+{
+    for (uint64_t i = 0; i < iterations; i++)
+    {
+        set_distance((distance_t)i);
+        sink_u32 = get_distance();
+    }
+}
+
+/***** Main function *********************************************************/
+
+int main(int argc, char *argv[])
+{
+    bench_config_t config = {BENCH_DEFAULT_WARMUP, BENCH_DEFAULT_REPETITIONS};
+    bench_result_t results[BENCH_MAX_RESULTS];
+    uint32_t count = 0;
+    int stdout_fd = 0;
+    int null_fd = 0;
+    int opt = 0;
+
+    while ((opt = getopt(argc, argv, "r:w:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'r':
+            config.repetitions = (uint32_t)atoi(optarg);
+            break;
+        case 'w':
+            config.warmup = (uint32_t)atoi(optarg);
+            break;
+        default:
+            fprintf(stderr, "Usage: %s [-r repetitions] [-w warmup]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    /* Setup inputs */
+    bcgv_ctx_init();
+    mux_frame[DRV_UDP_100MS_FRAME_SIZE - 1] = crc8_compute(mux_frame, DRV_UDP_100MS_FRAME_SIZE - 1);
+    drv_stub_set_udp_100ms(mux_frame);
+    mux_read_frame_100ms(drv_open());
+    bench_script_build(&lights_script, lights_steps, sizeof(lights_steps) / sizeof(*lights_steps));
+    bench_script_build(&indicators_script, indicators_steps, sizeof(indicators_steps) / sizeof(*indicators_steps));
+    bench_script_build(&washer_script, washer_steps, sizeof(washer_steps) / sizeof(*washer_steps));
+
+    /* Logger output is discarded while measuring */
+    fflush(stdout);
+    stdout_fd = dup(STDOUT_FILENO);
+    null_fd = open("/dev/null", O_WRONLY);
+    dup2(null_fd, STDOUT_FILENO);
+
+    bench_run(&config, "crc8_compute", &bench_crc8_compute, &results[count++]);
+    bench_run(&config, "mux_decode_frame_100ms", &bench_mux_decode_frame_100ms, &results[count++]);
+    bench_run(&config, "mux_encode_frame_200ms", &bench_mux_encode_frame_200ms, &results[count++]);
+    bench_run(&config, "comodo_decode_frame", &bench_comodo_decode_frame, &results[count++]);
+    bench_run(&config, "script_apply", &bench_script_apply_only, &results[count++]);
+    bench_run(&config, "fsm_lights_run", &bench_fsm_lights_run, &results[count++]);
+    bench_run(&config, "fsm_indicators_run", &bench_fsm_indicators_run, &results[count++]);
+    bench_run(&config, "fsm_windshield_washer_run", &bench_fsm_windshield_washer_run, &results[count++]);
+    bench_run(&config, "log_write", &bench_log_write, &results[count++]);
+    bench_run(&config, "log_write_repeated", &bench_log_write_repeated, &results[count++]);
+    if (log_open_binary(BENCH_LOG_BINARY_PATH) == true)
+    {
+        bench_run(&config, "log_write_binary", &bench_log_write_binary, &results[count++]);
+        log_close_binary();
+        unlink(BENCH_LOG_BINARY_PATH);
+    }
+    bench_run(&config, "ctx_get_all", &bench_ctx_get_all, &results[count++]);
+    bench_run(&config, "ctx_set_ranged", &bench_ctx_set_ranged, &results[count++]);
+    bench_run(&config, "ctx_set_ranged_noisy", &bench_ctx_set_ranged_noisy, &results[count++]);
+    bench_run(&config, "ctx_history_record", &bench_ctx_history_record, &results[count++]);
+    bench_run(&config, "trip_stats_update", &bench_trip_stats_update, &results[count++]);
+    if (checkpoint_open(BENCH_CHECKPOINT_PATH) == true)
+    {
+        bench_run(&config, "checkpoint_save", &bench_checkpoint_save, &results[count++]);
+        checkpoint_close();
+        unlink(BENCH_CHECKPOINT_PATH);
+    }
+    bench_run(&config, "ctx_set_get_cmd", &bench_ctx_set_get_cmd, &results[count++]);
+    bench_run(&config, "ctx_set_get_u32", &bench_ctx_set_get_u32, &results[count++]);
+
+    fflush(stdout);
+    dup2(stdout_fd, STDOUT_FILENO);
+    close(null_fd);
+    close(stdout_fd);
+
+    bench_write_json(stdout, "micro", results, count);
+
+    return EXIT_SUCCESS;
+}
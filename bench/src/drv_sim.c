@@ -0,0 +1,350 @@
+/**
+ * \file drv_sim.c
+ * \brief Implementation of simulated driver for end-to-end benchmarks.
+ * \details Replace drv_api.a: produce periodic MUX 100ms frames, deliver injected COMODO frames,
+ *          acknowledge BGF messages and record every frame written by the application with its time.
+ * \author Raphael CAUSSE
+ */
+
+/***** Includes **************************************************************/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+#include <string.h>
+#include <time.h>
+#include "drv_sim.h"
+#include "bench.h"
+#include "crc8.h"
+
+/***** Definitions ***********************************************************/
+
+#define DRV_SIM_FD (1)
+#define DRV_SIM_SERIAL_QUEUE_SIZE (64)
+#define DRV_SIM_EVENTS_SIZE (1024)
+
+/* Frame written by the application */
+typedef enum
+{
+    DRV_SIM_EVENT_BGF = 0,
+    DRV_SIM_EVENT_MUX
+} drv_sim_event_kind_t;
+
+typedef struct
+{
+    drv_sim_event_kind_t kind;
+    uint8_t data[DRV_UDP_200MS_FRAME_SIZE];
+    uint64_t timestamp;
+} drv_sim_event_t;
+
+/* Serial frame waiting for delivery */
+typedef struct
+{
+    serial_frame_t frame;
+    uint64_t due;
+} drv_sim_pending_t;
+
+/***** Static Variables ******************************************************/
+
+static pthread_mutex_t sim_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t sim_cond;
+static bool sim_cond_init = false;
+
+static drv_sim_config_t sim_config = {100000000ULL, 5000000ULL};
+static volatile bool sim_stopped = false;
+
+/* MUX 100ms frames */
+static uint64_t sim_next_udp = 0;
+static uint8_t sim_frame_number = 0;
+static uint8_t sim_fuel_level = 40;
+
+/* Serial frames to deliver */
+static drv_sim_pending_t sim_serial_queue[DRV_SIM_SERIAL_QUEUE_SIZE];
+static uint32_t sim_serial_count = 0;
+
+/* Frames written by application */
+static drv_sim_event_t sim_events[DRV_SIM_EVENTS_SIZE];
+static uint32_t sim_events_head = 0;
+static uint32_t sim_events_count = 0;
+
+/***** Static Functions ******************************************************/
+
+/**
+ * \brief Queue a serial frame for delivery. Must be called with simulation mutex held.
+ */
+static void drv_sim_queue_serial(uint32_t ser_num, const uint8_t *data, size_t size, uint64_t due)
+{
+    drv_sim_pending_t *pending = NULL;
+
+    if (sim_serial_count >= DRV_SIM_SERIAL_QUEUE_SIZE)
+    {
+        return;
+    }
+
+    pending = &sim_serial_queue[sim_serial_count++];
+    memset(pending, 0, sizeof(*pending));
+    pending->frame.serNum = ser_num;
+    pending->frame.frameSize = size;
+    memcpy(pending->frame.frame, data, size);
+    pending->due = due;
+}
+
+/**
+ * \brief Record a frame written by the application. Must be called with simulation mutex held.
+ */
+static void drv_sim_record(drv_sim_event_kind_t kind, const uint8_t *data, size_t size, uint64_t timestamp)
+{
+    drv_sim_event_t *event = &sim_events[(sim_events_head + sim_events_count) % DRV_SIM_EVENTS_SIZE];
+
+    if (sim_events_count < DRV_SIM_EVENTS_SIZE)
+    {
+        sim_events_count++;
+    }
+    else
+    {
+        sim_events_head = (sim_events_head + 1) % DRV_SIM_EVENTS_SIZE;
+    }
+
+    event->kind = kind;
+    memset(event->data, 0, sizeof(event->data));
+    memcpy(event->data, data, size);
+    event->timestamp = timestamp;
+    pthread_cond_broadcast(&sim_cond);
+}
+
+/**
+ * \brief Convert a monotonic time to an absolute timespec.
+ */
+static struct timespec drv_sim_timespec(uint64_t ns)
+{
+    struct timespec ts;
+
+    ts.tv_sec = (time_t)(ns / 1000000000ULL);
+    ts.tv_nsec = (long)(ns % 1000000000ULL);
+
+    return ts;
+}
+
+typedef bool (*drv_sim_match_t)(const drv_sim_event_t *event, const uint8_t *args);
+
+static bool drv_sim_match_bgf(const drv_sim_event_t *event, const uint8_t *args)
+{
+    return (event->kind == DRV_SIM_EVENT_BGF) && (event->data[0] == args[0]) && (event->data[1] == args[1]);
+}
+
+static bool drv_sim_match_mux_bit(const drv_sim_event_t *event, const uint8_t *args)
+{
+    return (event->kind == DRV_SIM_EVENT_MUX) && ((uint8_t)((event->data[args[0]] >> args[1]) & 1U) == args[2]);
+}
+
+/**
+ * \brief Wait for the first recorded event matching a predicate after a given time.
+ */
+static uint64_t drv_sim_wait(drv_sim_match_t match, const uint8_t *args, uint64_t after, uint64_t timeout_ns)
+{
+    struct timespec deadline;
+    uint64_t found = 0;
+    int ret = 0;
+
+    deadline = drv_sim_timespec(bench_now_ns() + timeout_ns);
+
+    pthread_mutex_lock(&sim_mutex);
+    while ((found == 0) && (ret == 0))
+    {
+        for (uint32_t i = 0; i < sim_events_count; i++)
+        {
+            const drv_sim_event_t *event = &sim_events[(sim_events_head + i) % DRV_SIM_EVENTS_SIZE];
+
+            if ((event->timestamp > after) && match(event, args))
+            {
+                found = event->timestamp;
+                break;
+            }
+        }
+        if (found == 0)
+        {
+            ret = pthread_cond_timedwait(&sim_cond, &sim_mutex, &deadline);
+        }
+    }
+    pthread_mutex_unlock(&sim_mutex);
+
+    return found;
+}
+
+/***** Functions *************************************************************/
+
+void drv_sim_reset(const drv_sim_config_t *config)
+{
+    pthread_condattr_t attr;
+
+    pthread_mutex_lock(&sim_mutex);
+    if (sim_cond_init == false)
+    {
+        pthread_condattr_init(&attr);
+        pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+        pthread_cond_init(&sim_cond, &attr);
+        pthread_condattr_destroy(&attr);
+        sim_cond_init = true;
+    }
+    sim_config = *config;
+    sim_stopped = false;
+    sim_next_udp = 0;
+    sim_frame_number = 0;
+    sim_fuel_level = 40;
+    sim_serial_count = 0;
+    sim_events_head = 0;
+    sim_events_count = 0;
+    pthread_mutex_unlock(&sim_mutex);
+}
+
+void drv_sim_stop(void)
+{
+    sim_stopped = true;
+}
+
+uint64_t drv_sim_inject_comodo(uint8_t frame)
+{
+    uint64_t now = 0;
+
+    pthread_mutex_lock(&sim_mutex);
+    now = bench_now_ns();
+    drv_sim_queue_serial(DRV_SIM_COMODO_CHANNEL, &frame, 1, now);
+    pthread_mutex_unlock(&sim_mutex);
+
+    return now;
+}
+
+uint64_t drv_sim_inject_fuel_level(uint8_t fuel_level)
+{
+    uint64_t now = 0;
+
+    pthread_mutex_lock(&sim_mutex);
+    now = bench_now_ns();
+    sim_fuel_level = fuel_level;
+    pthread_mutex_unlock(&sim_mutex);
+
+    return now;
+}
+
+uint64_t drv_sim_wait_bgf(uint8_t id, uint8_t flag, uint64_t after, uint64_t timeout_ns)
+{
+    const uint8_t args[2] = {id, flag};
+
+    return drv_sim_wait(&drv_sim_match_bgf, args, after, timeout_ns);
+}
+
+uint64_t drv_sim_wait_mux_bit(uint8_t byte, uint8_t bit, bool value, uint64_t after, uint64_t timeout_ns)
+{
+    const uint8_t args[3] = {byte, bit, (uint8_t)value};
+
+    return drv_sim_wait(&drv_sim_match_mux_bit, args, after, timeout_ns);
+}
+
+int32_t drv_open(void)
+{
+    return DRV_SIM_FD;
+}
+
+int32_t drv_read_udp_100ms(int32_t drvFd, uint8_t udpFrame[DRV_UDP_100MS_FRAME_SIZE])
+{
+    struct timespec wakeup;
+    uint64_t now = bench_now_ns();
+
+    (void)drvFd;
+    if (sim_stopped == true)
+    {
+        return DRV_ERROR;
+    }
+
+    /* Wait next period, frames are not buffered when the application is late */
+    pthread_mutex_lock(&sim_mutex);
+    if ((sim_next_udp == 0) || (sim_next_udp < now))
+    {
+        sim_next_udp = now + sim_config.udp_period_ns;
+    }
+    wakeup = drv_sim_timespec(sim_next_udp);
+    sim_next_udp += sim_config.udp_period_ns;
+    pthread_mutex_unlock(&sim_mutex);
+
+    clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wakeup, NULL);
+
+    pthread_mutex_lock(&sim_mutex);
+    sim_frame_number = (sim_frame_number % 100) + 1;
+    memset(udpFrame, 0, DRV_UDP_100MS_FRAME_SIZE);
+    udpFrame[0] = sim_frame_number;
+    udpFrame[4] = 100; /* Distance (km) */
+    udpFrame[5] = 90;  /* Speed (km/h) */
+    udpFrame[8] = sim_fuel_level;
+    udpFrame[11] = 0x0B; /* Engine RPM (3000) */
+    udpFrame[12] = 0xB8;
+    udpFrame[DRV_UDP_100MS_FRAME_SIZE - 1] = crc8_compute(udpFrame, DRV_UDP_100MS_FRAME_SIZE - 1);
+    pthread_mutex_unlock(&sim_mutex);
+
+    return DRV_SUCCESS;
+}
+
+int32_t drv_write_udp_200ms(int32_t drvFd, const uint8_t udpFrame[DRV_UDP_200MS_FRAME_SIZE])
+{
+    (void)drvFd;
+
+    pthread_mutex_lock(&sim_mutex);
+    drv_sim_record(DRV_SIM_EVENT_MUX, udpFrame, DRV_UDP_200MS_FRAME_SIZE, bench_now_ns());
+    pthread_mutex_unlock(&sim_mutex);
+
+    return DRV_SUCCESS;
+}
+
+int32_t drv_read_ser(int32_t drvFd, serial_frame_t serialData[DRV_MAX_FRAMES], uint32_t *serialDataLen)
+{
+    uint64_t now = bench_now_ns();
+    uint32_t kept = 0;
+
+    (void)drvFd;
+    *serialDataLen = 0;
+
+    pthread_mutex_lock(&sim_mutex);
+    for (uint32_t i = 0; i < sim_serial_count; i++)
+    {
+        if ((sim_serial_queue[i].due <= now) && (*serialDataLen < DRV_MAX_FRAMES))
+        {
+            serialData[(*serialDataLen)++] = sim_serial_queue[i].frame;
+        }
+        else
+        {
+            sim_serial_queue[kept++] = sim_serial_queue[i];
+        }
+    }
+    sim_serial_count = kept;
+    pthread_mutex_unlock(&sim_mutex);
+
+    return DRV_SUCCESS;
+}
+
+int32_t drv_write_ser(int32_t drvFd, const serial_frame_t *serialData, uint32_t serialDataLen)
+{
+    uint64_t now = bench_now_ns();
+
+    (void)drvFd;
+
+    pthread_mutex_lock(&sim_mutex);
+    for (uint32_t i = 0; i < serialDataLen; i++)
+    {
+        if (serialData[i].serNum == DRV_SIM_BGF_CHANNEL)
+        {
+            drv_sim_record(DRV_SIM_EVENT_BGF, serialData[i].frame, serialData[i].frameSize, now);
+
+            /* BGF acknowledges with the same message */
+            drv_sim_queue_serial(DRV_SIM_BGF_CHANNEL, serialData[i].frame, serialData[i].frameSize,
+                                 now + sim_config.bgf_ack_delay_ns);
+        }
+    }
+    pthread_mutex_unlock(&sim_mutex);
+
+    return DRV_SUCCESS;
+}
+
+int32_t drv_close(int32_t drvFd)
+{
+    (void)drvFd;
+    return DRV_SUCCESS;
+}
@@ -0,0 +1,77 @@
+/**
+ * \file drv_sim.h
+ * \brief Interface of simulated driver for end-to-end benchmarks.
+ * \details Replace drv_api.a: produce periodic MUX 100ms frames, deliver injected COMODO frames,
+ *          acknowledge BGF messages and record every frame written by the application with its time.
+ * \author Raphael CAUSSE
+ */
+
+#ifndef DRV_SIM_H
+#define DRV_SIM_H
+
+/***** Includes **************************************************************/
+
+#include <stdbool.h>
+#include "drv_api.h"
+
+/***** Definitions ***********************************************************/
+
+#define DRV_SIM_COMODO_CHANNEL (12)
+#define DRV_SIM_BGF_CHANNEL (11)
+
+/* Simulation configuration */
+typedef struct
+{
+    uint64_t udp_period_ns;   /* Period of MUX 100ms frames */
+    uint64_t bgf_ack_delay_ns; /* Delay before BGF acknowledges a message */
+} drv_sim_config_t;
+
+/***** Functions *************************************************************/
+
+/**
+ * \brief Reset the simulation with a configuration.
+ * \param config : Simulation configuration
+ */
+void drv_sim_reset(const drv_sim_config_t *config);
+
+/**
+ * \brief Stop the simulation, unblocking any pending MUX read.
+ */
+void drv_sim_stop(void);
+
+/**
+ * \brief Inject a COMODO frame, available to next serial read.
+ * \param frame : COMODO frame
+ * \return uint64_t : Injection time (ns)
+ */
+uint64_t drv_sim_inject_comodo(uint8_t frame);
+
+/**
+ * \brief Change the fuel level carried by next MUX 100ms frames.
+ * \param fuel_level : Fuel level (litres)
+ * \return uint64_t : Injection time (ns)
+ */
+uint64_t drv_sim_inject_fuel_level(uint8_t fuel_level);
+
+/**
+ * \brief Wait until the application writes a BGF message.
+ * \param id : Message id
+ * \param flag : Message flag
+ * \param after : Only consider messages written after this time (ns)
+ * \param timeout_ns : Maximum waiting time
+ * \return uint64_t : Write time (ns), 0 on timeout
+ */
+uint64_t drv_sim_wait_bgf(uint8_t id, uint8_t flag, uint64_t after, uint64_t timeout_ns);
+
+/**
+ * \brief Wait until the application writes a MUX 200ms frame with a given bit value.
+ * \param byte : Byte index in the frame
+ * \param bit : Bit index in the byte
+ * \param value : Expected bit value
+ * \param after : Only consider frames written after this time (ns)
+ * \param timeout_ns : Maximum waiting time
+ * \return uint64_t : Write time (ns), 0 on timeout
+ */
+uint64_t drv_sim_wait_mux_bit(uint8_t byte, uint8_t bit, bool value, uint64_t after, uint64_t timeout_ns);
+
+#endif /* DRV_SIM_H */
@@ -0,0 +1,67 @@
+/**
+ * \file drv_stub.c
+ * \brief Implementation of driver stub for micro benchmarks.
+ * \details Replace drv_api.a: frames are provided by the benchmark instead of the driver process.
+ * \author Raphael CAUSSE
+ */
+
+/***** Includes **************************************************************/
+
+#include <string.h>
+#include "drv_stub.h"
+
+/***** Definitions ***********************************************************/
+
+#define DRV_STUB_FD (1)
+
+/***** Static Variables ******************************************************/
+
+static uint8_t drv_stub_udp_100ms[DRV_UDP_100MS_FRAME_SIZE];
+
+/***** Functions *************************************************************/
+
+void drv_stub_set_udp_100ms(const uint8_t frame[DRV_UDP_100MS_FRAME_SIZE])
+{
+    memcpy(drv_stub_udp_100ms, frame, DRV_UDP_100MS_FRAME_SIZE);
+}
+
+int32_t drv_open(void)
+{
+    return DRV_STUB_FD;
+}
+
+int32_t drv_read_udp_100ms(int32_t drvFd, uint8_t udpFrame[DRV_UDP_100MS_FRAME_SIZE])
+{
+    (void)drvFd;
+    memcpy(udpFrame, drv_stub_udp_100ms, DRV_UDP_100MS_FRAME_SIZE);
+    return DRV_SUCCESS;
+}
+
+int32_t drv_write_udp_200ms(int32_t drvFd, const uint8_t udpFrame[DRV_UDP_200MS_FRAME_SIZE])
+{
+    (void)drvFd;
+    (void)udpFrame;
+    return DRV_SUCCESS;
+}
+
+int32_t drv_read_ser(int32_t drvFd, serial_frame_t serialData[DRV_MAX_FRAMES], uint32_t *serialDataLen)
+{
+    (void)drvFd;
+    (void)serialData;
+    *serialDataLen = 0;
+    return DRV_SUCCESS;
+}
+
+int32_t drv_write_ser(int32_t drvFd, const serial_frame_t *serialData, uint32_t serialDataLen)
+{
+    (void)drvFd;
+    (void)serialData;
+    (void)serialDataLen;
+    return DRV_SUCCESS;
+}
+
+int32_t drv_close(int32_t drvFd)
+{
+    (void)drvFd;
+    return DRV_SUCCESS;
+}
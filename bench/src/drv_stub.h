@@ -0,0 +1,23 @@
+/**
+ * \file drv_stub.h
+ * \brief Interface of driver stub for micro benchmarks.
+ * \details Replace drv_api.a: frames are provided by the benchmark instead of the driver process.
+ * \author Raphael CAUSSE
+ */
+
+#ifndef DRV_STUB_H
+#define DRV_STUB_H
+
+/***** Includes **************************************************************/
+
+#include "drv_api.h"
+
+/***** Functions *************************************************************/
+
+/**
+ * \brief Set the frame returned by next drv_read_udp_100ms() calls.
+ * \param frame : MUX 100ms frame
+ */
+void drv_stub_set_udp_100ms(const uint8_t frame[DRV_UDP_100MS_FRAME_SIZE]);
+
+#endif /* DRV_STUB_H */
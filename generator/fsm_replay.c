@@ -0,0 +1,167 @@
+/**
+ * \file fsm_replay.c
+ * \brief Replay a seeded input sequence through the FSMs and print their outputs.
+ * \details Built by "make fsm_replay" in app against the hand-written FSMs of fsm/reference, the generated
+ *          FSMs and the precomputed tables, whose outputs must be identical. Each step changes a few commands,
+ *          sets acknowledgement bits as BGF would, optionally kicks the lights and indicators FSMs, then runs
+ *          the three FSMs and prints their states, flags and acknowledgement bits. Return codes are not
+ *          compared, see readme.md.
+ *          Usage: fsm_replay <seed> <kick 0|1> [steps]
+ * \author Raphael CAUSSE
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+/***** Includes **************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "bcgv_api.h"
+#include "fsm_common.h"
+#include "fsm_lights.h"
+#include "fsm_indicators.h"
+#include "fsm_windshield_washer.h"
+#include "log.h"
+
+/***** Definitions ***********************************************************/
+
+#define DEFAULT_STEPS (500)
+#define SEED_BASE (88172645463325252ULL)
+#define SEED_MIX (0x9E3779B97F4A7C15ULL)
+
+/***** Static Variables ******************************************************/
+
+static uint64_t random_state = SEED_BASE;
+
+/***** Static Functions ******************************************************/
+
+/**
+ * \brief Draw a pseudo-random number (xorshift64), identical on every platform.
+ * \return uint32_t : Random number
+ */
+static uint32_t random_next(void)
+{
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 7;
+    random_state ^= random_state << 17;
+
+    return (uint32_t)random_state;
+}
+
+/**
+ * \brief Change a few commands, each one rarely, so that the FSMs stay long enough in their waiting states.
+ */
+static void change_commands(void)
+{
+    uint32_t r = random_next();
+
+    if ((r & 0x000007u) == 0)
+    {
+        set_cmd_position_light((random_next() & 1u) != 0);
+    }
+    if ((r & 0x000038u) == 0)
+    {
+        set_cmd_crossing_light((random_next() & 1u) != 0);
+    }
+    if ((r & 0x0001c0u) == 0)
+    {
+        set_cmd_highbeam_light((random_next() & 1u) != 0);
+    }
+    if ((r & 0x000e00u) == 0)
+    {
+        set_cmd_indic_left((random_next() & 1u) != 0);
+    }
+    if ((r & 0x007000u) == 0)
+    {
+        set_cmd_indic_right((random_next() & 1u) != 0);
+    }
+    if ((r & 0x038000u) == 0)
+    {
+        set_cmd_indic_hazard((random_next() & 1u) != 0);
+    }
+    if ((r & 0x1c0000u) == 0)
+    {
+        set_cmd_wiper((random_next() & 1u) != 0);
+    }
+    if ((r & 0xe00000u) == 0)
+    {
+        set_cmd_washer((random_next() & 1u) != 0);
+    }
+}
+
+/**
+ * \brief Set acknowledgement bits as BGF would: for the outputs switched on, sometimes spurious or lost.
+ */
+static void echo_acks(void)
+{
+    uint32_t r = random_next();
+    bit_flag_t ack = get_bit_flag_bgf_ack();
+
+    if ((r & 0x0003u) == 0)
+    {
+        ack |= (get_flag_position_light() == ON) ? BGF_ACK_POSITION_LIGHT : 0;
+        ack |= (get_flag_crossing_light() == ON) ? BGF_ACK_CROSSING_LIGHT : 0;
+        ack |= (get_flag_highbeam_light() == ON) ? BGF_ACK_HIGHBEAM_LIGHT : 0;
+        /* Blinking indicators are acknowledged while off too */
+        ack |= ((get_cmd_indic_left() == ON) || (get_cmd_indic_hazard() == ON)) ? BGF_ACK_INDIC_LEFT : 0;
+        ack |= ((get_cmd_indic_right() == ON) || (get_cmd_indic_hazard() == ON)) ? BGF_ACK_INDIC_RIGHT : 0;
+    }
+    if ((r & 0x03f0u) == 0)
+    {
+        ack |= (bit_flag_t)(1u << (random_next() % 5));
+    }
+    if ((r & 0x7c00u) == 0)
+    {
+        ack = 0;
+    }
+    set_bit_flag_bgf_ack(ack);
+}
+
+/***** Main function *********************************************************/
+
+int main(int argc, char *argv[])
+{
+    unsigned long steps = DEFAULT_STEPS;
+    bool kick = false;
+
+    if ((argc != 3) && (argc != 4))
+    {
+        fprintf(stderr, "Usage: %s <seed> <kick 0|1> [steps]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    random_state = SEED_BASE ^ (strtoull(argv[1], NULL, 10) * SEED_MIX);
+    if (random_state == 0)
+    {
+        random_state = SEED_BASE;
+    }
+    kick = (atoi(argv[2]) != 0);
+    if (argc == 4)
+    {
+        steps = strtoul(argv[3], NULL, 10);
+    }
+
+    /* Transitions to the final state are logged on stdout, which only holds the outputs */
+    log_set_level(LOG_LEVEL_NONE);
+    bcgv_ctx_init();
+
+    for (unsigned long step = 0; step < steps; step++)
+    {
+        change_commands();
+        echo_acks();
+        if ((kick == true) && ((random_next() & 0x3u) == 0))
+        {
+            fsm_lights_kick();
+            fsm_indicators_kick();
+        }
+        fsm_lights_run();
+        fsm_indicators_run();
+        fsm_windshield_washer_run();
+
+        printf("%lu %d %d %d %d%d%d %d%d%d %d%d %02x\n", step, fsm_lights_get_state(), fsm_indicators_get_state(),
+               fsm_windshield_washer_get_state(), get_flag_position_light(), get_flag_crossing_light(),
+               get_flag_highbeam_light(), get_flag_indic_hazard(), get_flag_indic_left(), get_flag_indic_right(),
+               get_flag_wiper(), get_flag_washer(), (unsigned)get_bit_flag_bgf_ack());
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,315 @@
+import glob
+import json
+import os
+import re
+import sys
+
+# Input and output directories
+spec_dir = 'fsm'
+output_dir = '../app/src/fsm'
+
+ANY = 'ANY'
+NONE = 'NONE'
+ERR = 'ERR'
+
+# A function that reports a specification problem
+def report(spec_name, level, message, problems):
+    print(f"{spec_name}: {level}: {message}")
+    if level == 'error':
+        problems.append(message)
+
+# A function that lists the C identifiers used by an expression
+def identifiers(expression):
+    return set(re.findall(r'\b[A-Za-z_]\w*\b', expression))
+
+# A function that returns the first transition taken for (state, event), like a table scan would
+def find_transition(spec, state, event):
+    for index, transition in enumerate(spec['transitions']):
+        if transition['from'] in (state, ANY) and transition['event'] == event:
+            return index, transition
+    return None, None
+
+# A function that returns the rules of a state, ending with the implicit "no event" rule
+def state_rules(spec, state):
+    rules = list(spec.get('rules', {}).get(state, []))
+    if not rules or 'when' in rules[-1]:
+        rules.append({'event': NONE})
+    return rules
+
+# [checks] - A function that validates the specification and runs the static analysis
+def check_spec(spec):
+    name = spec['name']
+    problems = []
+    states = [s['name'] for s in spec['states']]
+    events = [e['name'] for e in spec['events']]
+    actions = spec.get('actions', [])
+    initial = states[0]
+    final = spec['final']
+
+    if NONE not in events or ERR not in events:
+        report(name, 'error', f"events {NONE} and {ERR} are mandatory", problems)
+    if final not in states:
+        report(name, 'error', f"final state {final} is not declared", problems)
+
+    # References
+    for transition in spec['transitions']:
+        if transition['from'] != ANY and transition['from'] not in states:
+            report(name, 'error', f"transition from undeclared state {transition['from']}", problems)
+        if transition['to'] not in states:
+            report(name, 'error', f"transition to undeclared state {transition['to']}", problems)
+        if transition['event'] not in events:
+            report(name, 'error', f"transition on undeclared event {transition['event']}", problems)
+        if transition.get('action') and transition['action'] not in actions:
+            report(name, 'error', f"transition calls undeclared action {transition['action']}", problems)
+    for state, rules in spec.get('rules', {}).items():
+        if state not in states or state == final:
+            report(name, 'error', f"rules given for undeclared or final state {state}", problems)
+        for rule in rules:
+            if rule['event'] not in events:
+                report(name, 'error', f"state {state} raises undeclared event {rule['event']}", problems)
+    for timer in spec.get('timers', []):
+        if timer.get('advance') not in ('before', 'after'):
+            report(name, 'error', f"timer {timer['name']} must advance 'before' or 'after' the rules", problems)
+        for state in timer['states']:
+            if state not in states:
+                report(name, 'error', f"timer {timer['name']} runs in undeclared state {state}", problems)
+    if problems:
+        return problems
+
+    # Unhandled events: a rule raises an event no transition takes in that state
+    raised = set()
+    taken = set()
+    for state in states:
+        if state == final:
+            continue
+        for rule in state_rules(spec, state):
+            event = rule['event']
+            index, _ = find_transition(spec, state, event)
+            raised.add(event)
+            if index is not None:
+                taken.add(index)
+            elif event != NONE:
+                report(name, 'error', f"event {event} raised in state {state} is not handled", problems)
+
+    # Unreachable states, walking the transitions actually taken from the initial state
+    reachable = {initial}
+    pending = [initial]
+    while pending:
+        state = pending.pop()
+        if state == final:
+            continue
+        for rule in state_rules(spec, state):
+            _, transition = find_transition(spec, state, rule['event'])
+            if transition is not None and transition['to'] not in reachable:
+                reachable.add(transition['to'])
+                pending.append(transition['to'])
+    for state in states:
+        if state not in reachable:
+            # A machine that can not fail never reaches its final state
+            level = 'warning' if state == final else 'error'
+            report(name, level, f"state {state} is unreachable", problems)
+
+    # Dead code that does not break the machine
+    for event in events:
+        if event not in raised and event != ERR:
+            report(name, 'warning', f"event {event} is never raised", problems)
+    for index, transition in enumerate(spec['transitions']):
+        if index not in taken and transition['from'] != ANY:
+            report(name, 'warning', f"transition {index} ({transition['from']}, {transition['event']}) is never taken", problems)
+
+    return problems
+
+# A function that generates an enum with aligned comments
+def generate_enum(members, type_name):
+    width = max(len(member) for member, _ in members) + 1
+    enum = "typedef enum\n{\n"
+    for index, (member, comment) in enumerate(members):
+        separator = "," if index < len(members) - 1 else ""
+        enum += f"    {(member + separator).ljust(width)} /* {comment} */\n"
+    return enum + f"}} {type_name};\n\n"
+
+# [fsm_<name>_gen.h] - A function that generates the direct-dispatch evaluation of one FSM
+def generate_fsm(spec, spec_file):
+    name = spec['name']
+    guard_name = f"FSM_{name.upper()}_GEN_H"
+    states = spec['states']
+    events = spec['events']
+    final = spec['final']
+    inputs = spec.get('inputs', {})
+    timers = spec.get('timers', [])
+
+    header = f"""/**
+ * \\file fsm_{name}_gen.h
+ * \\brief Generated evaluation of the {spec['brief']} FSM.
+ * \\details Generated by generator/gen_fsm.py from generator/{spec_file}, do not edit.
+ *          Private to fsm_{name}.c, which provides the actions and guards declared here.
+ *          Each state evaluates its own rules and calls the matching transition directly.
+ * \\author Raphael CAUSSE
+ */
+
+#ifndef {guard_name}
+#define {guard_name}
+
+/***** Definitions ***********************************************************/
+
+"""
+    for definition in spec.get('definitions', []):
+        header += f"#define {definition['name']} ({definition['value']}) /* {definition['comment']} */\n"
+    if spec.get('definitions'):
+        header += "\n"
+
+    # States: initial is 0, final is 255
+    members = []
+    for index, state in enumerate(states):
+        if state['name'] == final:
+            value = " = 255"
+        elif index == 0:
+            value = " = 0"
+        else:
+            value = ""
+        members.append((f"ST_{state['name']}{value}", state['comment']))
+    header += "/* States */\n" + generate_enum(members, 'fsm_state_t')
+
+    # Events: none is 0, error is 255
+    ordered = [e for e in events if e['name'] == NONE] + [e for e in events if e['name'] not in (NONE, ERR)] + [e for e in events if e['name'] == ERR]
+    members = []
+    for event in ordered:
+        if event['name'] == NONE:
+            value = " = 0"
+        elif event['name'] == ERR:
+            value = " = 255"
+        else:
+            value = ""
+        members.append((f"EV_{event['name']}{value}", event['comment']))
+    header += "/* Events */\n" + generate_enum(members, 'fsm_event_t')
+
+    header += "/***** Static Functions Declarations *****************************************/\n\n"
+    for action in spec.get('actions', []):
+        header += f"static int {action}(void);\n"
+    for guard in spec.get('guards', []):
+        header += f"static bool {guard}(void);\n"
+    header += "static int fsm_step(bool tick);\n\n"
+
+    header += "/***** Static Variables ******************************************************/\n\n"
+    variables = [(f"static fsm_state_t state = ST_{states[0]['name']};", "State of the FSM"),
+                 ("static fsm_trace_t trace;", "Transition instrumentation")]
+    for timer in timers:
+        variables.append((f"static uint8_t {timer['name']} = 0;", timer['comment']))
+    width = max(len(variable) for variable, _ in variables) + 1
+    for variable, comment in variables:
+        header += f"{variable.ljust(width)}/* {comment} */\n"
+    header += "\n"
+
+    header += f"""/***** Static Functions Definitions ******************************************/
+
+/**
+ * \\brief Evaluate the FSM once.
+ * \\param tick : true for periodic 100ms evaluation, false for an immediate evaluation not advancing timers
+ * \\return int : Return code of transition callback.
+ */
+static int fsm_step(bool tick)
+{{
+    int ret = {spec.get('idle_return', 0)};
+    fsm_state_t previous = state;
+
+"""
+    if not timers:
+        header += "    (void)tick;\n\n"
+    header += "    fsm_trace_begin(&trace);\n"
+    header += "    switch (state)\n    {\n"
+
+    for state in states:
+        state_name = state['name']
+        if state_name == final:
+            continue
+        rules = state_rules(spec, state_name)
+        body = ""
+
+        # Inputs used by this state, with their dependencies, in declaration order
+        used = set()
+        for rule in rules:
+            used |= identifiers(rule.get('when', ''))
+        for input_name in reversed(list(inputs)):
+            if input_name in used:
+                used |= identifiers(inputs[input_name])
+        for input_name, expression in inputs.items():
+            if input_name in used:
+                body += f"        const bool {input_name} = {expression};\n"
+        if body:
+            body += "\n"
+
+        for timer in timers:
+            if timer['advance'] == 'before' and state_name in timer['states']:
+                body += f"        if (tick)\n        {{\n            {timer['name']}++;\n        }}\n"
+
+        for position, rule in enumerate(rules):
+            index, transition = find_transition(spec, state_name, rule['event'])
+            if index is None and 'when' not in rule:
+                continue
+            if 'when' in rule:
+                keyword = "if" if position == 0 else "else if"
+                body += f"        {keyword} ({rule['when']})\n"
+            elif position > 0:
+                body += "        else\n"
+            indent = "            " if (position > 0 or 'when' in rule) else "        "
+            block = ""
+            if index is None:
+                block += f"{indent}/* EV_{rule['event']}: no transition */\n"
+            else:
+                block += f"{indent}fsm_trace_transition(&trace, {index}u, ST_{state_name}, ST_{transition['to']}, EV_{rule['event']});\n"
+                block += f"{indent}state = ST_{transition['to']};\n"
+                if transition.get('action'):
+                    block += f"{indent}ret = {transition['action']}();\n"
+            if indent == "        ":
+                body += block
+            else:
+                body += "        {\n" + block + "        }\n"
+
+        for timer in timers:
+            if timer['advance'] == 'after' and state_name in timer['states']:
+                body += f"        if (tick && (state == ST_{state_name}))\n        {{\n            {timer['name']}++;\n        }}\n"
+
+        header += f"    case ST_{state_name}:\n    {{\n{body}        break;\n    }}\n\n"
+
+    # The final state stays put, a corrupted state takes the error transition if any
+    header += f"    case ST_{final}:\n        break;\n\n    default:\n"
+    index, transition = find_transition(spec, None, ERR)
+    if index is not None:
+        header += f"        fsm_trace_transition(&trace, {index}u, state, ST_{transition['to']}, EV_{ERR});\n"
+        header += f"        state = ST_{transition['to']};\n"
+        if transition.get('action'):
+            header += f"        ret = {transition['action']}();\n"
+    header += f"""        break;
+    }}
+    fsm_trace_end(&trace);
+
+    /* Keep the transitions leading to the final state */
+    if ((state == ST_{final}) && (previous != ST_{final}))
+    {{
+        fsm_trace_dump("{name}", &trace.data);
+    }}
+
+    return ret;
+}}
+
+#endif /* {guard_name} */
+"""
+    return header
+
+# Generate every FSM described in the specification directory
+def main():
+    failed = False
+    for path in sorted(glob.glob(os.path.join(spec_dir, '*.json'))):
+        with open(path, 'r', encoding='utf-8') as f:
+            spec = json.load(f)
+        if check_spec(spec):
+            failed = True
+            continue
+        output = os.path.join(output_dir, f"fsm_{spec['name']}_gen.h")
+        with open(output, 'w', encoding='utf-8') as f:
+            f.write(generate_fsm(spec, path.replace(os.sep, '/')))
+        print(f"{spec['name']}: generated {output}")
+    return 1 if failed else 0
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,434 @@
+/**
+ * \file gen_fsm_product.c
+ * \brief Generate the precomputed table of one FSM (see fsm_product.h).
+ * \details Built once per FSM by "make fsm_product" in app, with FSM_PRODUCT_LIGHTS, FSM_PRODUCT_INDICATORS
+ *          or FSM_PRODUCT_WINDSHIELD_WASHER defined. The FSM source is included to drive its evaluation
+ *          directly: every packed state, input vector, tick and timer class is evaluated once to fill the
+ *          table, then random input sequences are run through both the table and the FSM, which must agree
+ *          on state, timer, flags, acknowledgement bits and return code before the table is written.
+ *          Usage: gen_fsm_product <output.c>
+ * \author Raphael CAUSSE
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+/***** Includes **************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "fsm_product.h"
+#include "log.h"
+
+/* Capture the transitions taken by the FSM instead of recording them */
+#define fsm_trace_transition capture_transition
+
+#if defined(FSM_PRODUCT_LIGHTS)
+#include "fsm_lights.c"
+#define FSM_NAME "lights"
+#define FSM_INPUTS FSM_PRODUCT_LIGHTS_INPUTS
+#define FSM_STATES FSM_PRODUCT_LIGHTS_STATES
+#define FSM_TRANSITIONS FSM_PRODUCT_LIGHTS_TRANSITIONS
+#define FSM_SIZE FSM_PRODUCT_LIGHTS_SIZE
+#define FSM_TIMER_LIMIT TIMER_1S_COUNT_100MS
+#define FSM_CMDS (3)
+#define FSM_FLAGS (3)
+#define FSM_ACKS (3)
+#elif defined(FSM_PRODUCT_INDICATORS)
+#include "fsm_indicators.c"
+#define FSM_NAME "indicators"
+#define FSM_INPUTS FSM_PRODUCT_INDICATORS_INPUTS
+#define FSM_STATES FSM_PRODUCT_INDICATORS_STATES
+#define FSM_TRANSITIONS FSM_PRODUCT_INDICATORS_TRANSITIONS
+#define FSM_SIZE FSM_PRODUCT_INDICATORS_SIZE
+#define FSM_TIMER_LIMIT TIMER_1S_COUNT_100MS
+#define FSM_CMDS (3)
+#define FSM_FLAGS (3)
+#define FSM_ACKS (2)
+#elif defined(FSM_PRODUCT_WINDSHIELD_WASHER)
+#include "fsm_windshield_washer.c"
+#define FSM_NAME "windshield_washer"
+#define FSM_INPUTS FSM_PRODUCT_WINDSHIELD_WASHER_INPUTS
+#define FSM_STATES FSM_PRODUCT_WINDSHIELD_WASHER_STATES
+#define FSM_TRANSITIONS FSM_PRODUCT_WINDSHIELD_WASHER_TRANSITIONS
+#define FSM_SIZE FSM_PRODUCT_WINDSHIELD_WASHER_SIZE
+#define FSM_TIMER_LIMIT TIMER_2S_COUNT_100MS
+#define FSM_CMDS (2)
+#define FSM_FLAGS (2)
+#define FSM_ACKS (0)
+#else
+#error "Define FSM_PRODUCT_LIGHTS, FSM_PRODUCT_INDICATORS or FSM_PRODUCT_WINDSHIELD_WASHER"
+#endif
+
+/***** Definitions ***********************************************************/
+
+#define ACK_SHIFT (FSM_CMDS + FSM_FLAGS)
+#define RANDOM_STEPS (1u << 20)
+#define NO_TRANSITION (-1)
+
+/***** Static Variables ******************************************************/
+
+static int captured = NO_TRANSITION; /* Transition taken by the last evaluation */
+static int captured_to = 0;          /* Its next state */
+static int captured_event = 0;       /* Its event */
+
+static uint16_t table[FSM_SIZE];
+static int trans_next[FSM_TRANSITIONS];
+static int trans_event[FSM_TRANSITIONS];
+static uint32_t checked = 0; /* Transitions taken by the random sequences, one bit each */
+
+/***** Static Functions ******************************************************/
+
+#if defined(FSM_PRODUCT_LIGHTS)
+
+static void load_inputs(uint32_t inputs)
+{
+    set_cmd_position_light(inputs & 0x01u);
+    set_cmd_crossing_light((inputs >> 1) & 0x01u);
+    set_cmd_highbeam_light((inputs >> 2) & 0x01u);
+    set_flag_position_light((inputs >> 3) & 0x01u);
+    set_flag_crossing_light((inputs >> 4) & 0x01u);
+    set_flag_highbeam_light((inputs >> 5) & 0x01u);
+    set_bit_flag_bgf_ack((bit_flag_t)((inputs >> ACK_SHIFT) & 0x07u));
+}
+
+static uint32_t read_inputs(void)
+{
+    return (uint32_t)get_cmd_position_light() | ((uint32_t)get_cmd_crossing_light() << 1) |
+           ((uint32_t)get_cmd_highbeam_light() << 2) | ((uint32_t)get_flag_position_light() << 3) |
+           ((uint32_t)get_flag_crossing_light() << 4) | ((uint32_t)get_flag_highbeam_light() << 5) |
+           ((uint32_t)(get_bit_flag_bgf_ack() & 0x07u) << ACK_SHIFT);
+}
+
+#elif defined(FSM_PRODUCT_INDICATORS)
+
+static void load_inputs(uint32_t inputs)
+{
+    set_cmd_indic_hazard(inputs & 0x01u);
+    set_cmd_indic_left((inputs >> 1) & 0x01u);
+    set_cmd_indic_right((inputs >> 2) & 0x01u);
+    set_flag_indic_hazard((inputs >> 3) & 0x01u);
+    set_flag_indic_left((inputs >> 4) & 0x01u);
+    set_flag_indic_right((inputs >> 5) & 0x01u);
+    set_bit_flag_bgf_ack((bit_flag_t)(((inputs >> ACK_SHIFT) & 0x03u) << 3));
+}
+
+static uint32_t read_inputs(void)
+{
+    return (uint32_t)get_cmd_indic_hazard() | ((uint32_t)get_cmd_indic_left() << 1) |
+           ((uint32_t)get_cmd_indic_right() << 2) | ((uint32_t)get_flag_indic_hazard() << 3) |
+           ((uint32_t)get_flag_indic_left() << 4) | ((uint32_t)get_flag_indic_right() << 5) |
+           ((uint32_t)((get_bit_flag_bgf_ack() >> 3) & 0x03u) << ACK_SHIFT);
+}
+
+#else
+
+static void load_inputs(uint32_t inputs)
+{
+    set_cmd_wiper(inputs & 0x01u);
+    set_cmd_washer((inputs >> 1) & 0x01u);
+    set_flag_wiper((inputs >> 2) & 0x01u);
+    set_flag_washer((inputs >> 3) & 0x01u);
+    set_bit_flag_bgf_ack(0);
+}
+
+static uint32_t read_inputs(void)
+{
+    return (uint32_t)get_cmd_wiper() | ((uint32_t)get_cmd_washer() << 1) | ((uint32_t)get_flag_wiper() << 2) |
+           ((uint32_t)get_flag_washer() << 3);
+}
+
+#endif
+
+static uint32_t flags_of(uint32_t inputs)
+{
+    return (inputs >> FSM_CMDS) & ((1u << FSM_FLAGS) - 1u);
+}
+
+static uint32_t acks_of(uint32_t inputs)
+{
+    return inputs >> ACK_SHIFT;
+}
+
+static int state_value(uint32_t state_index)
+{
+    return (state_index == FSM_STATES - 1) ? 255 : (int)state_index;
+}
+
+/**
+ * \brief Timer value standing for a timer class.
+ * \param timer_class : Timer class
+ * \return uint8_t : Timer value, not 0 so that a reset is visible.
+ */
+static uint8_t timer_value(uint32_t timer_class)
+{
+    return (uint8_t)(FSM_TIMER_LIMIT - 2 + timer_class);
+}
+
+/**
+ * \brief Evaluate the FSM once from a given situation and encode the outcome.
+ * \return int : 0 on success, -1 when the outcome can not be encoded.
+ */
+static int evaluate(uint32_t state_index, uint32_t inputs, bool tick, uint32_t timer_class, uint16_t *entry)
+{
+    uint8_t timer_before = timer_value(timer_class);
+    uint32_t after = 0;
+    uint32_t timer_op = FSM_PRODUCT_TIMER_KEEP;
+    int ret = 0;
+
+    load_inputs(inputs);
+    state = (fsm_state_t)state_value(state_index);
+    timer_counter = timer_before;
+    captured = NO_TRANSITION;
+
+    ret = fsm_step(tick);
+    after = read_inputs();
+
+    if ((ret != 0) && (ret != -1))
+    {
+        fprintf(stderr, "%s: return code %d can not be encoded\n", FSM_NAME, ret);
+        return -1;
+    }
+    if ((acks_of(after) & ~acks_of(inputs)) != 0)
+    {
+        fprintf(stderr, "%s: acknowledgement bits set by the FSM\n", FSM_NAME);
+        return -1;
+    }
+    if ((after & ((1u << FSM_CMDS) - 1u)) != (inputs & ((1u << FSM_CMDS) - 1u)))
+    {
+        fprintf(stderr, "%s: commands written by the FSM\n", FSM_NAME);
+        return -1;
+    }
+
+    if (timer_counter == timer_before)
+    {
+        timer_op = FSM_PRODUCT_TIMER_KEEP;
+    }
+    else if (timer_counter == timer_before + 1)
+    {
+        timer_op = FSM_PRODUCT_TIMER_INCR;
+    }
+    else if (timer_counter == 0)
+    {
+        timer_op = FSM_PRODUCT_TIMER_RESET;
+    }
+    else
+    {
+        fprintf(stderr, "%s: timer %u -> %u can not be encoded\n", FSM_NAME, timer_before, timer_counter);
+        return -1;
+    }
+
+    if (captured == NO_TRANSITION)
+    {
+        if ((int)state != state_value(state_index))
+        {
+            fprintf(stderr, "%s: state changed without transition\n", FSM_NAME);
+            return -1;
+        }
+    }
+    else
+    {
+        if ((captured >= FSM_TRANSITIONS) || ((int)state != captured_to) ||
+            ((trans_next[captured] >= 0) &&
+             ((trans_next[captured] != captured_to) || (trans_event[captured] != captured_event))))
+        {
+            fprintf(stderr, "%s: transition %d is not stable\n", FSM_NAME, captured);
+            return -1;
+        }
+        trans_next[captured] = captured_to;
+        trans_event[captured] = captured_event;
+    }
+
+    *entry = FSM_PRODUCT_ENTRY((uint32_t)(captured + 1), flags_of(after), acks_of(inputs) & ~acks_of(after), timer_op,
+                               ret != 0);
+    return 0;
+}
+
+/**
+ * \brief Fill the table from every situation.
+ * \return int : 0 on success, -1 on error.
+ */
+static int fill_table(void)
+{
+    uint32_t state_index = 0;
+    uint32_t inputs = 0;
+    uint32_t tick = 0;
+    uint32_t timer_class = 0;
+    uint32_t index = 0;
+
+    for (state_index = 0; state_index < FSM_STATES; state_index++)
+    {
+        for (inputs = 0; inputs < (1u << FSM_INPUTS); inputs++)
+        {
+            for (tick = 0; tick < 2; tick++)
+            {
+                for (timer_class = 0; timer_class < FSM_PRODUCT_TIMER_CLASSES; timer_class++)
+                {
+                    index = fsm_product_index(inputs, FSM_INPUTS, tick != 0, timer_class, state_index);
+                    if (evaluate(state_index, inputs, tick != 0, timer_class, &table[index]) != 0)
+                    {
+                        return -1;
+                    }
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+/**
+ * \brief Run random input sequences through the table and the FSM.
+ * \return int : 0 when they agree, -1 otherwise.
+ */
+static int check_table(void)
+{
+    uint32_t step = 0;
+    uint32_t model_state = 0;
+    uint8_t model_timer = 0;
+    uint32_t inputs = 0;
+    uint32_t expected = 0;
+    uint32_t transition = 0;
+    uint16_t entry = 0;
+    bool tick = true;
+    int ret = 0;
+
+    srand(1);
+    state = (fsm_state_t)state_value(0);
+    timer_counter = 0;
+    load_inputs(0);
+
+    for (step = 0; step < RANDOM_STEPS; step++)
+    {
+        /* Commands change from time to time, acknowledgements come in */
+        inputs = read_inputs();
+        if ((rand() % 4) == 0)
+        {
+            inputs ^= 1u << (rand() % FSM_CMDS);
+        }
+#if FSM_ACKS > 0
+        if ((rand() % 3) == 0)
+        {
+            inputs |= 1u << (ACK_SHIFT + (rand() % FSM_ACKS));
+        }
+#endif
+        load_inputs(inputs);
+        tick = (rand() % 4) != 0;
+
+        entry = table[fsm_product_index(inputs, FSM_INPUTS, tick,
+                                        fsm_product_timer_class(model_timer, FSM_TIMER_LIMIT), model_state)];
+        transition = FSM_PRODUCT_TRANSITION(entry);
+        if (transition != 0)
+        {
+            model_state = fsm_product_state_index(trans_next[transition - 1], FSM_STATES);
+            checked |= 1u << (transition - 1);
+        }
+        model_timer = fsm_product_timer_next(entry, model_timer);
+        expected = (inputs & ((1u << FSM_CMDS) - 1u)) | (FSM_PRODUCT_FLAGS(entry) << FSM_CMDS) |
+                   ((acks_of(inputs) & ~FSM_PRODUCT_ACK_CLEAR(entry)) << ACK_SHIFT);
+
+        ret = fsm_step(tick);
+
+        if ((fsm_product_state_index(state, FSM_STATES) != model_state) || (timer_counter != model_timer) ||
+            (read_inputs() != expected) || (ret != (((entry & FSM_PRODUCT_ERROR) != 0) ? -1 : 0)))
+        {
+            fprintf(stderr, "%s: table and FSM disagree at step %u\n", FSM_NAME, step);
+            return -1;
+        }
+
+        /* Leave the final state now and then */
+        if ((model_state == FSM_STATES - 1) && ((rand() % 16) == 0))
+        {
+            state = (fsm_state_t)state_value(0);
+            timer_counter = 0;
+            model_state = 0;
+            model_timer = 0;
+        }
+    }
+    return 0;
+}
+
+static int write_table(const char *path)
+{
+    FILE *file = NULL;
+    uint32_t i = 0;
+
+    file = fopen(path, "w");
+    if (file == NULL)
+    {
+        perror(path);
+        return -1;
+    }
+
+    fprintf(file,
+            "/**\n"
+            " * \\file fsm_%s_product.c\n"
+            " * \\brief Precomputed table of the %s FSM.\n"
+            " * \\details Generated by generator/gen_fsm_product.c (make fsm_product), do not edit.\n"
+            " * \\author Raphael CAUSSE\n"
+            " */\n\n"
+            "/***** Includes **************************************************************/\n\n"
+            "#include \"fsm_product.h\"\n\n"
+            "/***** Variables *************************************************************/\n\n",
+            FSM_NAME, FSM_NAME);
+
+    fprintf(file, "const uint8_t fsm_product_%s_next[%u] = {", FSM_NAME, (unsigned)FSM_TRANSITIONS);
+    for (i = 0; i < FSM_TRANSITIONS; i++)
+    {
+        fprintf(file, "%s%d", (i == 0) ? "" : ", ", (trans_next[i] < 0) ? 0 : trans_next[i]);
+    }
+    fprintf(file, "};\n\nconst uint8_t fsm_product_%s_event[%u] = {", FSM_NAME, (unsigned)FSM_TRANSITIONS);
+    for (i = 0; i < FSM_TRANSITIONS; i++)
+    {
+        fprintf(file, "%s%d", (i == 0) ? "" : ", ", (trans_event[i] < 0) ? 0 : trans_event[i]);
+    }
+    fprintf(file, "};\n\nconst uint16_t fsm_product_%s[%u] = {", FSM_NAME, (unsigned)FSM_SIZE);
+    for (i = 0; i < FSM_SIZE; i++)
+    {
+        fprintf(file, "%s0x%04x%s", ((i % 12) == 0) ? "\n    " : " ", table[i], (i + 1 < FSM_SIZE) ? "," : "");
+    }
+    fprintf(file, "\n};\n");
+
+    return fclose(file);
+}
+
+/***** Functions *************************************************************/
+
+void capture_transition(fsm_trace_t *trace, uint32_t transition, int from, int to, int event)
+{
+    (void)trace;
+    (void)from;
+    captured = (int)transition;
+    captured_to = to;
+    captured_event = event;
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t i = 0;
+    uint32_t taken = 0;
+
+    if (argc != 2)
+    {
+        fprintf(stderr, "Usage: %s <output.c>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    log_set_level(LOG_LEVEL_NONE);
+    for (i = 0; i < FSM_TRANSITIONS; i++)
+    {
+        trans_next[i] = -1;
+        trans_event[i] = -1;
+    }
+
+    if ((fill_table() != 0) || (check_table() != 0) || (write_table(argv[1]) != 0))
+    {
+        return EXIT_FAILURE;
+    }
+
+    for (i = 0; i < FSM_TRANSITIONS; i++)
+    {
+        taken += (checked >> i) & 0x01u;
+    }
+    printf("%s: %u entries, %u random steps equivalent (%u/%u transitions), written to %s\n", FSM_NAME,
+           (unsigned)FSM_SIZE, RANDOM_STEPS, taken, (unsigned)FSM_TRANSITIONS, argv[1]);
+    return EXIT_SUCCESS;
+}
@@ -22,6 +22,36 @@ src_dir = '../app/lib/bcgv_api/src'
 os.makedirs(include_dir, exist_ok=True)
 os.makedirs(src_dir, exist_ok=True)
 
+# Context layout: boolean types are packed in one bitset each, bits in spreadsheet order unless given here
+bitset_positions = {
+    # COMODO frame layout, so that a whole frame is stored at once with set_cmds()
+    'cmd_indic_hazard': 7,
+    'cmd_position_light': 6,
+    'cmd_crossing_light': 5,
+    'cmd_highbeam_light': 4,
+    'cmd_indic_right': 3,
+    'cmd_indic_left': 2,
+    'cmd_wiper': 1,
+    'cmd_washer': 0,
+}
+
+# Context layout: fields only read for debug output, kept apart from the ones used every cycle
+cold_fields = ['frame_number', 'crc8']
+
+# Out-of-range policy of the setters of ranged types, 'reject' unless given here:
+# - 'reject': keep the previous value
+# - 'clamp': store the nearest bound
+# - 'wrap': fold the value into the range
+# Setters are branch-free and count every out-of-range value, whatever the policy
+range_policies = {
+    'frame_number': 'reject',
+    'fuel_level': 'reject',
+    'engine_rpm': 'reject',
+}
+
+# Size in bytes of C base types, to order the context fields without padding
+base_type_sizes = {'bool': 1, 'uint8_t': 1, 'int8_t': 1, 'uint16_t': 2, 'int16_t': 2, 'uint32_t': 4, 'int32_t': 4}
+
 # A function that generates global variables
 def create_global_variables(domaine, nom):
     match = re.search(r'\[(\d+); (\d+)\]', str(domaine))
@@ -34,6 +64,80 @@ def create_global_variables(domaine, nom):
             return f"#define {var_name}_MIN ({min_val})\n#define {var_name}_MAX ({max_val})\n\n"
     return ""
 
+# A function that returns the boolean types of the TYPES table
+def bool_types(types_df):
+    return [row['Nom'] for _, row in types_df.iterrows() if row['Genre'].lower() == 'atom' and row['Declaration'] == 'bool']
+
+# A function that returns the bitsets of the context: {type: (field, bulk type, [(data, bit name, position)])}
+def context_bitsets(types_df, donnees_df):
+    bitsets = {}
+    for type_name in bool_types(types_df):
+        prefix = type_name.replace("_t", "")
+        members = [row['Nom'] for _, row in donnees_df.iterrows() if row['Type'] == type_name]
+        if not members:
+            continue
+        bits = []
+        free = [position for position in range(32) if position not in [bitset_positions.get(m) for m in members]]
+        for member in members:
+            position = bitset_positions[member] if member in bitset_positions else free.pop(0)
+            bits.append((member, f"{prefix.upper()}_BIT_{member[len(prefix) + 1:].upper()}", position))
+        width = max(position for _, _, position in bits) + 1
+        bulk_type = 'uint8_t' if width <= 8 else 'uint16_t' if width <= 16 else 'uint32_t'
+        bitsets[type_name] = (f"{prefix}s", bulk_type, bits)
+    return bitsets
+
+# A function that returns the size of a type of the TYPES table
+def type_size(types_df, type_name):
+    for _, row in types_df.iterrows():
+        if row['Nom'] == type_name:
+            return base_type_sizes.get(row['Declaration'], 4) if row['Genre'].lower() == 'atom' else 4
+    return base_type_sizes.get(type_name, 4)
+
+# A function that returns the ranged data of the context: [(data, type, domain prefix, has minimum, policy)]
+def ranged_fields(donnees_df, domain_values):
+    fields = []
+    for _, row in donnees_df.iterrows():
+        name, type_def = row['Nom'], row['Type']
+        var_name = name.upper().replace("_T", "")
+        if f"#define {var_name}_MAX" in domain_values:
+            policy = range_policies.get(name, 'reject')
+            if policy not in ('reject', 'clamp', 'wrap'):
+                raise ValueError(f"unknown range policy {policy} for {name}")
+            fields.append((name, type_def, var_name, f"#define {var_name}_MIN" in domain_values, policy))
+    return fields
+
+# A function that generates the branch-free body of the setter of a ranged data
+def generate_ranged_setter_body(name, type_def, var_name, has_min, policy):
+    counter = f"bcgv_range_violations[RANGE_FIELD_{var_name}]"
+    low = f"({type_def})(value < {var_name}_MIN)" if has_min else None
+    high = f"({type_def})(value > {var_name}_MAX)"
+    body = ""
+    if low:
+        body += f"    const {type_def} low = {low};\n"
+    body += f"    const {type_def} high = {high};\n"
+    out = "(low | high)" if low else "high"
+    body += f"    {counter} += {out};\n"
+    if policy == 'reject':
+        # all ones when out of range
+        body += f"    const {type_def} keep = ({type_def})-{out};\n"
+        body += f"    bcgv_context.{name} = ({type_def})((value & ~keep) | (bcgv_context.{name} & keep));\n"
+    elif policy == 'clamp':
+        body += f"    {type_def} result = value;\n"
+        if low:
+            body += f"    result = ({type_def})(result ^ ((result ^ {var_name}_MIN) & ({type_def})-low));\n"
+        body += f"    result = ({type_def})(result ^ ((result ^ {var_name}_MAX) & ({type_def})-high));\n"
+        body += f"    bcgv_context.{name} = result;\n"
+    else:
+        if low:
+            # signed offset from the minimum, remainder brought back to [0, span)
+            body += f"    const int64_t span = (int64_t){var_name}_MAX - {var_name}_MIN + 1;\n"
+            body += f"    int64_t offset = ((int64_t)value - {var_name}_MIN) % span;\n"
+            body += "    offset += span & -(int64_t)(offset < 0);\n"
+            body += f"    bcgv_context.{name} = ({type_def})({var_name}_MIN + offset);\n"
+        else:
+            body += f"    bcgv_context.{name} = ({type_def})(value % ((uint64_t){var_name}_MAX + 1));\n"
+    return body
+
 # [bcgv_api.h] - A function that generates bcgv_api.h
 def generate_bcgv_api_h(types_df, donnees_df):
     header = """/**
@@ -63,12 +167,71 @@ def generate_bcgv_api_h(types_df, donnees_df):
             enum_values = ',\n    '.join(map(str.strip, declaration.split(',')))
             bcgv_api_h += f"typedef enum {{\n    {enum_values},\n}} {nom};\n"
     
+    bitsets = context_bitsets(types_df, donnees_df)
+    for type_name, (field, bulk_type, bits) in bitsets.items():
+        bcgv_api_h += f"\n// {type_name} bits in get_{field}() and set_{field}()\ntypedef enum {{\n"
+        for _, bit_name, position in bits:
+            bcgv_api_h += f"    {bit_name} = (1 << {position}),\n"
+        bcgv_api_h += f"}} {type_name.replace('_t', '')}_bit_t;\n"
+
+    ranged = ranged_fields(donnees_df, domain_values)
+    bcgv_api_h += "\n// Ranged data, out-of-range values counted by get_range_violations()\ntypedef enum {\n"
+    for index, (name, _, var_name, _, _) in enumerate(ranged):
+        bcgv_api_h += f"    RANGE_FIELD_{var_name}{' = 0' if index == 0 else ''},\n"
+    bcgv_api_h += "    RANGE_FIELD_COUNT,\n} range_field_t;\n"
+
     bcgv_api_h += """\n/**
  * \\brief Initialize context.
  * \\brief Initialize context variables for the api.
  */
 void bcgv_ctx_init();
+
+/**
+ * \\brief Gets the number of out-of-range values given to the setter of a ranged data.
+ * \\param field : The ranged data.
+ * \\return uint32_t : The number of out-of-range values since start or last reset, 0 for an unknown field.
+ */
+uint32_t get_range_violations(range_field_t field);
+
+/**
+ * \\brief Gets the name of a ranged data.
+ * \\param field : The ranged data.
+ * \\return const char * : The data name, "unknown" for an unknown field.
+ */
+const char *get_range_field_name(range_field_t field);
+
+/**
+ * \\brief Resets the out-of-range counters of all ranged data.
+ */
+void reset_range_violations();
+"""
+    bcgv_api_h += """
+#ifdef BCGV_API_INLINE
+// Header-only accessors, the context itself stays in the library
+#include "bcgv_api_inline.h"
+#else
 """
+    for type_name, (field, bulk_type, bits) in bitsets.items():
+        bcgv_api_h += f"""\n/**
+ * \\brief Gets all {type_name} values at once.
+ * \\details One bit per value, see {type_name.replace('_t', '')}_bit_t.
+ * \\return {bulk_type} : The {field} bits.
+ */
+{bulk_type} get_{field}();
+
+/**
+ * \\brief Sets all {type_name} values at once.
+ * \\details One bit per value, see {type_name.replace('_t', '')}_bit_t.
+ * \\param value : The new {field} bits.
+ */
+void set_{field}({bulk_type} value);
+"""
+    range_details = {
+        'reject': "Sets the {0} to the given value, an out-of-range value is counted and ignored.",
+        'clamp': "Sets the {0} to the given value, an out-of-range value is counted and saturated to the range.",
+        'wrap': "Sets the {0} to the given value, an out-of-range value is counted and wrapped into the range.",
+    }
+    range_details = {name: range_details[policy].format(name) for name, _, _, _, policy in ranged}
     for _, row in donnees_df.iterrows():
         type_name, type_def = row['Nom'], row['Type']
         bcgv_api_h += f"""\n/**
@@ -80,18 +243,91 @@ void bcgv_ctx_init();
 
 /**
  * \\brief Sets the {type_name.lower()} value.
- * \\details Sets the {type_name.lower()} to the given value.
+ * \\details {range_details.get(type_name, f"Sets the {type_name.lower()} to the given value.")}
  * \\param value : The new value for the {type_name.lower()}.
  */
 void set_{type_name.lower()}({type_def} value);
 """
-    bcgv_api_h += "\n#endif // BCGV_API_H"
+    bcgv_api_h += "\n#endif // BCGV_API_INLINE\n\n#endif // BCGV_API_H"
     
     with open(os.path.join(include_dir, 'bcgv_api.h'), 'w') as file:
         file.write(bcgv_api_h)
 
+# A function that generates the context structure, shared by bcgv_api.c and bcgv_api_inline.h
+def generate_context_struct(types_df, donnees_df):
+    bitsets = context_bitsets(types_df, donnees_df)
+
+    # Fields used every cycle first, 32-bit ones then bitsets then bytes to avoid padding, then fields only used
+    # for debug output
+    fields = [(row['Nom'], row['Type'], row['Commentaire']) for _, row in donnees_df.iterrows() if row['Type'] not in bitsets]
+    hot_wide = [f for f in fields if f[0] not in cold_fields and type_size(types_df, f[1]) > 1]
+    hot_narrow = [f for f in fields if f[0] not in cold_fields and type_size(types_df, f[1]) == 1]
+    cold = [f for f in fields if f[0] in cold_fields]
+    hot_wide.sort(key=lambda f: -type_size(types_df, f[1]))
+    context_struct = "// Context structure\ntypedef struct {\n    // Used every cycle\n"
+    for name, type_def, comment in hot_wide:
+        context_struct += f"    {type_def} {name}; // {comment}\n"
+    for type_name, (field, bulk_type, bits) in bitsets.items():
+        context_struct += f"    {bulk_type} {field}; // {type_name} values, one bit each\n"
+    for name, type_def, comment in hot_narrow:
+        context_struct += f"    {type_def} {name}; // {comment}\n"
+    context_struct += "    // Only used for debug output\n"
+    for name, type_def, comment in cold:
+        context_struct += f"    {type_def} {name}; // {comment}\n"
+    return context_struct + "} bcgv_context_t;\n"
+
+# A function that generates the getters and setters, out-of-line (qualifier "") or inline (qualifier "static inline ")
+def generate_accessors(types_df, donnees_df, domain_values, qualifier):
+    bitsets = context_bitsets(types_df, donnees_df)
+    bit_of = {member: (field, bit_name) for field, _, bits in bitsets.values() for member, bit_name, _ in bits}
+    ranged = {field[0]: field for field in ranged_fields(donnees_df, domain_values)}
+    accessors = ""
+
+    # bulk getters and setters
+    for type_name, (field, bulk_type, bits) in bitsets.items():
+        accessors += f"""
+{qualifier}{bulk_type} get_{field}() {{
+    return bcgv_context.{field};
+}}
+
+{qualifier}void set_{field}({bulk_type} value) {{
+    bcgv_context.{field} = value;
+}}
+"""
+
+    # getters et setters
+    for _, row in donnees_df.iterrows():
+        type_name, type_def = row['Nom'], row['Type']
+        var_name = type_name.upper().replace("_T", "")
+        if type_name in bit_of:
+            field, bit_name = bit_of[type_name]
+            bulk_type = bitsets[type_def][1]
+            accessors += f"""
+{qualifier}{type_def} get_{type_name.lower()}() {{
+    return (bcgv_context.{field} & {bit_name}) != 0;
+}}
+
+{qualifier}void set_{type_name.lower()}({type_def} value) {{
+    bcgv_context.{field} = ({bulk_type})((bcgv_context.{field} & ~{bit_name}) | (value ? {bit_name} : 0));
+}}
+"""
+            continue
+        accessors += f"""
+{qualifier}{type_def} get_{type_name.lower()}() {{
+    return bcgv_context.{type_name.lower()};
+}}
+
+{qualifier}void set_{type_name.lower()}({type_def} value) {{
+"""
+        if type_name in ranged:
+            accessors += generate_ranged_setter_body(*ranged[type_name])
+        else:
+            accessors += f"    bcgv_context.{type_name.lower()} = value;\n"
+        accessors += "}\n"
+    return accessors
+
 # [bcgv_api.c] - A function that generates bcgv_api.c
-def generate_bcgv_api_c(donnees_df, domain_values):
+def generate_bcgv_api_c(types_df, donnees_df, domain_values):
     bcgv_api_c = """/**
  * \\file bcgv_api.c
  * \\brief Context initialization and definitions for project
@@ -99,49 +335,74 @@ def generate_bcgv_api_c(donnees_df, domain_values):
  * \\author Raphael CAUSSE - Melvyn MUNOZ - Roland Cedric TAYO
  */
 
+// The out-of-line accessors are defined here, whatever the accessor mode of the rest of the build
+#undef BCGV_API_INLINE
 #include "bcgv_api.h"
 
-// Context structure
-typedef struct {
 """
-    for _, row in donnees_df.iterrows():
-        bcgv_api_c += f"    {row['Type']} {row['Nom']}; // {row['Commentaire']}\n"
-    
-    bcgv_api_c += """} context_t;
+    bitsets = context_bitsets(types_df, donnees_df)
+    bit_of = {member: (field, bit_name) for field, _, bits in bitsets.values() for member, bit_name, _ in bits}
+    bcgv_api_c += generate_context_struct(types_df, donnees_df)
+    bcgv_api_c += """
+// Global context structure instance, also accessed by the inline accessors of bcgv_api_inline.h
+bcgv_context_t bcgv_context;
 
-// Global context structure instance
-static context_t context;
+// Out-of-range values given to the setters of ranged data
+uint32_t bcgv_range_violations[RANGE_FIELD_COUNT];
 
 void bcgv_ctx_init() {
 """
+    for type_name, (field, bulk_type, bits) in bitsets.items():
+        set_bits = [bit_name for member, bit_name, _ in bits
+                    if str(donnees_df.loc[donnees_df['Nom'] == member, "Valeur d'init"].iloc[0]) not in ('0', 'false')]
+        bcgv_api_c += f"    bcgv_context.{field} = {' | '.join(set_bits) if set_bits else '0'};\n"
     for _, row in donnees_df.iterrows():
-        bcgv_api_c += f"    context.{row['Nom']} = {row['Valeur d\'init']};\n"
+        if row['Nom'] in bit_of:
+            continue
+        init_value = row["Valeur d'init"]
+        bcgv_api_c += f"    bcgv_context.{row['Nom']} = {init_value};\n"
     bcgv_api_c += "}\n\n"
-    
-    # getters et setters
-    for _, row in donnees_df.iterrows():
-        type_name, type_def = row['Nom'], row['Type']
-        var_name = type_name.upper().replace("_T", "")
-        bcgv_api_c += f"""
-{type_def} get_{type_name.lower()}() {{
-    return context.{type_name.lower()};
-}}
 
-void set_{type_name.lower()}({type_def} value) {{
-"""
-        if f"#define {var_name}_MIN" in domain_values and f"#define {var_name}_MAX" in domain_values:
-            bcgv_api_c += f"    if (value >= {var_name}_MIN && value <= {var_name}_MAX) {{\n"
-            bcgv_api_c += f"        context.{type_name.lower()} = value;\n    }}\n"
-        elif f"#define {var_name}_MAX" in domain_values:
-            bcgv_api_c += f"    if (value <= {var_name}_MAX) {{\n"
-            bcgv_api_c += f"        context.{type_name.lower()} = value;\n    }}\n"
-        else:
-            bcgv_api_c += f"    context.{type_name.lower()} = value;\n"
-        bcgv_api_c += "}\n"
+    # out-of-range counters
+    ranged = ranged_fields(donnees_df, domain_values)
+    bcgv_api_c += "uint32_t get_range_violations(range_field_t field) {\n"
+    bcgv_api_c += "    return (field < RANGE_FIELD_COUNT) ? bcgv_range_violations[field] : 0;\n}\n\n"
+    bcgv_api_c += "const char *get_range_field_name(range_field_t field) {\n    static const char *const names[RANGE_FIELD_COUNT] = {\n"
+    for name, _, _, _, _ in ranged:
+        bcgv_api_c += f'        "{name}",\n'
+    bcgv_api_c += '    };\n    return (field < RANGE_FIELD_COUNT) ? names[field] : "unknown";\n}\n\n'
+    bcgv_api_c += "void reset_range_violations() {\n"
+    bcgv_api_c += "    for (int field = 0; field < RANGE_FIELD_COUNT; field++) {\n"
+    bcgv_api_c += "        bcgv_range_violations[field] = 0;\n    }\n}\n\n"
+    bcgv_api_c += generate_accessors(types_df, donnees_df, domain_values, "")
 
     with open(os.path.join(src_dir, 'bcgv_api.c'), 'w') as file:
         file.write(bcgv_api_c)
 
+# [bcgv_api_inline.h] - A function that generates bcgv_api_inline.h
+def generate_bcgv_api_inline_h(types_df, donnees_df, domain_values):
+    bcgv_api_inline_h = """/**
+ * \\file bcgv_api_inline.h
+ * \\brief Header-only context accessors for project
+ * \\details Included by bcgv_api.h when BCGV_API_INLINE is defined: the getters and setters of bcgv_api.c, with the
+ *          same range checks, as static inline functions on the context of the library.
+ * \\author Raphael CAUSSE - Melvyn MUNOZ - Roland Cedric TAYO
+ */
+
+#ifndef BCGV_API_INLINE_H
+#define BCGV_API_INLINE_H
+
+"""
+    bcgv_api_inline_h += generate_context_struct(types_df, donnees_df)
+    bcgv_api_inline_h += "\n// Global context structure instance, defined in bcgv_api.c\nextern bcgv_context_t bcgv_context;\n"
+    bcgv_api_inline_h += "\n// Out-of-range values given to the setters of ranged data, defined in bcgv_api.c\n"
+    bcgv_api_inline_h += "extern uint32_t bcgv_range_violations[RANGE_FIELD_COUNT];\n"
+    bcgv_api_inline_h += generate_accessors(types_df, donnees_df, domain_values, "static inline ")
+    bcgv_api_inline_h += "\n#endif // BCGV_API_INLINE_H\n"
+
+    with open(os.path.join(include_dir, 'bcgv_api_inline.h'), 'w') as file:
+        file.write(bcgv_api_inline_h)
+
 # Read the excel file
 file_path = 'app_types_data.xlsx'
 df = pd.read_excel(file_path, sheet_name=0)
@@ -158,7 +419,9 @@ donnees_df.columns = df.iloc[donnees_start+1]
 
 # Generate files
 generate_bcgv_api_h(types_df, donnees_df)
-generate_bcgv_api_c(donnees_df, domain_values)
+generate_bcgv_api_c(types_df, donnees_df, domain_values)
+generate_bcgv_api_inline_h(types_df, donnees_df, domain_values)
 
 print(f"bcgv_api.h generated in {include_dir}.")
 print(f"bcgv_api.c generated in {src_dir}.")
+print(f"bcgv_api_inline.h generated in {include_dir}.")
@@ -0,0 +1,268 @@
+/**
+ * \file debug_trace_dump.c
+ * \brief Pretty-print the debug trace ring of a debug build.
+ * \details Reads a ring file (see debug_trace.h), possibly while the application is still writing it, and
+ *          prints its records from the oldest to the newest, as the former DEBUG dumps of MUX and COMODO did.
+ * \author Raphael CAUSSE
+ */
+
+/***** Includes **************************************************************/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "bcgv_api.h"
+#include "debug_trace.h"
+
+/***** Definitions ***********************************************************/
+
+#define DUMP_NS_PER_S (1000000000ULL)
+
+/***** Static Variables ******************************************************/
+
+static const char *const dump_type_names[DEBUG_TRACE_TYPE_COUNT] = {
+    "NONE",
+    "MUX READ",
+    "MUX DECODE",
+    "MUX ENCODE",
+    "COMODO READ",
+    "COMODO DECODE",
+};
+
+/* Static ring, too large for the stack */
+static debug_trace_ring_t dump_ring;
+
+/***** Static Functions ******************************************************/
+
+/**
+ * \brief Print raw bytes of a frame.
+ * \param prefix : Frame origin
+ * \param record : Record
+ */
+static void dump_raw(const char *prefix, const debug_trace_record_t *record)
+{
+    printf("%s [ ", prefix);
+    for (uint32_t i = 0; i < record->size; i++)
+    {
+        printf("%02X ", record->payload[i]);
+    }
+    printf("]\n");
+}
+
+/**
+ * \brief Print names of set bits, or "None".
+ * \param label : Field label
+ * \param bits : Bits
+ * \param names : Name of each bit, from bit 0
+ * \param count : Number of names
+ */
+static void dump_bits(const char *label, uint8_t bits, const char *const *names, uint32_t count)
+{
+    printf("%s: ", label);
+    if (bits == 0)
+    {
+        printf("None");
+    }
+    for (uint32_t i = 0; i < count; i++)
+    {
+        if ((bits & (1u << i)) != 0)
+        {
+            printf("%s ", names[i]);
+        }
+    }
+    printf("\n");
+}
+
+/**
+ * \brief Print a decoded MUX 100ms frame.
+ * \param record : Record
+ */
+static void dump_mux_decoded(const debug_trace_record_t *record)
+{
+    static const char *const chassis_names[] = {"Tyres", "Brakes"};
+    static const char *const motor_names[] = {"Pression", "Temperature LDR", "Oil Overheating"};
+    static const char *const battery_names[] = {"Discharged", "KO"};
+    debug_trace_mux_decoded_t decoded;
+
+    if (record->size < sizeof(decoded))
+    {
+        printf("truncated record\n");
+        return;
+    }
+    memcpy(&decoded, record->payload, sizeof(decoded));
+
+    printf("Frame number: %u\n", decoded.frame_number);
+    printf("Distance: %u km\n", decoded.distance);
+    printf("Speed: %u km/h\n", decoded.speed);
+    dump_bits("Chassis issues", decoded.chassis_issues, chassis_names, 2);
+    dump_bits("Motor issues", decoded.motor_issues, motor_names, 3);
+    printf("Fuel level: %u\n", decoded.fuel_level);
+    printf("Engine RPM: %u\n", decoded.engine_rpm);
+    dump_bits("Battery issues", decoded.battery_issues, battery_names, 2);
+    printf("CRC8: %02X\n", decoded.crc8);
+}
+
+/**
+ * \brief Print decoded COMODO commands.
+ * \param record : Record
+ */
+static void dump_comodo_decoded(const debug_trace_record_t *record)
+{
+    uint8_t cmds = (record->size > 0) ? record->payload[0] : 0;
+
+    printf("Indic hazard: %u\n", (cmds & CMD_BIT_INDIC_HAZARD) ? 1u : 0u);
+    printf("Position light: %u\n", (cmds & CMD_BIT_POSITION_LIGHT) ? 1u : 0u);
+    printf("Crossing light: %u\n", (cmds & CMD_BIT_CROSSING_LIGHT) ? 1u : 0u);
+    printf("Highbeam light: %u\n", (cmds & CMD_BIT_HIGHBEAM_LIGHT) ? 1u : 0u);
+    printf("Indic right: %u\n", (cmds & CMD_BIT_INDIC_RIGHT) ? 1u : 0u);
+    printf("Indic left: %u\n", (cmds & CMD_BIT_INDIC_LEFT) ? 1u : 0u);
+    printf("Wiper: %u\n", (cmds & CMD_BIT_WIPER) ? 1u : 0u);
+    printf("Washer: %u\n", (cmds & CMD_BIT_WASHER) ? 1u : 0u);
+}
+
+/**
+ * \brief Print one record.
+ * \param record : Record
+ * \param start_time : Monotonic time the ring was reset (ns)
+ * \param raw : Print raw payloads only, one line per record
+ */
+static void dump_record(const debug_trace_record_t *record, uint64_t start_time, bool raw)
+{
+    uint64_t elapsed = (record->time > start_time) ? record->time - start_time : 0;
+    const char *name = (record->type < DEBUG_TRACE_TYPE_COUNT) ? dump_type_names[record->type] : "UNKNOWN";
+
+    printf("[cycle %u +%llu.%06llus] ", record->cycle, (unsigned long long)(elapsed / DUMP_NS_PER_S),
+           (unsigned long long)(elapsed % DUMP_NS_PER_S / 1000));
+    if (raw == true)
+    {
+        dump_raw(name, record);
+        return;
+    }
+
+    printf("%s\n", name);
+    switch (record->type)
+    {
+    case DEBUG_TRACE_MUX_READ:
+    case DEBUG_TRACE_MUX_ENCODE:
+        dump_raw("MUX", record);
+        break;
+    case DEBUG_TRACE_MUX_DECODE:
+        dump_mux_decoded(record);
+        break;
+    case DEBUG_TRACE_COMODO_READ:
+        dump_raw("COMODO", record);
+        break;
+    case DEBUG_TRACE_COMODO_DECODE:
+        dump_comodo_decoded(record);
+        break;
+    default:
+        dump_raw("DATA", record);
+        break;
+    }
+}
+
+/**
+ * \brief Print usage.
+ * \param name : Program name
+ */
+static void print_usage(const char *name)
+{
+    printf("Usage: %s [-n cycles] [-r] [-h] [file]\n", name);
+    printf("  -n : Print only the last cycles\n");
+    printf("  -r : Print raw payloads, one line per record\n");
+    printf("  -h : Print this help\n");
+    printf("File defaults to %s, as written by a debug build of app\n", DEBUG_TRACE_DEFAULT_PATH);
+}
+
+/***** Main function *********************************************************/
+
+int main(int argc, char *argv[])
+{
+    const char *path = DEBUG_TRACE_DEFAULT_PATH;
+    const debug_trace_header_t *header = &dump_ring.header;
+    const debug_trace_record_t *record = NULL;
+    FILE *file = NULL;
+    uint64_t first = 0;
+    uint64_t skipped = 0;
+    uint32_t cycles = 0;
+    bool raw = false;
+    int opt = 0;
+
+    /***** Parsing options *****/
+
+    while ((opt = getopt(argc, argv, "n:rh")) != -1)
+    {
+        switch (opt)
+        {
+        case 'n':
+            cycles = (uint32_t)atoi(optarg);
+            break;
+        case 'r':
+            raw = true;
+            break;
+        case 'h':
+            print_usage(argv[0]);
+            return EXIT_SUCCESS;
+        default:
+            print_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (optind < argc)
+    {
+        path = argv[optind];
+    }
+
+    /***** Reading ring *****/
+
+    file = fopen(path, "rb");
+    if (file == NULL)
+    {
+        perror(path);
+        return EXIT_FAILURE;
+    }
+    if (fread(&dump_ring, sizeof(dump_ring), 1, file) != 1)
+    {
+        fprintf(stderr, "%s: truncated debug trace\n", path);
+        fclose(file);
+        return EXIT_FAILURE;
+    }
+    fclose(file);
+
+    if ((memcmp(header->magic, DEBUG_TRACE_MAGIC, sizeof(header->magic)) != 0) ||
+        (header->version != DEBUG_TRACE_VERSION) || (header->record_size != sizeof(debug_trace_record_t)) ||
+        (header->records != DEBUG_TRACE_RECORDS))
+    {
+        fprintf(stderr, "%s: not a debug trace of this version\n", path);
+        return EXIT_FAILURE;
+    }
+
+    /***** Printing records, oldest first *****/
+
+    first = (header->head > DEBUG_TRACE_RECORDS) ? header->head - DEBUG_TRACE_RECORDS : 0;
+    for (uint64_t number = first; number < header->head; number++)
+    {
+        record = &dump_ring.records[number % DEBUG_TRACE_RECORDS];
+
+        /* Being written or overwritten while the file was read */
+        if (record->seq != (uint32_t)(number + 1))
+        {
+            skipped++;
+            continue;
+        }
+        if ((cycles > 0) && (record->cycle + cycles <= header->cycle))
+        {
+            continue;
+        }
+        dump_record(record, header->start_time, raw);
+    }
+
+    fprintf(stderr, "%llu records, %u cycles, %llu overwritten, %llu skipped\n",
+            (unsigned long long)header->head, header->cycle, (unsigned long long)first,
+            (unsigned long long)skipped);
+
+    return EXIT_SUCCESS;
+}
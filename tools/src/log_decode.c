@@ -0,0 +1,503 @@
+/**
+ * \file log_decode.c
+ * \brief Render or filter a binary log file offline.
+ * \details Reads a file written by the application with -L (see log_binary.h), rebuilds its table of call
+ *          sites from their definition records and prints messages as the text logger would have, or the
+ *          table of call sites with their message counts.
+ * \author Raphael CAUSSE
+ */
+
+/***** Includes **************************************************************/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "log_binary.h"
+
+/***** Definitions ***********************************************************/
+
+#define DECODE_LEVELS (3)
+#define DECODE_MESSAGE_SIZE (1024)
+#define DECODE_SPEC_SIZE (32)
+#define DECODE_NS_PER_S (1000000000ULL)
+#define DECODE_NS_PER_MS (1000000ULL)
+
+/* Call site, as defined in the file */
+typedef struct
+{
+    bool defined;
+    log_binary_site_t def;
+    const char *file;
+    const char *func;
+    const char *fmt;
+    uint64_t messages;   /* Message records */
+    uint64_t repeated;   /* Repetitions not written */
+    uint64_t suppressed; /* Messages dropped by rate limiting */
+} decode_site_t;
+
+/* Options */
+typedef struct
+{
+    uint8_t level;       /* Minimum level */
+    const char *where;   /* Substring of the file or function, NULL for all */
+    const char *match;   /* Substring of the message, NULL for all */
+    bool sites;          /* Print the call site table instead of messages */
+} decode_options_t;
+
+/***** Static Variables ******************************************************/
+
+static const char *const decode_level_names[DECODE_LEVELS] = {"INFO", "WARN", "ERR"};
+
+static decode_site_t *decode_sites = NULL;
+static uint32_t decode_site_count = 0;
+
+/***** Static Functions ******************************************************/
+
+/**
+ * \brief Get a call site, growing the table.
+ * \param id : Call site id
+ * \return decode_site_t * : Call site, NULL if out of memory
+ */
+static decode_site_t *decode_site(uint32_t id)
+{
+    decode_site_t *sites = NULL;
+    uint32_t count = decode_site_count;
+
+    if (id >= count)
+    {
+        while (id >= count)
+        {
+            count = (count == 0) ? 64 : count * 2;
+        }
+        sites = realloc(decode_sites, count * sizeof(decode_site_t));
+        if (sites == NULL)
+        {
+            return NULL;
+        }
+        memset(&sites[decode_site_count], 0, (count - decode_site_count) * sizeof(decode_site_t));
+        decode_sites = sites;
+        decode_site_count = count;
+    }
+
+    return &decode_sites[id];
+}
+
+/**
+ * \brief Read a string argument.
+ * \param words : Payload words, from the length word
+ * \param count : Payload words left
+ * \param string : Output string, DECODE_MESSAGE_SIZE
+ * \return uint32_t : Words used, 0 if truncated
+ */
+static uint32_t decode_string(const uint64_t *words, uint32_t count, char *string)
+{
+    uint64_t length = (count > 0) ? words[0] : 0;
+    uint64_t used = 1 + ((length + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+
+    if ((count == 0) || (used > count) || (length >= DECODE_MESSAGE_SIZE))
+    {
+        return 0;
+    }
+    memcpy(string, &words[1], length);
+    string[length] = '\0';
+
+    return (uint32_t)used;
+}
+
+/**
+ * \brief Format one argument with its conversion.
+ * \param spec : Conversion, NUL-terminated
+ * \param kind : Argument kind
+ * \param word : Argument word
+ * \param output : Output
+ * \param size : Output size
+ * \return int : Characters written, as snprintf
+ */
+static int decode_argument(const char *spec, log_arg_t kind, uint64_t word, char *output, size_t size)
+{
+    double value = 0;
+
+    switch (kind)
+    {
+    case LOG_ARG_INT:
+        return snprintf(output, size, spec, (int)(int64_t)word);
+    case LOG_ARG_UINT:
+        return snprintf(output, size, spec, (unsigned int)word);
+    case LOG_ARG_LONG:
+        return snprintf(output, size, spec, (long)(int64_t)word);
+    case LOG_ARG_ULONG:
+        return snprintf(output, size, spec, (unsigned long)word);
+    case LOG_ARG_LLONG:
+        return snprintf(output, size, spec, (long long)(int64_t)word);
+    case LOG_ARG_ULLONG:
+        return snprintf(output, size, spec, (unsigned long long)word);
+    case LOG_ARG_SIZE:
+        return snprintf(output, size, spec, (size_t)word);
+    case LOG_ARG_INTMAX:
+        return snprintf(output, size, spec, (intmax_t)(int64_t)word);
+    case LOG_ARG_UINTMAX:
+        return snprintf(output, size, spec, (uintmax_t)word);
+    case LOG_ARG_PTRDIFF:
+        return snprintf(output, size, spec, (ptrdiff_t)(int64_t)word);
+    case LOG_ARG_DOUBLE:
+        memcpy(&value, &word, sizeof(value));
+        return snprintf(output, size, spec, value);
+    case LOG_ARG_POINTER:
+        return snprintf(output, size, spec, (void *)(uintptr_t)word);
+    default:
+        return snprintf(output, size, "%%");
+    }
+}
+
+/**
+ * \brief Render a message record.
+ * \param site : Call site
+ * \param words : Payload words
+ * \param count : Number of payload words
+ * \param message : Output message, DECODE_MESSAGE_SIZE
+ * \return bool : true on success, false if the payload does not match the format
+ */
+static bool decode_message(const decode_site_t *site, const uint64_t *words, uint32_t count, char *message)
+{
+    log_binary_conversion_t conversion;
+    char spec[DECODE_SPEC_SIZE];
+    char string[DECODE_MESSAGE_SIZE];
+    const char *fmt = site->fmt;
+    size_t length = 0;
+    size_t literal = 0;
+    uint32_t used = 0;
+    int written = 0;
+
+    /* Formatted by the application */
+    if (site->def.text != 0)
+    {
+        return decode_string(words, count, message) > 0;
+    }
+
+    message[0] = '\0';
+    while (log_binary_next_conversion(fmt, &conversion) == 1)
+    {
+        literal = (size_t)(conversion.start - fmt);
+        if ((literal >= DECODE_MESSAGE_SIZE - length) || (conversion.length >= sizeof(spec)))
+        {
+            return false;
+        }
+        memcpy(&message[length], fmt, literal);
+        length += literal;
+        memcpy(spec, conversion.start, conversion.length);
+        spec[conversion.length] = '\0';
+        fmt = conversion.start + conversion.length;
+
+        if (conversion.kind == LOG_ARG_NONE)
+        {
+            written = snprintf(&message[length], DECODE_MESSAGE_SIZE - length, "%%");
+        }
+        else if (conversion.kind == LOG_ARG_STRING)
+        {
+            used = decode_string(&words[0], count, string);
+            if (used == 0)
+            {
+                return false;
+            }
+            written = snprintf(&message[length], DECODE_MESSAGE_SIZE - length, spec, string);
+            words += used;
+            count -= used;
+        }
+        else
+        {
+            if (count == 0)
+            {
+                return false;
+            }
+            written = decode_argument(spec, conversion.kind, words[0], &message[length],
+                                      DECODE_MESSAGE_SIZE - length);
+            words++;
+            count--;
+        }
+        if (written < 0)
+        {
+            return false;
+        }
+        length += (size_t)written;
+        if (length >= DECODE_MESSAGE_SIZE)
+        {
+            message[DECODE_MESSAGE_SIZE - 1] = '\0';
+            return true;
+        }
+    }
+    snprintf(&message[length], DECODE_MESSAGE_SIZE - length, "%s", fmt);
+
+    return true;
+}
+
+/**
+ * \brief Print a line as the text logger does.
+ * \param header : File header
+ * \param time : Record monotonic time (ns)
+ * \param site : Call site
+ * \param message : Message
+ */
+static void decode_print(const log_binary_header_t *header, uint64_t time, const decode_site_t *site,
+                         const char *message)
+{
+    uint64_t wall = header->start_wall + ((time > header->start_time) ? time - header->start_time : 0);
+    time_t seconds = (time_t)(wall / DECODE_NS_PER_S);
+    struct tm local_time;
+    char time_buf[20];
+
+    localtime_r(&seconds, &local_time);
+    strftime(time_buf, sizeof(time_buf), "%Y-%m-%d %H:%M:%S", &local_time);
+    printf("[%s.%03u] [%s] %s:%u: %s\n", time_buf, (unsigned)(wall % DECODE_NS_PER_S / DECODE_NS_PER_MS),
+           (site->def.level < DECODE_LEVELS) ? decode_level_names[site->def.level] : "?", site->func,
+           site->def.line, message);
+}
+
+/**
+ * \brief Check whether a call site passes the filters.
+ * \param site : Call site
+ * \param options : Options
+ * \return bool : true if selected
+ */
+static bool decode_selected(const decode_site_t *site, const decode_options_t *options)
+{
+    return (site->def.level >= options->level) &&
+           ((options->where == NULL) || (strstr(site->file, options->where) != NULL) ||
+            (strstr(site->func, options->where) != NULL));
+}
+
+/**
+ * \brief Read a call site definition.
+ * \param site : Call site
+ * \param payload : Payload
+ * \param size : Payload size (bytes)
+ * \return bool : true on success
+ */
+static bool decode_define(decode_site_t *site, const uint8_t *payload, size_t size)
+{
+    const char *strings[3] = {NULL, NULL, NULL};
+    const char *end = (const char *)payload + size;
+    const char *c = (const char *)payload + sizeof(log_binary_site_t);
+
+    if (size < sizeof(log_binary_site_t))
+    {
+        return false;
+    }
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        strings[i] = c;
+        while ((c < end) && (*c != '\0'))
+        {
+            c++;
+        }
+        if (c == end)
+        {
+            return false;
+        }
+        c++;
+    }
+
+    memcpy(&site->def, payload, sizeof(log_binary_site_t));
+    site->file = strings[0];
+    site->func = strings[1];
+    site->fmt = strings[2];
+    site->defined = true;
+
+    return true;
+}
+
+/**
+ * \brief Print the call site table.
+ * \param options : Options
+ */
+static void decode_print_sites(const decode_options_t *options)
+{
+    const decode_site_t *site = NULL;
+
+    printf("%6s %-4s %10s %10s %10s  %s\n", "id", "lvl", "messages", "repeated", "suppressed", "site");
+    for (uint32_t id = 0; id < decode_site_count; id++)
+    {
+        site = &decode_sites[id];
+        if ((site->defined == false) || (decode_selected(site, options) == false))
+        {
+            continue;
+        }
+        printf("%6u %-4s %10llu %10llu %10llu  %s:%u %s() \"%s\"\n", id,
+               (site->def.level < DECODE_LEVELS) ? decode_level_names[site->def.level] : "?",
+               (unsigned long long)site->messages, (unsigned long long)site->repeated,
+               (unsigned long long)site->suppressed, site->file, site->def.line, site->func, site->fmt);
+    }
+}
+
+/**
+ * \brief Print usage.
+ * \param name : Program name
+ */
+static void print_usage(const char *name)
+{
+    printf("Usage: %s [-l level] [-w where] [-m match] [-s] [-h] file\n", name);
+    printf("  -l : Minimum level (0: info, 1: warn, 2: error)\n");
+    printf("  -w : Only call sites whose file or function contains this text\n");
+    printf("  -m : Only messages containing this text\n");
+    printf("  -s : Print the call sites with their message counts instead of messages\n");
+    printf("  -h : Print this help\n");
+}
+
+/***** Main function *********************************************************/
+
+int main(int argc, char *argv[])
+{
+    decode_options_t options = {0, NULL, NULL, false};
+    const log_binary_header_t *header = NULL;
+    const log_binary_record_t *record = NULL;
+    const uint64_t *words = NULL;
+    decode_site_t *site = NULL;
+    char message[DECODE_MESSAGE_SIZE];
+    uint8_t *data = NULL;
+    FILE *file = NULL;
+    long size = 0;
+    size_t offset = 0;
+    size_t payload = 0;
+    uint64_t records = 0;
+    uint64_t invalid = 0;
+    int opt = 0;
+
+    /***** Parsing options *****/
+
+    while ((opt = getopt(argc, argv, "l:w:m:sh")) != -1)
+    {
+        switch (opt)
+        {
+        case 'l':
+            options.level = (uint8_t)atoi(optarg);
+            break;
+        case 'w':
+            options.where = optarg;
+            break;
+        case 'm':
+            options.match = optarg;
+            break;
+        case 's':
+            options.sites = true;
+            break;
+        case 'h':
+            print_usage(argv[0]);
+            return EXIT_SUCCESS;
+        default:
+            print_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (optind >= argc)
+    {
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    /***** Reading file *****/
+
+    file = fopen(argv[optind], "rb");
+    if (file == NULL)
+    {
+        perror(argv[optind]);
+        return EXIT_FAILURE;
+    }
+    if ((fseek(file, 0, SEEK_END) != 0) || ((size = ftell(file)) < (long)sizeof(log_binary_header_t)) ||
+        (fseek(file, 0, SEEK_SET) != 0) || ((data = malloc((size_t)size)) == NULL) ||
+        (fread(data, (size_t)size, 1, file) != 1))
+    {
+        fprintf(stderr, "%s: cannot read binary log\n", argv[optind]);
+        fclose(file);
+        free(data);
+        return EXIT_FAILURE;
+    }
+    fclose(file);
+
+    header = (const log_binary_header_t *)data;
+    if ((memcmp(header->magic, LOG_BINARY_MAGIC, sizeof(header->magic)) != 0) ||
+        (header->version != LOG_BINARY_VERSION) || (header->word_size != sizeof(uint64_t)))
+    {
+        fprintf(stderr, "%s: not a binary log of this version\n", argv[optind]);
+        free(data);
+        return EXIT_FAILURE;
+    }
+
+    /***** Decoding records *****/
+
+    offset = sizeof(log_binary_header_t);
+    while (offset + sizeof(log_binary_record_t) <= (size_t)size)
+    {
+        record = (const log_binary_record_t *)&data[offset];
+        payload = record->words * sizeof(uint64_t);
+        if ((record->type == LOG_BINARY_END) || (offset + sizeof(log_binary_record_t) + payload > (size_t)size))
+        {
+            break;
+        }
+        words = (const uint64_t *)&data[offset + sizeof(log_binary_record_t)];
+        offset += sizeof(log_binary_record_t) + payload;
+        records++;
+
+        site = decode_site(record->site);
+        if (site == NULL)
+        {
+            fprintf(stderr, "out of memory\n");
+            break;
+        }
+        if (record->type == LOG_BINARY_SITE)
+        {
+            invalid += (decode_define(site, (const uint8_t *)words, payload) == true) ? 0 : 1;
+            continue;
+        }
+        if (site->defined == false)
+        {
+            invalid++;
+            continue;
+        }
+
+        switch (record->type)
+        {
+        case LOG_BINARY_MESSAGE:
+            site->messages++;
+            if (decode_message(site, words, record->words, message) == false)
+            {
+                invalid++;
+                continue;
+            }
+            break;
+        case LOG_BINARY_REPEATED:
+            site->repeated += (record->words > 0) ? words[0] : 0;
+            snprintf(message, sizeof(message), "last message repeated %llu times",
+                     (unsigned long long)((record->words > 0) ? words[0] : 0));
+            break;
+        case LOG_BINARY_SUPPRESSED:
+            site->suppressed += (record->words > 0) ? words[0] : 0;
+            snprintf(message, sizeof(message), "%llu messages suppressed",
+                     (unsigned long long)((record->words > 0) ? words[0] : 0));
+            break;
+        default:
+            invalid++;
+            continue;
+        }
+
+        if ((options.sites == false) && (decode_selected(site, &options) == true) &&
+            ((options.match == NULL) || (strstr(message, options.match) != NULL)))
+        {
+            decode_print(header, record->time, site, message);
+        }
+    }
+
+    if (options.sites == true)
+    {
+        decode_print_sites(&options);
+    }
+    fprintf(stderr, "%llu records, %llu invalid, %ld bytes\n", (unsigned long long)records,
+            (unsigned long long)invalid, size);
+
+    free(decode_sites);
+    free(data);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,166 @@
+/**
+ * \file query_scan.c
+ * \brief Implementation of trace query scans.
+ * \details A range test is a single unsigned comparison, (value - low) <= (high - low). SIMD instruction
+ *          sets only compare signed integers, so both sides are biased by 2^31 first.
+ * \author Raphael CAUSSE
+ */
+
+/***** Includes **************************************************************/
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+#include "query_scan.h"
+
+/***** Definitions ***********************************************************/
+
+#define QUERY_SCAN_BIAS (0x80000000u)
+
+/***** Static Functions ******************************************************/
+
+/**
+ * \brief Compute the mask of in-range rows of 64 values.
+ * \param values : 64 values
+ * \param low : Range lowest value
+ * \param span : Range high - low
+ * \return uint64_t : Bit i set if values[i] is in range
+ */
+static uint64_t query_scan_word(const uint32_t *values, uint32_t low, uint32_t span)
+{
+    uint64_t word = 0;
+
+#if defined(__AVX2__)
+    const __m256i bias = _mm256_set1_epi32((int32_t)QUERY_SCAN_BIAS);
+    const __m256i vlow = _mm256_set1_epi32((int32_t)low);
+    const __m256i vspan = _mm256_set1_epi32((int32_t)(span ^ QUERY_SCAN_BIAS));
+    __m256i v;
+
+    for (uint32_t i = 0; i < 64; i += 8)
+    {
+        v = _mm256_loadu_si256((const __m256i *)&values[i]);
+        v = _mm256_xor_si256(_mm256_sub_epi32(v, vlow), bias);
+        word |= (uint64_t)(uint32_t)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(v, vspan))) << i;
+    }
+    word = ~word;
+#elif defined(__SSE2__)
+    const __m128i bias = _mm_set1_epi32((int32_t)QUERY_SCAN_BIAS);
+    const __m128i vlow = _mm_set1_epi32((int32_t)low);
+    const __m128i vspan = _mm_set1_epi32((int32_t)(span ^ QUERY_SCAN_BIAS));
+    __m128i v;
+
+    for (uint32_t i = 0; i < 64; i += 4)
+    {
+        v = _mm_loadu_si128((const __m128i *)&values[i]);
+        v = _mm_xor_si128(_mm_sub_epi32(v, vlow), bias);
+        word |= (uint64_t)(uint32_t)_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(v, vspan))) << i;
+    }
+    word = ~word;
+#else
+    for (uint32_t i = 0; i < 64; i++)
+    {
+        word |= (uint64_t)((values[i] - low) <= span) << i;
+    }
+#endif
+
+    return word;
+}
+
+/***** Functions *************************************************************/
+
+void query_scan_init(query_mask_t mask, uint32_t count)
+{
+    for (uint32_t w = 0; w < QUERY_SCAN_WORDS; w++)
+    {
+        if (count >= (w + 1) * 64)
+        {
+            mask[w] = UINT64_MAX;
+        }
+        else if (count > w * 64)
+        {
+            mask[w] = (1ull << (count - w * 64)) - 1;
+        }
+        else
+        {
+            mask[w] = 0;
+        }
+    }
+}
+
+void query_scan_range(const uint32_t *values, uint32_t count, uint32_t low, uint32_t high, bool negate,
+                      query_mask_t mask)
+{
+    const uint64_t invert = (negate == true) ? UINT64_MAX : 0;
+    const uint32_t span = high - low;
+    const uint32_t full_words = count / 64;
+    uint64_t word = 0;
+
+    for (uint32_t w = 0; w < full_words; w++)
+    {
+        if (mask[w] != 0)
+        {
+            mask[w] &= query_scan_word(&values[w * 64], low, span) ^ invert;
+        }
+    }
+
+    /* Last rows, the mask is already cleared past count */
+    if (full_words < QUERY_SCAN_WORDS)
+    {
+        word = 0;
+        for (uint32_t i = full_words * 64; i < count; i++)
+        {
+            word |= (uint64_t)((values[i] - low) <= span) << (i - full_words * 64);
+        }
+        mask[full_words] &= word ^ invert;
+    }
+}
+
+uint32_t query_scan_count(const query_mask_t mask)
+{
+    uint32_t count = 0;
+
+    for (uint32_t w = 0; w < QUERY_SCAN_WORDS; w++)
+    {
+        count += (uint32_t)__builtin_popcountll(mask[w]);
+    }
+
+    return count;
+}
+
+void query_scan_aggregate(const uint32_t *values, const query_mask_t mask, uint64_t *sum, uint32_t *min,
+                          uint32_t *max)
+{
+    uint64_t total = *sum;
+    uint32_t low = *min;
+    uint32_t high = *max;
+    uint64_t bits = 0;
+    const uint32_t *word_values = NULL;
+    uint32_t value = 0;
+
+    for (uint32_t w = 0; w < QUERY_SCAN_WORDS; w++)
+    {
+        word_values = &values[w * 64];
+        if (mask[w] == UINT64_MAX)
+        {
+            /* Whole word kept, vectorized by the compiler */
+            for (uint32_t i = 0; i < 64; i++)
+            {
+                total += word_values[i];
+                low = (word_values[i] < low) ? word_values[i] : low;
+                high = (word_values[i] > high) ? word_values[i] : high;
+            }
+            continue;
+        }
+        for (bits = mask[w]; bits != 0; bits &= bits - 1)
+        {
+            value = word_values[__builtin_ctzll(bits)];
+            total += value;
+            low = (value < low) ? value : low;
+            high = (value > high) ? value : high;
+        }
+    }
+
+    *sum = total;
+    *min = low;
+    *max = high;
+}
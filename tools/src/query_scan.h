@@ -0,0 +1,64 @@
+/**
+ * \file query_scan.h
+ * \brief Interface of trace query scans.
+ * \details Filter the decoded values of a trace block column with SIMD comparisons (AVX2 or SSE2 when
+ *          available at build time, scalar otherwise) into a bitmap of kept rows, one bit per row.
+ * \author Raphael CAUSSE
+ */
+
+#ifndef QUERY_SCAN_H
+#define QUERY_SCAN_H
+
+/***** Includes **************************************************************/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "trace_file.h"
+
+/***** Definitions ***********************************************************/
+
+#define QUERY_SCAN_WORDS (TRACE_FILE_BLOCK_ROWS / 64)
+
+/* Kept rows of a block, bit i of word i / 64 for row i */
+typedef uint64_t query_mask_t[QUERY_SCAN_WORDS];
+
+/***** Functions *************************************************************/
+
+/**
+ * \brief Keep all rows of a block.
+ * \param mask : Output mask, rows past count are cleared
+ * \param count : Rows in block
+ */
+void query_scan_init(query_mask_t mask, uint32_t count);
+
+/**
+ * \brief Keep only rows whose value is in a range, or outside of it.
+ * \param values : Decoded column values
+ * \param count : Rows in block
+ * \param low : Range lowest value
+ * \param high : Range highest value, not lower than low
+ * \param negate : Keep rows outside of the range instead
+ * \param mask : Mask updated in place
+ */
+void query_scan_range(const uint32_t *values, uint32_t count, uint32_t low, uint32_t high, bool negate,
+                      query_mask_t mask);
+
+/**
+ * \brief Count kept rows.
+ * \param mask : Mask
+ * \return uint32_t : Number of kept rows
+ */
+uint32_t query_scan_count(const query_mask_t mask);
+
+/**
+ * \brief Sum, minimum and maximum of the values of kept rows.
+ * \param values : Decoded column values
+ * \param mask : Mask, at least one row kept
+ * \param sum : Sum, updated in place
+ * \param min : Minimum, updated in place
+ * \param max : Maximum, updated in place
+ */
+void query_scan_aggregate(const uint32_t *values, const query_mask_t mask, uint64_t *sum, uint32_t *min,
+                          uint32_t *max);
+
+#endif /* QUERY_SCAN_H */
@@ -0,0 +1,915 @@
+/**
+ * \file trace_query.c
+ * \brief Offline queries over trace files.
+ * \details Trace files (see trace_file.h) are memory-mapped and scanned by a pool of threads, one file
+ *          at a time per thread. Rows are kept by predicates on columns, then aggregated, optionally
+ *          grouped by wall clock period, or printed as intervals of consecutive kept rows.
+ *          Blocks are skipped, or predicates resolved without decoding, from column minimum and maximum.
+ * \author Raphael CAUSSE
+ */
+
+/***** Includes **************************************************************/
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#include "trace_file.h"
+#include "query_scan.h"
+
+/***** Definitions ***********************************************************/
+
+#define QUERY_MAX_PREDICATES (16)
+#define QUERY_MAX_THREADS (64)
+#define QUERY_TIME_SIZE (32) /* Formatted wall clock time */
+
+/* Predicate, keeps rows whose value is in [low, high], or outside if negate */
+typedef struct
+{
+    trace_column_t column;
+    uint32_t low;
+    uint32_t high;
+    bool negate;
+} query_predicate_t;
+
+/* Aggregates */
+typedef enum
+{
+    QUERY_AGG_COUNT = 0,
+    QUERY_AGG_SUM,
+    QUERY_AGG_MIN,
+    QUERY_AGG_MAX,
+    QUERY_AGG_MEAN
+} query_aggregate_t;
+
+/* Aggregate of kept rows of one period */
+typedef struct
+{
+    int64_t key;    /* Period number since epoch, 0 if not grouped */
+    uint64_t count; /* Kept rows */
+    uint64_t sum;
+    uint32_t min;
+    uint32_t max;
+} query_group_t;
+
+/* Consecutive kept rows */
+typedef struct
+{
+    int64_t start_ns; /* Wall clock time of the first row */
+    int64_t end_ns;   /* Wall clock time of the last row */
+    uint32_t rows;
+} query_interval_t;
+
+/* One input file */
+typedef struct
+{
+    const char *path;
+    query_interval_t *intervals;
+    uint32_t intervals_count;
+    uint32_t intervals_capacity;
+    uint32_t next_row; /* Row extending the last interval */
+    bool in_interval;  /* Last row was kept */
+    bool failed;
+} query_file_t;
+
+/* One worker thread */
+typedef struct
+{
+    pthread_t thread;
+    query_group_t *groups; /* In order of appearance, merged after all files */
+    uint32_t groups_count;
+    uint32_t groups_capacity;
+    uint64_t blocks;
+    uint64_t skipped; /* Blocks skipped from minimum and maximum */
+    uint64_t rows;
+    uint64_t kept;
+    uint32_t values[TRACE_COL_COUNT][TRACE_FILE_BLOCK_ROWS];
+    bool decoded[TRACE_COL_COUNT];
+} query_worker_t;
+
+/***** Static Variables ******************************************************/
+
+/* Query, read-only once workers are started */
+static query_predicate_t query_predicates[QUERY_MAX_PREDICATES];
+static uint32_t query_predicates_count = 0;
+static query_aggregate_t query_aggregate = QUERY_AGG_COUNT;
+static trace_column_t query_aggregate_column = TRACE_COL_TIME_MS;
+static int64_t query_period_ns = 0; /* Grouping period, 0 if not grouped */
+static bool query_intervals = false;
+
+static query_file_t *query_files = NULL;
+static uint32_t query_files_count = 0;
+
+/* Next file to scan, shared by workers */
+static pthread_mutex_t query_mutex = PTHREAD_MUTEX_INITIALIZER;
+static uint32_t query_next_file = 0;
+
+static query_worker_t query_workers[QUERY_MAX_THREADS];
+
+/***** Static Functions ******************************************************/
+
+/**
+ * \brief Grow an array when full.
+ * \param array : Array, reallocated
+ * \param capacity : Allocated elements, updated
+ * \param count : Used elements
+ * \param size : Element size
+ * \return bool : true on success, false if out of memory.
+ */
+static bool query_grow(void **array, uint32_t *capacity, uint32_t count, size_t size)
+{
+    uint32_t new_capacity = (*capacity == 0) ? 64 : *capacity * 2;
+    void *new_array = NULL;
+
+    if (count < *capacity)
+    {
+        return true;
+    }
+    new_array = realloc(*array, (size_t)new_capacity * size);
+    if (new_array == NULL)
+    {
+        return false;
+    }
+    *array = new_array;
+    *capacity = new_capacity;
+
+    return true;
+}
+
+/**
+ * \brief Get the decoded values of a column, decoding it once per block.
+ * \param worker : Worker
+ * \param block : Block
+ * \param column : Column
+ * \return const uint32_t* : Values, NULL if the block is corrupted.
+ */
+static const uint32_t *query_column(query_worker_t *worker, const trace_block_t *block, trace_column_t column)
+{
+    if (worker->decoded[column] == false)
+    {
+        if (trace_file_decode_column(block, column, worker->values[column]) == false)
+        {
+            return NULL;
+        }
+        worker->decoded[column] = true;
+    }
+
+    return worker->values[column];
+}
+
+/**
+ * \brief Add kept rows to the aggregate of a period.
+ * \param worker : Worker
+ * \param key : Period
+ * \param count : Kept rows
+ * \param sum : Sum of kept values
+ * \param min : Minimum of kept values
+ * \param max : Maximum of kept values
+ * \return bool : true on success, false if out of memory.
+ */
+static bool query_group_add(query_worker_t *worker, int64_t key, uint64_t count, uint64_t sum, uint32_t min,
+                            uint32_t max)
+{
+    query_group_t *group = NULL;
+
+    /* Rows of a file are in time order, a new period is appended */
+    if ((worker->groups_count == 0) || (worker->groups[worker->groups_count - 1].key != key))
+    {
+        if (query_grow((void **)&worker->groups, &worker->groups_capacity, worker->groups_count,
+                       sizeof(query_group_t)) == false)
+        {
+            return false;
+        }
+        group = &worker->groups[worker->groups_count++];
+        group->key = key;
+        group->count = 0;
+        group->sum = 0;
+        group->min = UINT32_MAX;
+        group->max = 0;
+    }
+    group = &worker->groups[worker->groups_count - 1];
+    group->count += count;
+    group->sum += sum;
+    group->min = (min < group->min) ? min : group->min;
+    group->max = (max > group->max) ? max : group->max;
+
+    return true;
+}
+
+/**
+ * \brief Aggregate kept rows of a block, by period if grouped.
+ * \param worker : Worker
+ * \param block : Block
+ * \param mask : Kept rows
+ * \param full : All rows kept
+ * \param start_time_ns : Wall clock time of start of recording
+ * \return bool : true on success, false otherwise.
+ */
+static bool query_block_aggregate(query_worker_t *worker, const trace_block_t *block, const query_mask_t mask,
+                                  bool full, int64_t start_time_ns)
+{
+    const trace_chunk_t *chunk = &block->chunks[query_aggregate_column];
+    const uint32_t *times = NULL;
+    const uint32_t *values = NULL;
+    query_mask_t period_mask;
+    uint64_t sum = 0;
+    uint32_t min = UINT32_MAX;
+    uint32_t max = 0;
+    int64_t key = 0;
+    uint32_t row = 0;
+    uint32_t end = 0;
+
+    /* Minimum and maximum of a whole ungrouped block are in its header */
+    if ((query_period_ns == 0) && (full == true) &&
+        ((query_aggregate == QUERY_AGG_COUNT) || (query_aggregate == QUERY_AGG_MIN) ||
+         (query_aggregate == QUERY_AGG_MAX)))
+    {
+        return query_group_add(worker, 0, block->rows, 0, chunk->min, chunk->max);
+    }
+
+    if (query_aggregate != QUERY_AGG_COUNT)
+    {
+        values = query_column(worker, block, query_aggregate_column);
+        if (values == NULL)
+        {
+            return false;
+        }
+    }
+    if (query_period_ns == 0)
+    {
+        if (values != NULL)
+        {
+            query_scan_aggregate(values, mask, &sum, &min, &max);
+        }
+        return query_group_add(worker, 0, query_scan_count(mask), sum, min, max);
+    }
+
+    /* Split the block in runs of rows of the same period */
+    times = query_column(worker, block, TRACE_COL_TIME_MS);
+    if (times == NULL)
+    {
+        return false;
+    }
+    while (row < block->rows)
+    {
+        key = (start_time_ns + (int64_t)times[row] * 1000000LL) / query_period_ns;
+        end = row + 1;
+        while ((end < block->rows) && ((start_time_ns + (int64_t)times[end] * 1000000LL) / query_period_ns == key))
+        {
+            end++;
+        }
+
+        query_scan_init(period_mask, end);
+        for (uint32_t w = 0; w < QUERY_SCAN_WORDS; w++)
+        {
+            period_mask[w] &= mask[w];
+            if ((w + 1) * 64 <= row)
+            {
+                period_mask[w] = 0;
+            }
+            else if (w * 64 < row)
+            {
+                period_mask[w] &= ~((1ull << (row - w * 64)) - 1);
+            }
+        }
+        if (query_scan_count(period_mask) > 0)
+        {
+            sum = 0;
+            min = UINT32_MAX;
+            max = 0;
+            if (values != NULL)
+            {
+                query_scan_aggregate(values, period_mask, &sum, &min, &max);
+            }
+            if (query_group_add(worker, key, query_scan_count(period_mask), sum, min, max) == false)
+            {
+                return false;
+            }
+        }
+        row = end;
+    }
+
+    return true;
+}
+
+/**
+ * \brief Extend the intervals of a file with the kept rows of a block.
+ * \param worker : Worker
+ * \param file : File
+ * \param block : Block
+ * \param mask : Kept rows
+ * \param start_time_ns : Wall clock time of start of recording
+ * \return bool : true on success, false otherwise.
+ */
+static bool query_block_intervals(query_worker_t *worker, query_file_t *file, const trace_block_t *block,
+                                  const query_mask_t mask, int64_t start_time_ns)
+{
+    const uint32_t *times = query_column(worker, block, TRACE_COL_TIME_MS);
+    query_interval_t *interval = NULL;
+    int64_t time_ns = 0;
+    uint32_t row = 0;
+
+    if (times == NULL)
+    {
+        return false;
+    }
+    for (uint32_t i = 0; i < block->rows; i++)
+    {
+        if ((mask[i / 64] & (1ull << (i % 64))) == 0)
+        {
+            file->in_interval = false;
+            continue;
+        }
+
+        /* Rows dropped by the recorder end an interval */
+        row = block->first_row + i;
+        time_ns = start_time_ns + (int64_t)times[i] * 1000000LL;
+        if ((file->in_interval == false) || (row != file->next_row))
+        {
+            if (query_grow((void **)&file->intervals, &file->intervals_capacity, file->intervals_count,
+                           sizeof(query_interval_t)) == false)
+            {
+                return false;
+            }
+            interval = &file->intervals[file->intervals_count++];
+            interval->start_ns = time_ns;
+            interval->rows = 0;
+        }
+        interval = &file->intervals[file->intervals_count - 1];
+        interval->end_ns = time_ns;
+        interval->rows++;
+        file->in_interval = true;
+        file->next_row = row + 1;
+    }
+
+    return true;
+}
+
+/**
+ * \brief Scan one block.
+ * \param worker : Worker
+ * \param file : File
+ * \param block : Block
+ * \param start_time_ns : Wall clock time of start of recording
+ * \return bool : true on success, false otherwise.
+ */
+static bool query_block(query_worker_t *worker, query_file_t *file, const trace_block_t *block, int64_t start_time_ns)
+{
+    const query_predicate_t *predicate = NULL;
+    const trace_chunk_t *chunk = NULL;
+    const uint32_t *values = NULL;
+    query_mask_t mask;
+    bool none = false;
+    bool all = false;
+    bool swap = false;
+    bool full = true;
+
+    worker->blocks++;
+    worker->rows += block->rows;
+    memset(worker->decoded, 0, sizeof(worker->decoded));
+    query_scan_init(mask, block->rows);
+
+    for (uint32_t p = 0; p < query_predicates_count; p++)
+    {
+        predicate = &query_predicates[p];
+        chunk = &block->chunks[predicate->column];
+        /* Rows of the block in range: none, all or some of them */
+        none = (chunk->max < predicate->low) || (chunk->min > predicate->high);
+        all = (chunk->min >= predicate->low) && (chunk->max <= predicate->high);
+        if (predicate->negate == true)
+        {
+            swap = none;
+            none = all;
+            all = swap;
+        }
+        if (none == true)
+        {
+            worker->skipped++;
+            file->in_interval = false;
+            return true;
+        }
+        if (all == true)
+        {
+            continue;
+        }
+
+        values = query_column(worker, block, predicate->column);
+        if (values == NULL)
+        {
+            return false;
+        }
+        query_scan_range(values, block->rows, predicate->low, predicate->high, predicate->negate, mask);
+        full = false;
+    }
+
+    if (query_scan_count(mask) == 0)
+    {
+        file->in_interval = false;
+        return true;
+    }
+    worker->kept += query_scan_count(mask);
+    if (query_intervals == true)
+    {
+        return query_block_intervals(worker, file, block, mask, start_time_ns);
+    }
+
+    return query_block_aggregate(worker, block, mask, full, start_time_ns);
+}
+
+/**
+ * \brief Map and scan one file.
+ * \param worker : Worker
+ * \param file : File
+ */
+static void query_file(query_worker_t *worker, query_file_t *file)
+{
+    struct stat status;
+    trace_block_t block;
+    const uint8_t *data = NULL;
+    int64_t start_time_ns = 0;
+    uint32_t block_rows = 0;
+    size_t offset = TRACE_FILE_HEADER_SIZE;
+    size_t size = 0;
+    int fd = open(file->path, O_RDONLY);
+
+    if ((fd < 0) || (fstat(fd, &status) != 0) || (status.st_size < TRACE_FILE_HEADER_SIZE))
+    {
+        fprintf(stderr, "%s: %s\n", file->path, (fd < 0) ? strerror(errno) : "not a trace file");
+        file->failed = true;
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+        return;
+    }
+    size = (size_t)status.st_size;
+    data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+    {
+        fprintf(stderr, "%s: %s\n", file->path, strerror(errno));
+        file->failed = true;
+        return;
+    }
+    posix_madvise((void *)data, size, POSIX_MADV_SEQUENTIAL);
+
+    if (trace_file_parse_header(data, size, &start_time_ns, &block_rows) == false)
+    {
+        fprintf(stderr, "%s: not a trace file\n", file->path);
+        file->failed = true;
+    }
+    else
+    {
+        /* Blocks are walked in file order, the index is not needed and may be missing */
+        while ((offset < size) && (trace_file_parse_block(data + offset, size - offset, &block) == true))
+        {
+            if (query_block(worker, file, &block, start_time_ns) == false)
+            {
+                fprintf(stderr, "%s: corrupted block at offset %zu\n", file->path, offset);
+                file->failed = true;
+                break;
+            }
+            offset += block.size;
+        }
+    }
+
+    munmap((void *)data, size);
+}
+
+/**
+ * \brief Worker thread main function.
+ * \param arg : Worker
+ * \return void* : Unused
+ */
+static void *query_worker_main(void *arg)
+{
+    query_worker_t *worker = arg;
+    uint32_t file = 0;
+
+    while (true)
+    {
+        pthread_mutex_lock(&query_mutex);
+        file = query_next_file++;
+        pthread_mutex_unlock(&query_mutex);
+        if (file >= query_files_count)
+        {
+            break;
+        }
+        query_file(worker, &query_files[file]);
+    }
+
+    return NULL;
+}
+
+/**
+ * \brief Compare groups by period, for qsort().
+ */
+static int query_group_compare(const void *a, const void *b)
+{
+    const query_group_t *group_a = a;
+    const query_group_t *group_b = b;
+
+    return (group_a->key > group_b->key) - (group_a->key < group_b->key);
+}
+
+/**
+ * \brief Format a wall clock time, UTC.
+ * \param time_ns : Time since epoch (ns)
+ * \param text : Output, QUERY_TIME_SIZE characters
+ */
+static void query_format_time(int64_t time_ns, char *text)
+{
+    struct tm date;
+    time_t seconds = (time_t)(time_ns / 1000000000LL);
+    size_t length = 0;
+
+    gmtime_r(&seconds, &date);
+    length = strftime(text, QUERY_TIME_SIZE, "%Y-%m-%dT%H:%M:%S", &date);
+    snprintf(text + length, QUERY_TIME_SIZE - length, ".%03dZ", (int)((time_ns / 1000000LL) % 1000));
+}
+
+/**
+ * \brief Print the aggregate of a group.
+ * \param group : Group
+ */
+static void query_print_group(const query_group_t *group)
+{
+    char text[QUERY_TIME_SIZE];
+
+    if (query_period_ns != 0)
+    {
+        query_format_time(group->key * query_period_ns, text);
+        printf("%s ", text);
+    }
+    switch (query_aggregate)
+    {
+    case QUERY_AGG_COUNT:
+        printf("%llu\n", (unsigned long long)group->count);
+        break;
+    case QUERY_AGG_SUM:
+        printf("%llu\n", (unsigned long long)group->sum);
+        break;
+    case QUERY_AGG_MIN:
+        printf("%u\n", group->min);
+        break;
+    case QUERY_AGG_MAX:
+        printf("%u\n", group->max);
+        break;
+    case QUERY_AGG_MEAN:
+        printf("%.3f\n", (group->count > 0) ? (double)group->sum / (double)group->count : 0.0);
+        break;
+    }
+}
+
+/**
+ * \brief Merge the groups of all workers and print them in time order.
+ * \param threads : Number of workers
+ * \return bool : true on success, false if out of memory.
+ */
+static bool query_print_groups(uint32_t threads)
+{
+    query_group_t *groups = NULL;
+    query_group_t merged;
+    uint32_t count = 0;
+    uint32_t capacity = 0;
+
+    for (uint32_t t = 0; t < threads; t++)
+    {
+        for (uint32_t g = 0; g < query_workers[t].groups_count; g++)
+        {
+            if (query_grow((void **)&groups, &capacity, count, sizeof(query_group_t)) == false)
+            {
+                free(groups);
+                return false;
+            }
+            groups[count++] = query_workers[t].groups[g];
+        }
+    }
+    if (count > 0)
+    {
+        qsort(groups, count, sizeof(query_group_t), &query_group_compare);
+    }
+
+    if ((count == 0) && (query_period_ns == 0))
+    {
+        memset(&merged, 0, sizeof(merged));
+        query_print_group(&merged);
+    }
+    for (uint32_t g = 0; g < count;)
+    {
+        merged = groups[g++];
+        while ((g < count) && (groups[g].key == merged.key))
+        {
+            merged.count += groups[g].count;
+            merged.sum += groups[g].sum;
+            merged.min = (groups[g].min < merged.min) ? groups[g].min : merged.min;
+            merged.max = (groups[g].max > merged.max) ? groups[g].max : merged.max;
+            g++;
+        }
+        query_print_group(&merged);
+    }
+    free(groups);
+
+    return true;
+}
+
+/**
+ * \brief Print the intervals of all files, in command line order.
+ */
+static void query_print_intervals(void)
+{
+    const query_interval_t *interval = NULL;
+    char start[QUERY_TIME_SIZE];
+    char end[QUERY_TIME_SIZE];
+
+    for (uint32_t f = 0; f < query_files_count; f++)
+    {
+        for (uint32_t i = 0; i < query_files[f].intervals_count; i++)
+        {
+            interval = &query_files[f].intervals[i];
+            query_format_time(interval->start_ns, start);
+            query_format_time(interval->end_ns, end);
+            printf("%s %s %s %.1f %u\n", query_files[f].path, start, end,
+                   (double)(interval->end_ns - interval->start_ns) / 1e9, interval->rows);
+        }
+    }
+}
+
+/**
+ * \brief Find a column by name.
+ * \param name : Column name
+ * \param length : Name length
+ * \param column : Output column
+ * \return bool : true if found, false otherwise.
+ */
+static bool query_parse_column(const char *name, size_t length, trace_column_t *column)
+{
+    const char *candidate = NULL;
+
+    for (int c = 0; c < TRACE_COL_COUNT; c++)
+    {
+        candidate = trace_file_column_name((trace_column_t)c);
+        if ((strlen(candidate) == length) && (strncmp(candidate, name, length) == 0))
+        {
+            *column = (trace_column_t)c;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * \brief Parse a predicate "column op value", op in < <= > >= = !=.
+ * \param arg : Predicate
+ * \param predicate : Output predicate
+ * \return bool : true on success, false otherwise.
+ */
+static bool query_parse_predicate(const char *arg, query_predicate_t *predicate)
+{
+    size_t length = strcspn(arg, "<>=!");
+    const char *op = arg + length;
+    const char *number = NULL;
+    char *end = NULL;
+    unsigned long long value = 0;
+
+    if (query_parse_column(arg, length, &predicate->column) == false)
+    {
+        return false;
+    }
+    number = op + (((op[0] != '\0') && (op[1] == '=')) ? 2 : 1);
+    value = strtoull(number, &end, 0);
+    if ((op[0] == '\0') || (*number == '\0') || (*end != '\0') || (value > UINT32_MAX))
+    {
+        return false;
+    }
+
+    /* Every operator is a range, an empty range is the negation of the full range */
+    predicate->low = 0;
+    predicate->high = UINT32_MAX;
+    predicate->negate = false;
+    if (strncmp(op, "<=", 2) == 0)
+    {
+        predicate->high = (uint32_t)value;
+    }
+    else if (strncmp(op, ">=", 2) == 0)
+    {
+        predicate->low = (uint32_t)value;
+    }
+    else if (strncmp(op, "!=", 2) == 0)
+    {
+        predicate->low = (uint32_t)value;
+        predicate->high = (uint32_t)value;
+        predicate->negate = true;
+    }
+    else if (op[0] == '<')
+    {
+        predicate->high = (uint32_t)value - 1;
+        predicate->negate = (value == 0);
+        predicate->high = (value == 0) ? UINT32_MAX : predicate->high;
+    }
+    else if (op[0] == '>')
+    {
+        predicate->low = (uint32_t)value + 1;
+        predicate->negate = (value == UINT32_MAX);
+        predicate->low = (value == UINT32_MAX) ? 0 : predicate->low;
+    }
+    else if ((op[0] == '=') && ((op[1] != '=') || (number == op + 2)))
+    {
+        predicate->low = (uint32_t)value;
+        predicate->high = (uint32_t)value;
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * \brief Parse an aggregate "count" or "function:column".
+ * \param arg : Aggregate
+ * \return bool : true on success, false otherwise.
+ */
+static bool query_parse_aggregate(const char *arg)
+{
+    static const char *const names[] = {"count", "sum", "min", "max", "mean"};
+    size_t length = strcspn(arg, ":");
+
+    for (int a = 0; a < (int)(sizeof(names) / sizeof(names[0])); a++)
+    {
+        if ((strlen(names[a]) == length) && (strncmp(names[a], arg, length) == 0))
+        {
+            query_aggregate = (query_aggregate_t)a;
+            if (query_aggregate == QUERY_AGG_COUNT)
+            {
+                return (arg[length] == '\0');
+            }
+            return (arg[length] == ':') &&
+                   query_parse_column(arg + length + 1, strlen(arg + length + 1), &query_aggregate_column);
+        }
+    }
+
+    return false;
+}
+
+/**
+ * \brief Print command line usage.
+ * \param name : Program name
+ */
+static void print_usage(const char *name)
+{
+    printf("Usage: %s [-w predicate]... [-a aggregate] [-g seconds] [-i] [-j threads] [-l] [-h] file...\n", name);
+    printf("  -w : Keep rows matching \"column op value\", op in < <= > >= = != (repeatable, all must match)\n");
+    printf("  -a : Aggregate of kept rows: count (default), sum:column, min:column, max:column, mean:column\n");
+    printf("  -g : Group by wall clock period, e.g. 3600 for hours\n");
+    printf("  -i : Print intervals of consecutive kept rows instead of an aggregate\n");
+    printf("  -j : Worker threads, default one per online CPU (max %d)\n", QUERY_MAX_THREADS);
+    printf("  -l : List columns\n");
+    printf("  -h : Print this help\n");
+    printf("Example: %s -i -w 'out_fuel_percent<5' -w 'speed>90' *.trc\n", name);
+}
+
+/***** Main function *********************************************************/
+
+int main(int argc, char *argv[])
+{
+    struct timespec start;
+    struct timespec end;
+    uint64_t blocks = 0;
+    uint64_t skipped = 0;
+    uint64_t rows = 0;
+    uint64_t kept = 0;
+    long threads = sysconf(_SC_NPROCESSORS_ONLN);
+    bool failed = false;
+    int opt = 0;
+    int ret = 0;
+
+    /***** Parsing options *****/
+
+    while ((opt = getopt(argc, argv, "w:a:g:ij:lh")) != -1)
+    {
+        switch (opt)
+        {
+        case 'w':
+            if ((query_predicates_count == QUERY_MAX_PREDICATES) ||
+                (query_parse_predicate(optarg, &query_predicates[query_predicates_count++]) == false))
+            {
+                fprintf(stderr, "invalid predicate: %s\n", optarg);
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'a':
+            if (query_parse_aggregate(optarg) == false)
+            {
+                fprintf(stderr, "invalid aggregate: %s\n", optarg);
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'g':
+            query_period_ns = atoll(optarg) * 1000000000LL;
+            if (query_period_ns <= 0)
+            {
+                print_usage(argv[0]);
+                return EXIT_FAILURE;
+            }
+            break;
+        case 'i':
+            query_intervals = true;
+            break;
+        case 'j':
+            threads = atol(optarg);
+            break;
+        case 'l':
+            for (int c = 0; c < TRACE_COL_COUNT; c++)
+            {
+                printf("%s\n", trace_file_column_name((trace_column_t)c));
+            }
+            return EXIT_SUCCESS;
+        case 'h':
+            print_usage(argv[0]);
+            return EXIT_SUCCESS;
+        default:
+            print_usage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+    if (optind >= argc)
+    {
+        print_usage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    query_files_count = (uint32_t)(argc - optind);
+    query_files = calloc(query_files_count, sizeof(query_file_t));
+    if (query_files == NULL)
+    {
+        fprintf(stderr, "out of memory\n");
+        return EXIT_FAILURE;
+    }
+    for (uint32_t f = 0; f < query_files_count; f++)
+    {
+        query_files[f].path = argv[optind + (int)f];
+    }
+    threads = (threads < 1) ? 1 : threads;
+    threads = (threads > QUERY_MAX_THREADS) ? QUERY_MAX_THREADS : threads;
+    threads = (threads > (long)query_files_count) ? (long)query_files_count : threads;
+
+    /***** Scanning files *****/
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (long t = 0; t < threads; t++)
+    {
+        ret = pthread_create(&query_workers[t].thread, NULL, &query_worker_main, &query_workers[t]);
+        if (ret != 0)
+        {
+            fprintf(stderr, "error while creating worker thread (%d)\n", ret);
+            threads = t;
+            break;
+        }
+    }
+    if (threads == 0)
+    {
+        return EXIT_FAILURE;
+    }
+    for (long t = 0; t < threads; t++)
+    {
+        pthread_join(query_workers[t].thread, NULL);
+        blocks += query_workers[t].blocks;
+        skipped += query_workers[t].skipped;
+        rows += query_workers[t].rows;
+        kept += query_workers[t].kept;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    /***** Printing results *****/
+
+    if (query_intervals == true)
+    {
+        query_print_intervals();
+    }
+    else if (query_print_groups((uint32_t)threads) == false)
+    {
+        fprintf(stderr, "out of memory\n");
+        return EXIT_FAILURE;
+    }
+    for (uint32_t f = 0; f < query_files_count; f++)
+    {
+        failed = failed || query_files[f].failed;
+    }
+    fprintf(stderr, "%u files, %llu blocks (%llu skipped), %llu rows, %llu kept, %.3f s, %ld threads\n",
+            query_files_count, (unsigned long long)blocks, (unsigned long long)skipped, (unsigned long long)rows,
+            (unsigned long long)kept,
+            (double)(end.tv_sec - start.tv_sec) + (double)(end.tv_nsec - start.tv_nsec) / 1e9, threads);
+
+    return (failed == true) ? EXIT_FAILURE : EXIT_SUCCESS;
+}